@@ -14,6 +14,8 @@
 
 #include "DenseMat.hpp"
 #include "OCPConst.hpp"
+#include "UtilRestart.hpp"
+#include <unordered_map>
 #include <vector>
 
 using namespace std;
@@ -64,6 +66,10 @@ public:
     void ResetToLastTimeStep();
     /// Update SkipStaAnaly term at last time step
     void UpdateLastTimeStep();
+    /// Write SkipStaAnaly term to a restart file
+    void WriteRestart(ofstream& out) const;
+    /// Read SkipStaAnaly term from a restart file
+    void ReadRestart(ifstream& in);
 
 protected:
     OCP_BOOL ifSetup{OCP_FALSE}; ///< Only one setup is needed.
@@ -85,6 +91,61 @@ protected:
     vector<OCP_DBL>  lzi;       ///< Last zi
 };
 
+/////////////////////////////////////////////////////////////////////
+// Flash Cache
+/////////////////////////////////////////////////////////////////////
+
+/// FlashCache stores the equilibrium constants of converged two-phase splits, which
+/// are indexed by quantized (P, T, zi), so that bulks in similar states could start
+/// phase splitting from them instead of stability analysis.
+//  Note: Each mixture owns a cache, so caches are private to threads and PVT regions.
+//  A hit is only an initial guess, it is accepted after phase splitting converges.
+//  Results with the cache are approximate: stability analysis is skipped on a hit, and
+//  the split converges from another guess, so they differ from flashes without it
+//  within the tolerance of phase splitting. Since entries come from the bulks flashed
+//  before, results also depend on the order of bulks and the number of threads. The
+//  cache is off unless the KVCACHE keyword is given.
+class FlashCache
+{
+public:
+    /// Set ifUseCache to true or false
+    void SetUseCache(const OCP_BOOL& flag) { ifUseCache = flag; }
+    /// Set widths of cells of ln P, T, zi and the max num of entries
+    void SetParam(const vector<OCP_DBL>& param);
+    /// Return whether the cache is used, a cache of no entries is not used.
+    OCP_BOOL IfUseCache() const { return ifUseCache && maxEntry > 0; }
+    /// Allocate memory for FlashCache term
+    void Setup(const USI& nc);
+    /// Find the equilibrium constants of a split near (Pin, Tin, ziin)
+    OCP_BOOL Find(const OCP_DBL&         Pin,
+                  const OCP_DBL&         Tin,
+                  const vector<OCP_DBL>& ziin,
+                  vector<OCP_DBL>&       Ksout);
+    /// Insert the equilibrium constants of a converged split at (Pin, Tin, ziin)
+    void Insert(const OCP_DBL&         Pin,
+                const OCP_DBL&         Tin,
+                const vector<OCP_DBL>& ziin,
+                const vector<OCP_DBL>& Ksin);
+
+protected:
+    /// Quantize (Pin, Tin, ziin) into keyBuf and return its hash value
+    OCP_ULL CalKey(const OCP_DBL& Pin, const OCP_DBL& Tin, const vector<OCP_DBL>& ziin);
+
+protected:
+    OCP_BOOL ifUseCache{OCP_FALSE}; ///< If true, then cache will be used
+    USI      numCom;                ///< Num of components in phase equilibrium
+    USI      keyLen;                ///< Length of a key: numCom + 2
+    OCP_DBL  dlnP{1E-3};            ///< Width of cells of ln P
+    OCP_DBL  dT{0.1};               ///< Width of cells of T
+    OCP_DBL  dz{1E-3};              ///< Width of cells of zi
+    OCP_USI  maxEntry{1 << 16};     ///< Max num of entries, cleared if full, 0: off
+
+    unordered_map<OCP_ULL, OCP_USI> index;  ///< Hash value -> entry
+    vector<long long>               keys;   ///< Keys of entries: maxEntry * keyLen
+    vector<OCP_DBL>                 Ks;     ///< Ks of entries: maxEntry * numCom
+    vector<long long>               keyBuf; ///< Key of current state
+};
+
 #endif /* end if __ACCELERATEPVT_HEADER__ */
 
 /*----------------------------------------------------------------------------*/
@@ -93,4 +154,8 @@ protected:
 /*  Author              Date             Actions                              */
 /*----------------------------------------------------------------------------*/
 /*  Shizhe Li           Dec/25/2022      Create file                          */
+/*  OpenCAEPoro team    Oct/16/2026      Add FlashCache                       */
+/*  OpenCAEPoro team    Oct/16/2026      Add restart of SkipStaAnaly          */
+/*  OpenCAEPoro team    Oct/17/2026      Add KVCACHE keyword                  */
+/*  OpenCAEPoro team    Oct/17/2026      Turn off caches of no entries        */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
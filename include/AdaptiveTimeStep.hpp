@@ -0,0 +1,104 @@
+/*! \file    AdaptiveTimeStep.hpp
+ *  \brief   PI control of time step sizes with failure-aware prediction
+ *  \author  OpenCAEPoro team
+ *  \date    Oct/16/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the OpenCAEPoro team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+#ifndef __ADAPTIVETIMESTEP_HEADER__
+#define __ADAPTIVETIMESTEP_HEADER__
+
+// Standard header files
+#include <deque>
+#include <fstream>
+#include <vector>
+
+// OpenCAEPoro header files
+#include "OCPConst.hpp"
+
+using namespace std;
+
+// Modes of time step control
+const USI DTCTRL_CLASSIC  = 0; ///< Min of ratios of changes and a rule of iterations
+const USI DTCTRL_ADAPTIVE = 1; ///< PI control with failure-aware prediction
+
+/// A cut of time step after a failure.
+class TimeStepCut
+{
+public:
+    OCP_DBL time;   ///< Beginning of the failed step
+    OCP_DBL dt;     ///< Size of the failed step
+    USI     iterNR; ///< Newton iterations of the failed step
+    OCP_DBL factor; ///< Factor by which the step is cut
+};
+
+/// AdaptiveTimeStep chooses time step sizes by a PI controller of solution changes,
+/// the convergence of Newton iterations and the points of recent failures.
+//  Note: The error of a step is the max ratio of a change to its ideal limit, such as
+//  dPmax / dPlim, so the target error is 1. As changes are nearly proportional to
+//  step sizes, the integral gain is 1 and a small proportional gain follows trends.
+//  Newton iterations which cycle are stopped once the residual makes no progress.
+//  If they converge too slowly, the rate is assumed to hold with the residual after
+//  the first iteration proportional to the step size, which gives the step to retry.
+//  Failures repeated from the same time cut harder, and a step is not larger than a
+//  fraction of a failed one until the point where it failed is passed.
+class AdaptiveTimeStep
+{
+public:
+    /// Set the mode of time step control.
+    void SetMode(const USI& m) { mode = m; }
+    /// Return whether the adaptive control is used.
+    OCP_BOOL IfEnabled() const { return mode == DTCTRL_ADAPTIVE; }
+    /// Record the residual of a Newton iteration of current step.
+    void RecordNR(const OCP_DBL& res) { resNR.push_back(res); }
+    /// Discard the residuals of Newton iterations at the end of an attempt.
+    void ResetNR() { resNR.clear(); }
+    /// Return the factor of next step after an accepted step, where ratio is the min
+    /// ratio of limits to changes, 1 / TINY if no change is limited.
+    OCP_DBL GetFactor(const OCP_DBL& ratio);
+    /// Record a failed step of dt from time t, and return the factor to cut it, where
+    /// fac is the factor of the classic control and byNR is true if Newton iterations
+    /// fail to converge.
+    OCP_DBL Cut(const OCP_DBL&  t,
+                const OCP_DBL&  dt,
+                const OCP_DBL&  fac,
+                const OCP_BOOL& byNR,
+                const OCP_DBL&  tol,
+                const USI&      maxNRiter);
+    /// Return whether Newton iterations of current step stall.
+    OCP_BOOL IfStalled() const;
+    /// Return the max step from time t limited by the points of recent failures.
+    OCP_DBL GetMaxDt(const OCP_DBL& t) const;
+    /// Return recent cuts of time steps.
+    const deque<TimeStepCut>& GetCuts() const { return cuts; }
+    /// Write the error of last step and recent cuts to a restart file.
+    void WriteRestart(ofstream& out) const;
+    /// Read the error of last step and recent cuts from a restart file.
+    void ReadRestart(ifstream& in);
+
+protected:
+    /// Return the factor of the step converging in target iterations estimated from
+    /// the convergence rate of current step, 0 if it can not be estimated.
+    OCP_DBL EstimateByNR(const OCP_DBL& tol, const USI& target) const;
+
+protected:
+    USI                mode{DTCTRL_CLASSIC}; ///< Mode of time step control
+    OCP_DBL            lastErr{0};           ///< Error of last accepted step, 0: none
+    vector<OCP_DBL>    resNR;                ///< Residuals of Newton iterations
+    deque<TimeStepCut> cuts;                 ///< Recent cuts of time steps
+};
+
+#endif /* end if __ADAPTIVETIMESTEP_HEADER__ */
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  OpenCAEPoro team    Oct/16/2026      Create file                          */
+/*  OpenCAEPoro team    Oct/17/2026      Save controller state in restart     */
+/*----------------------------------------------------------------------------*/
@@ -135,6 +135,10 @@ public:
         for (auto& w : wells) w.lbhp = w.bhp;
     }
     void ResetBHP();
+    /// Write states of wells to a restart file.
+    void WriteRestart(ofstream& out) const;
+    /// Read states of wells from a restart file.
+    void ReadRestart(ifstream& in);
     /// Check if unreasonable well pressure or perforation pressure occurs.
     OCP_INT CheckP(const Bulk& myBulk);
     /// Return the num of wells.
@@ -147,6 +151,8 @@ public:
     USI GetWellPerfNum(const USI& i) const { return wells[i].numPerf; }
     /// Return the num of perforations of all wells
     USI GetWellPerfNum() const;
+    /// Return the grid cells perforated by each well.
+    vector<vector<OCP_USI>> GetWellPerfGrid(const Grid& myGrid) const;
     /// Calculate maximum num of perforations of all Wells.
     USI     GetMaxWellPerNum() const;
     void    CalMaxBHPChange();
@@ -167,6 +173,8 @@ public:
         for (USI w = 0; w < numWell; w++) wells[w].ShowPerfStatus(myBulk);
     }
     OCP_BOOL    GetWellChange() const { return wellChange; }
+    /// Return the id of current set of open wells, it changes once the set changes.
+    USI         GetOpenWellSetId() const { return openWellSetId; }
     const auto& GetWell2Bulk() const { return well2bulk; }
 
 protected:
@@ -176,9 +184,10 @@ protected:
     vector<WellGroup>       wellGroup; ///< wellGroup set
     vector<vector<OCP_USI>> well2bulk; ///< connections between wells and bulks
 
-    OCP_BOOL           wellChange; ///< if wells change, then OCP_TRUE
-    vector<SolventINJ> solvents;   ///< Sets of Solvent
-    OCP_DBL            dPmax{0};   ///< Maximum BHP change
+    OCP_BOOL           wellChange;       ///< if wells change, then OCP_TRUE
+    USI                openWellSetId{0}; ///< id of current set of open wells
+    vector<SolventINJ> solvents;         ///< Sets of Solvent
+    OCP_DBL            dPmax{0};         ///< Maximum BHP change
 
     vector<Mixture*> flashCal;               ///< Useless now.
     OCP_DBL          Psurf{PRESSURE_STD};    ///< well reference pressure
@@ -266,4 +275,7 @@ public:
 /*  Shizhe Li           Oct/01/2021      Create file                          */
 /*  Chensong Zhang      Oct/15/2021      Format file                          */
 /*  Shizhe Li           Feb/08/2022      Rename to AllWells                   */
+/*  OpenCAEPoro team    Oct/16/2026      Track set of open wells              */
+/*  OpenCAEPoro team    Oct/16/2026      Add restart                          */
+/*  OpenCAEPoro team    Oct/17/2026      Distribute FIM among MPI processes   */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
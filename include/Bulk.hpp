@@ -26,9 +26,12 @@
 #include "MixtureComp.hpp"
 #include "MixtureThermal.hpp"
 #include "OCPConst.hpp"
+#include "OCPStateArena.hpp"
 #include "OCPStructure.hpp"
 #include "ParamReservoir.hpp"
 #include "Rock.hpp"
+#include "UtilMPI.hpp"
+#include "UtilOpenMP.hpp"
 
 using namespace std;
 
@@ -66,14 +69,16 @@ public:
     void     InputParam(const HLoss& loss);
     void     Setup(const OCP_USI& nb);
     OCP_BOOL IfHeatLoss() const { return ifHLoss; }
-    void     CalHeatLoss(const vector<USI>&     location,
-                         const vector<OCP_DBL>& T,
-                         const vector<OCP_DBL>& lT,
-                         const vector<OCP_DBL>& initT,
-                         const OCP_DBL&         t,
-                         const OCP_DBL&         dt);
+    void     CalHeatLoss(const vector<USI>&       location,
+                         const OCPArray<OCP_DBL>& T,
+                         const OCPArray<OCP_DBL>& lT,
+                         const vector<OCP_DBL>&   initT,
+                         const OCP_DBL&           t,
+                         const OCP_DBL&           dt);
     void     ResetToLastTimeStep();
     void     UpdateLastTimeStep();
+    void     WriteRestart(ofstream& out) const;
+    void     ReadRestart(ifstream& in);
 
 public:
     OCP_BOOL ifHLoss{OCP_FALSE}; ///< If use Heat loss
@@ -144,13 +149,16 @@ public:
 public:
     /// Return the number of bulks.
     OCP_USI GetBulkNum() const { return numBulk; }
+    /// Return the number of bulks owned by this process.
+    OCP_USI GetOwnedBulkNum() const { return numOwnedBulk; }
     /// Return the number of phases.
     USI GetPhaseNum() const { return numPhase; }
     /// Return the number of components.
     USI GetComNum() const { return numCom; }
 
 protected:
-    OCP_USI numBulk;  ///< Number of bulks (active grids).
+    OCP_USI numBulk;      ///< Number of bulks (active grids).
+    OCP_USI numOwnedBulk; ///< Number of bulks owned by this process, numbered first.
     USI     numPhase; ///< Number of phase.
     USI     numCom;   ///< Number of component.
     USI     numComH;  ///< Number of HydroCarbon
@@ -183,13 +191,25 @@ public:
     /// Return flash.
     const vector<Mixture*>& GetMixture() const { return flashCal; }
     /// Output iterations in Mixture
-    void OutMixtureIters() const { flashCal[0]->OutMixtureIters(); }
+    void OutMixtureIters() const;
+    /// Setup copies of flashCal for threads, it should be called after flashCal is
+    /// completely setup.
+    void SetupFlashThreads();
+    /// Return the flash calculation class of region pvtnum for the calling thread.
+    Mixture* GetFlashCal(const USI& pvtnum) const
+    {
+        return flashCalT[GetThreadId() * NTPVT + pvtnum];
+    }
 
 protected:
-    USI              NTPVT;    ///< num of PVT regions
-    USI              PVTmodeB; ///< Identify PVT mode in black-oil model.
-    vector<USI>      PVTNUM;   ///< Identify PVT region in black-oil model: numBulk.
-    vector<Mixture*> flashCal; ///< Flash calculation class.
+    USI              NTPVT;      ///< num of PVT regions
+    USI              PVTmodeB;   ///< Identify PVT mode in black-oil model.
+    vector<USI>      PVTNUM;     ///< Identify PVT region in black-oil model: numBulk.
+    vector<Mixture*> flashCal;   ///< Flash calculation class.
+    USI              numThreads; ///< num of threads used in flash calculation
+    /// Flash calculation class of each thread: numThreads * NTPVT, the first NTPVT
+    /// ones are exactly flashCal.
+    vector<Mixture*> flashCalT;
 
     USI               NTSFUN;  ///< num of SAT regions
     USI               SATmode; ///< Identify SAT mode.
@@ -240,36 +260,36 @@ protected:
     vector<OCP_DBL> v;     ///< Volume of grids: activeGridNum.
     vector<OCP_DBL> depth; ///< Depth of center of grid cells: activeGridNum.
 
-    vector<OCP_DBL> ntg;      ///< net to gross of bulk.
-    vector<OCP_DBL> poroInit; ///< initial rock porosity * ntg.
-    vector<OCP_DBL> poro;     ///< rock porosity * ntg.
-    vector<OCP_DBL> rockVp;   ///< pore volume = Vgrid * ntg * poro.
-    vector<OCP_DBL> rockKx;   ///< current rock permeability along the x direction.
-    vector<OCP_DBL> rockKy;   ///< current rock permeability along the y direction.
-    vector<OCP_DBL> rockKz;   ///< current rock permeability along the z direction.
-    vector<OCP_DBL> thconr;   ///< Rock ifThermal conductivity: activeGridNum.
-    vector<OCP_DBL> vr;       ///< Volume of rock: activeGridNum.
-    vector<OCP_DBL> Hr;       ///< Enthalpy of rock: activeGridNum.
+    vector<OCP_DBL>   ntg;      ///< net to gross of bulk.
+    vector<OCP_DBL>   poroInit; ///< initial rock porosity * ntg.
+    OCPArray<OCP_DBL> poro;     ///< rock porosity * ntg.
+    OCPArray<OCP_DBL> rockVp;   ///< pore volume = Vgrid * ntg * poro.
+    vector<OCP_DBL>   rockKx;   ///< current rock permeability along the x direction.
+    vector<OCP_DBL>   rockKy;   ///< current rock permeability along the y direction.
+    vector<OCP_DBL>   rockKz;   ///< current rock permeability along the z direction.
+    vector<OCP_DBL>   thconr;   ///< Rock ifThermal conductivity: activeGridNum.
+    OCPArray<OCP_DBL> vr;       ///< Volume of rock: activeGridNum.
+    OCPArray<OCP_DBL> Hr;       ///< Enthalpy of rock: activeGridNum.
 
     // Last time step
-    vector<OCP_DBL> lporo;   ///< last poro.
-    vector<OCP_DBL> lrockVp; ///< Pore volume: numBulk.
-    vector<OCP_DBL> lvr;     ///< Last vr: activeGridNum.
-    vector<OCP_DBL> lHr;     ///< Last Hr: activeGridNum.
+    OCPArray<OCP_DBL> lporo;   ///< last poro.
+    OCPArray<OCP_DBL> lrockVp; ///< Pore volume: numBulk.
+    OCPArray<OCP_DBL> lvr;     ///< Last vr: activeGridNum.
+    OCPArray<OCP_DBL> lHr;     ///< Last Hr: activeGridNum.
 
     // Derivatives
-    vector<OCP_DBL> poroP; ///< d poro / d P.
-    vector<OCP_DBL> poroT; ///< d poro / d T.
-    vector<OCP_DBL> vrP;   ///< d vr / d p, numbulk
-    vector<OCP_DBL> vrT;   ///< dvr / dT: activeGridNum.
-    vector<OCP_DBL> HrT;   ///< dHr / dT: activeGridNum.
+    OCPArray<OCP_DBL> poroP; ///< d poro / d P.
+    OCPArray<OCP_DBL> poroT; ///< d poro / d T.
+    OCPArray<OCP_DBL> vrP;   ///< d vr / d p, numbulk
+    OCPArray<OCP_DBL> vrT;   ///< dvr / dT: activeGridNum.
+    OCPArray<OCP_DBL> HrT;   ///< dHr / dT: activeGridNum.
 
     // Last time step
-    vector<OCP_DBL> lporoP; ///< last poroP.
-    vector<OCP_DBL> lporoT; ///< last poroT.
-    vector<OCP_DBL> lvrP;   ///< last vrp.
-    vector<OCP_DBL> lvrT;   ///< Last vrT.
-    vector<OCP_DBL> lHrT;   ///< Last HrT.
+    OCPArray<OCP_DBL> lporoP; ///< last poroP.
+    OCPArray<OCP_DBL> lporoT; ///< last poroT.
+    OCPArray<OCP_DBL> lvrP;   ///< last vrp.
+    OCPArray<OCP_DBL> lvrT;   ///< Last vrT.
+    OCPArray<OCP_DBL> lHrT;   ///< Last HrT.
 
     /////////////////////////////////////////////////////////////////////
     // Basic Fluid Information
@@ -301,97 +321,97 @@ public:
 protected:
     vector<USI> phase2Index;     ///< Location of phase according to its name: numPhase.
                                  // Note: For example, `Oil' is at the i-th location.
-    vector<USI>      phaseNum;   ///< Num of hydrocarbon phase in each bulk
-    vector<OCP_DBL>  Nt;         ///< Total moles of components in bulks: numBulk.
-    vector<OCP_DBL>  Ni;         ///< Moles of component: numCom*numBulk.
-    vector<OCP_DBL>  vf;         ///< Total fluid volume: numBulk.
-    vector<OCP_DBL>  T;          ///< Temperature: numBulk.
-    vector<OCP_DBL>  P;          ///< Pressure: numBulk.
-    vector<OCP_DBL>  Pb;         ///< Bubble point pressure: numBulk.
-    vector<OCP_DBL>  Pj;         ///< Pressure of phase: numPhase*numBulk.
-    vector<OCP_DBL>  Pc;         ///< Capillary pressure of phase: numPhase*numBulk.
-    vector<OCP_BOOL> phaseExist; ///< Existence of phase: numPhase*numBulk.
-    vector<OCP_DBL>  S;          ///< Saturation of phase: numPhase*numBulk.
-    vector<OCP_DBL>  vj;         ///< Volume of phase: numPhase*numBulk.
-    vector<OCP_DBL>  nj;         ///< moles number of phase: numPhase*numBulk.
-    vector<OCP_DBL>  xij;        ///< Nij / Nj: numPhase*numCom*numBulk.
-    vector<OCP_DBL>  rho;        ///< Mass density of phase: numPhase*numBulk.
-    vector<OCP_DBL>  xi;         ///< Moles density of phase: numPhase*numBulk.
-    vector<OCP_DBL>  mu;         ///< Viscosity of phase: numPhase*numBulk.
-    vector<OCP_DBL>  kr;         ///< Relative permeability of phase: numPhase*numBulk.
-    vector<OCP_DBL>  Uf;         ///< Internal energy of fluid: numBulk
-    vector<OCP_DBL>  H;          ///< Enthalpy of phase: numPhase*numBulk.
-    vector<OCP_DBL>  kt;         ///< Coefficient of thermal diffusivity: activeGridNum.
+    OCPArray<USI>      phaseNum;   ///< Num of hydrocarbon phase in each bulk
+    OCPArray<OCP_DBL>  Nt;         ///< Total moles of components in bulks: numBulk.
+    OCPArray<OCP_DBL>  Ni;         ///< Moles of component: numCom*numBulk.
+    OCPArray<OCP_DBL>  vf;         ///< Total fluid volume: numBulk.
+    OCPArray<OCP_DBL>  T;          ///< Temperature: numBulk.
+    OCPArray<OCP_DBL>  P;          ///< Pressure: numBulk.
+    vector<OCP_DBL>    Pb;         ///< Bubble point pressure: numBulk.
+    OCPArray<OCP_DBL>  Pj;         ///< Pressure of phase: numPhase*numBulk.
+    OCPArray<OCP_DBL>  Pc;         ///< Capillary pressure of phase: numPhase*numBulk.
+    OCPArray<OCP_BOOL> phaseExist; ///< Existence of phase: numPhase*numBulk.
+    OCPArray<OCP_DBL>  S;          ///< Saturation of phase: numPhase*numBulk.
+    OCPArray<OCP_DBL>  vj;         ///< Volume of phase: numPhase*numBulk.
+    OCPArray<OCP_DBL>  nj;         ///< moles number of phase: numPhase*numBulk.
+    OCPArray<OCP_DBL>  xij;        ///< Nij / Nj: numPhase*numCom*numBulk.
+    OCPArray<OCP_DBL>  rho;        ///< Mass density of phase: numPhase*numBulk.
+    OCPArray<OCP_DBL>  xi;         ///< Moles density of phase: numPhase*numBulk.
+    OCPArray<OCP_DBL>  mu;         ///< Viscosity of phase: numPhase*numBulk.
+    OCPArray<OCP_DBL>  kr;         ///< Relative permeability: numPhase*numBulk.
+    OCPArray<OCP_DBL>  Uf;         ///< Internal energy of fluid: numBulk
+    OCPArray<OCP_DBL>  H;          ///< Enthalpy of phase: numPhase*numBulk.
+    OCPArray<OCP_DBL>  kt;         ///< Coef of thermal diffusivity: activeGridNum.
 
     // Last time step
-    vector<USI>      lphaseNum;   ///< last phaseNum
-    vector<OCP_DBL>  lNt;         ///< last Nt
-    vector<OCP_DBL>  lNi;         ///< last Ni
-    vector<OCP_DBL>  lvf;         ///< last vf
-    vector<OCP_DBL>  lT;          ///< last T
-    vector<OCP_DBL>  lP;          ///< last P
-    vector<OCP_DBL>  lPj;         ///< last Pj
-    vector<OCP_DBL>  lPc;         ///< last Pc
-    vector<OCP_BOOL> lphaseExist; ///< last phaseExist
-    vector<OCP_DBL>  lS;          ///< last S
-    vector<OCP_DBL>  lvj;         ///< last vj
-    vector<OCP_DBL>  lnj;         ///< last nj
-    vector<OCP_DBL>  lxij;        ///< last xij
-    vector<OCP_DBL>  lrho;        ///< last rho
-    vector<OCP_DBL>  lxi;         ///< last xi
-    vector<OCP_DBL>  lmu;         ///< last mu
-    vector<OCP_DBL>  lkr;         ///< last kr
-    vector<OCP_DBL>  lUf;         ///< last Uf
-    vector<OCP_DBL>  lH;          ///< last H
-    vector<OCP_DBL>  lkt;         ///< last kt
+    OCPArray<USI>      lphaseNum;   ///< last phaseNum
+    OCPArray<OCP_DBL>  lNt;         ///< last Nt
+    OCPArray<OCP_DBL>  lNi;         ///< last Ni
+    OCPArray<OCP_DBL>  lvf;         ///< last vf
+    OCPArray<OCP_DBL>  lT;          ///< last T
+    OCPArray<OCP_DBL>  lP;          ///< last P
+    OCPArray<OCP_DBL>  lPj;         ///< last Pj
+    OCPArray<OCP_DBL>  lPc;         ///< last Pc
+    OCPArray<OCP_BOOL> lphaseExist; ///< last phaseExist
+    OCPArray<OCP_DBL>  lS;          ///< last S
+    OCPArray<OCP_DBL>  lvj;         ///< last vj
+    OCPArray<OCP_DBL>  lnj;         ///< last nj
+    OCPArray<OCP_DBL>  lxij;        ///< last xij
+    OCPArray<OCP_DBL>  lrho;        ///< last rho
+    OCPArray<OCP_DBL>  lxi;         ///< last xi
+    OCPArray<OCP_DBL>  lmu;         ///< last mu
+    OCPArray<OCP_DBL>  lkr;         ///< last kr
+    OCPArray<OCP_DBL>  lUf;         ///< last Uf
+    OCPArray<OCP_DBL>  lH;          ///< last H
+    OCPArray<OCP_DBL>  lkt;         ///< last kt
 
     // Derivatives
-    vector<OCP_DBL> vfP;     ///< d vf   / d P: numBulk.
-    vector<OCP_DBL> vfT;     ///< d vf   / d T, numBulk
-    vector<OCP_DBL> vfi;     ///< d vf   / d Ni: numCom*numBulk.
-    vector<OCP_DBL> rhoP;    ///< d Rho  / d P: numPhase*numBulk.
-    vector<OCP_DBL> rhoT;    ///< d rhoj / d T: numPhase * numbulk
-    vector<OCP_DBL> rhox;    ///< d Rhoj / d xij: numPhase*numCom*numBulk.
-    vector<OCP_DBL> xiP;     ///< d xi   / d P: numPhase*numBulk.
-    vector<OCP_DBL> xiT;     ///< d xij  / d T, numPhase * numbulk
-    vector<OCP_DBL> xix;     ///< d Xi_j / d xij: numPhase*numCom*numBulk.
-    vector<OCP_DBL> muP;     ///< d Mu   / d P: numPhase*numBulk.
-    vector<OCP_DBL> muT;     ///< d muj  / d T: numPhase * numbulk
-    vector<OCP_DBL> mux;     ///< d Muj  / d xij: numPhase*numCom*numBulk.
-    vector<OCP_DBL> dPcj_dS; ///< d Pcj  / d Sk: numPhase * numPhase * bulk.
-    vector<OCP_DBL> dKr_dS;  ///< d Krj  / d Sk: numPhase * numPhase * bulk.
-    vector<OCP_DBL> UfP;     ///< d Uf   / d P: numbulk
-    vector<OCP_DBL> UfT;     ///< d Uf   / d T: numbulk
-    vector<OCP_DBL> Ufi;     ///< d Uf   / d Ni: numCom * numBulk
-    vector<OCP_DBL> HT;      ///< d Hj   / d T: numPhase * numbulk
-    vector<OCP_DBL> Hx;      ///< d Hj   / d xij: numPhase * numCom * numbulk
-    vector<OCP_DBL> ktP;     ///< d kt   / d P: numbulk
-    vector<OCP_DBL> ktT;     ///< d kt   / d T: activeGridNum.
-    vector<OCP_DBL> ktS;     ///< d kt   / d S: numPhase * numbulk
+    OCPArray<OCP_DBL> vfP;     ///< d vf   / d P: numBulk.
+    OCPArray<OCP_DBL> vfT;     ///< d vf   / d T, numBulk
+    OCPArray<OCP_DBL> vfi;     ///< d vf   / d Ni: numCom*numBulk.
+    OCPArray<OCP_DBL> rhoP;    ///< d Rho  / d P: numPhase*numBulk.
+    OCPArray<OCP_DBL> rhoT;    ///< d rhoj / d T: numPhase * numbulk
+    OCPArray<OCP_DBL> rhox;    ///< d Rhoj / d xij: numPhase*numCom*numBulk.
+    OCPArray<OCP_DBL> xiP;     ///< d xi   / d P: numPhase*numBulk.
+    OCPArray<OCP_DBL> xiT;     ///< d xij  / d T, numPhase * numbulk
+    OCPArray<OCP_DBL> xix;     ///< d Xi_j / d xij: numPhase*numCom*numBulk.
+    OCPArray<OCP_DBL> muP;     ///< d Mu   / d P: numPhase*numBulk.
+    OCPArray<OCP_DBL> muT;     ///< d muj  / d T: numPhase * numbulk
+    OCPArray<OCP_DBL> mux;     ///< d Muj  / d xij: numPhase*numCom*numBulk.
+    OCPArray<OCP_DBL> dPcj_dS; ///< d Pcj  / d Sk: numPhase * numPhase * bulk.
+    OCPArray<OCP_DBL> dKr_dS;  ///< d Krj  / d Sk: numPhase * numPhase * bulk.
+    OCPArray<OCP_DBL> UfP;     ///< d Uf   / d P: numbulk
+    OCPArray<OCP_DBL> UfT;     ///< d Uf   / d T: numbulk
+    OCPArray<OCP_DBL> Ufi;     ///< d Uf   / d Ni: numCom * numBulk
+    OCPArray<OCP_DBL> HT;      ///< d Hj   / d T: numPhase * numbulk
+    OCPArray<OCP_DBL> Hx;      ///< d Hj   / d xij: numPhase * numCom * numbulk
+    OCPArray<OCP_DBL> ktP;     ///< d kt   / d P: numbulk
+    OCPArray<OCP_DBL> ktT;     ///< d kt   / d T: activeGridNum.
+    OCPArray<OCP_DBL> ktS;     ///< d kt   / d S: numPhase * numbulk
 
     // Last time step
-    vector<OCP_DBL> lvfP;     ///< last vfP
-    vector<OCP_DBL> lvfT;     ///< last vfT
-    vector<OCP_DBL> lvfi;     ///< last vfi
-    vector<OCP_DBL> lrhoP;    ///< last rhoP
-    vector<OCP_DBL> lrhoT;    ///< last rhoT
-    vector<OCP_DBL> lrhox;    ///< last rhox
-    vector<OCP_DBL> lxiP;     ///< last xiP
-    vector<OCP_DBL> lxiT;     ///< last xiT
-    vector<OCP_DBL> lxix;     ///< last xix
-    vector<OCP_DBL> lmuP;     ///< last muP
-    vector<OCP_DBL> lmuT;     ///< last muT
-    vector<OCP_DBL> lmux;     ///< last mux
-    vector<OCP_DBL> ldPcj_dS; ///< last Pcj_dS
-    vector<OCP_DBL> ldKr_dS;  ///< last dKr_dS
-    vector<OCP_DBL> lUfP;     ///< last UfP
-    vector<OCP_DBL> lUfT;     ///< last UfT
-    vector<OCP_DBL> lUfi;     ///< last Ufi
-    vector<OCP_DBL> lHT;      ///< last HT
-    vector<OCP_DBL> lHx;      ///< last Hx
-    vector<OCP_DBL> lktP;     ///< last ktP
-    vector<OCP_DBL> lktT;     ///< last ktT
-    vector<OCP_DBL> lktS;     ///< last ktS
+    OCPArray<OCP_DBL> lvfP;     ///< last vfP
+    OCPArray<OCP_DBL> lvfT;     ///< last vfT
+    OCPArray<OCP_DBL> lvfi;     ///< last vfi
+    OCPArray<OCP_DBL> lrhoP;    ///< last rhoP
+    OCPArray<OCP_DBL> lrhoT;    ///< last rhoT
+    OCPArray<OCP_DBL> lrhox;    ///< last rhox
+    OCPArray<OCP_DBL> lxiP;     ///< last xiP
+    OCPArray<OCP_DBL> lxiT;     ///< last xiT
+    OCPArray<OCP_DBL> lxix;     ///< last xix
+    OCPArray<OCP_DBL> lmuP;     ///< last muP
+    OCPArray<OCP_DBL> lmuT;     ///< last muT
+    OCPArray<OCP_DBL> lmux;     ///< last mux
+    OCPArray<OCP_DBL> ldPcj_dS; ///< last Pcj_dS
+    OCPArray<OCP_DBL> ldKr_dS;  ///< last dKr_dS
+    OCPArray<OCP_DBL> lUfP;     ///< last UfP
+    OCPArray<OCP_DBL> lUfT;     ///< last UfT
+    OCPArray<OCP_DBL> lUfi;     ///< last Ufi
+    OCPArray<OCP_DBL> lHT;      ///< last HT
+    OCPArray<OCP_DBL> lHx;      ///< last Hx
+    OCPArray<OCP_DBL> lktP;     ///< last ktP
+    OCPArray<OCP_DBL> lktT;     ///< last ktT
+    OCPArray<OCP_DBL> lktS;     ///< last ktS
 
     /////////////////////////////////////////////////////////////////////
     // Newton Iteration Information
@@ -404,6 +424,10 @@ public:
     OCP_DBL GetNRdPmax() const { return NRdPmax; };
     /// Return NRdNmax.
     OCP_DBL GetNRdNmax() const { return NRdNmax; };
+    /// Reset maxNRdSSP of all threads before flash calculation.
+    void ResetMaxNRdSSP();
+    /// Collect maxNRdSSP of all threads in thread order after flash calculation.
+    void ReduceMaxNRdSSP();
 
 protected:
     vector<OCP_DBL> dSNR;  ///< saturation change between NR steps
@@ -419,6 +443,9 @@ protected:
     OCP_DBL NRdNmax;         ///< Max Ni difference in an NR step
     OCP_DBL NRdSmax;         ///< Max saturation difference in an NR step(Real)
 
+    vector<OCP_DBL> maxNRdSSPT;       ///< maxNRdSSP of each thread: numThreads
+    vector<OCP_USI> index_maxNRdSSPT; ///< index_maxNRdSSP of each thread: numThreads
+
     vector<OCP_DBL> NRstep;     ///< NRstep for FIM
     vector<USI>     NRphaseNum; ///< phaseNum in NR step
 
@@ -481,21 +508,31 @@ protected:
     // Method-Specified Variable
     /////////////////////////////////////////////////////////////////////
 
-    USI              maxLendSdP;   ///< length of dSec_dPri.
-    vector<USI>      bRowSizedSdP; ///< length of dSec_dPri in each bulk
-    vector<OCP_DBL>  dSec_dPri;    ///< d Secondary variable / d Primary variable.
-    vector<OCP_BOOL> pSderExist;   ///< Existence of derivative of phase saturation
-    vector<USI>      pVnumCom;     ///< num of variable components in the phase
-    vector<OCP_DBL>  res_n;        ///< residual for FIM_n
-    vector<OCP_DBL>  resPc;        ///< a precalculated value
+    USI                maxLendSdP;   ///< length of dSec_dPri.
+    OCPArray<USI>      bRowSizedSdP; ///< length of dSec_dPri in each bulk
+    OCPArray<OCP_DBL>  dSec_dPri;    ///< d Secondary variable / d Primary variable.
+    OCPArray<OCP_BOOL> pSderExist;   ///< Existence of derivative of phase saturation
+    OCPArray<USI>      pVnumCom;     ///< num of variable components in the phase
+    OCPArray<OCP_DBL>  res_n;        ///< residual for FIM_n
+    OCPArray<OCP_DBL>  resPc;        ///< a precalculated value
 
     // Last time step
-    vector<USI>      lbRowSizedSdP; ///< last bRowSizedSdP
-    vector<OCP_DBL>  ldSec_dPri;    ///< last dSec_dPri
-    vector<OCP_BOOL> lpSderExist;   ///< last pSderExist
-    vector<USI>      lpVnumCom;     ///< last pVnumCom
-    vector<OCP_DBL>  lres_n;        ///< last res_n
-    vector<OCP_DBL>  lresPc;        ///< last lresPc;
+    OCPArray<USI>      lbRowSizedSdP; ///< last bRowSizedSdP
+    OCPArray<OCP_DBL>  ldSec_dPri;    ///< last dSec_dPri
+    OCPArray<OCP_BOOL> lpSderExist;   ///< last pSderExist
+    OCPArray<USI>      lpVnumCom;     ///< last pVnumCom
+    OCPArray<OCP_DBL>  lres_n;        ///< last res_n
+    OCPArray<OCP_DBL>  lresPc;        ///< last lresPc;
+
+    /// Contiguous storage of the arrays above and their copies at last time step, so
+    /// that saving and restoring a time step are single memory copies.
+    OCPStateArena stateArena;
+
+public:
+    /// Write states of bulks to a restart file.
+    void WriteRestart(ofstream& out) const;
+    /// Read states of bulks from a restart file.
+    void ReadRestart(ifstream& in);
 
 public:
     /// Print Bulk which are implicit
@@ -532,4 +569,7 @@ protected:
 /*  Shizhe Li           Oct/01/2021      Create file                          */
 /*  Chensong Zhang      Oct/15/2021      Format file                          */
 /*  Chensong Zhang      Jan/09/2022      Update Doxygen                       */
+/*  OpenCAEPoro team    Oct/16/2026      Store states in OCPStateArena        */
+/*  OpenCAEPoro team    Oct/16/2026      Add restart                          */
+/*  OpenCAEPoro team    Oct/17/2026      Distribute FIM among MPI processes   */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
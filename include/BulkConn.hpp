@@ -70,8 +70,6 @@ protected:
 class BulkConn
 {
     friend class Reservoir;
-    // temp
-    friend class MyMetisTest;
     friend class Out4VTK;
     friend class IsoT_FIM;
     friend class IsoT_IMPEC;
@@ -123,6 +121,26 @@ protected:
     //  in iteratorConn is generated from neighbor.
     vector<BulkPair> iteratorConn;
 
+    /////////////////////////////////////////////////////////////////////
+    // Matrix Pattern
+    /////////////////////////////////////////////////////////////////////
+
+public:
+    /// Setup locations of connections in the rows of bulks in matrix.
+    void SetupMatPattern();
+    /// Allocate rows of bulks in matrix with the pattern of connections.
+    void SetupMatRows(LinearSystem& ls) const;
+    /// Add off-diagonal blocks of connections to diagonal blocks of bulks.
+    void AssembleMatDiag(LinearSystem& ls) const;
+
+protected:
+    //  Note: Entries in the row of a bulk follow the order in which connections are
+    //  visited, and the diagonal entry is always the first one.
+    vector<USI>     connPosB;   ///< Location of eId in the row of bId: numConn
+    vector<USI>     connPosE;   ///< Location of bId in the row of eId: numConn
+    vector<OCP_USI> rowConnPtr; ///< Start of connections of each bulk: numBulk + 1
+    vector<OCP_USI> rowConn;    ///< Connections of each bulk in order: 2 * numConn
+
     /////////////////////////////////////////////////////////////////////
     // Physical Variables
     /////////////////////////////////////////////////////////////////////
@@ -157,6 +175,12 @@ protected:
     vector<OCP_DBL> lAdktT; ///< last AdktT
     vector<OCP_DBL> lAdktS; ///< last AdktS
 
+public:
+    /// Write states of connections to a restart file.
+    void WriteRestart(ofstream& out) const;
+    /// Read states of connections from a restart file.
+    void ReadRestart(ifstream& in);
+
 public:
     /// rho = (S1*rho1 + S2*rho2)/(S1+S2)
     void CalFluxFIMS(const Grid& myGrid, const Bulk& myBulk);
@@ -173,4 +197,7 @@ public:
 /*  Shizhe Li           Oct/01/2021      Create file                          */
 /*  Chensong Zhang      Oct/15/2021      Format file                          */
 /*  Chensong Zhang      Jan/17/2022      Update Doxygen                       */
+/*  OpenCAEPoro team    Oct/16/2026      Add matrix pattern of connections    */
+/*  OpenCAEPoro team    Oct/16/2026      Add restart                          */
+/*  OpenCAEPoro team    Oct/17/2026      Remove unused METIS test             */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
@@ -13,12 +13,14 @@
 #define __CORNERGRID_HEADER__
 
 // Standard header files
+#include <algorithm>
 #include <math.h>
 #include <stdlib.h>
 #include <vector>
 
 // OpenCAEPoro header files
 #include "OCPConst.hpp"
+#include "UtilOpenMP.hpp"
 
 using namespace std;
 
@@ -57,7 +59,6 @@ public:
         , y(y0)
         , z(z0){};
 
-    Point3D& operator=(const Point3D& other);       ///< equal
     Point3D  operator+(const Point3D& other) const; ///< Addition
     Point3D  operator-(const Point3D& other) const; ///< Subtraction
     OCP_DBL  operator*(const Point3D& other) const; ///< Multiplication
@@ -116,30 +117,15 @@ Point2D CalCrossingPoint(const Point2D Line1[2], const Point2D Line2[2]);
 /// ???
 OCP_DBL CalAreaNotQuadr(const HexahedronFace& FACE1, const HexahedronFace& FACE2);
 
-/// ???
+/// Connection of a block to a neighbor, which is half of a connection.
 class HalfConn
 {
 public:
     OCP_DBL Ad_dd;
-    Point3D d;
     OCP_USI neigh;
     USI     directionType; // 1 - x, 2 - y, 3 - z, 4 - extension
 };
 
-/// ???
-class ConnGrid
-{
-public:
-    USI              nConn, maxConn;
-    vector<HalfConn> halfConn;
-    void             Allocate(const USI& max_neighbor);
-    void             AddHalfConn(const OCP_USI& n,
-                                 const Point3D& area,
-                                 const Point3D& d,
-                                 const USI&     direction,
-                                 const OCP_DBL& flag = 1);
-};
-
 /// ???
 class GeneralConnect
 {
@@ -150,6 +136,12 @@ public:
     OCP_DBL Ad_dd_end;
 };
 
+// Sides of a block connected to the neighboring columns
+const USI SIDE_XM = 0; ///< Side x-
+const USI SIDE_XP = 1; ///< Side x+
+const USI SIDE_YM = 2; ///< Side y-
+const USI SIDE_YP = 3; ///< Side y+
+
 /// ???
 class OCP_COORD
 {
@@ -157,9 +149,12 @@ class OCP_COORD
 
 public:
     void     Allocate(const USI& Nx, const USI& Ny, const USI& Nz);
+    /// Input COORD and ZCORN, which are used in place and must outlive this object.
     void     InputData(const vector<OCP_DBL>& coord, const vector<OCP_DBL>& zcorn);
     OCP_BOOL InputCOORDDATA(const vector<OCP_DBL>& coord);
     OCP_BOOL InputZCORNDATA(const vector<OCP_DBL>& zcorn);
+    /// Calculate the corner points of block (i, j, k) from COORD and ZCORN.
+    void GetHexahedron(const USI& i, const USI& j, const USI& k, Hexahedron& h) const;
     // New version
     void SetupCornerPoints();
     void SetAllFlags(const HexahedronFace& oFace, const HexahedronFace& Face);
@@ -167,12 +162,45 @@ public:
     OCP_DBL OCP_SIGN(const OCP_DBL& x) { return x >= 0 ? 1 : -1; }
 
 private:
-    USI           nx;
-    USI           ny;
-    USI           nz;
-    OCP_DBL***    COORDDATA;
-    OCP_DBL****   ZCORNDATA;
-    Hexahedron*** cornerPoints;
+    /// Calculate blocks of layer k with their volumes and centers.
+    void SetupLayer(const USI& k);
+    /// Return block (i, j, k), which is calculated if it is not in the kept layers.
+    const Hexahedron& GetBlock(const USI& i, const USI& j, const USI& k);
+    /// Add a half connection from current block to block n.
+    void AddHalfConn(const OCP_USI& n,
+                     const Point3D& area,
+                     const Point3D& d,
+                     const USI&     direction,
+                     const OCP_DBL& flag = 1);
+    /// Return the depth of corner point c of block (i, j, k).
+    OCP_DBL GetZCorn(const USI& i, const USI& j, const USI& k, const USI& c) const;
+    /// Find the overlapping blocks of each side by sweeping the faces of neighboring
+    /// columns sorted by depth.
+    void SetupFaultNeighbor();
+    /// Add half connections of side s of block (i, j, k) with face Face, and return
+    /// the number of them.
+    OCP_USI AddSideConn(const USI&            i,
+                        const USI&            j,
+                        const USI&            k,
+                        const USI&            s,
+                        const HexahedronFace& Face,
+                        const Point3D&        Pc2f);
+
+private:
+    USI            nx;
+    USI            ny;
+    USI            nz;
+    const OCP_DBL* COORDDATA; ///< COORD, top and bottom points of each pillar
+    const OCP_DBL* ZCORNDATA; ///< ZCORN in the order of Eclipse
+
+    // Blocks are set up layer by layer, and only layers k and k-1 are kept
+    USI                curK{0};       ///< Current layer
+    vector<Hexahedron> layer[2];      ///< Blocks of layer k are in layer[k % 2]
+    Hexahedron         tmpHex;        ///< Block out of the kept layers
+    vector<HalfConn>   halfConn;      ///< Half connections of all blocks in turn
+    vector<OCP_USI>    halfConnBegin; ///< Begin of half connections of each block
+    vector<OCP_USI>    sideBegin;     ///< Begin of neighbors of each side of blocks
+    vector<USI>        sideK;         ///< Layers of neighbors of sides in turn
 
     OCP_USI         numGrid;
     OCP_USI         numConn;
@@ -192,7 +220,6 @@ private:
     // if the i th point of oFace is very close to the one of Face, then flagpi = 0;
     OCP_INT        flagp0, flagp1, flagp2, flagp3;
     OCP_BOOL       flagQuad;
-    OCP_BOOL       upNNC, downNNC;
     OCP_BOOL       flagJump;
     HexahedronFace tmpFace;
     // after the Axes are determined, blocks will be placed along the y+, or along the
@@ -210,4 +237,8 @@ private:
 /*----------------------------------------------------------------------------*/
 /*  Shizhe Li           Nov/16/2021      Create file                          */
 /*  Chensong Zhang      Jan/16/2022      Update Doxygen                       */
+/*  OpenCAEPoro team    Oct/17/2026      Flat storage and layer-by-layer setup*/
+/*  OpenCAEPoro team    Oct/17/2026      Sweep faces of columns for NNC       */
+/*  OpenCAEPoro team    Oct/17/2026      Parallel setup with prefix sums      */
+/*  OpenCAEPoro team    Oct/17/2026      Use implicit copy of Point3D         */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
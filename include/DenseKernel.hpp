@@ -0,0 +1,242 @@
+/*! \file    DenseKernel.hpp
+ *  \brief   Fixed-size kernels for small dense matrices
+ *  \author  OpenCAEPoro team
+ *  \date    Oct/17/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the OpenCAEPoro team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+#ifndef __DENSEKERNEL_HEADER__
+#define __DENSEKERNEL_HEADER__
+
+// Standard header files
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+
+// Note: All matrices are column-major as in LAPACK. The dimension N is known at compile
+// time, so loops can be unrolled and the factors stay in registers or on the stack
+// without work arrays. The callers in DenseMat.cpp dispatch on the runtime dimension
+// and call LAPACK for matrices larger than DENSE_FIXED_MAX or if a kernel fails.
+
+/// Max dimension of matrices solved by fixed-size kernels.
+const int DENSE_FIXED_MAX = 16;
+
+/// Max number of QL iterations for an eigenvalue.
+const int DENSE_QL_MAXITER = 30;
+
+/// Solves A X = B by LU factorization with partial pivoting as dgesv, where B has nrhs
+/// columns. Returns the index (from 1) of the first zero pivot, then X is not computed.
+template <int N>
+int FixedLUSolve(const int& nrhs, double* A, double* B, int* pivot)
+{
+    // Factorize a local copy, which the compiler knows is not aliased with B
+    double LU[N * N];
+    copy(A, A + N * N, LU);
+    for (int k = 0; k < N; k++) {
+        int    p    = k;
+        double amax = fabs(LU[k + k * N]);
+        for (int i = k + 1; i < N; i++) {
+            if (fabs(LU[i + k * N]) > amax) {
+                amax = fabs(LU[i + k * N]);
+                p    = i;
+            }
+        }
+        pivot[k] = p + 1;
+        if (amax == 0) {
+            copy(LU, LU + N * N, A);
+            return k + 1;
+        }
+        if (p != k) {
+            for (int j = 0; j < N; j++) swap(LU[k + j * N], LU[p + j * N]);
+        }
+        const double inv = 1 / LU[k + k * N];
+        for (int i = k + 1; i < N; i++) LU[i + k * N] *= inv;
+        for (int j = k + 1; j < N; j++) {
+            const double akj = LU[k + j * N];
+            for (int i = k + 1; i < N; i++) LU[i + j * N] -= LU[i + k * N] * akj;
+        }
+    }
+    copy(LU, LU + N * N, A);
+
+    // Columns of B are independent, so they are updated together in each step
+    for (int r = 0; r < nrhs; r++) {
+        double* b = B + r * N;
+        for (int k = 0; k < N; k++) swap(b[k], b[pivot[k] - 1]);
+    }
+    for (int k = 0; k < N; k++) {
+        for (int r = 0; r < nrhs; r++) {
+            double*      b  = B + r * N;
+            const double bk = b[k];
+            for (int i = k + 1; i < N; i++) b[i] -= LU[i + k * N] * bk;
+        }
+    }
+    for (int k = N - 1; k >= 0; k--) {
+        for (int r = 0; r < nrhs; r++) {
+            double* b = B + r * N;
+            b[k] /= LU[k + k * N];
+            const double bk = b[k];
+            for (int i = 0; i < k; i++) b[i] -= LU[i + k * N] * bk;
+        }
+    }
+    return 0;
+}
+
+/// Solves A X = B for symmetric positive definite A by Cholesky factorization, where
+/// only the triangle of A given by uplo is read. A is not modified. Returns false if A
+/// is not positive definite, then B is not modified.
+template <int N>
+bool FixedCholSolve(const int& nrhs, const char& uplo, const double* A, double* B)
+{
+    const int si = uplo == 'U' ? N : 1;
+    const int sj = uplo == 'U' ? 1 : N;
+
+    double L[N * N];
+    for (int j = 0; j < N; j++) {
+        double ljj = A[j * si + j * sj];
+        for (int k = 0; k < j; k++) ljj -= L[j + k * N] * L[j + k * N];
+        if (!(ljj > 0)) return false;
+        ljj          = sqrt(ljj);
+        L[j + j * N] = ljj;
+        for (int i = j + 1; i < N; i++) {
+            double lij = A[i * si + j * sj];
+            for (int k = 0; k < j; k++) lij -= L[i + k * N] * L[j + k * N];
+            L[i + j * N] = lij / ljj;
+        }
+    }
+
+    for (int r = 0; r < nrhs; r++) {
+        double* b = B + r * N;
+        for (int k = 0; k < N; k++) {
+            b[k] /= L[k + k * N];
+            for (int i = k + 1; i < N; i++) b[i] -= L[i + k * N] * b[k];
+        }
+        for (int k = N - 1; k >= 0; k--) {
+            for (int i = k + 1; i < N; i++) b[k] -= L[i + k * N] * b[i];
+            b[k] /= L[k + k * N];
+        }
+    }
+    return true;
+}
+
+/// Computes the eigenvalues of symmetric A in ascending order by Householder
+/// tridiagonalization and implicit QL iterations, where only the triangle of A given
+/// by uplo is read. A is not modified. Returns false if QL iterations do not converge
+/// in DENSE_QL_MAXITER for an eigenvalue, then w is not computed.
+template <int N, typename T>
+bool FixedEigenSY(const char& uplo, const T* A, T* w)
+{
+    const int si = uplo == 'U' ? N : 1;
+    const int sj = uplo == 'U' ? 1 : N;
+
+    // a(i, j) = a[i + j * N] with i >= j
+    double a[N * N];
+    double d[N];
+    double e[N];
+    for (int j = 0; j < N; j++) {
+        for (int i = j; i < N; i++) a[i + j * N] = A[i * si + j * sj];
+    }
+
+    // Householder reduction to tridiagonal form
+    for (int i = N - 1; i > 0; i--) {
+        double h = 0;
+        if (i > 1) {
+            double scale = 0;
+            for (int k = 0; k < i; k++) scale += fabs(a[i + k * N]);
+            if (scale == 0) {
+                e[i] = a[i + (i - 1) * N];
+            } else {
+                for (int k = 0; k < i; k++) {
+                    a[i + k * N] /= scale;
+                    h += a[i + k * N] * a[i + k * N];
+                }
+                double       f = a[i + (i - 1) * N];
+                double       g = f >= 0 ? -sqrt(h) : sqrt(h);
+                e[i]           = scale * g;
+                h -= f * g;
+                a[i + (i - 1) * N] = f - g;
+                f                  = 0;
+                for (int j = 0; j < i; j++) {
+                    g = 0;
+                    for (int k = 0; k <= j; k++) g += a[j + k * N] * a[i + k * N];
+                    for (int k = j + 1; k < i; k++) g += a[k + j * N] * a[i + k * N];
+                    e[j] = g / h;
+                    f += e[j] * a[i + j * N];
+                }
+                const double hh = f / (h + h);
+                for (int j = 0; j < i; j++) {
+                    f = a[i + j * N];
+                    e[j] = g = e[j] - hh * f;
+                    for (int k = 0; k <= j; k++) {
+                        a[j + k * N] -= f * e[k] + g * a[i + k * N];
+                    }
+                }
+            }
+        } else {
+            e[i] = a[i + (i - 1) * N];
+        }
+        d[i] = h;
+    }
+    for (int i = 0; i < N; i++) d[i] = a[i + i * N];
+
+    // Implicit QL iterations on the tridiagonal matrix
+    for (int i = 1; i < N; i++) e[i - 1] = e[i];
+    e[N - 1] = 0;
+    for (int l = 0; l < N; l++) {
+        int iter = 0;
+        for (; iter < DENSE_QL_MAXITER; iter++) {
+            int m = l;
+            for (; m < N - 1; m++) {
+                if (fabs(e[m]) <= 1E-16 * (fabs(d[m]) + fabs(d[m + 1]))) break;
+            }
+            if (m == l) break;
+
+            double g = (d[l + 1] - d[l]) / (2 * e[l]);
+            double r = sqrt(g * g + 1);
+            g        = d[m] - d[l] + e[l] / (g + (g >= 0 ? r : -r));
+            double s = 1, c = 1, p = 0;
+            int    i = m - 1;
+            for (; i >= l; i--) {
+                const double f = s * e[i];
+                const double b = c * e[i];
+                r = e[i + 1] = sqrt(f * f + g * g);
+                if (r == 0) {
+                    d[i + 1] -= p;
+                    e[m] = 0;
+                    break;
+                }
+                s        = f / r;
+                c        = g / r;
+                g        = d[i + 1] - p;
+                r        = (d[i] - g) * s + 2 * c * b;
+                p        = s * r;
+                d[i + 1] = g + p;
+                g        = c * r - b;
+            }
+            if (r == 0 && i >= l) continue;
+            d[l] -= p;
+            e[l] = g;
+            e[m] = 0;
+        }
+        if (iter == DENSE_QL_MAXITER) return false;
+    }
+
+    sort(d, d + N);
+    for (int i = 0; i < N; i++) w[i] = static_cast<T>(d[i]);
+    return true;
+}
+
+#endif /* end if __DENSEKERNEL_HEADER__ */
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  OpenCAEPoro team    Oct/17/2026      Create file                          */
+/*  OpenCAEPoro team    Oct/17/2026      Remove LDLT, report QL failures      */
+/*----------------------------------------------------------------------------*/
@@ -106,8 +106,10 @@ int ssyevd_(char*      jobz,
             int*       info);
 }
 
-/// Calculate the minimal eigenvalue for symmetric matrix with mkl lapack
-void CalEigenSY(const int& N, float* A, float* w, float* work, const int& lwork);
+/// Calculate the eigenvalues for symmetric matrix in ascending order, where fixed-size
+/// kernels are used for small matrices and lapack for others or if they fail. Returns
+/// 0 if successful.
+int CalEigenSY(const int& N, float* A, float* w, float* work, const int& lwork);
 
 /// Calculate the minimal eigenvalue for symmetric matrix with mkl lapack
 // void MinEigenS(const int& N, float* a, float* w);
@@ -181,10 +183,12 @@ void DaAxpby(const int&    m,
              const double& b,
              double*       y);
 
-/// Calls dgesv to solve the linear system for general matrices.
+/// Solves the linear system for general matrices by fixed-size kernels for small
+/// matrices, or by dgesv.
 void LUSolve(const int& nrhs, const int& N, double* A, double* b, int* pivot);
 
-/// Calls dsysy to solve the linear system for symm matrices.
+/// Solves the linear system for symm matrices by fixed-size Cholesky for small positive
+/// definite matrices, or by dsysv with Bunch-Kaufman pivoting for others.
 int SYSSolve(const int&  nrhs,
              const char* uplo,
              const int&  N,
@@ -225,4 +229,6 @@ bool CheckNan(const int& N, const T* x)
 /*----------------------------------------------------------------------------*/
 /*  Shizhe Li           Oct/24/2021      Create file                          */
 /*  Chensong Zhang      Jan/16/2022      Update Doxygen                       */
+/*  OpenCAEPoro team    Oct/17/2026      Add fixed-size kernels               */
+/*  OpenCAEPoro team    Oct/17/2026      Return status of CalEigenSY          */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
@@ -50,6 +50,9 @@ extern "C" {
 
 // OpenCAEPoro header files
 #include "LinearSolver.hpp"
+#include "PCReuse.hpp"
+#include "UtilProfiler.hpp"
+#include "UtilTiming.hpp"
 
 using namespace std;
 
@@ -63,10 +66,10 @@ using namespace std;
 #define PC_DIAG  68 ///< DIAG:  diagonal preconditioner
 #define PC_BILU  69 ///< BILU:  block ILU preconditioner
 
-// Sharing-setup preconditioner types
-#define PC_FASP1_SHARE 71 ///< Sharing setup stage for PC_FASP1, use with caution
-#define PC_FASP4_SHARE 74 ///< Sharing setup stage for PC_FASP4, use with caution
-#define RESET_CONST    35 ///< Sharing threshold for PC_FASP1_SHARE, PC_FASP4_SHARE
+// Sharing-setup preconditioner types, they are PC_FASP1 and PC_FASP4 with setup reuse
+#define PC_FASP1_SHARE     71 ///< PC_FASP1 with setup reuse
+#define PC_FASP4_SHARE     74 ///< PC_FASP4 with setup reuse
+#define PC_SHARE_MAX_REUSE 20 ///< Default PC_reuse_max of sharing-setup types
 
 /// Basic FASP solver class.
 class FaspSolver : public LinearSolver
@@ -78,6 +81,12 @@ public:
     /// Get number of iterations used by iterative solver.
     USI GetNumIters() const override { return itParam.maxit; }
 
+    /// Discard the setup of preconditioner, it is rebuilt in next solve.
+    void ResetPC() override { pcReuse.Reset(); }
+
+    /// Return the time of setup in last solve, setups inside FASP are not included.
+    OCP_DBL GetSetupTime() const override { return pcReuse.GetLastSetupTime(); }
+
 public:
     string      solveDir;  ///< Current work dir
     string      solveFile; ///< Relative path of fasp file
@@ -86,6 +95,7 @@ public:
     AMG_param   amgParam;  ///< Parameters for AMG method
     ILU_param   iluParam;  ///< Parameters for ILU method
     SWZ_param   swzParam;  ///< Parameters for Schwarz method
+    PCReuse     pcReuse;   ///< Policy of setup reuse
 };
 
 /// Scalar solvers in CSR format from FASP.
@@ -103,7 +113,7 @@ private:
     void InitParam() override;
 
     /// Assemble coefficient matrix.
-    void AssembleMat(const vector<vector<USI>>&     colId,
+    void AssembleMat(const vector<vector<OCP_USI>>& colId,
                      const vector<vector<OCP_DBL>>& val,
                      const OCP_USI&                 dim,
                      const USI&                     blockDim,
@@ -134,7 +144,7 @@ private:
     void InitParam() override;
 
     /// Assemble coefficient matrix.
-    void AssembleMat(const vector<vector<USI>>&     colId,
+    void AssembleMat(const vector<vector<OCP_USI>>& colId,
                      const vector<vector<OCP_DBL>>& val,
                      const OCP_USI&                 dim,
                      const USI&                     blockDim,
@@ -144,14 +154,19 @@ private:
     /// Solve the linear system.
     OCP_INT Solve() override;
 
-    /// Apply decoupling to the linear system.
+    /// Return the values of BSR matrix, whose pattern is kept between assemblies.
+    OCP_DBL* GetMatValue() override { return A.val; }
+
+    /// Apply decoupling to the linear system, Dmatvec of last decoupling is used if
+    /// reuse is true.
     void Decoupling(dBSRmat* Absr,
                     dvector* b,
                     dBSRmat* Asc,
                     dvector* fsc,
                     ivector* order,
                     double*  Dmatvec,
-                    int      decouple_type);
+                    int      decouple_type,
+                    bool     reuse);
 
 private:
     dBSRmat A; ///< Matrix for vector-value problems
@@ -163,6 +178,9 @@ private:
     ivector order; ///< User-defined ordering for smoothing process
 
     vector<OCP_DBL> Dmat; ///< Decoupling matrices
+
+    ILU_data LU;              ///< ILU factors of PC_BILU
+    OCP_BOOL iluReady{false}; ///< If LU holds the factors
 };
 
 #endif // __FASPSOLVER_HEADER__
@@ -176,4 +194,8 @@ private:
 /*  Chensong Zhang      Jan/08/2022      Update Doxygen                       */
 /*  Chensong Zhang      Jan/19/2022      Set FASP4BLKOIL as optional          */
 /*  Li Zhao             Apr/04/2022      Set FASP4CUDA   as optional          */
+/*  OpenCAEPoro team    Oct/16/2026      Expose BSR values for reuse          */
+/*  OpenCAEPoro team    Oct/16/2026      Reuse setups of preconditioners      */
+/*  OpenCAEPoro team    Oct/16/2026      Report setup time                    */
+/*  OpenCAEPoro team    Oct/17/2026      Add 64-bit global index option       */
 /*----------------------------------------------------------------------------*/
@@ -20,8 +20,15 @@
 #include "OptionalFeatures.hpp"
 #include "ParamReservoir.hpp"
 
+/// Max num of columns of saturation tables
+const USI MAX_SATCOL = 4;
+/// Num of cursors of saturation tables for CalKrPc: water, gas and oil tables
+const USI NUM_KRPC_HINT = 3;
+
 /// designed to deal with matters related to saturation table.
 /// relative permeability, capillary pressure will be calculated here.
+//  Note: CalKrPc and CalKrPcDeriv keep no state in FlowUnit, interpolation is done in
+//  local scratch and table cursors are owned by caller, so they can run in threads.
 class FlowUnit
 {
 public:
@@ -42,26 +49,28 @@ public:
     /// Return the value of Scm
     virtual const vector<OCP_DBL>& GetScm() const = 0;
 
-    /// Calculate relative permeability and capillary pressure.
+    /// Calculate relative permeability and capillary pressure, hint points to
+    /// NUM_KRPC_HINT cursors of saturation tables owned by caller.
     virtual void CalKrPc(const OCP_DBL* S_in,
                          OCP_DBL*       kr_out,
                          OCP_DBL*       pc_out,
-                         const OCP_USI& bId) = 0;
+                         const OCP_USI& bId,
+                         USI*           hint) const = 0;
 
-    /// Calculate derivatives of relative permeability and capillary pressure.
+    /// Calculate derivatives of relative permeability and capillary pressure, hint is
+    /// the same as the one of CalKrPc.
     virtual void CalKrPcDeriv(const OCP_DBL* S_in,
                               OCP_DBL*       kr_out,
                               OCP_DBL*       pc_out,
                               OCP_DBL*       dkrdS,
                               OCP_DBL*       dPcjdS,
-                              const OCP_USI& bId) = 0;
+                              const OCP_USI& bId,
+                              USI*           hint) const = 0;
 
     OCP_DBL GetSwco() const { return Swco; };
 
 protected:
-    OCP_DBL         Swco;
-    vector<OCP_DBL> data;  ///< container to store the values of interpolation.
-    vector<OCP_DBL> cdata; ///< container to store the slopes of interpolation.
+    OCP_DBL Swco;
 };
 
 ///////////////////////////////////////////////
@@ -80,13 +89,15 @@ public:
     void CalKrPc(const OCP_DBL* S_in,
                  OCP_DBL*       kr_out,
                  OCP_DBL*       pc_out,
-                 const OCP_USI& bId) override;
+                 const OCP_USI& bId,
+                 USI*           hint) const override;
     void CalKrPcDeriv(const OCP_DBL* S_in,
                       OCP_DBL*       kr_out,
                       OCP_DBL*       pc_out,
                       OCP_DBL*       dkrdS,
                       OCP_DBL*       dPcjdS,
-                      const OCP_USI& bId) override;
+                      const OCP_USI& bId,
+                      USI*           hint) const override;
 
     OCP_DBL GetPcowBySw(const OCP_DBL& sw) override { return 0; }
     OCP_DBL GetSwByPcow(const OCP_DBL& pcow) override { return 0; }
@@ -116,13 +127,15 @@ public:
     void CalKrPc(const OCP_DBL* S_in,
                  OCP_DBL*       kr_out,
                  OCP_DBL*       pc_out,
-                 const OCP_USI& bId) override;
+                 const OCP_USI& bId,
+                 USI*           hint) const override;
     void CalKrPcDeriv(const OCP_DBL* S_in,
                       OCP_DBL*       kr_out,
                       OCP_DBL*       pc_out,
                       OCP_DBL*       dkrdS,
                       OCP_DBL*       dPcjdS,
-                      const OCP_USI& bId) override;
+                      const OCP_USI& bId,
+                      USI*           hint) const override;
 
     OCP_DBL GetPcowBySw(const OCP_DBL& sw) override { return SWOF.Eval(0, sw, 3); }
     OCP_DBL GetSwByPcow(const OCP_DBL& pcow) override
@@ -160,13 +173,15 @@ public:
     void    CalKrPc(const OCP_DBL* S_in,
                     OCP_DBL*       kr_out,
                     OCP_DBL*       pc_out,
-                    const OCP_USI& bId) override;
+                    const OCP_USI& bId,
+                    USI*           hint) const override;
     void    CalKrPcDeriv(const OCP_DBL* S_in,
                          OCP_DBL*       kr_out,
                          OCP_DBL*       pc_out,
                          OCP_DBL*       dkrdS,
                          OCP_DBL*       dPcjdS,
-                         const OCP_USI& bId) override;
+                         const OCP_USI& bId,
+                         USI*           hint) const override;
     OCP_DBL GetPcgoBySg(const OCP_DBL& sg) override { return SGOF.Eval(0, sg, 3); }
     OCP_DBL GetSgByPcgo(const OCP_DBL& pcgo) override { return SGOF.Eval(3, pcgo, 0); }
 
@@ -226,13 +241,15 @@ public:
     virtual void CalKrPc(const OCP_DBL* S_in,
                          OCP_DBL*       kr_out,
                          OCP_DBL*       pc_out,
-                         const OCP_USI& bId) override;
+                         const OCP_USI& bId,
+                         USI*           hint) const override;
     virtual void CalKrPcDeriv(const OCP_DBL* S_in,
                               OCP_DBL*       kr_out,
                               OCP_DBL*       pc_out,
                               OCP_DBL*       dkrdS,
                               OCP_DBL*       dPcjdS,
-                              const OCP_USI& bId) override;
+                              const OCP_USI& bId,
+                              USI*           hint) const override;
 
     OCP_DBL CalKro_Stone2Der(OCP_DBL  krow,
                              OCP_DBL  krog,
@@ -301,13 +318,15 @@ public:
     void CalKrPc(const OCP_DBL* S_in,
                  OCP_DBL*       kr_out,
                  OCP_DBL*       pc_out,
-                 const OCP_USI& bId) override;
+                 const OCP_USI& bId,
+                 USI*           hint) const override;
     void CalKrPcDeriv(const OCP_DBL* S_in,
                       OCP_DBL*       kr_out,
                       OCP_DBL*       pc_out,
                       OCP_DBL*       dkrdS,
                       OCP_DBL*       dPcjdS,
-                      const OCP_USI& bId) override;
+                      const OCP_USI& bId,
+                      USI*           hint) const override;
 
 protected:
     ScalePcow* scaleTerm;
@@ -316,10 +335,6 @@ protected:
     OCP_DBL maxPcow;
     OCP_DBL minPcow;
 
-    OCP_DBL Fk;     ///< The relative permeability interpolation parameter
-    OCP_DBL Fp;     ///< The capillary pressure interpolation parameter
-    OCP_DBL surTen; ///< Surface tension
-
     /*
     OCP_DBL kroMis{0};  ///< miscible oil relative permeability
     OCP_DBL krgMis{0};  ///< miscible gas relative permeability
@@ -345,13 +360,15 @@ public:
     void    CalKrPc(const OCP_DBL* S_in,
                     OCP_DBL*       kr_out,
                     OCP_DBL*       pc_out,
-                    const OCP_USI& bId) override;
+                    const OCP_USI& bId,
+                    USI*           hint) const override;
     void    CalKrPcDeriv(const OCP_DBL* S_in,
                          OCP_DBL*       kr_out,
                          OCP_DBL*       pc_out,
                          OCP_DBL*       dkrdS,
                          OCP_DBL*       dPcjdS,
-                         const OCP_USI& bId) override;
+                         const OCP_USI& bId,
+                         USI*           hint) const override;
     OCP_DBL CalKro_Stone2Der(OCP_DBL  krow,
                              OCP_DBL  krog,
                              OCP_DBL  krw,
@@ -399,4 +416,5 @@ protected:
 /*----------------------------------------------------------------------------*/
 /*  Shizhe Li           Oct/01/2021      Create file                          */
 /*  Chensong Zhang      Oct/05/2022      Format file                          */
+/*  OpenCAEPoro team    Oct/17/2026      Keep no state in CalKrPc             */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
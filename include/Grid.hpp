@@ -13,6 +13,7 @@
 #define __GRID_HEADER__
 
 // Standard header files
+#include <algorithm>
 #include <iostream>
 #include <vector>
 
@@ -21,6 +22,7 @@
 #include "OCPConst.hpp"
 #include "ParamOutput.hpp"
 #include "ParamReservoir.hpp"
+#include "UtilOpenMP.hpp"
 #include "UtilOutput.hpp"
 
 using namespace std;
@@ -93,6 +95,7 @@ class Grid
     friend class ScalePcow;
     friend class Out4RPT;
     friend class Out4VTK;
+    friend class Partition;
 
     /////////////////////////////////////////////////////////////////////
     // Input Param and Setup
@@ -128,12 +131,24 @@ protected:
     void CalActiveGridIsoT(const OCP_DBL& e1, const OCP_DBL& e2);
     /// Calculate the activity of grid cells for ifThermal model
     void CalActiveGridT(const OCP_DBL& e1, const OCP_DBL& e2);
+    /// Renumber active grid cells in the ordering given by gridOrder.
+    void ReorderActiveGrid();
+    /// Calculate the reverse Cuthill-McKee ordering of active grid cells.
+    void CalOrderRCM(vector<OCP_USI>& order) const;
+    /// Calculate the ordering of active grid cells along a Hilbert curve.
+    void CalOrderHilbert(vector<OCP_USI>& order) const;
+
+    /// Restrict active grid cells to the given ones, which are renumbered locally.
+    void RestrictActiveGrid(const vector<OCP_USI>& act, const OCP_USI& numOwned);
 
     /// Setup Grid location for Structured grid
     void SetupGridLocation();
 
 public:
     OCP_USI GetGridNum() const { return numGrid; }
+    USI     GetGridOrder() const { return gridOrder; }
+    /// Return the active index of a fluid cell, -1 for other cells, and -2 for the
+    /// cells owned by other processes.
     OCP_INT GetActIndex(const USI& I, const USI& J, const USI& K) const;
 
 protected:
@@ -187,7 +202,14 @@ protected:
     vector<vector<GPair>> gNeighbor; ///< Neighboring information of grid.
 
     // Active grid cells
-    OCP_USI activeGridNum; ///< Num of active grid.
+    // Note: Active cells are numbered in the natural order by default, gridOrder could
+    // renumber them to improve the locality of bulks and connections. All the other
+    // modules follow the numbering through map_All2Act and map_Act2All. With more
+    // than one process, they are restricted to the owned cells followed by the ghost
+    // cells of calling process, see Partition.
+    USI     gridOrder{ORDER_NATURAL}; ///< Ordering of active grid cells
+    OCP_USI activeGridNum;            ///< Num of active grid.
+    OCP_USI ownedGridNum;             ///< Num of active grid owned by this process.
     vector<OCP_USI>
         map_Act2All; ///< Mapping from active grid to all grid: activeGridNum.
     vector<GB_Pair> map_All2Act; ///< Mapping from grid to active all grid: numGrid.
@@ -232,4 +254,8 @@ protected:
 /*  Chensong Zhang      Oct/15/2021      Format file                          */
 /*  Shizhe Li           Nov/18/2021      Add Connections between Grids        */
 /*  Chensong Zhang      Jan/16/2022      Finish Doxygen                       */
+/*  OpenCAEPoro team    Oct/17/2026      Parallel setup with prefix sums      */
+/*  OpenCAEPoro team    Oct/17/2026      Reorder active cells                 */
+/*  OpenCAEPoro team    Oct/17/2026      Record grid order in restart files   */
+/*  OpenCAEPoro team    Oct/17/2026      Distribute FIM among MPI processes   */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
@@ -0,0 +1,73 @@
+/*! \file    LinearCapture.hpp
+ *  \brief   Binary capture files of linear systems for offline benchmarks
+ *  \author  OpenCAEPoro team
+ *  \date    Oct/16/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the OpenCAEPoro team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+#ifndef __LINEARCAPTURE_HEADER__
+#define __LINEARCAPTURE_HEADER__
+
+// Standard header files
+#include <fstream>
+#include <string>
+#include <vector>
+
+// OpenCAEPoro header files
+#include "OCPConst.hpp"
+
+using namespace std;
+
+const char CAPTURE_MAGIC[8] = {'O', 'C', 'P', 'L', 'S', 'Y', 'S', 'C'}; ///< File id
+const USI  CAPTURE_VERSION  = 2; ///< Version of capture files
+
+/// A linear system captured during simulation, A is stored in BSR format and the
+/// diagonal block is the first one of each row.
+//  Note: A capture file has a header of CAPTURE_MAGIC and CAPTURE_VERSION, followed by
+//  systems written by Write one after another until the end of file. Indices are
+//  stored as 64-bit integers, so files are exchangeable between 32-bit and 64-bit
+//  builds. No initial guess is stored, benchmarks start every solve from zero as the
+//  native and block FASP solvers do.
+class CapturedSystem
+{
+public:
+    /// Write the header of a capture file.
+    static void WriteHeader(ofstream& out);
+    /// Read and check the header of a capture file, return OCP_FALSE if it is not.
+    static OCP_BOOL ReadHeader(ifstream& in);
+    /// Append the system to a capture file.
+    void Write(ofstream& out) const;
+    /// Read next system from a capture file, return OCP_FALSE at the end of file.
+    OCP_BOOL Read(ifstream& in);
+
+public:
+    // Metadata
+    USI     tstep{0};  ///< Index of time step
+    USI     iterNR{0}; ///< Index of Newton iteration in time step
+    USI     method{0}; ///< Discrete method
+    OCP_DBL time{0};   ///< Current time
+    OCP_DBL dt{0};     ///< Current time step size
+
+    // Linear system
+    OCP_USI         dim{0};      ///< Num of block rows
+    USI             blockDim{1}; ///< Dimension of blocks
+    vector<OCP_USI> rowPtr;      ///< Beginning of each block row: dim+1
+    vector<OCP_USI> colIdx;      ///< Block column indices
+    vector<OCP_DBL> val;         ///< Values of blocks, stored row by row
+    vector<OCP_DBL> b;           ///< Right-hand side
+};
+
+#endif /* end if __LINEARCAPTURE_HEADER__ */
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  OpenCAEPoro team    Oct/16/2026      Create file                          */
+/*  OpenCAEPoro team    Oct/17/2026      Store indices as 64-bit integers     */
+/*----------------------------------------------------------------------------*/
@@ -21,10 +21,15 @@
 
 using namespace std;
 
+class Partition;
+
 /// Virtual base class for linear solvers.
 class LinearSolver
 {
 public:
+    /// Destroy the linear solver.
+    virtual ~LinearSolver() = default;
+
     /// Read the params for linear solvers from an input file.
     virtual void SetupParam(const string& dir, const string& file) = 0;
 
@@ -37,7 +42,7 @@ public:
                           const USI&         blockDim) = 0;
 
     /// Assemble matrix for linear solver from the internal matrix data.
-    virtual void AssembleMat(const vector<vector<USI>>&     colId,
+    virtual void AssembleMat(const vector<vector<OCP_USI>>& colId,
                              const vector<vector<OCP_DBL>>& val,
                              const OCP_USI&                 dim,
                              const USI&                     blockDim,
@@ -49,6 +54,19 @@ public:
 
     /// Get number of iterations.
     virtual USI GetNumIters() const = 0;
+
+    /// Return the value storage of the assembled matrix, nullptr if not exposed.
+    virtual OCP_DBL* GetMatValue() { return nullptr; }
+
+    /// Discard the setup of preconditioner, it is rebuilt in next solve.
+    virtual void ResetPC() {}
+
+    /// Return the time of preconditioner setup in last solve in ms, which is a part
+    /// of the solve. It is 0 if the setup is reused or not timed separately.
+    virtual OCP_DBL GetSetupTime() const { return 0; }
+
+    /// Set the partition of bulks, whose ghost bulks are numbered after owned ones.
+    virtual void SetPartition(const Partition*) {}
 };
 
 #endif // __LINEARSOLVER_HEADER__
@@ -60,4 +78,9 @@ public:
 /*----------------------------------------------------------------------------*/
 /*  Shizhe Li           Nov/22/2021      Create file                          */
 /*  Chensong Zhang      Jan/18/2022      Update Doxygen                       */
+/*  OpenCAEPoro team    Oct/16/2026      Add GetMatValue                      */
+/*  OpenCAEPoro team    Oct/16/2026      Add ResetPC                          */
+/*  OpenCAEPoro team    Oct/16/2026      Add GetSetupTime and destructor      */
+/*  OpenCAEPoro team    Oct/17/2026      Add 64-bit global index option       */
+/*  OpenCAEPoro team    Oct/17/2026      Distribute FIM among MPI processes   */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
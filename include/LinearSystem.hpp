@@ -20,8 +20,13 @@
 
 // OpenCAEPoro header files
 #include "DenseMat.hpp"
+#include "LinearCapture.hpp"
+#if WITH_FASP
 #include "FaspSolver.hpp"
+#endif
+#include "NativeSolver.hpp"
 #include "OCPConst.hpp"
+#include "UtilProfiler.hpp"
 
 using namespace std;
 
@@ -49,14 +54,23 @@ public:
     void OutputLinearSystem(const string& fileA, const string& fileb) const;
     /// Output the solution to a disk file name.
     void OutputSolution(const string& filename) const;
+    /// Copy the assembled matrix, rhs and initial guess to a captured system.
+    void GetCapturedSystem(CapturedSystem& sys) const;
 
     // Linear Solver
     /// Setup LinearSolver.
     void SetupLinearSolver(const USI& i, const string& dir, const string& file);
     /// Assemble Mat for Linear Solver.
-    void AssembleMatLinearSolver() { LS->AssembleMat(colId, val, dim, blockDim, b, u); }
+    void AssembleMatLinearSolver();
+    /// Reuse the sparsity pattern of the first assembled matrix if possible.
+    void SetFrozenPattern(const OCP_BOOL& flag);
+    /// Check the key of current pattern, the pattern and the setup of preconditioner
+    /// will be rebuilt if it changes.
+    void CheckPattern(const OCP_ULL& key);
     /// Solve the Linear System.
     OCP_INT Solve() { return LS->Solve(); }
+    /// Set the partition of bulks for the linear solver.
+    void SetPartition(const Partition* part) { LS->SetPartition(part); }
 
     /// Setup dimensions.
     OCP_USI AddDim(const OCP_USI& n)
@@ -69,6 +83,7 @@ public:
     /// Push back a diagonal val, which is always at the first location.
     void NewDiag(const OCP_USI& n, const OCP_DBL& v)
     {
+        OCP_ASSERT(!patternFrozen, "Frozen pattern is not supported");
         OCP_ASSERT(colId[n].size() == 0, "Wrong Diag");
         colId[n].push_back(n);
         val[n].push_back(v);
@@ -76,12 +91,14 @@ public:
     /// Add a value at diagonal value.
     void AddDiag(const OCP_USI& n, const OCP_DBL& v)
     {
+        OCP_ASSERT(!patternFrozen, "Frozen pattern is not supported");
         OCP_ASSERT(colId[n].size() > 0, "Wrong Diag");
         val[n][0] += v;
     }
     /// Push back a off-diagonal value.
     void NewOffDiag(const OCP_USI& bId, const OCP_USI& eId, const OCP_DBL& v)
     {
+        OCP_ASSERT(!patternFrozen, "Frozen pattern is not supported");
         OCP_ASSERT(colId[bId].size() > 0, "Wrong Diag");
         colId[bId].push_back(eId);
         val[bId].push_back(v);
@@ -94,12 +111,24 @@ public:
     // Vector
     void NewDiag(const OCP_USI& n, const vector<OCP_DBL>& v)
     {
+        if (patternFrozen) {
+            rowFill[n] = 1;
+            copy(v.begin(), v.begin() + blockSize, FrozenVal(n, 0));
+            return;
+        }
         OCP_ASSERT(colId[n].size() == 0, "Wrong Diag");
         colId[n].push_back(n);
         val[n].insert(val[n].begin(), v.begin(), v.end());
     }
     void AddDiag(const OCP_USI& n, const vector<OCP_DBL>& v)
     {
+        if (patternFrozen) {
+            OCP_DBL* dst = FrozenVal(n, 0);
+            for (USI i = 0; i < blockSize; i++) {
+                dst[i] += v[i];
+            }
+            return;
+        }
         OCP_ASSERT(colId[n].size() > 0, "Wrong Diag");
         for (USI i = 0; i < blockSize; i++) {
             val[n][i] += v[i];
@@ -107,10 +136,50 @@ public:
     }
     void NewOffDiag(const OCP_USI& bId, const OCP_USI& eId, const vector<OCP_DBL>& v)
     {
+        if (patternFrozen) {
+            const OCP_USI k = rowPtr[bId] + rowFill[bId]++;
+            if (k >= rowPtr[bId + 1] || colIdx[k] != eId)
+                OCP_ABORT("Entry does not match the frozen pattern!");
+            copy(v.begin(), v.begin() + blockSize, valPtr + k * blockSize);
+            return;
+        }
         OCP_ASSERT(colId[bId].size() > 0, "Wrong Diag");
         colId[bId].push_back(eId);
         val[bId].insert(val[bId].end(), v.begin(), v.end());
     }
+    /// Allocate a row with len entries whose values are zero, the diagonal entry is at
+    /// the first location and other column indices are assigned by SetColId.
+    void NewRow(const OCP_USI& n, const USI& len)
+    {
+        if (patternFrozen) {
+            if (rowPtr[n] + len > rowPtr[n + 1])
+                OCP_ABORT("Row does not match the frozen pattern!");
+            rowFill[n] = len;
+            fill(FrozenVal(n, 0), FrozenVal(n, len), 0.0);
+            return;
+        }
+        OCP_ASSERT(colId[n].size() == 0, "Wrong Diag");
+        colId[n].resize(len);
+        colId[n][0] = n;
+        val[n].resize(len * blockSize, 0);
+    }
+    /// Assign the column index of the k-th entry in row n.
+    void SetColId(const OCP_USI& n, const USI& k, const OCP_USI& col)
+    {
+        if (patternFrozen) {
+            OCP_ASSERT(colIdx[rowPtr[n] + k] == col, "Wrong ColId");
+            return;
+        }
+        colId[n][k] = col;
+    }
+    /// Return the address of the k-th block in row n.
+    OCP_DBL* GetVal(const OCP_USI& n, const USI& k)
+    {
+        if (patternFrozen) return FrozenVal(n, k);
+        return &val[n][k * blockSize];
+    }
+    /// Return the size of small block matrix.
+    USI GetBlockSize() const { return blockSize; }
     /// Add a value at b[n].
     void AddRhs(const OCP_USI& n, const vector<OCP_DBL>& v)
     {
@@ -149,6 +218,26 @@ private:
 
     string solveDir; ///< Current workdir.
 
+    // Frozen pattern: after the first assembly, the row structure is kept in
+    // rowPtr/colIdx and values are written directly into the matrix of the linear
+    // solver, so the rows are neither rebuilt nor copied again until the key changes.
+    /// Return the address of the k-th block in row n of the frozen pattern.
+    OCP_DBL* FrozenVal(const OCP_USI& n, const USI& k) const
+    {
+        return valPtr + (rowPtr[n] + k) * blockSize;
+    }
+    /// Record the current row structure and release the row-segmented storage.
+    void FreezePattern();
+
+    OCP_BOOL        ifFrozenPattern{OCP_FALSE}; ///< If frozen pattern is used
+    OCP_BOOL        patternFrozen{OCP_FALSE};   ///< If current pattern is frozen
+    OCP_ULL         patternKey{0};              ///< Key of current pattern
+    OCP_USI         patternDim{0};              ///< Dimension of frozen pattern
+    vector<OCP_USI> rowPtr;                     ///< Row pointers of frozen pattern
+    vector<OCP_USI> colIdx;                     ///< Column indices of frozen pattern
+    vector<USI>     rowFill;                    ///< Num of filled entries in rows
+    OCP_DBL*        valPtr{nullptr};            ///< Values of matrix in solver
+
     LinearSolver* LS;
 };
 
@@ -163,4 +252,9 @@ private:
 /*  Chensong Zhang      Oct/15/2021      Format file                          */
 /*  Chensong Zhang      Nov/09/2021      Remove decoupling methods            */
 /*  Chensong Zhang      Nov/22/2021      renamed to LinearSystem              */
+/*  OpenCAEPoro team    Oct/16/2026      Add frozen sparsity pattern          */
+/*  OpenCAEPoro team    Oct/16/2026      Select native solvers                */
+/*  OpenCAEPoro team    Oct/16/2026      Capture linear systems               */
+/*  OpenCAEPoro team    Oct/17/2026      Time PC setup apart from Krylov      */
+/*  OpenCAEPoro team    Oct/17/2026      Distribute FIM among MPI processes   */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
@@ -70,6 +70,8 @@ public:
     };
     virtual void SetupOptionalFeatures(OptionalFeatures& optFeatures,
                                        const OCP_USI&    numBulk) = 0;
+    /// Return a copy of current mixture, which is used by threads in parallel flash.
+    virtual Mixture* Clone() const = 0;
     /// return type of mixture.
     USI GetMixtureType() const { return mixtureType; }
     /// flash calculation with saturation of phases.
@@ -178,6 +180,8 @@ public:
 
     virtual OCP_DBL GetErrorPEC()           = 0;
     virtual void    OutMixtureIters() const = 0;
+    /// Accumulate iterations of mixture src, which has the same type as this.
+    virtual void AddMixtureIters(const Mixture* src) = 0;
 
 public:
     const OCP_DBL&  GetNt() const { return Nt; }
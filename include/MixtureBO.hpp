@@ -65,6 +65,7 @@ public:
         return 0;
     }
     void OutMixtureIters() const override{};
+    void AddMixtureIters(const Mixture* src) override{};
 
 protected:
     // USI mixtureType; ///< indicates the type of mixture, black oil or compositional
@@ -85,6 +86,7 @@ class BOMixture_W : public BOMixture
 {
 public:
     BOMixture_W() = default;
+    Mixture* Clone() const override { return new BOMixture_W(*this); }
     BOMixture_W(const ParamReservoir& rs_param, const USI& i)
     {
         OCP_ABORT("Not Completed!");
@@ -183,6 +185,7 @@ class BOMixture_OW : public BOMixture
 {
 public:
     BOMixture_OW() = default;
+    Mixture* Clone() const override { return new BOMixture_OW(*this); }
     BOMixture_OW(const ParamReservoir& rs_param, const USI& i);
     void Flash(const OCP_DBL& Pin, const OCP_DBL& Tin, const OCP_DBL* Niin) override;
     void InitFlashIMPEC(const OCP_DBL& Pin,
@@ -257,6 +260,7 @@ class BOMixture_ODGW : public BOMixture
 {
 public:
     BOMixture_ODGW() = default;
+    Mixture* Clone() const override { return new BOMixture_ODGW(*this); }
     BOMixture_ODGW(const ParamReservoir& rs_param, const USI& i);
 
     void Flash(const OCP_DBL& Pin, const OCP_DBL& Tin, const OCP_DBL* Niin) override;
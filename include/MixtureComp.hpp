@@ -21,6 +21,8 @@
 #include "DenseMat.hpp"
 #include "Mixture.hpp"
 #include "OCPTable.hpp"
+#include "UtilOpenMP.hpp"
+#include "UtilProfiler.hpp"
 
 using namespace std;
 
@@ -128,6 +130,7 @@ class MixtureComp : public Mixture
 public:
     OCP_DBL GetErrorPEC() override { return ePEC; }
     void    OutMixtureIters() const override;
+    void    AddMixtureIters(const Mixture* src) override;
 
 private:
     // total iters
@@ -151,6 +154,7 @@ private:
 
 public:
     MixtureComp() = default;
+    Mixture* Clone() const override { return new MixtureComp(*this); }
 
     MixtureComp(const ParamReservoir& rs_param, const USI& i)
         : MixtureComp(rs_param.comsParam, i)
@@ -323,9 +327,18 @@ public:
     void SolEoS(OCP_DBL& ZjT, const OCP_DBL& AjT, const OCP_DBL& BjT) const;
     // Calculate Ai and Bi
     void CalAiBi();
-    // Calculate Aj and Bj with specified xj
+    // Calculate Aj and Bj with specified xj, and Aij * xj if AxT is given
     void CalAjBj(OCP_DBL& AjT, OCP_DBL& BjT, const vector<OCP_DBL>& xj) const;
-    void CalAjBj(OCP_DBL& AjT, OCP_DBL& BjT, const OCP_DBL* xj) const;
+    void CalAjBj(OCP_DBL&       AjT,
+                 OCP_DBL&       BjT,
+                 const OCP_DBL* xj,
+                 OCP_DBL*       AxT = nullptr) const;
+    // Calculate fugacity coefficients with Aj, Bj, Zj and Aij * xj of a phase
+    void CalPhiEoS(OCP_DBL*       phiT,
+                   const OCP_DBL& aj,
+                   const OCP_DBL& bj,
+                   const OCP_DBL& zj,
+                   const OCP_DBL* AxT) const;
     /// Result is stored in Ztmp.
     USI CubicRoot(const OCP_DBL&  a,
                   const OCP_DBL&  b,
@@ -341,6 +354,8 @@ private:
     // EoS Variables
     vector<OCP_DBL>         Ai;
     vector<OCP_DBL>         Bi;
+    vector<OCP_DBL>         Aij; ///< (1 - BIC) * sqrt(Ai * Aj), size: NC * NC
+    vector<OCP_DBL>         Axj; ///< Aij * xj of each phase, size: NPmax * NC
     vector<OCP_DBL>         Aj;
     vector<OCP_DBL>         Bj;
     vector<OCP_DBL>         Zj;
@@ -586,6 +601,20 @@ protected:
     vector<OCP_SIN> eigenSkip;
     vector<OCP_SIN> eigenWork; ///< work space for computing eigenvalues with ssyevd_
 
+    /////////////////////////////////////////////////////////////////////
+    // Flash Cache
+    /////////////////////////////////////////////////////////////////////
+
+protected:
+    /// Split phases from cached equilibrium constants, return true if accepted
+    OCP_BOOL SplitFromCache();
+    /// Insert current two-phase split into cache
+    void InsertToCache();
+
+protected:
+    FlashCache flashCache;           ///< Converged splits of this mixture
+    OCP_BOOL   ifKsGiven{OCP_FALSE}; ///< If true, Ks has been given before splitting
+
     /////////////////////////////////////////////////////////////////////
     // Miscible
     /////////////////////////////////////////////////////////////////////
@@ -60,12 +60,14 @@ public:
         return 0;
     }
     void OutMixtureIters() const override{};
+    void AddMixtureIters(const Mixture* src) override{};
 };
 
 class MixtureThermal_K01 : public MixtureThermal
 {
 public:
     MixtureThermal_K01() = default;
+    Mixture* Clone() const override { return new MixtureThermal_K01(*this); }
     MixtureThermal_K01(const ParamReservoir& param, const USI& tarId);
     void Flash(const OCP_DBL& Pin, const OCP_DBL& Tin, const OCP_DBL* Niin) override;
     /// flash calculation with saturation of phases.
@@ -0,0 +1,110 @@
+/*! \file    NativeAMG.hpp
+ *  \brief   Classical AMG for scalar sparse systems
+ *  \author  OpenCAEPoro team
+ *  \date    Oct/16/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the OpenCAEPoro team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+#ifndef __NATIVEAMG_HEADER__
+#define __NATIVEAMG_HEADER__
+
+// Standard header files
+#include <vector>
+
+// OpenCAEPoro header files
+#include "OCPConst.hpp"
+#include "SparseMat.hpp"
+
+using namespace std;
+
+/// Params of AMG, which are read from the parameter file of FASP.
+class AMGParam
+{
+public:
+    USI     maxLevel{20};   ///< AMG_levels: max num of levels
+    OCP_USI coarseDof{500}; ///< AMG_coarse_dof: max size of coarsest level
+    OCP_DBL strong{0.25};   ///< AMG_strong_threshold: threshold of strong couplings
+    USI     preSmooth{1};   ///< AMG_presmooth_iter: num of presmoothing sweeps
+    USI     postSmooth{1};  ///< AMG_postsmooth_iter: num of postsmoothing sweeps
+    USI     maxReuse{10};   ///< AMG_reuse: num of setups reusing interpolations
+};
+
+/// A level of AMG hierarchy, all matrices have 1*1 blocks.
+class AMGLevel
+{
+public:
+    BSRMatrix               A;    ///< Matrix of this level
+    BSRMatrix               P;    ///< Interpolation from next level
+    BSRMatrix               R;    ///< Restriction to next level: P^T
+    BSRMatrix               AP;   ///< A * P, used in Galerkin product
+    vector<OCP_DBL>         dinv; ///< Inverse of diagonal of A
+    mutable vector<OCP_DBL> x;    ///< Solution of this level
+    mutable vector<OCP_DBL> b;    ///< Right-hand side of this level
+    mutable vector<OCP_DBL> r;    ///< Residual of this level
+    mutable vector<OCP_DBL> xold; ///< Solution of last sweep of smoother
+};
+
+/// NativeAMG is a classical AMG used as a V-cycle preconditioner.
+//  Note: Rows are split into C and F rows by Ruge-Stuben coarsening of strong
+//  connections, F rows are interpolated directly from their strong C neighbors, and
+//  coarse matrices are Galerkin products R * A * P. The smoother is Gauss-Seidel
+//  within fixed chunks of rows and Jacobi between them, so results do not depend on
+//  the number of threads. The coarsest level is solved by dense LU. Interpolations are
+//  reused while the pattern of A is unchanged for at most maxReuse setups, only coarse
+//  matrices are recomputed then, and LU factors are kept if the coarsest one is the
+//  same.
+class NativeAMG
+{
+public:
+    /// Set the params of AMG.
+    void SetupParam(const AMGParam& param) { amgParam = param; }
+    /// Build the hierarchy of A, or update the coarse matrices of cached hierarchy.
+    void Setup(const BSRMatrix& A);
+    /// x = M^{-1} * b by a V-cycle with zero initial guess.
+    void Apply(const OCP_DBL* b, OCP_DBL* x) const;
+    /// Return the num of levels.
+    USI GetNumLevels() const { return numLevel; }
+
+protected:
+    /// Build the interpolation of level l and allocate the matrix of level l+1, return
+    /// OCP_FALSE if level l can not be coarsened further.
+    OCP_BOOL Coarsen(const USI& l);
+    /// Split rows of A into C and F rows by strong connections, return the num of C
+    /// rows and the index of each row in next level, which is -1 for F rows.
+    OCP_USI Split(const BSRMatrix&    A,
+                  const vector<char>& strong,
+                  vector<OCP_INT>&    cf) const;
+    /// Compute the diagonals of level l and factorize the coarsest level if it changes.
+    void SetupSmoother(const USI& l);
+    /// Sweep of Gauss-Seidel smoother on level l.
+    void Smooth(const USI& l, const OCP_BOOL& forward) const;
+    /// V-cycle from level l.
+    void VCycle(const USI& l) const;
+    /// Solve the coarsest level.
+    void CoarseSolve() const;
+
+protected:
+    AMGParam         amgParam;    ///< Params of AMG
+    vector<AMGLevel> level;       ///< Levels of AMG hierarchy
+    USI              numLevel{0}; ///< Num of levels in use
+    USI              numReuse{0}; ///< Num of setups since last building
+    OCP_BOOL         coarseLU{0}; ///< If coarsest level is solved by LU
+    vector<OCP_DBL>  coarseMat;   ///< LU factors of coarsest level
+    vector<OCP_USI>  coarsePiv;   ///< Pivots of LU factors of coarsest level
+    vector<OCP_DBL>  coarseVal;   ///< Values of coarsest level of LU factors
+};
+
+#endif /* end if __NATIVEAMG_HEADER__ */
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  OpenCAEPoro team    Oct/16/2026      Create file                          */
+/*  OpenCAEPoro team    Oct/17/2026      Keep LU factors of same coarse level */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,173 @@
+/*! \file    NativeSolver.hpp
+ *  \brief   Built-in Krylov solvers for block linear systems
+ *  \author  OpenCAEPoro team
+ *  \date    Oct/16/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the OpenCAEPoro team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+#ifndef __NATIVESOLVER_HEADER__
+#define __NATIVESOLVER_HEADER__
+
+// Standard header files
+#include <string>
+#include <vector>
+
+// OpenCAEPoro header files
+#include "LinearSolver.hpp"
+#include "NativeAMG.hpp"
+#include "PCReuse.hpp"
+#include "SparseMat.hpp"
+
+using namespace std;
+
+// Native preconditioner types, they share precond_type with FASP solvers
+#define PC_NATIVE_BILU 81 ///< Native: block ILU(0) of decoupled system
+#define PC_NATIVE_CPR  82 ///< Native: CPR with AMG of pressure and block ILU(0)
+
+// Native Krylov methods, they share solver_type with FASP solvers
+#define NATIVE_BICGSTAB 2 ///< BiCGStab
+#define NATIVE_GMRES    6 ///< Restarted GMRES, used for other solver types too
+
+class Partition;
+
+/// Parameters of native solvers, which are read from the parameter file of FASP.
+//  Note: Only the lines "key = value" of the keys below are used, others are skipped.
+class NativeParam
+{
+public:
+    /// Read params from file, return OCP_FALSE if the file can not be opened.
+    OCP_BOOL Read(const string& file);
+    /// Return whether file chooses a native preconditioner, always true without FASP.
+    static OCP_BOOL IfSelected(const string& file);
+
+public:
+    USI          printLevel{0};               ///< print_level
+    USI          solverType{NATIVE_GMRES};    ///< solver_type
+    USI          decoupType{1};               ///< decoup_type: 0 none, others ABF
+    USI          precondType{PC_NATIVE_BILU}; ///< precond_type
+    OCP_DBL      tol{1E-4};                   ///< itsolver_tol: relative residual
+    USI          maxIter{100};                ///< itsolver_maxit
+    USI          restart{30};                 ///< itsolver_restart
+    AMGParam     amg;                         ///< AMG_* params for pressure of CPR
+    PCReuseParam reuse;                       ///< PC_reuse_* params of setup reuse
+};
+
+/// NativeSolver solves linear systems in BSR format without external libraries.
+//  Note: Rows are decoupled by the inverse of their diagonal blocks (ABF), then the
+//  system is solved by right-preconditioned restarted GMRES or BiCGStab. The
+//  preconditioner is block ILU(0), or two-stage CPR: an AMG V-cycle of the pressure
+//  block followed by block ILU(0) of the full system. Decoupling matrices and
+//  preconditioners could be reused by later solves as decided by PCReuse. Matrix-vector
+//  products, vector operations and preconditioners are parallelized by OpenMP. Scalar
+//  problems are solved as block problems with 1*1 blocks. With bulks distributed among
+//  processes, Krylov vectors keep zeros at ghost bulks, whose values are received from
+//  owners before matrix-vector products, and the preconditioner is block Jacobi with
+//  the local system of owned bulks and wells on each process.
+class NativeSolver : public LinearSolver
+{
+public:
+    /// Read the params for linear solvers from an input file.
+    void SetupParam(const string& dir, const string& file) override;
+
+    /// Initialize the params for linear solvers.
+    void InitParam() override { param = NativeParam(); }
+
+    /// Allocate memory for the linear system.
+    void Allocate(const vector<USI>& rowCapacity,
+                  const OCP_USI&     maxDim,
+                  const USI&         blockDim) override;
+
+    /// Assemble coefficient matrix.
+    void AssembleMat(const vector<vector<OCP_USI>>& colId,
+                     const vector<vector<OCP_DBL>>& val,
+                     const OCP_USI&                 dim,
+                     const USI&                     blockDim,
+                     vector<OCP_DBL>&               rhs,
+                     vector<OCP_DBL>&               u) override;
+
+    /// Solve the linear system, return the num of iterations or -1 if it fails.
+    OCP_INT Solve() override;
+
+    /// Get number of iterations used in last solve.
+    USI GetNumIters() const override { return numIters; }
+
+    /// Return the values of BSR matrix, whose pattern is kept between assemblies.
+    OCP_DBL* GetMatValue() override { return A.val.data(); }
+
+    /// Discard the setup of preconditioner, it is rebuilt in next solve.
+    void ResetPC() override { pcReuse.Reset(); }
+
+    /// Return the time of decoupling and preconditioner setup in last solve.
+    OCP_DBL GetSetupTime() const override { return pcReuse.GetLastSetupTime(); }
+
+    /// Set the partition of bulks, systems are distributed if it has ghost bulks.
+    void SetPartition(const Partition* p) override { part = p; }
+
+protected:
+    /// Scale each row of A and b by the inverse of its diagonal block, the inverses
+    /// of last setup are used if it is not rebuilt.
+    void Decouple(const OCP_BOOL& rebuild);
+    /// Setup the preconditioner of decoupled system.
+    void SetupPC();
+    /// z = M^{-1} * r.
+    void ApplyPC(const OCP_DBL* r, OCP_DBL* z) const;
+    /// Return whether the system is distributed among processes.
+    OCP_BOOL IfDistributed() const;
+    /// Replace the rows of ghost bulks by identity rows.
+    void SetGhostIdentity(BSRMatrix& mat) const;
+    /// Receive the entries of ghost bulks of v from their owners.
+    void ExchangeGhost(OCP_DBL* v) const;
+    /// Set the entries of ghost bulks of v to zero.
+    void ZeroGhost(OCP_DBL* v) const;
+    /// y = mat * x, entries of ghost bulks of x are received from owners.
+    void SpMV(const BSRMatrix& mat, const OCP_DBL* x, OCP_DBL* y) const;
+    /// r = f - mat * x, entries of ghost bulks of x are received from owners.
+    void Residual(const BSRMatrix& mat,
+                  const OCP_DBL*   f,
+                  const OCP_DBL*   x,
+                  OCP_DBL*         r) const;
+    /// Restarted GMRES with right preconditioning.
+    OCP_INT GMRES(const BSRMatrix& mat, const OCP_DBL* f, OCP_DBL* u);
+    /// BiCGStab with right preconditioning.
+    OCP_INT BiCGStab(const BSRMatrix& mat, const OCP_DBL* f, OCP_DBL* u);
+
+protected:
+    NativeParam             param;          ///< Params of solvers
+    BSRMatrix               A;              ///< Matrix of linear system
+    BSRMatrix               Asc;            ///< Decoupled matrix
+    vector<OCP_DBL>         fsc;            ///< Decoupled right-hand side
+    vector<OCP_DBL>         Dmat;           ///< Decoupling matrices of last setup
+    OCP_DBL*                b{nullptr};     ///< Right-hand side of linear system
+    OCP_DBL*                x{nullptr};     ///< Solution of linear system
+    const BSRMatrix*        pcMat{nullptr}; ///< Matrix of preconditioner
+    BlockILU0               bilu;           ///< Block ILU(0) preconditioner
+    BSRMatrix               Ap;             ///< Pressure block of CPR
+    NativeAMG               amg;            ///< AMG of pressure block
+    mutable vector<OCP_DBL> rp;             ///< Work space of CPR: pressure residual
+    mutable vector<OCP_DBL> zp;             ///< Work space of CPR: pressure solution
+    mutable vector<OCP_DBL> rc;             ///< Work space of CPR: second stage, 2*n
+    vector<OCP_DBL>         work;           ///< Work space of Krylov methods
+    USI                     numIters{0};    ///< Num of iterations in last solve
+    PCReuse                 pcReuse;        ///< Policy of setup reuse
+    const Partition*        part{nullptr};  ///< Partition of bulks among processes
+    mutable vector<OCP_DBL> xg;             ///< Work space of ghost exchange
+};
+
+#endif /* end if __NATIVESOLVER_HEADER__ */
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  OpenCAEPoro team    Oct/16/2026      Create file                          */
+/*  OpenCAEPoro team    Oct/16/2026      Add CPR preconditioner               */
+/*  OpenCAEPoro team    Oct/16/2026      Reuse setups of preconditioners      */
+/*  OpenCAEPoro team    Oct/16/2026      Report setup time                    */
+/*  OpenCAEPoro team    Oct/17/2026      Add 64-bit global index option       */
+/*  OpenCAEPoro team    Oct/17/2026      Distribute FIM among MPI processes   */
+/*----------------------------------------------------------------------------*/
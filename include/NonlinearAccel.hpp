@@ -0,0 +1,110 @@
+/*! \file    NonlinearAccel.hpp
+ *  \brief   Strategies of Newton iterations for FIM
+ *  \author  OpenCAEPoro team
+ *  \date    Oct/16/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the OpenCAEPoro team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+#ifndef __NONLINEARACCEL_HEADER__
+#define __NONLINEARACCEL_HEADER__
+
+// Standard header files
+#include <deque>
+#include <vector>
+
+// OpenCAEPoro header files
+#include "OCPConst.hpp"
+#include "OCPStructure.hpp"
+
+using namespace std;
+
+// Strategies of Newton iterations
+const USI NLSOLVER_NEWTON     = 0; ///< Newton with chops of large saturation changes
+const USI NLSOLVER_APPLEYARD  = 1; ///< Newton with Appleyard chops
+const USI NLSOLVER_LINESEARCH = 2; ///< Newton with backtracking line search
+const USI NLSOLVER_ANDERSON   = 3; ///< Newton with Anderson acceleration
+
+/// NonlinearAccel decides how the update of a Newton iteration is applied.
+//  Note: Appleyard chops stop a saturation at its critical value when it would change
+//  the mobility of a phase. The line search halves the update until the 2-norm of
+//  relative residuals decreases enough, and the full update is kept if it never does.
+//  Anderson acceleration mixes the Newton update with the recent ones once Newton
+//  iterations slow down, which breaks the cycles of iterates around switches of phases
+//  or mobilities. It restarts once a mixed update increases the residual.
+class NonlinearAccel
+{
+public:
+    /// Set the strategy of Newton iterations.
+    void SetMode(const USI& m) { mode = m; }
+    /// Return the strategy of Newton iterations.
+    USI GetMode() const { return mode; }
+    /// Return whether Appleyard chops are used.
+    OCP_BOOL IfAppleyard() const { return mode == NLSOLVER_APPLEYARD; }
+    /// Return whether the line search is used.
+    OCP_BOOL IfLineSearch() const { return mode == NLSOLVER_LINESEARCH; }
+    /// Return whether Anderson acceleration is used.
+    OCP_BOOL IfAnderson() const { return mode == NLSOLVER_ANDERSON; }
+    /// Begin a Newton iteration from the iterate with residual res.
+    void BeginIter(const OCPRes& res);
+    /// Record the residual after a Newton iteration.
+    void EndIter(const OCPRes& res) { resHist.push_back(GetResNorm(res)); }
+    /// Return the fraction of the update to retry if the update reaching residual res
+    /// is not accepted by the line search, 0 if it is accepted.
+    OCP_DBL LineSearch(const OCPRes& res);
+    /// Mix the Newton update f with recent ones, where w scales the unknowns.
+    void Accelerate(vector<OCP_DBL>& f, const vector<OCP_DBL>& w);
+    /// Record the update applied to the iterate after chops.
+    void RecordUpdate(const vector<OCP_DBL>& a) { aLast = a; }
+    /// Discard the history at the end of an attempt of a time step.
+    void Reset();
+    /// Return the residuals of Newton iterations of current step.
+    const vector<OCP_DBL>& GetResHistory() const { return resHist; }
+    /// Return the number of backtracks of the line search.
+    USI GetNumBacktrack() const { return numBacktrack; }
+    /// Return the number of line searches falling back to full updates.
+    USI GetNumLSFallback() const { return numLSFallback; }
+    /// Return the number of updates mixed by Anderson acceleration.
+    USI GetNumAccel() const { return numAccel; }
+    /// Return the number of restarts of Anderson acceleration.
+    USI GetNumAARestart() const { return numAARestart; }
+
+protected:
+    /// Return the 2-norm of relative residuals of bulks.
+    static OCP_DBL GetResNorm(const OCPRes& res);
+    /// Discard the history of Anderson acceleration.
+    void RestartAA();
+
+protected:
+    USI             mode{NLSOLVER_NEWTON}; ///< Strategy of Newton iterations
+    vector<OCP_DBL> resHist;               ///< Residuals of current step
+    OCP_DBL         resBegin{0};           ///< Residual at the beginning of iteration
+    OCP_DBL         lambda{1};             ///< Fraction of the update tried now
+    OCP_BOOL        fallback{OCP_FALSE};   ///< If the line search falls back
+
+    // Anderson acceleration
+    OCP_BOOL               accelerated{OCP_FALSE}; ///< If last update is mixed
+    vector<OCP_DBL>        fLast;                  ///< Last Newton update
+    vector<OCP_DBL>        aLast;                  ///< Last applied update
+    deque<vector<OCP_DBL>> dF;                     ///< Differences of Newton updates
+    deque<vector<OCP_DBL>> dX;                     ///< Differences of iterates
+
+    // Statistics
+    USI numBacktrack{0};  ///< Num of backtracks of the line search
+    USI numLSFallback{0}; ///< Num of line searches falling back to full updates
+    USI numAccel{0};      ///< Num of updates mixed by Anderson acceleration
+    USI numAARestart{0};  ///< Num of restarts of Anderson acceleration
+};
+
+#endif /* end if __NONLINEARACCEL_HEADER__ */
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  OpenCAEPoro team    Oct/16/2026      Create file                          */
+/*----------------------------------------------------------------------------*/
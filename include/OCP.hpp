@@ -57,10 +57,24 @@ public:
              << "      dtMax = maximum time stepsize  " << endl
              << "      dtMin = minimum time stepsize  " << endl
              << "    verbose = print level on screen  " << endl
+             << "    checkpt = restart file written at each TSTEP" << endl
+             << "    restart = restart file to resume from" << endl
+             << "    capture = file of linear systems for benchLinearSolver" << endl
+             << "   capsteps = first:last TSTEP index of captured systems" << endl
+             << "     dtCtrl = time step control: classic (default) or adaptive" << endl
+             << "   nlSolver = strategy of isothermal FIM: newton (default), appleyard,"
+                " linesearch or anderson"
+             << endl
+             << "    profile = Profile.csv and Profile.json of hot paths: on or off "
+                "(default)"
+             << endl
              << endl;
 
         cout << "Attention: " << endl
              << "  - Only if `method' is set, other options will take effect;" << endl
+             << "  - Except that `checkpt', `restart', `capture', `dtCtrl', "
+                "`nlSolver' and `profile' always take effect;"
+             << endl
              << "  - These cmd options will override those in the input file;" << endl
              << "  - If (dtInit,dtMax,dtMin) are not set, default values will be used."
              << endl
@@ -110,4 +124,10 @@ private:
 /*  Chensong Zhang      Oct/15/2021      Format file                          */
 /*  Chensong Zhang      Jan/08/2022      New tag info                         */
 /*  Chensong Zhang      Sep/21/2022      Add PrintUsage                       */
+/*  OpenCAEPoro team    Oct/16/2026      Add restart options                  */
+/*  OpenCAEPoro team    Oct/16/2026      Add capture options                  */
+/*  OpenCAEPoro team    Oct/16/2026      Add dtCtrl option                    */
+/*  OpenCAEPoro team    Oct/16/2026      Add nlSolver option                  */
+/*  OpenCAEPoro team    Oct/17/2026      Fall back to newton if unsupported   */
+/*  OpenCAEPoro team    Oct/17/2026      Add run-time switch of profiler      */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
@@ -22,7 +22,11 @@
 // Build-in data type
 typedef unsigned int       USI;      ///< Generic unsigned integer
 typedef unsigned long long OCP_ULL;  ///< Long long unsigned integer
+#ifdef OCP_USE_INT64
+typedef unsigned long long OCP_USI;  ///< Global index of cells, conns and nonzeros
+#else
 typedef unsigned int       OCP_USI;  ///< Long unsigned integer
+#endif
 typedef int                OCP_INT;  ///< Long integer
 typedef double             OCP_DBL;  ///< Double precision
 typedef float              OCP_SIN;  ///< Single precision
@@ -40,6 +44,17 @@ const OCP_DBL  PI           = 3.141592653; ///< Pi
 const OCP_BOOL OCP_TRUE     = 1;
 const OCP_BOOL OCP_FALSE    = 0;
 
+// Print levels and macros which come from FASP if it is used
+#if !WITH_FASP
+#define PRINT_NONE 0                        ///< Silent: no printout at all
+#define PRINT_MIN  1                        ///< Quiet: print error, important warnings
+#define PRINT_SOME 2                        ///< Some: print less important warnings
+#define PRINT_MORE 4                        ///< More: print some useful debug info
+#define PRINT_ALL  10                       ///< Everything: all printouts allowed
+#define MAX(a, b)  (((a) > (b)) ? (a) : (b)) ///< bigger one in a and b
+#define MIN(a, b)  (((a) < (b)) ? (a) : (b)) ///< smaller one in a and b
+#endif
+
 // Control consts
 const OCP_DBL MAX_TIME_STEP     = 365.0; ///< Maximal time stepsize
 const OCP_DBL MIN_TIME_STEP     = 0.01;  ///< Minimal time stepsize
@@ -77,6 +92,11 @@ const USI ORTHOGONAL_GRID = 1; ///< Grid type = orthogonal
 const USI CORNER_GRID     = 2; ///< Grid type = corner-point
 const USI GENERAL_GRID    = 3; ///< Grid type = general
 
+// Ordering of active grid cells
+const USI ORDER_NATURAL = 0; ///< Natural order of (i, j, k)
+const USI ORDER_RCM     = 1; ///< Reverse Cuthill-McKee order of connections
+const USI ORDER_HILBERT = 2; ///< Order along a Hilbert curve through (i, j, k)
+
 // Solution methods
 const USI IMPEC = 1; ///< Solution method = IMPEC
 const USI FIM   = 2; ///< Solution method = FIM
@@ -151,4 +171,7 @@ const USI Z_DIRECTION = 3; ///< z-direction
 /*  Chensong Zhang      Oct/27/2021      Unify error check                    */
 /*  Chensong Zhang      Jan/16/2022      Update Doxygen                       */
 /*  Chensong Zhang      Sep/21/2022      Add error messages                   */
+/*  OpenCAEPoro team    Oct/16/2026      Add print levels without FASP        */
+/*  OpenCAEPoro team    Oct/17/2026      Reorder active cells                 */
+/*  OpenCAEPoro team    Oct/17/2026      Add 64-bit global index option       */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
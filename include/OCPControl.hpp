@@ -16,6 +16,9 @@
 #include <vector>
 
 // OpenCAEPoro header files
+#include "AdaptiveTimeStep.hpp"
+#include "LinearSystem.hpp"
+#include "NonlinearAccel.hpp"
 #include "OCPConst.hpp"
 #include "ParamControl.hpp"
 #include "Reservoir.hpp"
@@ -81,11 +84,19 @@ public:
 
 public:
     OCP_BOOL activity{OCP_FALSE};
-    USI      method;        ///< IMPEC or FIM
-    OCP_DBL  timeInit;      ///< Maximum Init step length of next time step
-    OCP_DBL  timeMax;       ///< Maximum time step during running
-    OCP_DBL  timeMin;       ///< Minimum time step during running
-    USI      printLevel{0}; ///< Decide the depth for printing
+    USI      method;                    ///< IMPEC or FIM
+    OCP_DBL  timeInit;                  ///< Maximum Init step length of next time step
+    OCP_DBL  timeMax;                   ///< Maximum time step during running
+    OCP_DBL  timeMin;                   ///< Minimum time step during running
+    USI      printLevel{0};             ///< Decide the depth for printing
+    string   restartFile;               ///< Restart file to resume from
+    string   checkpointFile;            ///< Restart file written at each critical time
+    string   captureFile;               ///< File of captured linear systems
+    USI      captureBegin{0};           ///< First time step of captured systems
+    USI      captureEnd{0};             ///< Last time step of captured systems, 0: all
+    USI      dtControl{DTCTRL_CLASSIC}; ///< Mode of time step control
+    USI      nlSolver{NLSOLVER_NEWTON}; ///< Strategy of Newton iterations of FIM
+    OCP_BOOL profile{OCP_FALSE};        ///< If hot paths are timed and counted
 };
 
 /// All control parameters except for well controllers.
@@ -183,12 +194,46 @@ public:
     /// Return linear solver file name.
     string GetLsFile() const { return linearSolverFile; }
 
+    /// Return the restart file to resume from, empty if not restarted.
+    const string& GetRestartFile() const { return ctrlFast.restartFile; }
+
+    /// Return the restart file written at each critical time, empty if not written.
+    const string& GetCheckpointFile() const { return ctrlFast.checkpointFile; }
+
+    /// Return the index of critical time where simulation starts.
+    USI GetStartTStep() const { return startTstep; }
+
+    /// Write time, iteration information and the state of time step control to a
+    /// restart file.
+    void WriteRestart(ofstream& out) const;
+
+    /// Read time, iteration information and the state of time step control from a
+    /// restart file.
+    void ReadRestart(ifstream& in);
+
+    /// Append the linear system to the capture file if current time step is selected.
+    void CaptureLinearSystem(const LinearSystem& ls);
+
     // Check order is important
     OCP_BOOL Check(Reservoir& rs, initializer_list<string> il);
 
     // Calculate next time step
     void CalNextTimeStep(Reservoir& rs, initializer_list<string> il);
 
+    /// Cut current time step after a failure, where fac is the factor of the classic
+    /// control and byNR is true if Newton iterations fail to converge.
+    void CutTimeStep(const OCP_DBL& fac, const OCP_BOOL& byNR = OCP_FALSE);
+
+    /// Record the residual of current Newton iteration for time step control.
+    void RecordNRResidual(const OCPRes& res);
+
+    /// Return whether Newton iterations stall and the step should be cut early.
+    OCP_BOOL IfNRStalled() const { return dtCtrl.IfEnabled() && dtCtrl.IfStalled(); }
+
+private:
+    /// Print and discard the residuals of Newton iterations at the end of an attempt.
+    void ResetNRHistory();
+
 private:
     USI    model;            ///< model: ifThermal, isothermal
     USI    method;           ///< Discrete method
@@ -203,6 +248,9 @@ private:
     OCP_DBL last_dt;         ///< last time step
     OCP_DBL current_time{0}; ///< Current time
     OCP_DBL end_time;        ///< Next Critical time
+    USI     startTstep{0};   ///< Index of critical time where simulation starts
+
+    OCP_BOOL firstTime{OCP_TRUE}; ///< If true, no time step has been initialized
 
     OCP_DBL totalSimTime{0};            ///< Total simulation time
     OCP_DBL initTime{0};                ///< Initialize time
@@ -230,9 +278,12 @@ private:
     vector<ControlPreTime> ctrlPreTimeSet;
     ControlNR              ctrlNR;
     vector<ControlNR>      ctrlNRSet;
+    AdaptiveTimeStep       dtCtrl;  ///< Adaptive control of time steps
+    NonlinearAccel         nlAccel; ///< Strategy of Newton iterations
 
     // Receive directly from command lines, which will overwrite others
     FastControl ctrlFast;
+    ofstream    captureOut; ///< Stream of captured linear systems
 
     // Well
     OCP_BOOL wellChange; ///< if wells change, then OCP_FALSE
@@ -248,4 +299,10 @@ private:
 /*  Shizhe Li           Oct/01/2021      Create file                          */
 /*  Chensong Zhang      Oct/15/2021      Format file                          */
 /*  Chensong Zhang      Jan/08/2022      Update Doxygen                       */
+/*  OpenCAEPoro team    Oct/16/2026      Add restart                          */
+/*  OpenCAEPoro team    Oct/16/2026      Capture linear systems               */
+/*  OpenCAEPoro team    Oct/16/2026      Add adaptive time step control       */
+/*  OpenCAEPoro team    Oct/16/2026      Add nonlinear strategies             */
+/*  OpenCAEPoro team    Oct/17/2026      Add run-time switch of profiler      */
+/*  OpenCAEPoro team    Oct/17/2026      Save controller state in restart     */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
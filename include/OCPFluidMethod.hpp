@@ -17,6 +17,7 @@
 #include "OCPControl.hpp"
 #include "Reservoir.hpp"
 #include "UtilOutput.hpp"
+#include "UtilProfiler.hpp"
 #include "UtilTiming.hpp"
 
 class IsothermalMethod
@@ -107,7 +108,7 @@ public:
     /// Assemble Matrix
     void AssembleMat(LinearSystem& ls, const Reservoir& rs, const OCP_DBL& dt) const;
     /// Solve the linear system.
-    void SolveLinearSystem(LinearSystem& ls, Reservoir& rs, OCPControl& ctrl) const;
+    void SolveLinearSystem(LinearSystem& ls, Reservoir& rs, OCPControl& ctrl);
     /// Update properties of fluids.
     OCP_BOOL UpdateProperty(Reservoir& rs, OCPControl& ctrl);
     /// Finish a Newton-Raphson iteration.
@@ -174,6 +175,23 @@ private:
     /// Update P, Ni, BHP after linear system is solved
     void
     GetSolution(Reservoir& rs, const vector<OCP_DBL>& u, const OCPControl& ctrl) const;
+    /// Save the iterate and the update u before the update is applied.
+    void SaveIterate(const Reservoir& rs, const vector<OCP_DBL>& u);
+    /// Apply a fraction of the saved update to the saved iterate.
+    void RetryIterate(Reservoir& rs, const OCP_DBL& lambda, const OCPControl& ctrl);
+    /// Calculate the scales of unknowns in u used to mix updates.
+    const vector<OCP_DBL>& CalUpdateWeight(const Reservoir&        rs,
+                                           const vector<OCP_DBL>& u,
+                                           const OCPControl&      ctrl);
+    /// Return the update of unknowns applied after chops.
+    const vector<OCP_DBL>& GetAppliedUpdate(const Reservoir&        rs,
+                                            const vector<OCP_DBL>& u);
+
+private:
+    vector<char>    itState; ///< States of bulks before the update
+    vector<OCP_DBL> itBHP;   ///< BHP of open wells before the update
+    vector<OCP_DBL> itU;     ///< Update of unknowns from linear system
+    vector<OCP_DBL> itWork;  ///< Scales or applied fractions of update of unknowns
 };
 
 class IsoT_FIMn : protected IsoT_FIM
@@ -224,10 +242,6 @@ protected:
     /// Update P, Ni, BHP after linear system is solved
     void
     GetSolution(Reservoir& rs, const vector<OCP_DBL>& u, const OCPControl& ctrl) const;
-    /// Reset variables to last time step
-    void ResetToLastTimeStep(Reservoir& rs, OCPControl& ctrl);
-    /// Update values of last step for FIMn
-    void UpdateLastTimeStep(Reservoir& rs) const;
 };
 
 class IsoT_AIMc : protected IsoT_IMPEC, protected IsoT_FIM
@@ -288,4 +302,5 @@ protected:
 /*----------------------------------------------------------------------------*/
 /*  Shizhe Li           Oct/01/2021      Create file                          */
 /*  Chensong Zhang      Oct/15/2021      Format file                          */
+/*  OpenCAEPoro team    Oct/16/2026      Add nonlinear strategies to FIM      */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
@@ -22,12 +22,9 @@
 #include "ParamOutput.hpp"
 #include "Reservoir.hpp"
 #include "UtilOutput.hpp"
+#include "UtilProfiler.hpp"
 #include "UtilTiming.hpp"
 
-#ifdef USE_METIS
-#include "metis.h"
-#endif
-
 using namespace std;
 
 /// 3D coordinate representation in OpenCAEPoro
@@ -74,8 +71,7 @@ public:
     }
     OCP_BOOL  activity{OCP_FALSE};
     vector<T> obj;
-    vector<USI>
-        index; ///< Records the index of bulk or well, whose properties will be printed
+    vector<OCP_INT> index; ///< Index of bulks or wells to print, -1 for bulks of others
 };
 
 /// The SumItem class is an auxiliary structure storing summary data to output.
@@ -290,142 +286,50 @@ public:
     void InputParam(const OutputVTKParam& VTKParam);
     void Setup(const string& dir, const Reservoir& rs, const USI& ndates);
     void PrintVTK(const string& dir, const Reservoir& rs, const OCP_DBL& days) const;
+    /// Wait until files written in background are finished.
+    void     Finish() const { out4vtu.Finish(); }
     OCP_BOOL IfOutputVTK() const { return useVTK; }
 
 private:
-    OCP_BOOL          useVTK{OCP_FALSE}; ///< If use vtk
-    mutable USI       index{0};          ///< Index of output file
-    BasicGridProperty bgp;               ///< Basic grid information
-    Output4Vtk        out4vtk;           ///< Output for vtk
-
-    // test for Parallel version
-#ifdef USE_METIS
-    mutable class MyMetisTest
-    {
-        friend class Out4VTK;
-
-    private:
-        OCP_BOOL useMetis{OCP_FALSE};
-
-        OCP_USI nb;
-        OCP_USI nw;
-        OCP_USI ng;
-
-        mutable idx_t         nvtxs;
-        mutable idx_t         nedges;
-        mutable idx_t         ncon{1};
-        mutable idx_t         nparts{8};
-        mutable vector<idx_t> xadj;
-        mutable vector<idx_t> adjncy;
-        mutable vector<idx_t> adjwgt;
-        mutable vector<idx_t> vwgt;
-        mutable vector<idx_t> part;
-        mutable vector<USI>   partitions;
-        const idx_t           MAXWEIGHT = 100000000;
-
-    public:
-        void Setup(const Reservoir& rs)
-        {
-            if (!useMetis) return;
-            nb = rs.GetBulkNum();
-            nw = rs.GetWellNum();
-            ng = rs.grid.GetGridNum();
-
-            nvtxs                           = nb + nw;
-            nedges                          = 0;
-            vector<vector<OCP_USI>> tmpConn = rs.conn.neighbor;
-            vector<OCP_USI>         tmp;
-            for (USI w = 0; w < rs.allWells.numWell; w++) {
-                tmp.clear();
-                for (USI p = 0; p < rs.allWells.GetWellPerfNum(w); p++) {
-                    OCP_USI n = rs.allWells.wells[w].PerfLocation(p);
-                    tmpConn[n].push_back(nb + w);
-                    tmp.push_back(n);
-                }
-                tmpConn.push_back(tmp);
-                nedges += rs.allWells.GetWellPerfNum(w) * 2;
-            }
-
-            const vector<vector<OCP_USI>>& myConn = tmpConn;
-
-            for (OCP_USI n = 0; n < nb; n++) {
-                nedges += rs.conn.neighborNum[n];
-            }
-            nedges -= nb;
-
-            // generate xadj  adjncy  adjwgt
-            xadj.resize(nvtxs + 1);
-            xadj[0] = 0;
-            adjncy.reserve(nedges);
-            adjwgt.reserve(nedges);
-            // Bulk
-            for (OCP_USI n = 0; n < nb; n++) {
-                xadj[n + 1] = xadj[n] + myConn[n].size() - 1;
-                USI i       = 0;
-                // left
-                for (i = 0; i < rs.conn.selfPtr[n]; i++) {
-                    adjncy.push_back(myConn[n][i]);
-                    adjwgt.push_back(1);
-                }
-                // right
-                for (i = rs.conn.selfPtr[n] + 1; i < rs.conn.neighborNum[n]; i++) {
-                    adjncy.push_back(myConn[n][i]);
-                    adjwgt.push_back(1);
-                }
-                // well
-                for (i = rs.conn.neighborNum[n]; i < myConn[n].size(); i++) {
-                    adjncy.push_back(myConn[n][i]);
-                    adjwgt.push_back(MAXWEIGHT);
-                }
-            }
-            // Well
-            for (USI w = 0; w < nw; w++) {
-                xadj[nb + w + 1] += xadj[nb + w] + myConn[nb + w].size();
-                for (auto v : myConn[nb + w]) {
-                    adjncy.push_back(v);
-                    adjwgt.push_back(MAXWEIGHT);
-                }
-            }
-            // Setup active/inactive grid flags
-            // inactive grids' flags equal nparts
-            part.resize(nvtxs, 0);
-            partitions.resize(ng + nw, nparts);
-        }
-
-        void MyPartitionFunc(decltype(METIS_PartGraphKway)* METIS_PartGraphFunc) const
-        {
-
-            if (!useMetis) return;
-            idx_t objval;
-            int   ret = METIS_PartGraphFunc(&nvtxs, &ncon, xadj.data(), adjncy.data(),
-                                            vwgt.data(), NULL, adjwgt.data(), &nparts,
-                                            NULL, NULL, NULL, &objval, part.data());
-
-            if (ret != rstatus_et::METIS_OK) {
-                OCP_ABORT("METIS ERROR");
-            }
-            cout << "METIS_OK" << endl;
-            cout << "objval: " << objval << endl;
-        }
+    /// Output cell data to the vtk file or the snapshot of vtu file.
+    template <typename T>
+    void PrintCellData(const string&          file,
+                       const string&          dataName,
+                       const string&          dataType,
+                       const T*               gridVal,
+                       const USI&             gap,
+                       const vector<GB_Pair>& gbPair,
+                       const bool&            useActive,
+                       const T*               wellVal) const;
 
-        void SetPartitions(const vector<USI> b2g) const
-        {
-            if (!useMetis) return;
-            // bulk
-            OCP_USI n = 0;
-            for (n = 0; n < nb; n++) {
-                partitions[b2g[n]] = part[n];
-            }
-            // well
-            for (USI w = 0; w < nw; w++) {
-                partitions[ng + w] = part[n];
-                n++;
-            }
-        }
-    } metisTest;
-#endif // USE_METIS
+private:
+    OCP_BOOL           useVTK{OCP_FALSE};     ///< If use vtk
+    OCP_BOOL           useVTU{OCP_FALSE};     ///< If use binary vtu instead of vtk
+    OCP_BOOL           useFloat32{OCP_FALSE}; ///< If values of vtu are float32
+    mutable USI        index{0};              ///< Index of output file
+    BasicGridProperty  bgp;                   ///< Basic grid information
+    Output4Vtk         out4vtk;               ///< Output for vtk
+    mutable Output4Vtu out4vtu;               ///< Output for vtu
 };
 
+template <typename T>
+void Out4VTK::PrintCellData(const string&          file,
+                            const string&          dataName,
+                            const string&          dataType,
+                            const T*               gridVal,
+                            const USI&             gap,
+                            const vector<GB_Pair>& gbPair,
+                            const bool&            useActive,
+                            const T*               wellVal) const
+{
+    if (useVTU) {
+        out4vtu.AddCellData(dataName, gridVal, gap, gbPair, useActive, wellVal);
+    } else {
+        out4vtk.OutputCELL_DATA_SCALARS(file, dataName, dataType, gridVal, gap, gbPair,
+                                        useActive, wellVal);
+    }
+}
+
 /// The OCPOutput class manages different kinds of ways to output information.
 //  Note: The most commonly used is the summary file, which usually gives the
 //  information of bulks and wells in each time step, such as average pressure, oil
@@ -466,4 +370,6 @@ private:
 /*  Shizhe Li           Oct/01/2021      Create file                          */
 /*  Chensong Zhang      Oct/15/2021      Format file                          */
 /*  Chensong Zhang      Jan/08/2022      Update Doxygen                       */
+/*  OpenCAEPoro team    Oct/16/2026      Add binary and asynchronous VTU      */
+/*  OpenCAEPoro team    Oct/17/2026      Distribute FIM among MPI processes   */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
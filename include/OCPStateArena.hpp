@@ -0,0 +1,167 @@
+/*! \file    OCPStateArena.hpp
+ *  \brief   Contiguous storage of state arrays at current and last time step
+ *  \author  OpenCAEPoro team
+ *  \date    Oct/16/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the OpenCAEPoro team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+#ifndef __OCPSTATEARENA_HEADER__
+#define __OCPSTATEARENA_HEADER__
+
+// Standard header files
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+// OpenCAEPoro header files
+#include "OCPConst.hpp"
+#include "UtilError.hpp"
+#include "UtilRestart.hpp"
+
+using namespace std;
+
+class Partition;
+
+/// Base of arrays whose memory is managed by OCPStateArena.
+class OCPArrayBase
+{
+    friend class OCPStateArena;
+
+protected:
+    char*   addr{nullptr}; ///< Address of the first entry
+    OCP_USI num{0};        ///< Num of entries
+};
+
+/// Array whose entries live in an OCPStateArena, it is used like a fixed-size vector.
+template <typename T>
+class OCPArray : public OCPArrayBase
+{
+public:
+    OCPArray() = default;
+    OCPArray(const OCPArray&) = delete;
+    /// Copy the entries of an array with the same size.
+    OCPArray& operator=(const OCPArray& src)
+    {
+        OCP_ASSERT(num == src.num, "Wrong Size");
+        if (this != &src) copy(src.begin(), src.end(), begin());
+        return *this;
+    }
+
+    T&       operator[](const OCP_USI& i) { return data()[i]; }
+    const T& operator[](const OCP_USI& i) const { return data()[i]; }
+    T*       data() { return reinterpret_cast<T*>(addr); }
+    const T* data() const { return reinterpret_cast<const T*>(addr); }
+    OCP_USI  size() const { return num; }
+    T*       begin() { return data(); }
+    T*       end() { return data() + num; }
+    const T* begin() const { return data(); }
+    const T* end() const { return data() + num; }
+};
+
+/// Arrays of a state arena are stored in groups, and only the arrays in ROLLBACK_STATE
+/// are restored when a time step is repeated.
+enum OCPStateType : USI {
+    ROLLBACK_STATE = 0, ///< saved at the end of time step and restored if repeated
+    SAVED_STATE    = 1, ///< saved at the end of time step only
+    CURRENT_STATE  = 2  ///< no copy at last time step
+};
+
+/// Contiguous, cache-aligned storage of state arrays at current and last time step.
+//  Note: Arrays are registered with their sizes, then Setup() lays them out in one
+//  block. Current arrays of ROLLBACK_STATE and SAVED_STATE come first and their copies
+//  at last time step follow with the same layout, so saving and restoring a time step
+//  are both a single memcpy.
+class OCPStateArena
+{
+public:
+    /// Register an array and its copy at last time step.
+    template <typename T>
+    void Add(OCPArray<T>&        cur,
+             OCPArray<T>&        last,
+             const OCP_USI&      n,
+             const OCPStateType& type = ROLLBACK_STATE)
+    {
+        Add(&cur, &last, n, sizeof(T), type);
+    }
+    /// Register an array without copy at last time step.
+    template <typename T>
+    void Add(OCPArray<T>& cur, const OCP_USI& n)
+    {
+        Add(&cur, nullptr, n, sizeof(T), CURRENT_STATE);
+    }
+    /// Lay out all registered arrays in one block, entries already set are kept.
+    void Setup();
+    /// Copy the current states to the states at last time step.
+    void SaveState()
+    {
+        if (saveBytes > 0) memcpy(lastBase, curBase, saveBytes);
+    }
+    /// Copy the states at last time step back to the current states.
+    void RestoreState()
+    {
+        if (restoreBytes > 0) memcpy(curBase, lastBase, restoreBytes);
+    }
+    /// Copy the current states which are restored by RestoreState() to buf.
+    void CopyState(vector<char>& buf) const
+    {
+        buf.assign(curBase, curBase + restoreBytes);
+    }
+    /// Copy the states in buf from CopyState() back to the current states.
+    void PasteState(const vector<char>& buf)
+    {
+        OCP_ASSERT(buf.size() == restoreBytes, "Wrong Size");
+        if (restoreBytes > 0) memcpy(curBase, buf.data(), restoreBytes);
+    }
+    /// Receive the current states of ghost bulks from their owners, all arrays are
+    /// sized by multiples of nb bulks.
+    void ExchangeGhost(const Partition& part, const OCP_USI& nb) const;
+    /// Write current states and states at last time step to a restart file.
+    void WriteRestart(ofstream& out) const;
+    /// Read current states and states at last time step from a restart file.
+    void ReadRestart(ifstream& in);
+
+protected:
+    /// Register an array, an array registered again takes the new size and type.
+    void Add(OCPArrayBase*       cur,
+             OCPArrayBase*       last,
+             const OCP_USI&      n,
+             const size_t&       elemSize,
+             const OCPStateType& type);
+
+protected:
+    /// Descriptor of a registered array.
+    struct ArrayDesc {
+        OCPArrayBase* cur;      ///< current array
+        OCPArrayBase* last;     ///< array at last time step, nullptr if CURRENT_STATE
+        OCP_USI       num;      ///< num of entries
+        size_t        elemSize; ///< size of an entry in bytes
+        OCPStateType  type;     ///< type of state
+        size_t        offset;   ///< offset of current array in the block
+    };
+    static const size_t ALIGNMENT = 64; ///< Alignment of each array (cache line)
+
+    vector<ArrayDesc> desc;              ///< Descriptors of registered arrays
+    vector<char>      buffer;            ///< Memory of all arrays
+    char*             curBase{nullptr};  ///< Beginning of current states
+    char*             lastBase{nullptr}; ///< Beginning of states at last time step
+    size_t            saveBytes{0};      ///< Bytes copied by SaveState
+    size_t            restoreBytes{0};   ///< Bytes copied by RestoreState
+    size_t            allBytes{0};       ///< Bytes of current and last states
+};
+
+#endif /* end if __OCPSTATEARENA_HEADER__ */
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  OpenCAEPoro team    Oct/16/2026      Create file                          */
+/*  OpenCAEPoro team    Oct/16/2026      Add restart                          */
+/*  OpenCAEPoro team    Oct/16/2026      Copy states of Newton iterations     */
+/*  OpenCAEPoro team    Oct/17/2026      Distribute FIM among MPI processes   */
+/*----------------------------------------------------------------------------*/
@@ -23,15 +23,16 @@ using namespace std;
 
 /// OCPTable is a Table class, which used to deal with everything about table
 /// in OpenCAEPoro such as PVT table, saturation table.
+//  Note: Columns are stored contiguously one after another. A table is not modified
+//  by interpolation, so it can be shared by threads. Rows are located by binary
+//  search, or directly if the column is uniformly spaced. A cursor owned by caller
+//  can be given as a hint, it is checked first and then updated.
 class OCPTable
 {
 public:
     /// Default constructor.
     OCPTable() = default;
 
-    /// Construct a table of fixed size.
-    OCPTable(const USI& row, const USI& col);
-
     /// Construct from existing data
     OCPTable(const vector<vector<OCP_DBL>>& src);
 
@@ -44,56 +45,92 @@ public:
     /// return the column num of table.
     USI GetColNum() const { return nCol; }
 
+    /// return the row num of table.
+    USI GetRowNum() const { return nRow; }
+
     /// return the row index of the last zero of some colnum, which is sorted in
     /// increasing order.
     OCP_INT GetRowZero(const USI& mycol) const;
 
-    /// push v into the last column of table.
-    void PushCol(const vector<OCP_DBL>& v) { data.push_back(v); }
+    /// push v into the last column of table, call SetRowCol() after all columns.
+    void PushCol(const vector<OCP_DBL>& v);
 
-    /// return the jth column in table to modify or use.
-    vector<OCP_DBL>& GetCol(const USI& j) { return data[j]; }
-
-    /// Setup row nums and col nums of tables, initialize the bId.
-    void SetRowCol()
+    /// return a copy of the jth column in table.
+    vector<OCP_DBL> GetCol(const USI& j) const
     {
-        nRow = data[0].size();
-        nCol = data.size();
-        bId  = nRow / 2;
+        return vector<OCP_DBL>(data.begin() + j * nRow,
+                               data.begin() + (j + 1) * nRow);
     }
 
+    /// Setup row nums and col nums of tables, find uniformly spaced columns.
+    void SetRowCol();
+
     /// interpolate the specified monotonically increasing column in table to evaluate
     /// all columns and return slope
     USI Eval_All(const USI&       j,
                  const OCP_DBL&   val,
                  vector<OCP_DBL>& outdata,
-                 vector<OCP_DBL>& slope);
+                 vector<OCP_DBL>& slope,
+                 USI*             hint = nullptr) const
+    {
+        return Eval_All(j, val, outdata.data(), slope.data(), hint);
+    }
+
+    /// interpolate the specified monotonically increasing column in table to evaluate
+    /// all columns into outdata and slope of caller, which hold nCol values at least.
+    USI Eval_All(const USI&     j,
+                 const OCP_DBL& val,
+                 OCP_DBL*       outdata,
+                 OCP_DBL*       slope,
+                 USI*           hint = nullptr) const;
 
     /// interpolate the specified monotonically increasing column in table to evaluate
     /// all columns, j = 0 here and index of returning date begins from 1
-    USI Eval_All0(const OCP_DBL& val, vector<OCP_DBL>& outdata);
+    USI Eval_All0(const OCP_DBL&   val,
+                  vector<OCP_DBL>& outdata,
+                  USI*             hint = nullptr) const;
 
     /// interpolate the specified monotonically increasing column in table to evaluate
     /// the target column.
-    OCP_DBL Eval(const USI& j, const OCP_DBL& val, const USI& destj);
+    OCP_DBL Eval(const USI&     j,
+                 const OCP_DBL& val,
+                 const USI&     destj,
+                 USI*           hint = nullptr) const;
 
     /// interpolate the specified monotonically increasing column in table to evaluate
     /// the target column, and return corresponding slope.
-    OCP_DBL Eval(const USI& j, const OCP_DBL& val, const USI& destj, OCP_DBL& myK);
+    OCP_DBL Eval(const USI&     j,
+                 const OCP_DBL& val,
+                 const USI&     destj,
+                 OCP_DBL&       myK,
+                 USI*           hint = nullptr) const;
+
+    /// interpolate the specified monotonically increasing column in table to evaluate
+    /// the target column at n values, slope is returned if it is not nullptr.
+    void EvalBatch(const USI&     j,
+                   const OCP_USI& n,
+                   const OCP_DBL* val,
+                   const USI&     destj,
+                   OCP_DBL*       out,
+                   OCP_DBL*       slope = nullptr) const;
 
     /// interpolate the specified monotonically decreasing column in table to evaluate
     /// the target column.
-
-    OCP_DBL Eval_Inv(const USI& j, const OCP_DBL& val, const USI& destj);
+    OCP_DBL Eval_Inv(const USI& j, const OCP_DBL& val, const USI& destj) const;
 
     /// Display the data of table on screen.
     void Display() const;
 
 private:
-    USI                     nRow; ///< number of rows of the table
-    USI                     nCol; ///< number of columns of the table
-    USI                     bId;  ///< the starting point of rows when interpolating
-    vector<vector<OCP_DBL>> data; ///< data of the table, data[i] is the ith column.
+    /// Return the row i with col j in [i, i+1), -1 if val is below the column and
+    /// nRow-1 if val is above it.
+    OCP_INT Locate(const USI& j, const OCP_DBL& val, USI* hint) const;
+
+private:
+    USI             nRow{0}; ///< number of rows of the table
+    USI             nCol{0}; ///< number of columns of the table
+    vector<OCP_DBL> data;    ///< data of the table, the jth column begins at j*nRow.
+    vector<OCP_DBL> invStep; ///< inverse of spacing of uniform columns, 0 otherwise.
 };
 
 #endif /* end if __OCP_TABLE_HEADER__ */
@@ -105,4 +142,6 @@ private:
 /*----------------------------------------------------------------------------*/
 /*  Shizhe Li           Oct/01/2021      Create file                          */
 /*  Chensong Zhang      Oct/15/2021      Format file                          */
+/*  OpenCAEPoro team    Oct/16/2026      Stateless lookup with hints          */
+/*  OpenCAEPoro team    Oct/17/2026      Interpolate into scratch of callers  */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
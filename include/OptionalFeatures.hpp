@@ -38,6 +38,16 @@ public:
         skipStaAnaly.UpdateLastTimeStep();
         miscible.UpdateLastTimeStep();
     }
+    void WriteRestart(ofstream& out) const
+    {
+        skipStaAnaly.WriteRestart(out);
+        miscible.WriteRestart(out);
+    }
+    void ReadRestart(ifstream& in)
+    {
+        skipStaAnaly.ReadRestart(in);
+        miscible.ReadRestart(in);
+    }
 
     /////////////////////////////////////////////////////////////////////
     // Accelerate PVT
@@ -63,4 +73,5 @@ protected:
 /*  Author              Date             Actions                              */
 /*----------------------------------------------------------------------------*/
 /*  Shizhe Li           Dec/25/2022      Create file                          */
+/*  OpenCAEPoro team    Oct/16/2026      Add restart                          */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
@@ -12,8 +12,11 @@
 #ifndef __OUTPUT4VTK_HEADER__
 #define __OUTPUT4VTK_HEADER__
 
+#include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "Grid.hpp"
@@ -48,6 +51,13 @@ const VTK_USI VTK_POLY_LINE  = 4;
 const string VTK_FLOAT        = "float";
 const string VTK_UNSIGNED_INT = "unsigned_int";
 
+// Types of VTK XML format
+const string VTU_FLOAT32 = "Float32";
+const string VTU_FLOAT64 = "Float64";
+const string VTU_INT32   = "Int32";
+const string VTU_INT64   = "Int64";
+const string VTU_UINT8   = "UInt8";
+
 class Output4Vtk
 {
     friend class Out4VTK;
@@ -66,9 +76,7 @@ public:
     void OutputCELLS(const string&                myFile,
                      const vector<OCPpolyhedron>& myHexGrid,
                      const vector<OCPpolyhedron>& myHexWell) const;
-    void OutputCELL_TYPES(const string&                myFile,
-                          const vector<OCPpolyhedron>& myHex,
-                          const vector<OCPpolyhedron>& myHexWell) const;
+    void OutputCELL_TYPES(const string& myFile) const;
     template <typename T>
     void OutputCELL_DATA_SCALARS(const string&          myFile,
                                  const string&          dataName,
@@ -138,6 +146,124 @@ void Output4Vtk::OutputCELL_DATA_SCALARS(const string&          myFile,
     myVtk.close();
 }
 
+/// Cell data of a binary VTU file at one time, encoded before it is written.
+class VtuSnapshot
+{
+    friend class Output4Vtu;
+
+private:
+    string       file;    ///< Name of VTU file
+    OCP_DBL      days;    ///< Simulation time
+    string       dataXml; ///< Descriptions of cell data
+    vector<char> data;    ///< Appended data of cell data
+};
+
+/// Output reservoir information in binary VTU files (VTK XML format).
+//  Note: Geometry of grids and wells is encoded once in Setup, with shared corners
+//  stored once, and copied into each file. So a time step only encodes its cell data
+//  as raw appended float32 or float64 values. Snapshots are double-buffered: one is
+//  filled in the time loop while the last one is written on a background thread, whose
+//  errors are raised on the main thread when it is joined. A PVD file lists the files
+//  with times.
+class Output4Vtu
+{
+public:
+    ~Output4Vtu()
+    {
+        if (writer.joinable()) writer.join();
+    }
+    /// Encode the geometry, PVD file pvdFile will list the VTU files.
+    void Setup(const string&                pvdFile,
+               const vector<OCPpolyhedron>& myHexGrid,
+               const vector<OCPpolyhedron>& myHexWell,
+               const vector<USI>&           gridTag,
+               const OCP_BOOL&              float32);
+    /// Begin a snapshot which will be written to myFile at time days.
+    void BeginSnapshot(const string& myFile, const OCP_DBL& days);
+    /// Add cell data to current snapshot, inactive grids take 0.
+    template <typename T>
+    void AddCellData(const string&          dataName,
+                     const T*               gridVal,
+                     const USI&             gap,
+                     const vector<GB_Pair>& gbPair,
+                     const bool&            useActive,
+                     const T*               wellVal);
+    /// Write current snapshot on the background thread.
+    void EndSnapshot();
+    /// Wait until all snapshots have been written, abort if one of them fails.
+    void Finish();
+
+private:
+    /// Write a snapshot and the PVD file, it runs on the background thread and
+    /// records a failure in writeError.
+    void WriteSnapshot(const VtuSnapshot& snap, const string& pvd);
+    /// Append an array of n values with its size in bytes to data.
+    template <typename T>
+    static void Append(vector<char>& data, const T* val, const size_t& n);
+    /// Return the description of an appended array.
+    static string DataArrayXml(const string& type,
+                               const string& dataName,
+                               const USI&    numCom,
+                               const size_t& offset);
+
+private:
+    VTK_USI         numGrid;    ///< Num of grids
+    VTK_USI         numWell;    ///< Num of wells
+    VTK_USI         numCell;    ///< Num of cells: grids and wells
+    OCP_BOOL        useFloat32; ///< If values are written in float32
+    string          pvdName;    ///< Name of PVD file
+    string          pvdItems;   ///< Items of VTU files in PVD file
+    string          headXml;    ///< Description of file before time
+    string          pieceXml;   ///< Descriptions of geometry and static cell data
+    vector<char>    geomData;   ///< Appended data of geometry and static cell data
+    VtuSnapshot     snap[2];    ///< Double-buffered snapshots
+    USI             cur{0};     ///< Index of snapshot being filled
+    vector<OCP_DBL> val;        ///< Values of cells of current cell data
+    thread          writer;     ///< Background thread writing snapshots
+    string          writeError; ///< Failure of the background thread, empty if none
+};
+
+template <typename T>
+void Output4Vtu::Append(vector<char>& data, const T* val, const size_t& n)
+{
+    const uint64_t bytes = n * sizeof(T);
+    const size_t   len   = data.size();
+    data.resize(len + sizeof(bytes) + bytes);
+    memcpy(&data[len], &bytes, sizeof(bytes));
+    if (bytes > 0) memcpy(&data[len + sizeof(bytes)], val, bytes);
+}
+
+template <typename T>
+void Output4Vtu::AddCellData(const string&          dataName,
+                             const T*               gridVal,
+                             const USI&             gap,
+                             const vector<GB_Pair>& gbPair,
+                             const bool&            useActive,
+                             const T*               wellVal)
+{
+    VtuSnapshot& sp = snap[cur];
+
+    val.resize(numCell);
+    if (useActive) {
+        for (VTK_USI n = 0; n < numGrid; n++) {
+            val[n] = gbPair[n].IsAct() ? gridVal[gbPair[n].GetId() * gap] : 0;
+        }
+    } else {
+        for (VTK_USI n = 0; n < numGrid; n++) val[n] = gridVal[n * gap];
+    }
+    for (USI w = 0; w < numWell; w++) val[numGrid + w] = wellVal[w];
+
+    const size_t offset = geomData.size() + sp.data.size();
+    if (useFloat32) {
+        const vector<float> tmp(val.begin(), val.end());
+        Append(sp.data, tmp.data(), numCell);
+        sp.dataXml += DataArrayXml(VTU_FLOAT32, dataName, 1, offset);
+    } else {
+        Append(sp.data, val.data(), numCell);
+        sp.dataXml += DataArrayXml(VTU_FLOAT64, dataName, 1, offset);
+    }
+}
+
 #endif
 
 /*----------------------------------------------------------------------------*/
@@ -147,4 +273,6 @@ void Output4Vtk::OutputCELL_DATA_SCALARS(const string&          myFile,
 /*----------------------------------------------------------------------------*/
 /*  Shizhe Li           Oct/19/2022      Create file                          */
 /*  Chensong Zhang      Feb/05/2023      Update output in vtk files           */
+/*  OpenCAEPoro team    Oct/16/2026      Add binary and asynchronous VTU      */
+/*  OpenCAEPoro team    Oct/17/2026      Raise VTU errors on main thread      */
 /*----------------------------------------------------------------------------*/
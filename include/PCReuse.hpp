@@ -0,0 +1,109 @@
+/*! \file    PCReuse.hpp
+ *  \brief   Policy of reusing the setup of preconditioners between linear solves
+ *  \author  OpenCAEPoro team
+ *  \date    Oct/16/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the OpenCAEPoro team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+#ifndef __PCREUSE_HEADER__
+#define __PCREUSE_HEADER__
+
+// Standard header files
+#include <iostream>
+#include <string>
+
+// OpenCAEPoro header files
+#include "OCPConst.hpp"
+
+using namespace std;
+
+/// Params of setup reuse, which are read from the parameter file of linear solvers.
+//  Note: Only the lines "key = value" of the keys below are used, others are skipped.
+class PCReuseParam
+{
+public:
+    /// Read params from file, return OCP_FALSE if the file can not be opened.
+    OCP_BOOL Read(const string& file);
+
+public:
+    USI     maxReuse{0};   ///< PC_reuse_max: max num of solves sharing a setup, 0: off
+    OCP_DBL degrade{1.5};  ///< PC_reuse_degrade: allowed ratio of iterations
+    USI     slack{5};      ///< PC_reuse_slack: iterations allowed above the ratio
+    USI     printLevel{0}; ///< print_level: records are printed if it is above 1
+};
+
+/// PCReuse decides whether the setup of a preconditioner, such as decoupling matrices,
+/// ILU factors and AMG hierarchies, is rebuilt or reused in next linear solve.
+//  Note: The iterations of the first solve after a rebuild are the reference. The
+//  setup is rebuilt if the pattern changes, it has been used by maxReuse solves, or
+//  last solve fails or takes more than degrade * reference + slack iterations. As the
+//  tolerance is fixed, the latter means its convergence rate per iteration degrades.
+//  A solve failing with a reused setup is retried at once with a fresh setup, so only
+//  failures of fresh setups are reported to the nonlinear iterations.
+//  Only the usage of current setup is recorded, it is printed when the setup is rebuilt
+//  if print_level is above 1.
+class PCReuse
+{
+public:
+    /// Usage of a setup.
+    struct Record {
+        OCP_DBL setupTime{0}; ///< Time of the setup in ms
+        OCP_DBL solveTime{0}; ///< Time of solves using the setup in ms
+        USI     numSolve{0};  ///< Num of solves using the setup
+        USI     numIter{0};   ///< Num of iterations of solves using the setup
+    };
+
+    /// Set the params of reuse.
+    void SetupParam(const PCReuseParam& p) { param = p; }
+    /// Return whether setups could be reused.
+    OCP_BOOL IfEnabled() const { return param.maxReuse > 1; }
+    /// Discard current setup, which is rebuilt in next solve.
+    void Reset() { rebuild = OCP_TRUE; }
+    /// Return whether the setup should be rebuilt for a system of dim rows and nnz
+    /// nonzeros, a change of dimensions means a change of pattern.
+    OCP_BOOL IfRebuild(const OCP_USI& dim, const OCP_USI& nnz);
+    /// Return the max iterations of next solve before its setup is considered to be
+    /// degraded, 0 if next solve should rebuild it.
+    USI GetIterLimit() const;
+    /// Record the time of a setup in ms, it begins a new record.
+    void RecordSetup(const OCP_DBL& time);
+    /// Record the status and the time of a solve in ms, where status is the num of
+    /// iterations or negative if it fails. Return OCP_TRUE if the solve fails with a
+    /// reused setup, then it should be retried with a rebuilt one.
+    OCP_BOOL RecordSolve(const OCP_INT& status, const OCP_DBL& time);
+    /// Return the record of current setup.
+    const Record& GetRecord() const { return record; }
+    /// Return the setup time of last solve in ms, 0 if it reuses a setup.
+    OCP_DBL GetLastSetupTime() const
+    {
+        return record.numSolve == 1 ? record.setupTime : 0;
+    }
+
+protected:
+    /// Print a record of setup.
+    void PrintRecord(const Record& rec) const;
+
+protected:
+    PCReuseParam param;      ///< Params of reuse
+    OCP_BOOL     rebuild{1}; ///< If next solve should rebuild the setup
+    OCP_USI      lastDim{0}; ///< Num of rows of last setup
+    OCP_USI      lastNnz{0}; ///< Num of nonzeros of last setup
+    USI          refIter{0}; ///< Iterations of the first solve after last setup
+    Record       record;     ///< Record of current setup
+};
+
+#endif /* end if __PCREUSE_HEADER__ */
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  OpenCAEPoro team    Oct/16/2026      Create file                          */
+/*  OpenCAEPoro team    Oct/17/2026      Retry failed solves with a new setup */
+/*  OpenCAEPoro team    Oct/17/2026      Keep only the record of current setup*/
+/*----------------------------------------------------------------------------*/
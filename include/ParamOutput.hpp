@@ -127,6 +127,8 @@ class OutputVTKParam
 {
 public:
     OCP_BOOL               useVTK{OCP_FALSE};
+    OCP_BOOL               useVTU{OCP_FALSE};     ///< Binary VTU instead of ASCII VTK
+    OCP_BOOL               useFloat32{OCP_FALSE}; ///< Values of VTU in float32
     BasicGridPropertyParam bgp;
 };
 
@@ -166,4 +168,5 @@ public:
 /*----------------------------------------------------------------------------*/
 /*  Shizhe Li           Oct/01/2021      Create file                          */
 /*  Chensong Zhang      Oct/15/2021      Format file                          */
+/*  OpenCAEPoro team    Oct/16/2026      Add VTU options of VTKSCHED          */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
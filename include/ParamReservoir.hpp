@@ -113,6 +113,8 @@ public:
     void InputSSMSP(ifstream& ifs);
     void InputNRSP(ifstream& ifs);
     void InputRR(ifstream& ifs);
+    /// Input KVCACHE
+    void InputKVCACHE(ifstream& ifs);
 
 public:
     USI            NTPVT{1};       ///< num of EoS region, constant now.
@@ -190,6 +192,10 @@ public:
     vector<string> SSMparamSP;  ///< Params for Solving Phase Spliting with SSM
     vector<string> NRparamSP;   ///< Params for Solving Phase Spliting with NR
     vector<string> RRparam;     ///< Params for Solving Rachford-Rice equations
+
+    // Flash cache
+    OCP_BOOL        flashCache{OCP_FALSE}; ///< If true, converged splits are cached
+    vector<OCP_DBL> cacheParam{1E-3, 0.1, 1E-3, 65536}; ///< dlnP, dT, dz, max entries
 };
 
 class Miscstr
@@ -223,6 +229,8 @@ public:
     vector<OCP_DBL> coord; ///< TODO: Add Doxygen.
     vector<OCP_DBL> zcorn; ///< TODO: Add Doxygen.
 
+    USI gridOrder{ORDER_NATURAL}; ///< Ordering of active grid cells.
+
     // RockParam
     vector<OCP_DBL>   ntg;     ///< Net to gross for each grid.
     vector<OCP_DBL>   poro;    ///< Porosity for each grid.
@@ -329,6 +337,8 @@ public:
 
     /// Input the keyword: RTEMP. RTEMP gives the temperature of reservoir.
     void InputRTEMP(ifstream& ifs);
+    /// Input the keyword: REORDER. It chooses the ordering of active grid cells.
+    void InputREORDER(ifstream& ifs);
 
     /// Input the keyword: EQUALS. EQUALS contains many keywords about grids which has
     /// special input format. These keywords contains DX, TOPS, PORO and so on. You can
@@ -336,8 +346,9 @@ public:
     void InputEQUALS(ifstream& ifs);
 
     /// Input the keyword about grids, actually, it's a supplement for EQUALS.
-    /// It supplies another way to input the params in EQUALS.
-    void InputGRID(ifstream& ifs, string& keyword);
+    /// It supplies another way to input the params in EQUALS. Values are parsed in
+    /// the mapped memory of the input file if it is available.
+    void InputGRID(ifstream& ifs, string& keyword, const MappedFile& file);
 
     /// Input the keyword: COPY. COPY could copy the value of one variable to another.
     void InputCOPY(ifstream& ifs);
@@ -377,7 +388,7 @@ public:
     void InputTABDIMS(ifstream& ifs);
 
     /// Input the keyword: SATNUM and PVTNUM.
-    void InputRegion(ifstream& ifs, const string& keyword);
+    void InputRegion(ifstream& ifs, const string& keyword, const MappedFile& file);
 
     // Input ComponentParam
     // Basic params
@@ -400,6 +411,7 @@ public:
     void InputSSMSP(ifstream& ifs) { comsParam.InputSSMSP(ifs); };
     void InputNRSP(ifstream& ifs) { comsParam.InputNRSP(ifs); };
     void InputRR(ifstream& ifs) { comsParam.InputRR(ifs); };
+    void InputKVCACHE(ifstream& ifs) { comsParam.InputKVCACHE(ifs); };
 
     // check
     /// Check the reservoir param from input file.
@@ -440,4 +452,7 @@ public:
 /*  Shizhe Li           Oct/01/2021      Create file                          */
 /*  Chensong Zhang      Oct/15/2021      Format file                          */
 /*  Chensong Zhang      Jan/09/2022      Update Doxygen                       */
+/*  OpenCAEPoro team    Oct/16/2026      Parse arrays in mapped files         */
+/*  OpenCAEPoro team    Oct/17/2026      Reorder active cells                 */
+/*  OpenCAEPoro team    Oct/17/2026      Add KVCACHE keyword                  */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
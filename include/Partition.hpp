@@ -0,0 +1,103 @@
+/*! \file    Partition.hpp
+ *  \brief   Partition of active grid cells into domains with ghost layers
+ *  \author  OpenCAEPoro team
+ *  \date    Oct/17/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the OpenCAEPoro team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+#ifndef __PARTITION_HEADER__
+#define __PARTITION_HEADER__
+
+// Standard header files
+#include <utility>
+#include <vector>
+
+// OpenCAEPoro header files
+#include "AllWells.hpp"
+#include "Grid.hpp"
+#include "OCPConst.hpp"
+#include "UtilMPI.hpp"
+
+using namespace std;
+
+/// Partition divides active grid cells into domains, one domain for each process.
+//  Note: The graph of active cells is weighted by the cost of cells and the strength
+//  of connections, and it is partitioned by METIS if available, otherwise vertical
+//  columns of cells are divided into blocks in the areal ordering. Wells sharing
+//  perforated cells form a group, and the cells perforated by a group belong to the
+//  domain holding most of them, so every well is owned by one process. Each process
+//  keeps its owned cells followed by a ghost layer of the neighbors owned by others,
+//  both in increasing global order, and the active cells of Grid are renumbered to
+//  them, so all arrays of bulks and connections are local. Values of ghost cells are
+//  received from their owners by ExchangeGhost(). Input and Grid are replicated on
+//  processes.
+class Partition
+{
+public:
+    /// Partition active cells of myGrid, then restrict myGrid to the owned and ghost
+    /// cells of calling process. Nothing changes with one process.
+    void Setup(Grid& myGrid, const AllWells& wells);
+    /// Receive the values of ghost cells from their owners, the values of each cell
+    /// take size bytes, such as len * sizeof(OCP_DBL).
+    void ExchangeGhost(void* val, const size_t& size) const;
+    /// Receive the values of ghost cells of several arrays in one message, each array
+    /// is given by its address and the bytes of each cell.
+    void ExchangeGhost(const vector<pair<char*, size_t>>& arrays) const;
+    /// Return whether cells are distributed among more than one process.
+    OCP_BOOL IfDistributed() const { return numDomain > 1; }
+    /// Return the number of domains.
+    USI GetDomainNum() const { return numDomain; }
+    /// Return the domain of calling process.
+    USI GetMyDomain() const { return myDomain; }
+    /// Return the number of owned cells, which are numbered first.
+    OCP_USI GetOwnedNum() const { return numOwned; }
+    /// Return the number of owned and ghost cells.
+    OCP_USI GetLocalNum() const { return numLocal; }
+
+protected:
+    /// Build the weighted graph of active cells.
+    void BuildGraph(const Grid& myGrid, const vector<vector<OCP_USI>>& perfCell);
+    /// Partition the graph of active cells.
+    void PartGraph(const Grid& myGrid);
+    /// Move the cells perforated by a group of wells to one domain.
+    void AssignWell(const vector<vector<OCP_USI>>& perfCell);
+    /// Setup owned cells, ghost cells and communication lists of calling process.
+    void SetupLocal(Grid& myGrid);
+    /// Print the quality of partition.
+    void PrintInfo() const;
+
+protected:
+    USI     numDomain{1}; ///< Num of domains
+    USI     myDomain{0};  ///< Domain of calling process
+    OCP_USI numAct{0};    ///< Num of active cells of all domains
+    OCP_USI numOwned{0};  ///< Num of cells owned by calling process
+    OCP_USI numLocal{0};  ///< Num of owned and ghost cells of calling process
+
+    // Graph of active cells in CSR format, in global active indices
+    vector<OCP_USI> xadj;   ///< Beginning of neighbors of each cell: numAct+1
+    vector<OCP_USI> adjncy; ///< Neighbors of each cell, self-excluded
+    vector<OCP_USI> adjwgt; ///< Weights of edges, strength of connections
+    vector<OCP_USI> vwgt;   ///< Weights of vertices, cost of cells: numAct
+    vector<USI>     domain; ///< Domain of each active cell: numAct
+
+    // Communication with neighboring domains, in local indices
+    vector<USI>                  nbDomain; ///< Neighboring domains
+    vector<vector<OCP_USI>>      sendBulk; ///< Owned cells sent to each neighbor
+    vector<vector<OCP_USI>>      recvBulk; ///< Ghost cells received from each neighbor
+    mutable vector<vector<char>> sendBuf;  ///< Buffer of sending
+    mutable vector<vector<char>> recvBuf;  ///< Buffer of receiving
+};
+
+#endif /* end if __PARTITION_HEADER__ */
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  OpenCAEPoro team    Oct/17/2026      Create file                          */
+/*----------------------------------------------------------------------------*/
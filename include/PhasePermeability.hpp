@@ -15,6 +15,7 @@
 #include "Grid.hpp"
 #include "OCPConst.hpp"
 #include "ParamReservoir.hpp"
+#include "UtilRestart.hpp"
 
 #include <vector>
 
@@ -42,6 +43,16 @@ public:
     void ResetTolastTimeStep() { surTen = lsurTen; }
     /// Update Miscible term at last time step
     void UpdateLastTimeStep() { lsurTen = surTen; }
+    /// Write Miscible term to a restart file
+    void WriteRestart(ofstream& out) const
+    {
+        for (const auto* v : {&surTen, &Fk, &Fp, &lsurTen}) WriteBinary(out, *v);
+    }
+    /// Read Miscible term from a restart file
+    void ReadRestart(ifstream& in)
+    {
+        for (auto* v : {&surTen, &Fk, &Fp, &lsurTen}) ReadBinary(in, *v);
+    }
     /// Return surTen
     OCP_DBL GetSurTen(const OCP_USI& n) const { return surTen[n]; }
     /// Return Fk
@@ -102,4 +113,5 @@ protected:
 /*  Author              Date             Actions                              */
 /*----------------------------------------------------------------------------*/
 /*  Shizhe Li           Dec/26/2022      Create file                          */
+/*  OpenCAEPoro team    Oct/16/2026      Add restart of Miscible              */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
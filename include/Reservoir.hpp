@@ -19,6 +19,7 @@
 #include "Grid.hpp"
 #include "OptionalFeatures.hpp"
 #include "ParamRead.hpp"
+#include "Partition.hpp"
 
 /// Reservoir is the core component in our simulator, it contains the all reservoir
 /// information, and all operations on it.
@@ -64,6 +65,8 @@ public:
     void CalMaxChange();
     /// Return the num of Bulk
     OCP_USI GetBulkNum() const { return bulk.GetBulkNum(); }
+    /// Return the partition of bulks among processes
+    const Partition& GetPartition() const { return partition; }
     /// Return the num of Well
     USI GetWellNum() const { return allWells.GetWellNum(); }
     /// Return the num of Components
@@ -75,18 +78,26 @@ protected:
     AllWells         allWells;    ///< Wells class info.
     BulkConn         conn;        ///< Bulk's connection info.
     OptionalFeatures optFeatures; ///< optional features.
+    Partition        partition;   ///< Partition of bulks among processes.
 
 public:
     /// Calculate the CFL number, including bulks and wells for IMPEC
     OCP_DBL CalCFL(const OCP_DBL& dt) const;
     /// Return NRdPmax
-    OCP_DBL GetNRdPmax() { return bulk.GetNRdPmax(); }
+    OCP_DBL GetNRdPmax() { return AllReduceMaxAbs(bulk.GetNRdPmax()); }
     /// Return NRdSmax
-    OCP_DBL GetNRdSmax(OCP_USI& index) { return bulk.CalNRdSmax(index); }
+    OCP_DBL GetNRdSmax(OCP_USI& index)
+    {
+        return AllReduceMaxAbs(bulk.CalNRdSmax(index));
+    }
     /// Return NRdNmax
     OCP_DBL GetNRdNmax() { return bulk.GetNRdNmax(); }
     void    PrintSolFIM(const string& outfile) const;
     void    OutInfoFinal() const { bulk.OutMixtureIters(); }
+    /// Write dynamic states of reservoir to a restart file
+    void WriteRestart(ofstream& out) const;
+    /// Read dynamic states of reservoir from a restart file
+    void ReadRestart(ifstream& in);
 };
 
 #endif /* end if __RESERVOIR_HEADER__ */
@@ -98,4 +109,6 @@ public:
 /*----------------------------------------------------------------------------*/
 /*  Shizhe Li           Oct/01/2021      Create file                          */
 /*  Chensong Zhang      Oct/15/2021      Format file                          */
+/*  OpenCAEPoro team    Oct/16/2026      Add restart                          */
+/*  OpenCAEPoro team    Oct/17/2026      Distribute FIM among MPI processes   */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
@@ -27,8 +27,13 @@ public:
     void InitReservoir(Reservoir& rs) const;
     /// Start simulation.
     void RunSimulation(Reservoir& rs, OCPControl& ctrl, OCPOutput& output);
+    /// Resume the reservoir and control from a restart file.
+    void ReadRestart(Reservoir& rs, OCPControl& ctrl) const;
 
 private:
+    /// Write the reservoir and control to a restart file.
+    void WriteRestart(const Reservoir& rs, const OCPControl& ctrl) const;
+
     /// General API
     void GoOneStep(Reservoir& rs, OCPControl& ctrl);
 
@@ -61,4 +66,5 @@ private:
 /*  Shizhe Li           Oct/01/2021      Create file                          */
 /*  Shizhe Li           Oct/21/2021      Change from OCPMethod to Solver      */
 /*  Chensong Zhang      Oct/27/2021      Rearrange and add comments           */
+/*  OpenCAEPoro team    Oct/16/2026      Add restart                          */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
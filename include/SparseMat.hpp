@@ -0,0 +1,105 @@
+/*! \file    SparseMat.hpp
+ *  \brief   Block sparse matrices and their block ILU(0) factorization
+ *  \author  OpenCAEPoro team
+ *  \date    Oct/16/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the OpenCAEPoro team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+#ifndef __SPARSEMAT_HEADER__
+#define __SPARSEMAT_HEADER__
+
+// Standard header files
+#include <vector>
+
+// OpenCAEPoro header files
+#include "OCPConst.hpp"
+
+using namespace std;
+
+/// Invert a small nb*nb matrix in place by Gauss-Jordan elimination with partial
+/// pivoting, return OCP_FALSE if it is singular.
+OCP_BOOL BlockInverse(const USI& nb, OCP_DBL* A);
+
+/// C = A * B for small nb*nb matrices.
+void BlockMult(const USI& nb, const OCP_DBL* A, const OCP_DBL* B, OCP_DBL* C);
+
+/// y = A * x for a small nb*nb matrix.
+void BlockMatVec(const USI& nb, const OCP_DBL* A, const OCP_DBL* x, OCP_DBL* y);
+
+/// BSRMatrix is a square sparse matrix of nb*nb blocks in BSR format.
+//  Note: Blocks are stored row by row, entries of a block are stored row by row too.
+//  The diagonal block is the first one of each row as assembled by LinearSystem.
+class BSRMatrix
+{
+public:
+    /// Allocate memory for maxRow block rows and maxNnz blocks.
+    void Allocate(const OCP_USI& maxRow, const OCP_USI& maxNnz, const USI& blockDim);
+    /// Copy the pattern of another matrix, values are not copied.
+    void CopyPattern(const BSRMatrix& src);
+    /// Return the number of nonzero blocks.
+    OCP_USI GetNnz() const { return rowPtr[nrow]; }
+    /// y = A * x.
+    void SpMV(const OCP_DBL* x, OCP_DBL* y) const;
+    /// r = b - A * x.
+    void Residual(const OCP_DBL* b, const OCP_DBL* x, OCP_DBL* r) const;
+
+public:
+    OCP_USI         nrow{0}; ///< Num of block rows
+    USI             nb{1};   ///< Dimension of blocks
+    USI             nb2{1};  ///< Size of blocks
+    vector<OCP_USI> rowPtr;  ///< Beginning of each block row: nrow+1
+    vector<OCP_USI> colIdx;  ///< Block column indices: nnz
+    vector<OCP_DBL> val;     ///< Values of blocks: nnz*nb2
+};
+
+/// BlockILU0 is the block ILU(0) factorization of a BSRMatrix.
+//  Note: Entries of each row are sorted by column in the factors, rows are grouped in
+//  levels so that the factorization and the triangular solves can be done in
+//  parallel within a level. Results do not depend on the number of threads. The
+//  symbolic phase is repeated only if the pattern of the matrix changes.
+class BlockILU0
+{
+public:
+    /// Factorize A, return OCP_FALSE if a diagonal block is singular.
+    OCP_BOOL Setup(const BSRMatrix& A);
+    /// z = (LU)^{-1} * r.
+    void Apply(const OCP_DBL* r, OCP_DBL* z) const;
+
+protected:
+    /// Sort entries of rows and build levels if the pattern of A changes.
+    void Symbolic(const BSRMatrix& A);
+    /// Group rows into levels, each row depends on rows in lower levels only.
+    void BuildLevel(const OCP_BOOL&  lower,
+                    vector<OCP_USI>& levelPtr,
+                    vector<OCP_USI>& levelRow) const;
+
+protected:
+    OCP_USI         nrow{0}; ///< Num of block rows
+    USI             nb{0};   ///< Dimension of blocks
+    USI             nb2{0};  ///< Size of blocks
+    vector<OCP_USI> rowPtr;  ///< Pattern of A: beginning of each row
+    vector<OCP_USI> colIdx;  ///< Pattern of A: column indices in assembled order
+    vector<OCP_USI> perm;    ///< Position in A of each entry of factors
+    vector<OCP_USI> luCol;   ///< Column indices of factors, sorted in each row
+    vector<OCP_USI> diagPos; ///< Position of diagonal block of each row in factors
+    vector<OCP_DBL> luVal;   ///< L and U, the diagonal blocks of U are inverted
+    vector<OCP_USI> lvPtr;   ///< Beginning of each level of forward substitution
+    vector<OCP_USI> lvRow;   ///< Rows of levels of forward substitution
+    vector<OCP_USI> ulvPtr;  ///< Beginning of each level of backward substitution
+    vector<OCP_USI> ulvRow;  ///< Rows of levels of backward substitution
+    mutable vector<OCP_DBL> tmp; ///< Work space of triangular solves
+};
+
+#endif /* end if __SPARSEMAT_HEADER__ */
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  OpenCAEPoro team    Oct/16/2026      Create file                          */
+/*----------------------------------------------------------------------------*/
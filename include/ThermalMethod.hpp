@@ -16,6 +16,7 @@
 #include "OCPControl.hpp"
 #include "Reservoir.hpp"
 #include "UtilOutput.hpp"
+#include "UtilProfiler.hpp"
 #include "UtilTiming.hpp"
 
 class T_FIM
@@ -53,6 +53,49 @@ OCP_BOOL ReadLine(ifstream& ifs, vector<string>& result);
 /// m*n  -> <n,...,n> size m ,  m* -> <DEFAULT,..., DEFAULT> size m.
 void DealDefault(vector<string>& result);
 
+/// MappedFile maps a whole input file into memory, so that large numeric arrays could
+/// be parsed in place instead of line by line.
+//  Note: The file is read into a buffer if mmap is not available.
+class MappedFile
+{
+public:
+    MappedFile() = default;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    ~MappedFile() { Close(); }
+    /// Map a file into memory, return OCP_FALSE if failed.
+    OCP_BOOL Open(const string& filename);
+    /// Unmap the file.
+    void Close();
+    /// Return whether a file is mapped.
+    OCP_BOOL IsOpen() const { return data != nullptr; }
+    /// Return the beginning of the file.
+    const char* Begin() const { return data; }
+    /// Return the end of the file.
+    const char* End() const { return data + size; }
+
+protected:
+    const char*  data{nullptr}; ///< Contents of the file
+    size_t       size{0};       ///< Size of the file
+    vector<char> buffer;        ///< Contents of the file if mmap is not used
+};
+
+/// ReadNumbers parses numbers of keyword in [p, end) until '/', m*n is expanded into n
+/// repeated m times and comments are skipped. It returns the beginning of the line
+/// behind '/'. Defaults m* and wrong numbers are reported as errors of keyword.
+const char* ReadNumbers(const char*      p,
+                        const char*      end,
+                        const string&    keyword,
+                        vector<OCP_DBL>& result);
+
+/// ReadNumbers parses numbers of keyword from the position of ifs in the mapped memory
+/// of its file until '/', then the position of ifs is moved behind the line of '/'.
+//  Note: ifs must be opened in binary mode, so that its position is a byte offset.
+void ReadNumbers(ifstream&         ifs,
+                 const MappedFile& file,
+                 const string&     keyword,
+                 vector<OCP_DBL>&  result);
+
 /// DealData change a series of product of integers into two arrays.
 /// For example, 8*1  16*2  8*3  16*4  -> obj <8, 16, 8, 16> & val <1, 2, 3, 4>.
 template <typename T>
@@ -81,4 +124,6 @@ void DealData(const vector<string>& vbuf, vector<OCP_USI>& obj, vector<T>& regio
 /*----------------------------------------------------------------------------*/
 /*  Shizhe Li           Oct/01/2021      Create file                          */
 /*  Chensong Zhang      Oct/15/2021      Format file                          */
+/*  OpenCAEPoro team    Oct/16/2026      Parse numeric arrays in mapped files */
+/*  OpenCAEPoro team    Oct/17/2026      Report wrong numbers of keywords     */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
@@ -0,0 +1,145 @@
+/*! \file    UtilMPI.hpp
+ *  \brief   Thin wrappers of MPI runtime functions
+ *  \author  OpenCAEPoro team
+ *  \date    Oct/17/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the OpenCAEPoro team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+#ifndef __UTILMPI_HEADER__
+#define __UTILMPI_HEADER__
+
+#ifdef USE_MPI
+#include <mpi.h>
+#endif
+
+/// Initialize MPI if it has not been initialized, do nothing without MPI
+inline void InitMPI(int* argc, const char*** argv)
+{
+#ifdef USE_MPI
+    int flag = 0;
+    MPI_Initialized(&flag);
+    if (!flag) MPI_Init(argc, const_cast<char***>(argv));
+#else
+    (void)argc;
+    (void)argv;
+#endif
+}
+
+/// Finalize MPI if it has been initialized, do nothing without MPI
+inline void FinalizeMPI()
+{
+#ifdef USE_MPI
+    int flag = 0;
+    MPI_Initialized(&flag);
+    if (flag) MPI_Finalize();
+#endif
+}
+
+/// Return the number of processes, 1 without MPI
+inline int GetMPISize()
+{
+#ifdef USE_MPI
+    int flag = 0, size = 1;
+    MPI_Initialized(&flag);
+    if (flag) MPI_Comm_size(MPI_COMM_WORLD, &size);
+    return size;
+#else
+    return 1;
+#endif
+}
+
+/// Return the rank of the calling process, 0 without MPI
+inline int GetMPIRank()
+{
+#ifdef USE_MPI
+    int flag = 0, rank = 0;
+    MPI_Initialized(&flag);
+    if (flag) MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    return rank;
+#else
+    return 0;
+#endif
+}
+
+// Reductions over all processes, they return the local values with one process
+
+/// Sum up n values over all processes in place
+inline void AllReduceSum(double* val, const int& n)
+{
+#ifdef USE_MPI
+    if (GetMPISize() > 1) {
+        MPI_Allreduce(MPI_IN_PLACE, val, n, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    }
+#else
+    (void)val;
+    (void)n;
+#endif
+}
+
+/// Take the max of n values over all processes in place
+inline void AllReduceMax(double* val, const int& n)
+{
+#ifdef USE_MPI
+    if (GetMPISize() > 1) {
+        MPI_Allreduce(MPI_IN_PLACE, val, n, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+    }
+#else
+    (void)val;
+    (void)n;
+#endif
+}
+
+/// Return the sum of val over all processes
+inline double AllReduceSum(double val)
+{
+    AllReduceSum(&val, 1);
+    return val;
+}
+
+/// Return the max of val over all processes
+inline double AllReduceMax(double val)
+{
+    AllReduceMax(&val, 1);
+    return val;
+}
+
+/// Return the min of val over all processes
+inline double AllReduceMin(double val)
+{
+    val = -val;
+    AllReduceMax(&val, 1);
+    return -val;
+}
+
+/// Return the value of max magnitude over all processes, the sign is kept
+inline double AllReduceMaxAbs(const double& val)
+{
+    double m[2] = {val, -val};
+    AllReduceMax(m, 2);
+    return m[0] >= m[1] ? m[0] : -m[1];
+}
+
+/// Return the max of val over all processes
+inline int AllReduceMax(int val)
+{
+#ifdef USE_MPI
+    if (GetMPISize() > 1) {
+        MPI_Allreduce(MPI_IN_PLACE, &val, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+    }
+#endif
+    return val;
+}
+
+#endif /* end if __UTILMPI_HEADER__ */
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  OpenCAEPoro team    Oct/17/2026      Create file                          */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,112 @@
+/*! \file    UtilOpenMP.hpp
+ *  \brief   Thin wrappers of OpenMP runtime functions
+ *  \author  OpenCAEPoro team
+ *  \date    Oct/16/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the OpenCAEPoro team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+#ifndef __UTILOPENMP_HEADER__
+#define __UTILOPENMP_HEADER__
+
+// Standard header files
+#include <algorithm>
+#include <vector>
+
+#ifdef USE_OPENMP
+#include <omp.h>
+#endif
+
+#ifdef USE_OPENMP
+#define OCP_PRAGMA(x) _Pragma(#x)
+/// Vectorize the following loop
+#define OCP_SIMD OCP_PRAGMA(omp simd)
+/// Vectorize the following loop which sums up v
+#define OCP_SIMD_SUM(v) OCP_PRAGMA(omp simd reduction(+ : v))
+#else
+#define OCP_SIMD
+#define OCP_SIMD_SUM(v)
+#endif
+
+/// Return the max number of threads used in parallel regions, 1 without OpenMP
+inline int GetMaxThreads()
+{
+#ifdef USE_OPENMP
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+/// Return the id of the calling thread, 0 without OpenMP or outside parallel regions
+inline int GetThreadId()
+{
+#ifdef USE_OPENMP
+    return omp_get_thread_num();
+#else
+    return 0;
+#endif
+}
+
+/// Return the number of threads of current parallel region, 1 outside parallel regions
+inline int GetNumThreads()
+{
+#ifdef USE_OPENMP
+    return omp_get_num_threads();
+#else
+    return 1;
+#endif
+}
+
+/// Replace a[0], ..., a[n-1] by their exclusive prefix sums and return the sum of all,
+/// where each thread sums up a contiguous block. It is exact for integers, so the
+/// result does not depend on the number of threads.
+template <typename T, typename I>
+T ExclusiveScan(T* a, const I& n)
+{
+    std::vector<T> part(GetMaxThreads() + 1, 0);
+    int            nt = 1;
+#ifdef USE_OPENMP
+#pragma omp parallel
+#endif
+    {
+        const int t = GetThreadId();
+#ifdef USE_OPENMP
+#pragma omp single
+#endif
+        nt = GetNumThreads();
+
+        const I b   = n / nt * t + std::min<I>(n % nt, t);
+        const I e   = b + n / nt + (static_cast<I>(t) < n % nt ? 1 : 0);
+        T       sum = 0;
+        for (I i = b; i < e; i++) sum += a[i];
+        part[t + 1] = sum;
+#ifdef USE_OPENMP
+#pragma omp barrier
+#pragma omp single
+#endif
+        for (int p = 0; p < nt; p++) part[p + 1] += part[p];
+
+        sum = part[t];
+        for (I i = b; i < e; i++) {
+            const T tmp = a[i];
+            a[i]        = sum;
+            sum += tmp;
+        }
+    }
+    return part[nt];
+}
+
+#endif /* end if __UTILOPENMP_HEADER__ */
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  OpenCAEPoro team    Oct/16/2026      Create file                          */
+/*  OpenCAEPoro team    Oct/17/2026      Add parallel prefix sums             */
+/*----------------------------------------------------------------------------*/
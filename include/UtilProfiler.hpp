@@ -0,0 +1,168 @@
+/*! \file    UtilProfiler.hpp
+ *  \brief   Hierarchical timers and counters of hot paths
+ *  \author  OpenCAEPoro team
+ *  \date    Oct/16/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the OpenCAEPoro team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+#ifndef __UTILPROFILER_HEADER__
+#define __UTILPROFILER_HEADER__
+
+// Standard header files
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// OpenCAEPoro header files
+#include "OCPConst.hpp"
+#include "UtilOpenMP.hpp"
+
+using namespace std;
+
+/// Timers of hot paths, their names are given in OCPProfiler::timerName.
+enum OCPProfTimer : USI {
+    PROF_ASSEMBLE,     ///< Assemble linear systems
+    PROF_CALRES,       ///< Calculate residuals
+    PROF_CALFLUX,      ///< Calculate fluxes
+    PROF_LINEAR_SOLVE, ///< Setup and solve linear systems
+    PROF_DECOUPLE,     ///< Decouple linear systems
+    PROF_PC_SETUP,     ///< Setup preconditioners
+    PROF_KRYLOV,       ///< Krylov iterations
+    PROF_UPDATE,       ///< Update properties
+    PROF_FLASH,        ///< Flash calculation
+    PROF_KRPC,         ///< Relative permeability and capillary pressure
+    PROF_OUTPUT,       ///< Output of reports
+    PROF_NUM_TIMER     ///< Num of timers
+};
+
+/// Counters of hot paths, their names are given in OCPProfiler::counterName.
+enum OCPProfCounter : USI {
+    PROF_FLASH_BULK,   ///< Bulks flashed
+    PROF_FLASH_STA,    ///< Flash with phase stability analysis
+    PROF_FLASH_SKIP,   ///< Flash with phase stability analysis skipped
+    PROF_SSM_STA_ITER, ///< SSM iterations in phase stability analysis
+    PROF_NR_STA_ITER,  ///< NR iterations in phase stability analysis
+    PROF_SSM_SP_ITER,  ///< SSM iterations in phase splitting
+    PROF_NR_SP_ITER,   ///< NR iterations in phase splitting
+    PROF_FLASH_HIT,    ///< Flash started from cached splits and accepted
+    PROF_FLASH_MISS,   ///< Flash not found in cache or rejected
+    PROF_PC_REBUILD,   ///< Setups of preconditioners built
+    PROF_PC_REUSE,     ///< Linear solves reusing the setup of preconditioners
+    PROF_NUM_COUNTER   ///< Num of counters
+};
+
+/// OCPProfiler records the time of scoped timers in a tree of calls and the counters
+/// of each thread, and it emits a row of a CSV file at the end of each time step and a
+/// JSON file with the tree of calls at the end of simulation.
+//  Note: Timers work in serial regions only, calls from other threads are ignored.
+//  Counters can be added in parallel regions, each thread has its own copy. Nothing is
+//  recorded or written unless the profiler is enabled by the command line option
+//  profile=on before simulation starts.
+class OCPProfiler
+{
+public:
+    /// Return the only profiler.
+    static OCPProfiler& Instance()
+    {
+        static OCPProfiler profiler;
+        return profiler;
+    }
+    /// Enable or disable the profiler, it should not be called inside a timer.
+    void Enable(const OCP_BOOL& flag) { enabled = flag; }
+    /// Return whether the profiler is enabled.
+    OCP_BOOL IfEnabled() const { return enabled; }
+    /// Open the CSV file in dir, it receives a row at the end of each time step.
+    void Setup(const string& dir);
+    /// Start a timer, it is a child of the running timer.
+    void Start(const OCPProfTimer& item);
+    /// Stop the running timer.
+    void Stop();
+    /// Add n to a counter of calling thread.
+    void AddCount(const OCPProfCounter& item, const OCP_ULL& n = 1)
+    {
+        if (enabled) count[GetThreadId() * countStride + item] += n;
+    }
+    /// Write the values of current time step to the CSV file and reset them, the
+    /// total numbers of Newton and linear iterations are given.
+    void EndStep(const USI&     step,
+                 const OCP_DBL& time,
+                 const OCP_DBL& dt,
+                 const USI&     iterNRT,
+                 const USI&     iterLST);
+    /// Set the total numbers of Newton and linear iterations before current step.
+    void ResetIters(const USI& iterNRT, const USI& iterLST)
+    {
+        lastNRT = iterNRT;
+        lastLST = iterLST;
+    }
+    /// Write the tree of calls and the totals of counters to a JSON file in dir.
+    void PrintJSON(const string& dir) const;
+
+protected:
+    OCPProfiler();
+    OCPProfiler(const OCPProfiler&) = delete;
+    OCPProfiler& operator=(const OCPProfiler&) = delete;
+    /// Write a node and its children to JSON.
+    void PrintNode(ofstream& out, const USI& n, const USI& indent) const;
+
+protected:
+    typedef chrono::steady_clock::time_point TimePoint;
+
+    /// A node in the tree of calls.
+    struct Node {
+        USI         item;     ///< Timer of the node
+        USI         parent;   ///< Parent node
+        vector<USI> child;    ///< Children nodes
+        OCP_DBL     time{0};  ///< Total time in seconds
+        OCP_ULL     calls{0}; ///< Num of calls
+    };
+
+    static const char* timerName[PROF_NUM_TIMER];     ///< Names of timers
+    static const char* counterName[PROF_NUM_COUNTER]; ///< Names of counters
+
+    OCP_BOOL enabled{OCP_FALSE}; ///< Whether timers and counters are recorded
+
+    vector<Node>      nodes;    ///< Tree of calls, nodes[0] is the root
+    vector<USI>       stack;    ///< Running nodes
+    vector<TimePoint> start;    ///< Starting time of running nodes
+    vector<OCP_DBL>   stepTime; ///< Time of each timer in current step
+    vector<OCP_DBL>   allTime;  ///< Total time of each timer
+
+    USI             countStride; ///< Stride of counters of threads, one cache line
+    vector<OCP_ULL> count;       ///< Counters of each thread in current step
+    vector<OCP_ULL> allCount;    ///< Total of each counter
+
+    ofstream csv;        ///< CSV file of time steps
+    USI      lastNRT{0}; ///< Total Newton iterations at last time step
+    USI      lastLST{0}; ///< Total linear iterations at last time step
+};
+
+/// Start a timer at construction and stop it at destruction.
+class OCPScopedTimer
+{
+public:
+    OCPScopedTimer(const OCPProfTimer& item) { OCPProfiler::Instance().Start(item); }
+    ~OCPScopedTimer() { OCPProfiler::Instance().Stop(); }
+};
+
+/// Time the rest of current scope.
+#define OCP_PROFILE(item) OCPScopedTimer ocpScopedTimer_(item)
+
+/// Add n to a counter.
+#define OCP_PROFILE_COUNT(item, n) OCPProfiler::Instance().AddCount(item, n)
+
+#endif /* end if __UTILPROFILER_HEADER__ */
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  OpenCAEPoro team    Oct/16/2026      Create file                          */
+/*  OpenCAEPoro team    Oct/17/2026      Add run-time switch of profiler      */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,74 @@
+/*! \file    UtilRestart.hpp
+ *  \brief   Binary input and output of restart files
+ *  \author  OpenCAEPoro team
+ *  \date    Oct/16/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the OpenCAEPoro team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+#ifndef __UTILRESTART_HEADER__
+#define __UTILRESTART_HEADER__
+
+// Standard header files
+#include <fstream>
+#include <vector>
+
+// OpenCAEPoro header files
+#include "OCPConst.hpp"
+#include "UtilError.hpp"
+
+using namespace std;
+
+const char RESTART_MAGIC[8] = {'O', 'C', 'P', 'R', 'S', 'T', 'R', 'T'}; ///< File id
+const USI  RESTART_VERSION  = 4; ///< Version of restart files
+
+/// Write a value to a binary restart file.
+template <typename T>
+void WriteBinary(ofstream& out, const T& v)
+{
+    out.write(reinterpret_cast<const char*>(&v), sizeof(T));
+}
+
+/// Write a vector to a binary restart file, its size goes first.
+template <typename T>
+void WriteBinary(ofstream& out, const vector<T>& v)
+{
+    const OCP_ULL n = v.size();
+    WriteBinary(out, n);
+    if (n > 0) out.write(reinterpret_cast<const char*>(v.data()), n * sizeof(T));
+}
+
+/// Read a value from a binary restart file.
+template <typename T>
+void ReadBinary(ifstream& in, T& v)
+{
+    in.read(reinterpret_cast<char*>(&v), sizeof(T));
+    if (!in) OCP_ABORT("Restart file is truncated!");
+}
+
+/// Read a vector from a binary restart file, its size should not change.
+template <typename T>
+void ReadBinary(ifstream& in, vector<T>& v)
+{
+    OCP_ULL n;
+    ReadBinary(in, n);
+    if (n != v.size()) OCP_ABORT("Restart file does not match the model!");
+    if (n > 0) in.read(reinterpret_cast<char*>(v.data()), n * sizeof(T));
+    if (!in) OCP_ABORT("Restart file is truncated!");
+}
+
+#endif /* end if __UTILRESTART_HEADER__ */
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  OpenCAEPoro team    Oct/16/2026      Create file                          */
+/*  OpenCAEPoro team    Oct/17/2026      Record grid order in restart files   */
+/*  OpenCAEPoro team    Oct/17/2026      Save controller state in restart     */
+/*  OpenCAEPoro team    Oct/17/2026      Save well modes in restart files     */
+/*----------------------------------------------------------------------------*/
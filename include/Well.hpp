@@ -46,9 +46,6 @@ class Well
     friend class AllWells;
     friend class Out4RPT;
 
-    // temp
-    friend class MyMetisTest;
-
 public:
     Well() = default;
 
@@ -61,6 +58,8 @@ public:
     void InputPerfo(const WellParam& well);
     /// Setup the well after Grid and Bulk finish setup.
     void Setup(const Grid& gd, const Bulk& bk, const vector<SolventINJ>& sols);
+    /// Return the grid cells perforated by the well.
+    vector<OCP_USI> GetPerfGrid(const Grid& gd) const;
 
     /////////////////////////////////////////////////////////////////////
     // Basic Well information
@@ -88,6 +87,7 @@ protected:
 
     USI wOId; ///< well index in allWells, closed well is excluded, it's the well index
               ///< in equations
+    OCP_BOOL ifOwned{OCP_TRUE}; ///< If the well is owned by this process, see Partition
 
 public:
     /// Initialize the Well BHP
@@ -177,7 +177,7 @@ public:
     }
 
     OCP_BOOL PerfState(const USI& p) const { return perf[p].state; }
-    USI      PerfLocation(const USI& p) const { return perf[p].location; }
+    OCP_USI  PerfLocation(const USI& p) const { return perf[p].location; }
     OCP_DBL  PerfWI(const USI& p) const { return perf[p].WI; }
     OCP_DBL  PerfMultiplier(const USI& p) const { return perf[p].multiplier; }
     OCP_DBL  PerfTransInj(const USI& p) const { return perf[p].transINJ; }
@@ -269,4 +269,6 @@ public:
 /*----------------------------------------------------------------------------*/
 /*  Shizhe Li           Oct/01/2021      Create file                          */
 /*  Chensong Zhang      Oct/15/2021      Format file                          */
+/*  OpenCAEPoro team    Oct/17/2026      Add 64-bit global index option       */
+/*  OpenCAEPoro team    Oct/17/2026      Distribute FIM among MPI processes   */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
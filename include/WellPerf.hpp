@@ -24,6 +24,7 @@ using namespace std;
 class Perforation
 {
     friend class Well;
+    friend class AllWells;
     friend class Out4RPT;
 
 public:
@@ -76,4 +77,5 @@ private:
 /*----------------------------------------------------------------------------*/
 /*  Shizhe Li           Oct/01/2021      Create file                          */
 /*  Chensong Zhang      Oct/15/2021      Format file                          */
+/*  OpenCAEPoro team    Oct/17/2026      Save well modes in restart files     */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
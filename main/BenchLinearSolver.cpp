@@ -0,0 +1,260 @@
+/*! \file    BenchLinearSolver.cpp
+ *  \brief   Replay captured linear systems with different solvers and preconditioners
+ *  \author  OpenCAEPoro team
+ *  \date    Oct/16/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the OpenCAEPoro team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+// Standard header files
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// OpenCAEPoro header files
+#include "LinearCapture.hpp"
+#include "NativeSolver.hpp"
+#include "SparseMat.hpp"
+#include "UtilError.hpp"
+#include "UtilTiming.hpp"
+
+#if WITH_FASP
+#include "FaspSolver.hpp"
+#endif
+
+using namespace std;
+
+/// Temporary parameter file of each case, removed at the end.
+const string BENCH_PARAM_FILE = "benchLinearSolver.tmp";
+
+/// A combination of a linear solver and a preconditioner.
+struct BenchCase {
+    OCP_BOOL native;      ///< If the native solver is used
+    USI      solverType;  ///< solver_type
+    USI      precondType; ///< precond_type
+    string   name;        ///< Name of the combination
+};
+
+/// Return the cases which apply to systems with blocks of blockDim.
+static vector<BenchCase> GetCases(const USI& blockDim)
+{
+    vector<BenchCase> cases;
+    const USI         nativeSolver[] = {NATIVE_GMRES, NATIVE_BICGSTAB};
+    const string      nativeName[]   = {"GMRES", "BiCGStab"};
+    for (USI i = 0; i < 2; i++) {
+        cases.push_back({OCP_TRUE, nativeSolver[i], PC_NATIVE_BILU,
+                         "Native " + nativeName[i] + " + BILU"});
+        cases.push_back({OCP_TRUE, nativeSolver[i], PC_NATIVE_CPR,
+                         "Native " + nativeName[i] + " + CPR"});
+    }
+
+#if WITH_FASP
+    const USI    faspSolver[] = {SOLVER_VFGMRES, SOLVER_BiCGstab};
+    const string faspName[]   = {"VFGMRES", "BiCGstab"};
+    for (USI i = 0; i < 2; i++) {
+        if (blockDim == 1) {
+            cases.push_back({OCP_FALSE, faspSolver[i], PREC_NULL,
+                             "FASP " + faspName[i] + " + NULL"});
+            cases.push_back({OCP_FALSE, faspSolver[i], PREC_DIAG,
+                             "FASP " + faspName[i] + " + DIAG"});
+            cases.push_back({OCP_FALSE, faspSolver[i], PREC_AMG,
+                             "FASP " + faspName[i] + " + AMG"});
+            cases.push_back({OCP_FALSE, faspSolver[i], PREC_ILU,
+                             "FASP " + faspName[i] + " + ILU"});
+        } else {
+            cases.push_back({OCP_FALSE, faspSolver[i], PC_NULL,
+                             "FASP " + faspName[i] + " + NULL"});
+            cases.push_back({OCP_FALSE, faspSolver[i], PC_DIAG,
+                             "FASP " + faspName[i] + " + DIAG"});
+            cases.push_back({OCP_FALSE, faspSolver[i], PC_BILU,
+                             "FASP " + faspName[i] + " + BILU"});
+#if WITH_FASP4BLKOIL
+            for (USI pc = PC_FASP1; pc <= PC_FASP5; pc++) {
+                cases.push_back({OCP_FALSE, faspSolver[i], pc,
+                                 "FASP " + faspName[i] + " + FASP" +
+                                     to_string(pc - PC_FASP1 + 1)});
+            }
+#elif WITH_FASPCPR
+            cases.push_back({OCP_FALSE, faspSolver[i], PC_FASP1,
+                             "FASP " + faspName[i] + " + FASP1"});
+#endif
+        }
+    }
+#else
+    (void)blockDim;
+#endif
+    return cases;
+}
+
+/// Write the parameter file of a case: the base file with its types overridden, as
+/// the last value of a key takes effect.
+static void WriteParamFile(const string& baseFile, const BenchCase& bc)
+{
+    ofstream out(BENCH_PARAM_FILE);
+    if (!out.is_open()) OCP_ABORT("Can not open " + BENCH_PARAM_FILE);
+    if (!baseFile.empty()) {
+        ifstream in(baseFile);
+        if (!in.is_open()) OCP_ABORT("Can not open " + baseFile);
+        out << in.rdbuf() << "\n";
+    }
+    out << "solver_type = " << bc.solverType << "\n";
+    out << "precond_type = " << bc.precondType << "\n";
+}
+
+/// Return the name of a discrete method.
+static string GetMethodName(const USI& method)
+{
+    switch (method) {
+        case IMPEC:
+            return "IMPEC";
+        case FIM:
+            return "FIM";
+        case AIMc:
+            return "AIMc";
+        case FIMn:
+            return "FIMn";
+        default:
+            return "Unknown";
+    }
+}
+
+/// Return ||b - A * x|| / ||b||.
+static OCP_DBL GetRelResidual(const BSRMatrix&       A,
+                              const vector<OCP_DBL>& b,
+                              const vector<OCP_DBL>& x)
+{
+    vector<OCP_DBL> r(b.size());
+    A.Residual(b.data(), x.data(), r.data());
+    OCP_DBL rnorm = 0, bnorm = 0;
+    for (OCP_USI i = 0; i < b.size(); i++) {
+        rnorm += r[i] * r[i];
+        bnorm += b[i] * b[i];
+    }
+    return bnorm > 0 ? sqrt(rnorm / bnorm) : sqrt(rnorm);
+}
+
+/// Solve a captured system with a case and print a row of the report.
+static void RunCase(const USI&            index,
+                    const CapturedSystem& sys,
+                    const BSRMatrix&      A,
+                    const string&         baseFile,
+                    const BenchCase&      bc)
+{
+    WriteParamFile(baseFile, bc);
+
+    LinearSolver* LS = nullptr;
+    if (bc.native) {
+        LS = new NativeSolver;
+    }
+#if WITH_FASP
+    else if (sys.blockDim == 1) {
+        LS = new ScalarFaspSolver;
+    } else {
+        LS = new VectorFaspSolver;
+    }
+#endif
+    LS->SetupParam("", BENCH_PARAM_FILE);
+
+    // Rows of the captured system in the storage of LinearSystem
+    vector<USI>             rowCapacity(sys.dim);
+    vector<vector<OCP_USI>> colId(sys.dim);
+    vector<vector<OCP_DBL>> val(sys.dim);
+    const USI               nb2 = sys.blockDim * sys.blockDim;
+    for (OCP_USI i = 0; i < sys.dim; i++) {
+        const OCP_USI bId = sys.rowPtr[i];
+        const OCP_USI eId = sys.rowPtr[i + 1];
+        rowCapacity[i]    = eId - bId;
+        colId[i].assign(sys.colIdx.begin() + bId, sys.colIdx.begin() + eId);
+        val[i].assign(sys.val.begin() + bId * nb2, sys.val.begin() + eId * nb2);
+    }
+    vector<OCP_DBL> b = sys.b;
+    vector<OCP_DBL> x(b.size(), 0);
+    LS->Allocate(rowCapacity, sys.dim, sys.blockDim);
+    LS->AssembleMat(colId, val, sys.dim, sys.blockDim, b, x);
+
+    GetWallTime timer;
+    timer.Start();
+    const OCP_INT status    = LS->Solve();
+    const OCP_DBL totalTime = timer.Stop();
+    const OCP_DBL setupTime = LS->GetSetupTime();
+    delete LS;
+
+    cout << setw(5) << index << setw(6) << sys.tstep << setw(4) << sys.iterNR
+         << setw(7) << GetMethodName(sys.method) << setw(9) << sys.dim << setw(3)
+         << sys.blockDim << "  " << left << setw(24) << bc.name << right << fixed
+         << setprecision(2) << setw(10) << setupTime << setw(10)
+         << totalTime - setupTime << setw(7)
+         << (status < 0 ? string("fail") : to_string(status)) << scientific
+         << setprecision(2) << setw(11) << GetRelResidual(A, sys.b, x) << endl;
+    cout.unsetf(ios::floatfield);
+}
+
+/// Solve each system in a capture file by all applicable combinations of linear
+/// solvers and preconditioners, and report their setup time, solve time, iterations
+/// and final relative residuals.
+int main(int argc, const char* argv[])
+{
+    if (argc < 2 || argc > 3) {
+        cout << "Usage: " << argv[0] << " <capture file> [<param file>]" << endl;
+        cout << "  capture file: systems written by capture=<file> of the simulator"
+             << endl;
+        cout << "  param file:   params of linear solvers, solver_type and "
+                "precond_type are overridden"
+             << endl;
+        return OCP_ERROR_NUM_INPUT;
+    }
+    const string captureFile = argv[1];
+    const string baseFile    = argc > 2 ? argv[2] : "";
+
+    ifstream in(captureFile, ios::binary);
+    if (!in.is_open()) OCP_ABORT("Can not open " + captureFile);
+    if (!CapturedSystem::ReadHeader(in)) {
+        OCP_ABORT(captureFile + " is not a capture file of this version!");
+    }
+
+    cout << setw(5) << "Sys" << setw(6) << "Step" << setw(4) << "NR" << setw(7)
+         << "Method" << setw(9) << "Rows" << setw(3) << "nb"
+         << "  " << left << setw(24) << "Solver" << right << setw(10) << "Setup(ms)"
+         << setw(10) << "Solve(ms)" << setw(7) << "Iters" << setw(11) << "RelRes"
+         << endl;
+
+    CapturedSystem sys;
+    BSRMatrix      A;
+    USI            index = 0;
+    while (sys.Read(in)) {
+        // Matrix used to check the solutions
+        A.nrow   = sys.dim;
+        A.nb     = sys.blockDim;
+        A.nb2    = sys.blockDim * sys.blockDim;
+        A.rowPtr = sys.rowPtr;
+        A.colIdx = sys.colIdx;
+        A.val    = sys.val;
+
+        for (const auto& bc : GetCases(sys.blockDim)) {
+            RunCase(index, sys, A, baseFile, bc);
+        }
+        index++;
+    }
+    remove(BENCH_PARAM_FILE.c_str());
+
+    cout << index << " systems have been solved" << endl;
+    return OCP_SUCCESS;
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  OpenCAEPoro team    Oct/16/2026      Create file                          */
+/*  OpenCAEPoro team    Oct/17/2026      Index columns by OCP_USI             */
+/*  OpenCAEPoro team    Oct/17/2026      Drop initial guesses of captures     */
+/*----------------------------------------------------------------------------*/
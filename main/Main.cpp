@@ -17,6 +17,7 @@
 // OpenCAEPoro header files
 #include "OCP.hpp"
 #include "ParamRead.hpp"
+#include "UtilMPI.hpp"
 
 using namespace std;
 
@@ -24,14 +25,19 @@ using namespace std;
 int main(int argc, const char* argv[])
 {
     // Step 0. Print simulator version information.
+    // Remark: With more than one process, only the first one prints on the screen.
+    InitMPI(&argc, &argv);
+    if (GetMPIRank() > 0) cout.rdbuf(nullptr);
     OpenCAEPoro simulator;
     if (argc < 2) {
         simulator.PrintUsage(argv[0]);
+        FinalizeMPI();
         return OCP_ERROR_NUM_INPUT; // Need at least one parameter
     } else {
         simulator.PrintVersion();
         if (!strcmp(argv[1], "-h") || !strcmp(argv[1], "--help")) {
             simulator.PrintUsage(argv[0]);
+            FinalizeMPI();
             return OCP_SUCCESS;
         }
     }
@@ -57,6 +63,7 @@ int main(int argc, const char* argv[])
     // Remark: It will generate a summary file in your input data directory.
     simulator.OutputResults();
 
+    FinalizeMPI();
     return OCP_SUCCESS;
 }
 
@@ -67,4 +74,5 @@ int main(int argc, const char* argv[])
 /*----------------------------------------------------------------------------*/
 /*  Shizhe Li           Oct/01/2021      Create file                          */
 /*  Chensong Zhang      Jan/07/2022      Update documentation                 */
+/*  OpenCAEPoro team    Oct/17/2026      Initialize and finalize MPI          */
 /*----------------------------------------------------------------------------*/
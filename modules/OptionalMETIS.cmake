@@ -0,0 +1,25 @@
+# ##############################################################################
+# For METIS (graph partitioning of bulks)
+# ##############################################################################
+
+option(USE_METIS "Use METIS" OFF)
+
+if(USE_METIS)
+
+  # set the path to find specific modules
+  set(METIS_DIR "${METIS_DIR}")
+
+  find_package(METIS)
+
+  if(METIS_FOUND)
+    message(STATUS "INFO: METIS found")
+    target_include_directories(${LIBNAME} PUBLIC ${METIS_INCLUDE_DIRS})
+    target_link_libraries(${LIBNAME} PUBLIC ${METIS_LIBRARIES})
+    target_compile_definitions(${LIBNAME} PUBLIC WITH_METIS=1)
+  else(METIS_FOUND)
+    message(
+      WARNING
+        "WARNING: METIS was requested but not found! Continue without it.")
+  endif(METIS_FOUND)
+
+endif(USE_METIS)
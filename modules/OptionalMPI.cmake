@@ -0,0 +1,19 @@
+# ##############################################################################
+# For MPI (distributed domain decomposition)
+# ##############################################################################
+
+option(USE_MPI "Use MPI" OFF)
+
+if(USE_MPI)
+
+  find_package(MPI COMPONENTS CXX)
+
+  if(MPI_CXX_FOUND)
+    message(STATUS "INFO: MPI found")
+    target_link_libraries(${LIBNAME} PUBLIC MPI::MPI_CXX)
+    target_compile_definitions(${LIBNAME} PUBLIC USE_MPI)
+  else(MPI_CXX_FOUND)
+    message(WARNING "WARNING: MPI was requested but disabled!")
+  endif(MPI_CXX_FOUND)
+
+endif(USE_MPI)
@@ -15,6 +15,10 @@ if(USE_OPENMP)
     message(STATUS "INFO: OpenMP found")
     set(CMAKE_C_FLAGS "${CMAKE_C_FLAGS} ${OpenMP_C_FLAGS}")
     set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} ${OpenMP_CXX_FLAGS}")
+    # CMAKE_CXX_FLAGS set here is not seen by targets in other directories
+    target_compile_options(${LIBNAME} PUBLIC ${OpenMP_CXX_FLAGS})
+    target_link_libraries(${LIBNAME} PUBLIC ${OpenMP_CXX_FLAGS})
+    target_compile_definitions(${LIBNAME} PUBLIC USE_OPENMP)
   else(OPENMP_FOUND)
     message(WARNING "WARNING: OpenMP was requested but disabled!")
   endif(OPENMP_FOUND)
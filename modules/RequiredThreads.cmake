@@ -0,0 +1,7 @@
+# ##############################################################################
+# For threads, used by asynchronous output
+# ##############################################################################
+
+find_package(Threads REQUIRED)
+
+target_link_libraries(${LIBNAME} PUBLIC Threads::Threads)
@@ -0,0 +1,354 @@
+#!/usr/bin/env python3
+"""Regression and performance benchmark for OpenCAEPoro project
+
+Runs the simulator on the bundled examples, collects the wall time of each phase,
+Newton and linear iterations, peak memory and the final values of SUMMARY.out, and
+compares them with a baseline. Accuracy drift, extra iterations, slowdowns and
+memory growth beyond the tolerances are reported as failures, and so are cases
+without a valid result in the baseline.
+
+Usage:
+    benchmark.py --exe <testOpenCAEPoro> [--suite regular|large|all] [--update]
+
+Each case runs in a copy of its example directory under --workdir, so outputs do
+not pollute the examples. With --update, the results are written to the baseline
+instead of being compared. Timings depend on the machine, so keep one baseline per
+machine (--baseline) and refresh it after intended changes.
+"""
+
+import argparse
+import datetime
+import glob
+import json
+import os
+import platform
+import re
+import shutil
+import subprocess
+import sys
+import time
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+EXAMPLES = os.path.join(ROOT, "examples")
+DEFAULT_BASELINE = os.path.join(ROOT, "regression", "benchmark_baseline.json")
+
+FIM_ARGS = ["method=FIM", "dtInit=1", "dtMax=100", "dtMin=0.1"]
+IMPEC_ARGS = ["method=IMPEC", "dtInit=0.1", "dtMax=1", "dtMin=0.1"]
+
+# name: (suite, directory in examples, data file, command-line options)
+CASES = {
+    "spe1a_IMPEC": ("regular", "spe1a", "spe1a.data", IMPEC_ARGS),
+    "spe1a_FIM": ("regular", "spe1a", "spe1a.data", FIM_ARGS),
+    "spe1b_IMPEC": ("regular", "spe1b", "spe1b.data", IMPEC_ARGS),
+    "spe1b_FIM": ("regular", "spe1b", "spe1b.data", FIM_ARGS),
+    "cornerpoint_FIM": ("regular", "cornerpoint", "CP.data", FIM_ARGS),
+    "spe3_FIM": ("regular", "spe3", "spe3.data", FIM_ARGS),
+    "spe5_FIM": ("regular", "spe5", "spe5.data",
+                 ["method=FIM", "dtInit=1", "dtMax=50", "dtMin=0.1"]),
+    "spe9_FIM": ("regular", "spe9", "spe9_FIM.data", []),
+    "spe9_IMPEC": ("regular", "spe9", "spe9_IMPEC.data", []),
+    "spe5refine_FIM": ("large", "spe5refine", "spe5-70x70x30-2y.data",
+                       ["method=FIM", "dtInit=1", "dtMax=20", "dtMin=0.1"]),
+    "spe10": ("large", "spe10", "spe10.data", []),
+}
+
+# Scaling tests use the methods in their data files
+for _data in sorted(glob.glob(os.path.join(EXAMPLES, "scaling", "**", "*.data"),
+                              recursive=True)):
+    _rel = os.path.relpath(_data, EXAMPLES)
+    CASES[os.path.splitext(_rel)[0].replace(os.sep, "/")] = (
+        "large", os.path.dirname(_rel), os.path.basename(_rel), [])
+
+# Relative tolerances, times and memory below the floors are not compared
+DEFAULT_TOL = {
+    "accuracy": 1e-4,    # final values of SUMMARY.out and final time
+    "iterations": 0.10,  # Newton and linear iterations, time steps
+    "time": 0.20,        # wall time of each phase
+    "time_floor": 0.10,  # seconds
+    "memory": 0.20,      # peak resident set size
+    "memory_floor": 16,  # MB
+}
+
+# Lines of the final report on screen
+RE_STEPS = re.compile(r"Avg time step size \.+\s+\S+ \((\d+) steps\)")
+RE_NEWTON = re.compile(r"Avg Newton steps \.+\s+\S+ \((\d+) succeeded \+ (\d+) wasted")
+RE_LINEAR = re.compile(r"Avg linear steps \.+\s+\S+ \((\d+) succeeded \+ (\d+) wasted")
+RE_FINAL = re.compile(r"Final time:\s+(\S+) \(Days\)")
+RE_TOTAL = re.compile(r"Simulation time:\s+(\S+) \(Seconds\)")
+RE_PHASE = re.compile(r"- % (\w[\w ]*?) \.+\s+\S+ \((\S+)s\)")
+
+
+def run_case(exe, name, workdir, timeout):
+    """Run a case in a copy of its directory, return its metrics."""
+    _, subdir, data, args = CASES[name]
+    rundir = os.path.join(workdir, name.replace("/", "_"))
+    if os.path.isdir(rundir):
+        shutil.rmtree(rundir)
+    shutil.copytree(os.path.join(EXAMPLES, subdir), rundir)
+
+    log = os.path.join(rundir, "benchmark.log")
+    start = time.perf_counter()
+    with open(log, "w") as out:
+        proc = subprocess.Popen([exe, data] + args + ["profile=on"], cwd=rundir,
+                                stdout=out, stderr=subprocess.STDOUT)
+        rss = None
+        if hasattr(os, "wait4"):
+            deadline = start + timeout if timeout else None
+            while True:
+                pid, status, usage = os.wait4(proc.pid, os.WNOHANG)
+                if pid != 0:
+                    proc.returncode = (os.WEXITSTATUS(status)
+                                       if os.WIFEXITED(status) else -1)
+                    # ru_maxrss is in KB on Linux and in bytes on macOS
+                    scale = 1024 * 1024 if sys.platform == "darwin" else 1024
+                    rss = usage.ru_maxrss / scale
+                    break
+                if deadline and time.perf_counter() > deadline:
+                    proc.kill()
+                    proc.wait()
+                    return {"status": "timeout"}
+                time.sleep(0.02)
+        else:
+            try:
+                proc.wait(timeout=timeout or None)
+            except subprocess.TimeoutExpired:
+                proc.kill()
+                proc.wait()
+                return {"status": "timeout"}
+    wall = time.perf_counter() - start
+
+    if proc.returncode != 0:
+        return {"status": "exit code %d" % proc.returncode}
+    with open(log) as f:
+        text = f.read()
+    metrics = parse_screen(text)
+    if metrics is None:
+        return {"status": "no final report"}
+    metrics["status"] = "ok"
+    metrics["wall"] = wall
+    metrics["peak_rss_mb"] = rss
+    metrics["profile"] = parse_profile(os.path.join(rundir, "Profile.json"))
+    metrics["summary"] = parse_summary(os.path.join(rundir, "SUMMARY.out"))
+    return metrics
+
+
+def parse_screen(text):
+    """Parse the final report of a run, return None if it is incomplete."""
+    m = [r.search(text) for r in (RE_STEPS, RE_NEWTON, RE_LINEAR, RE_FINAL, RE_TOTAL)]
+    if not all(m):
+        return None
+    phases = {p.strip().lower().replace(" ", "_"): float(t)
+              for p, t in RE_PHASE.findall(text)}
+    phases["total"] = float(m[4].group(1))
+    return {
+        "final_time": float(m[3].group(1)),
+        "steps": int(m[0].group(1)),
+        "newton": int(m[1].group(1)),
+        "newton_wasted": int(m[1].group(2)),
+        "linear": int(m[2].group(1)),
+        "linear_wasted": int(m[2].group(2)),
+        "phases": phases,
+    }
+
+
+def parse_profile(path):
+    """Return the total time of each timer and the counters of Profile.json."""
+    try:
+        with open(path) as f:
+            prof = json.load(f)
+    except (OSError, ValueError):
+        return {}
+    return {"timers": prof.get("total", {}), "counters": prof.get("counters", {})}
+
+
+def parse_summary(path):
+    """Return the values of the last row of each table in SUMMARY.out."""
+    values = {}
+    try:
+        with open(path) as f:
+            lines = f.read().splitlines()
+    except OSError:
+        return values
+    i = 0
+    while i < len(lines):
+        if not lines[i].startswith("Row "):
+            i += 1
+            continue
+        # Columns are separated by tabs, names of objects may be empty
+        items = [c.strip() for c in lines[i + 1].split("\t")[1:]]
+        objs = [c.strip() for c in lines[i + 3].split("\t")[1:]]
+        i += 4
+        last = None
+        while i < len(lines) and lines[i].strip():
+            last = lines[i].split("\t")[1:]
+            i += 1
+        if last is None or len(items) != len(last) or len(objs) != len(items):
+            continue
+        for item, obj, val in zip(items, objs, last):
+            key = item if obj in ("", "-", "FIELD") else item + ":" + obj
+            try:
+                values[key] = float(val)
+            except ValueError:
+                pass
+    return values
+
+
+def rel_diff(new, old):
+    return abs(new - old) / max(abs(old), abs(new), 1e-30)
+
+
+def compare(name, new, old, tol):
+    """Return the failures of a case against its baseline."""
+    fails = []
+    if new.get("status") != "ok":
+        return ["%s: run failed (%s)" % (name, new.get("status"))]
+    # A case can not pass without a result to compare with
+    if old is None:
+        return ["%s: no baseline, run with --update to create it" % name]
+    if old.get("status") != "ok":
+        return ["%s: baseline run failed (%s), run with --update to refresh it"
+                % (name, old.get("status"))]
+
+    # Accuracy
+    acc = [("final_time", new["final_time"], old["final_time"])]
+    for key, val in old.get("summary", {}).items():
+        if key not in new["summary"]:
+            fails.append("%s: %s is missing in SUMMARY.out" % (name, key))
+        else:
+            acc.append((key, new["summary"][key], val))
+    for key, a, b in acc:
+        if rel_diff(a, b) > tol["accuracy"]:
+            fails.append("%s: accuracy of %s drifts: %.6g -> %.6g" % (name, key, b, a))
+
+    # Iterations, fewer ones are not failures
+    for key in ("steps", "newton", "newton_wasted", "linear", "linear_wasted"):
+        a, b = new[key], old[key]
+        if a > b and a - b > tol["iterations"] * max(b, 1):
+            fails.append("%s: %s increase: %d -> %d" % (name, key, b, a))
+
+    # Performance
+    times = [("wall", new["wall"], old["wall"])]
+    for key, val in old.get("phases", {}).items():
+        if key in new["phases"]:
+            times.append((key, new["phases"][key], val))
+    new_timers = new.get("profile", {}).get("timers", {})
+    for key, val in old.get("profile", {}).get("timers", {}).items():
+        if key in new_timers:
+            times.append(("timer " + key, new_timers[key], val))
+    for key, a, b in times:
+        if a - b > tol["time_floor"] and a > b * (1 + tol["time"]):
+            fails.append("%s: %s slows down: %.3fs -> %.3fs (%+.0f%%)"
+                         % (name, key, b, a, 100 * (a - b) / b))
+    a, b = new.get("peak_rss_mb"), old.get("peak_rss_mb")
+    if a is not None and b is not None:
+        if a - b > tol["memory_floor"] and a > b * (1 + tol["memory"]):
+            fails.append("%s: peak memory grows: %.1fMB -> %.1fMB" % (name, b, a))
+    return fails
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--exe", required=True, help="simulator executable")
+    parser.add_argument("--suite", default="regular",
+                        choices=["regular", "large", "all"], help="cases to run")
+    parser.add_argument("--cases", nargs="*", help="run the given cases only")
+    parser.add_argument("--list", action="store_true", help="list cases and exit")
+    parser.add_argument("--baseline", default=DEFAULT_BASELINE, help="baseline JSON")
+    parser.add_argument("--update", action="store_true",
+                        help="write results to the baseline instead of comparing")
+    parser.add_argument("--output", help="write results of this run to a JSON file")
+    parser.add_argument("--workdir", default="benchmark_runs", help="run directory")
+    parser.add_argument("--repeat", type=int, default=1,
+                        help="runs of each case, the fastest one is kept")
+    parser.add_argument("--timeout", type=float, default=0,
+                        help="seconds allowed for a run, 0: no limit")
+    for key, val in DEFAULT_TOL.items():
+        parser.add_argument("--tol-" + key.replace("_", "-"), type=float,
+                            help="tolerance of %s, default %g" % (key, val))
+    opts = parser.parse_args()
+
+    if opts.list:
+        for name, case in CASES.items():
+            print("%-50s %s" % (name, case[0]))
+        return 0
+
+    if opts.cases:
+        names = [n for n in opts.cases if n in CASES]
+        for n in set(opts.cases) - set(names):
+            print("Unknown case: " + n)
+            return 2
+    else:
+        names = [n for n, c in CASES.items() if opts.suite in ("all", c[0])]
+
+    baseline = {"cases": {}}
+    if os.path.isfile(opts.baseline):
+        with open(opts.baseline) as f:
+            baseline = json.load(f)
+    elif not opts.update:
+        print("Baseline %s is missing, run with --update to create it"
+              % opts.baseline)
+        return 1
+
+    # Tolerances: command line, then baseline, then defaults
+    tol = dict(DEFAULT_TOL)
+    tol.update(baseline.get("tolerances", {}))
+    for key in DEFAULT_TOL:
+        val = getattr(opts, "tol_" + key)
+        if val is not None:
+            tol[key] = val
+
+    exe = os.path.abspath(opts.exe)
+    workdir = os.path.abspath(opts.workdir)
+    os.makedirs(workdir, exist_ok=True)
+    print("Benchmark of %s at %s" % (exe, datetime.datetime.now().strftime("%c")))
+    print("%-40s %6s %8s %8s %10s %10s %9s" % ("Case", "Steps", "Newton", "Linear",
+                                              "Wall(s)", "Base(s)", "RSS(MB)"))
+
+    results, fails = {}, []
+    for name in names:
+        best = None
+        for _ in range(max(opts.repeat, 1)):
+            res = run_case(exe, name, workdir, opts.timeout)
+            if res["status"] != "ok" or best is None or res["wall"] < best["wall"]:
+                best = res
+            if res["status"] != "ok":
+                break
+        results[name] = best
+        old = baseline["cases"].get(name)
+        if best["status"] == "ok":
+            print("%-40s %6d %8d %8d %10.3f %10s %9s" % (
+                name, best["steps"], best["newton"], best["linear"], best["wall"],
+                "%.3f" % old["wall"] if old and old.get("status") == "ok" else "-",
+                "%.1f" % best["peak_rss_mb"] if best["peak_rss_mb"] else "-"))
+        else:
+            print("%-40s %s" % (name, best["status"]))
+        sys.stdout.flush()
+        if not opts.update:
+            fails += compare(name, best, old, tol)
+
+    if opts.output:
+        with open(opts.output, "w") as f:
+            json.dump({"cases": results}, f, indent=2, sort_keys=True)
+
+    if opts.update:
+        baseline["cases"].update(results)
+        baseline["tolerances"] = tol
+        baseline["machine"] = "%s %s, %s" % (platform.node(), platform.machine(),
+                                            platform.platform())
+        baseline["date"] = datetime.date.today().isoformat()
+        with open(opts.baseline, "w") as f:
+            json.dump(baseline, f, indent=2, sort_keys=True)
+        print("Baseline %s is updated with %d cases" % (opts.baseline, len(results)))
+        return 0
+
+    if fails:
+        print("\n%d failures:" % len(fails))
+        for line in fails:
+            print("  " + line)
+        return 1
+    print("\nAll %d cases pass" % len(names))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
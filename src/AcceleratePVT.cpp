@@ -9,6 +9,11 @@
  *-----------------------------------------------------------------------------------
  */
 
+// Standard header files
+#include <algorithm>
+#include <cmath>
+
+// OpenCAEPoro header files
 #include "AcceleratePVT.hpp"
 
 /////////////////////////////////////////////////////////////////////
@@ -137,10 +142,112 @@ void SkipStaAnaly::UpdateLastTimeStep()
     lzi       = zi;
 }
 
+void SkipStaAnaly::WriteRestart(ofstream& out) const
+{
+    WriteBinary(out, flag);
+    WriteBinary(out, lflag);
+    for (const auto* v : {&minEigen, &P, &T, &zi, &lminEigen, &lP, &lT, &lzi}) {
+        WriteBinary(out, *v);
+    }
+}
+
+void SkipStaAnaly::ReadRestart(ifstream& in)
+{
+    ReadBinary(in, flag);
+    ReadBinary(in, lflag);
+    for (auto* v : {&minEigen, &P, &T, &zi, &lminEigen, &lP, &lT, &lzi}) {
+        ReadBinary(in, *v);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////
+// Flash Cache
+/////////////////////////////////////////////////////////////////////
+
+void FlashCache::SetParam(const vector<OCP_DBL>& param)
+{
+    dlnP     = param[0];
+    dT       = param[1];
+    dz       = param[2];
+    maxEntry = static_cast<OCP_USI>(param[3]);
+}
+
+void FlashCache::Setup(const USI& nc)
+{
+    numCom = nc;
+    keyLen = numCom + 2;
+    index.clear();
+    index.reserve(maxEntry);
+    keys.clear();
+    keys.reserve(maxEntry * keyLen);
+    Ks.clear();
+    Ks.reserve(maxEntry * numCom);
+    keyBuf.resize(keyLen);
+}
+
+OCP_ULL
+FlashCache::CalKey(const OCP_DBL& Pin, const OCP_DBL& Tin, const vector<OCP_DBL>& ziin)
+{
+    keyBuf[0] = llround(log(Pin) / dlnP);
+    keyBuf[1] = llround(Tin / dT);
+    for (USI i = 0; i < numCom; i++) keyBuf[i + 2] = llround(ziin[i] / dz);
+
+    // FNV-1a
+    OCP_ULL h = 14695981039346656037ULL;
+    for (const auto& k : keyBuf) {
+        h ^= static_cast<OCP_ULL>(k);
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+OCP_BOOL FlashCache::Find(const OCP_DBL&         Pin,
+                          const OCP_DBL&         Tin,
+                          const vector<OCP_DBL>& ziin,
+                          vector<OCP_DBL>&       Ksout)
+{
+    const auto it = index.find(CalKey(Pin, Tin, ziin));
+    if (it == index.end()) return OCP_FALSE;
+
+    const OCP_USI e = it->second;
+    if (!equal(keyBuf.begin(), keyBuf.end(), &keys[e * keyLen])) return OCP_FALSE;
+    copy(&Ks[e * numCom], &Ks[e * numCom] + numCom, Ksout.begin());
+    return OCP_TRUE;
+}
+
+void FlashCache::Insert(const OCP_DBL&         Pin,
+                        const OCP_DBL&         Tin,
+                        const vector<OCP_DBL>& ziin,
+                        const vector<OCP_DBL>& Ksin)
+{
+    const OCP_ULL h  = CalKey(Pin, Tin, ziin);
+    const auto    it = index.find(h);
+    OCP_USI       e;
+    if (it != index.end()) {
+        // replace the old one, its key may be different
+        e = it->second;
+    } else {
+        if (index.size() == maxEntry) {
+            index.clear();
+            keys.clear();
+            Ks.clear();
+        }
+        e = index.size();
+        index[h] = e;
+        keys.resize((e + 1) * keyLen);
+        Ks.resize((e + 1) * numCom);
+    }
+    copy(keyBuf.begin(), keyBuf.end(), &keys[e * keyLen]);
+    copy(Ksin.begin(), Ksin.begin() + numCom, &Ks[e * numCom]);
+}
+
 /*----------------------------------------------------------------------------*/
 /*  Brief Change History of This File                                         */
 /*----------------------------------------------------------------------------*/
 /*  Author              Date             Actions                              */
 /*----------------------------------------------------------------------------*/
 /*  Shizhe Li           Dec/25/2022      Create file                          */
+/*  OpenCAEPoro team    Oct/16/2026      Add FlashCache                       */
+/*  OpenCAEPoro team    Oct/16/2026      Add restart of SkipStaAnaly          */
+/*  OpenCAEPoro team    Oct/17/2026      Add KVCACHE keyword                  */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
@@ -0,0 +1,129 @@
+/*! \file    AdaptiveTimeStep.cpp
+ *  \brief   AdaptiveTimeStep class definition
+ *  \author  OpenCAEPoro team
+ *  \date    Oct/16/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the OpenCAEPoro team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+// Standard header files
+#include <algorithm>
+#include <cmath>
+
+// OpenCAEPoro header files
+#include "AdaptiveTimeStep.hpp"
+#include "UtilRestart.hpp"
+
+// Gains of PI control
+const OCP_DBL PI_KI      = 1.0;  ///< Integral gain
+const OCP_DBL PI_KP      = 0.05; ///< Proportional gain
+const OCP_DBL PI_MIN_ERR = 1E-3; ///< Errors below it are treated as it
+
+// Prediction by Newton iterations and failures
+const USI     NR_MIN_TARGET = 3;    ///< Min target of Newton iterations
+const OCP_DBL NR_MAX_RATE   = 0.9;  ///< Slower rates are not used in estimation
+const USI     NR_STALL_ITER = 3;    ///< Iterations without progress of a stall
+const OCP_DBL NR_STALL_FAC  = 0.9;  ///< Progress needed on the min residual
+const OCP_DBL CUT_MIN       = 0.1;  ///< Min factor of cuts estimated by Newton rates
+const OCP_DBL CUT_MAX       = 0.7;  ///< Max factor of cuts estimated by Newton rates
+const OCP_DBL CUT_REPEAT    = 0.5;  ///< Extra factor of each repeated failure
+const OCP_DBL FAIL_SAFE     = 0.95; ///< Fraction of a failed step allowed before it
+const USI     MAX_CUTS      = 16;   ///< Num of recent cuts kept
+
+OCP_DBL AdaptiveTimeStep::GetFactor(const OCP_DBL& ratio)
+{
+    if (ratio * TINY >= 1) return ratio;
+
+    // Missing history is treated as the current error
+    const OCP_DBL e  = max(1 / ratio, PI_MIN_ERR);
+    const OCP_DBL e1 = lastErr > 0 ? lastErr : e;
+    lastErr          = e;
+
+    return pow(1 / e, PI_KI) * pow(e1 / e, PI_KP);
+}
+
+OCP_DBL AdaptiveTimeStep::Cut(const OCP_DBL&  t,
+                              const OCP_DBL&  dt,
+                              const OCP_DBL&  fac,
+                              const OCP_BOOL& byNR,
+                              const OCP_DBL&  tol,
+                              const USI&      maxNRiter)
+{
+    OCP_DBL factor = fac;
+    if (byNR) {
+        const OCP_DBL est = EstimateByNR(tol, max(NR_MIN_TARGET, maxNRiter / 2));
+        if (est > 0) factor = min(max(est, CUT_MIN), CUT_MAX);
+    }
+
+    // Failures repeated from the same time cut harder
+    for (const auto& c : cuts) {
+        if (fabs(c.time - t) < TINY) factor *= CUT_REPEAT;
+    }
+
+    cuts.push_back({t, dt, static_cast<USI>(resNR.size()), factor});
+    if (cuts.size() > MAX_CUTS) cuts.pop_front();
+
+    // Changes of the retried step are not comparable with the history
+    lastErr = 0;
+    return factor;
+}
+
+OCP_DBL AdaptiveTimeStep::GetMaxDt(const OCP_DBL& t) const
+{
+    OCP_DBL dtMax = 1 / TINY;
+    for (const auto& c : cuts) {
+        if (c.time + c.dt > t + TINY) dtMax = min(dtMax, FAIL_SAFE * c.dt);
+    }
+    return dtMax;
+}
+
+OCP_BOOL AdaptiveTimeStep::IfStalled() const
+{
+    const USI k = resNR.size();
+    if (k < 2 * NR_STALL_ITER) return OCP_FALSE;
+
+    // Newton iterations which cycle never reach the min residual again
+    const OCP_DBL last = *min_element(resNR.end() - NR_STALL_ITER, resNR.end());
+    const OCP_DBL prev = *min_element(resNR.begin(), resNR.end() - NR_STALL_ITER);
+    return last > NR_STALL_FAC * prev;
+}
+
+OCP_DBL AdaptiveTimeStep::EstimateByNR(const OCP_DBL& tol, const USI& target) const
+{
+    const USI k = resNR.size();
+    if (k < 2 || resNR[0] <= 0) return 0;
+
+    const OCP_DBL rate = pow(resNR[k - 1] / resNR[0], 1.0 / (k - 1));
+    if (!(rate > 0 && rate < NR_MAX_RATE)) return 0;
+
+    return tol / resNR[0] * pow(rate, 1.0 - target);
+}
+
+void AdaptiveTimeStep::WriteRestart(ofstream& out) const
+{
+    WriteBinary(out, lastErr);
+    WriteBinary(out, vector<TimeStepCut>(cuts.begin(), cuts.end()));
+}
+
+void AdaptiveTimeStep::ReadRestart(ifstream& in)
+{
+    ReadBinary(in, lastErr);
+    OCP_ULL n;
+    ReadBinary(in, n);
+    if (n > MAX_CUTS) OCP_ABORT("Restart file does not match the model!");
+    cuts.resize(n);
+    for (auto& c : cuts) ReadBinary(in, c);
+    resNR.clear();
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  OpenCAEPoro team    Oct/16/2026      Create file                          */
+/*  OpenCAEPoro team    Oct/17/2026      Save controller state in restart     */
+/*----------------------------------------------------------------------------*/
@@ -169,7 +169,9 @@ void AllWells::SetupConnWell2Bulk(const Bulk& myBulk)
     well2bulk.resize(numWell);
     USI wId = 0;
     for (auto& w : wells) {
-        for (auto& p : w.perf) well2bulk[wId].push_back(p.Location());
+        if (w.ifOwned) {
+            for (auto& p : w.perf) well2bulk[wId].push_back(p.Location());
+        }
         wId++;
     }
 }
@@ -180,12 +182,16 @@ void AllWells::ApplyControl(const USI& i)
     wellChange = OCP_FALSE;
     USI wId    = 0;
     for (USI w = 0; w < numWell; w++) {
-        wells[w].opt = wells[w].optSet[i];
+        const auto& opt = wells[w].optSet[i];
+        wells[w].opt    = opt;
+        // wells owned by other processes are closed here
+        if (!wells[w].ifOwned) wells[w].opt.state = CLOSE;
         if (wells[w].IsOpen()) {
             wells[w].wOId = wId;
             wId++;
         }
-        if (i > 0 && wells[w].opt != wells[w].optSet[i - 1]) wellChange = OCP_TRUE;
+        if (i > 0 && opt != wells[w].optSet[i - 1]) wellChange = OCP_TRUE;
+        if (i > 0 && opt.state != wells[w].optSet[i - 1].state) openWellSetId++;
     }
 }
 
@@ -194,7 +200,7 @@ void AllWells::InitBHP(const Bulk& myBulk)
     OCP_FUNCNAME;
 
     for (USI w = 0; w < numWell; w++) {
-        wells[w].InitBHP(myBulk);
+        if (wells[w].ifOwned) wells[w].InitBHP(myBulk);
     }
 }
 
@@ -333,6 +339,55 @@ void AllWells::ResetBHP()
     }
 }
 
+void AllWells::WriteRestart(ofstream& out) const
+{
+    WriteBinary(out, numWell);
+    for (const auto& w : wells) {
+        WriteBinary(out, w.bhp);
+        WriteBinary(out, w.lbhp);
+        WriteBinary(out, w.dG);
+        WriteBinary(out, w.ldG);
+        for (const auto* v : {&w.WOPT, &w.WGPT, &w.WWPT, &w.WGIT, &w.WWIT}) {
+            WriteBinary(out, *v);
+        }
+        // Current operation mode and perforations, which may differ from input
+        WriteBinary(out, w.opt.optMode);
+        WriteBinary(out, w.opt.state);
+        WriteBinary(out, w.numPerf);
+        for (const auto& p : w.perf) {
+            WriteBinary(out, p.state);
+            WriteBinary(out, p.multiplier);
+        }
+    }
+    for (const auto* v : {&FGIT, &FWIT, &FOPT, &FGPt, &FWPT}) WriteBinary(out, *v);
+}
+
+void AllWells::ReadRestart(ifstream& in)
+{
+    USI nw;
+    ReadBinary(in, nw);
+    if (nw != numWell) OCP_ABORT("Restart file does not match the model!");
+    for (auto& w : wells) {
+        ReadBinary(in, w.bhp);
+        ReadBinary(in, w.lbhp);
+        ReadBinary(in, w.dG);
+        ReadBinary(in, w.ldG);
+        for (auto* v : {&w.WOPT, &w.WGPT, &w.WWPT, &w.WGIT, &w.WWIT}) {
+            ReadBinary(in, *v);
+        }
+        ReadBinary(in, w.opt.optMode);
+        ReadBinary(in, w.opt.state);
+        USI np;
+        ReadBinary(in, np);
+        if (np != w.numPerf) OCP_ABORT("Restart file does not match the model!");
+        for (auto& p : w.perf) {
+            ReadBinary(in, p.state);
+            ReadBinary(in, p.multiplier);
+        }
+    }
+    for (auto* v : {&FGIT, &FWIT, &FOPT, &FGPt, &FWPT}) ReadBinary(in, *v);
+}
+
 OCP_INT AllWells::CheckP(const Bulk& myBulk)
 {
     OCP_FUNCNAME;
@@ -382,6 +437,15 @@ USI AllWells::GetIndex(const string& name) const
     OCP_ABORT("Well name not found!");
 }
 
+vector<vector<OCP_USI>> AllWells::GetWellPerfGrid(const Grid& myGrid) const
+{
+    vector<vector<OCP_USI>> perfGrid(numWell);
+    for (USI w = 0; w < numWell; w++) {
+        perfGrid[w] = wells[w].GetPerfGrid(myGrid);
+    }
+    return perfGrid;
+}
+
 USI AllWells::GetWellPerfNum() const
 {
     USI numPerf = 0;
@@ -410,6 +474,7 @@ void AllWells::CalMaxBHPChange()
             dPmax = max(dPmax, fabs(wells[w].bhp - wells[w].lbhp));
         }
     }
+    dPmax = AllReduceMax(dPmax);
 }
 
 void AllWells::SetPolyhedronWell(const Grid& myGrid)
@@ -453,4 +518,7 @@ void AllWells::SetWellVal() const
 /*----------------------------------------------------------------------------*/
 /*  Shizhe Li           Oct/01/2021      Create file                          */
 /*  Chensong Zhang      Oct/15/2021      Format file                          */
+/*  OpenCAEPoro team    Oct/16/2026      Add restart                          */
+/*  OpenCAEPoro team    Oct/17/2026      Save well modes in restart files     */
+/*  OpenCAEPoro team    Oct/17/2026      Distribute FIM among MPI processes   */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
@@ -46,12 +46,12 @@ void HeatLoss::Setup(const OCP_USI& nb)
     }
 }
 
-void HeatLoss::CalHeatLoss(const vector<USI>&     location,
-                           const vector<OCP_DBL>& T,
-                           const vector<OCP_DBL>& lT,
-                           const vector<OCP_DBL>& initT,
-                           const OCP_DBL&         t,
-                           const OCP_DBL&         dt)
+void HeatLoss::CalHeatLoss(const vector<USI>&       location,
+                           const OCPArray<OCP_DBL>& T,
+                           const OCPArray<OCP_DBL>& lT,
+                           const vector<OCP_DBL>&   initT,
+                           const OCP_DBL&           t,
+                           const OCP_DBL&           dt)
 {
     if (ifHLoss) {
         OCP_DBL lambda, d, dT, theta;
@@ -91,6 +91,16 @@ void HeatLoss::UpdateLastTimeStep()
     lpT = pT;
 }
 
+void HeatLoss::WriteRestart(ofstream& out) const
+{
+    for (const auto* v : {&I, &p, &pT, &lI, &lp, &lpT}) WriteBinary(out, *v);
+}
+
+void HeatLoss::ReadRestart(ifstream& in)
+{
+    for (auto* v : {&I, &p, &pT, &lI, &lp, &lpT}) ReadBinary(in, *v);
+}
+
 /////////////////////////////////////////////////////////////////////
 // Input Param and Setup
 /////////////////////////////////////////////////////////////////////
@@ -409,7 +419,8 @@ void Bulk::SetupIsoT(const Grid& myGrid)
 {
     OCP_FUNCNAME;
 
-    numBulk = myGrid.activeGridNum;
+    numBulk      = myGrid.activeGridNum;
+    numOwnedBulk = myGrid.ownedGridNum;
     AllocateGridRockIsoT(myGrid);
     AllocateRegion(myGrid);
     AllocateError();
@@ -418,7 +429,8 @@ void Bulk::SetupIsoT(const Grid& myGrid)
 /// Allocate memory for fluid grid for ifThermal model
 void Bulk::SetupT(const Grid& myGrid)
 {
-    numBulk = myGrid.activeGridNum;
+    numBulk      = myGrid.activeGridNum;
+    numOwnedBulk = myGrid.ownedGridNum;
     AllocateGridRockT(myGrid);
     AllocateRegion(myGrid);
     SetupBulkType(myGrid);
@@ -461,14 +473,15 @@ void Bulk::InitPTSw(const USI& tabrow)
         Zmin          = Zmin < temp1 ? Zmin : temp1;
         Zmax          = Zmax > temp2 ? Zmax : temp2;
     }
+    Zmin = AllReduceMin(Zmin);
+    Zmax = AllReduceMax(Zmax);
     OCP_DBL tabdz = (Zmax - Zmin) / (tabrow - 1);
 
-    // create table
-    OCPTable         DepthP(tabrow, 4);
-    vector<OCP_DBL>& Ztmp  = DepthP.GetCol(0);
-    vector<OCP_DBL>& Potmp = DepthP.GetCol(1);
-    vector<OCP_DBL>& Pgtmp = DepthP.GetCol(2);
-    vector<OCP_DBL>& Pwtmp = DepthP.GetCol(3);
+    // columns of table
+    vector<OCP_DBL> Ztmp(tabrow, 0);
+    vector<OCP_DBL> Potmp(tabrow, 0);
+    vector<OCP_DBL> Pgtmp(tabrow, 0);
+    vector<OCP_DBL> Pwtmp(tabrow, 0);
 
     vector<OCP_DBL> tmpInitZi(numCom, 0);
 
@@ -959,6 +972,8 @@ void Bulk::InitPTSw(const USI& tabrow)
         }
     }
 
+    // create table
+    const OCPTable DepthP({Ztmp, Potmp, Pgtmp, Pwtmp});
     DepthP.Display();
 
     // calculate Pc from DepthP to calculate Sj
@@ -972,20 +987,24 @@ void Bulk::InitPTSw(const USI& tabrow)
         }
     }
 
+    if (initT_flag) {
+        initT_Tab[0].EvalBatch(0, numBulk, depth.data(), 1, initT.data());
+        for (OCP_USI n = 0; n < numBulk; n++) T[n] = initT[n];
+    }
+
+    // neighboring bulks have close depth, rows of last bulk are tried first
+    USI zHint = 0;
+    USI pHint = 0;
+    USI bHint = 0;
     for (OCP_USI n = 0; n < numBulk; n++) {
         if (initZi_flag) {
-            initZi_Tab[0].Eval_All0(depth[n], tmpInitZi);
+            initZi_Tab[0].Eval_All0(depth[n], tmpInitZi, &zHint);
             for (USI i = 0; i < numComH; i++) {
                 Ni[n * numCom + i] = tmpInitZi[i];
             }
         }
-        if (initT_flag) {
-            myTemp   = initT_Tab[0].Eval(0, depth[n], 1);
-            initT[n] = myTemp;
-            T[n]     = myTemp;
-        }
 
-        DepthP.Eval_All(0, depth[n], data, cdata);
+        DepthP.Eval_All(0, depth[n], data, cdata, &pHint);
         OCP_DBL Po   = data[1];
         OCP_DBL Pg   = data[2];
         OCP_DBL Pw   = data[3];
@@ -1018,7 +1037,7 @@ void Bulk::InitPTSw(const USI& tabrow)
         if (depth[n] < DOGC) {
             Pbb = Po;
         } else if (PBVD_flag) {
-            Pbb = EQUIL.PBVD.Eval(0, depth[n], 1);
+            Pbb = EQUIL.PBVD.Eval(0, depth[n], 1, &bHint);
         }
         Pb[n] = Pbb;
 
@@ -1038,7 +1057,7 @@ void Bulk::InitPTSw(const USI& tabrow)
             OCP_DBL tmpSw = 0;
             OCP_DBL tmpSg = 0;
             OCP_DBL dep   = depth[n] + dz[n] / ncut * (k - (ncut - 1) / 2.0);
-            DepthP.Eval_All(0, dep, data, cdata);
+            DepthP.Eval_All(0, dep, data, cdata, &pHint);
             Po   = data[1];
             Pg   = data[2];
             Pw   = data[3];
@@ -1095,17 +1114,43 @@ void Bulk::SetupBulkType(const Grid& myGrid)
 {
     bType.resize(numBulk, 0);
 
-    OCP_USI count = 0;
     for (OCP_USI n = 0; n < myGrid.numGrid; n++) {
-        if (myGrid.map_All2Act[n].IsAct()) {
-            if (myGrid.map_All2Flu[n].IsAct()) {
-                bType[count]++;
-            }
-            count++;
+        if (myGrid.map_All2Act[n].IsAct() && myGrid.map_All2Flu[n].IsAct()) {
+            bType[myGrid.map_All2Act[n].GetId()]++;
         }
     }
 }
 
+void Bulk::OutMixtureIters() const
+{
+    if (numThreads <= 1) {
+        flashCal[0]->OutMixtureIters();
+    } else {
+        // iterations of the first PVT region are collected from all threads
+        Mixture* mix = flashCal[0]->Clone();
+        for (USI t = 1; t < numThreads; t++) {
+            mix->AddMixtureIters(flashCalT[t * NTPVT]);
+        }
+        mix->OutMixtureIters();
+        delete mix;
+    }
+}
+
+void Bulk::SetupFlashThreads()
+{
+    numThreads = GetMaxThreads();
+
+    flashCalT.clear();
+    flashCalT.reserve(numThreads * NTPVT);
+    flashCalT.insert(flashCalT.end(), flashCal.begin(), flashCal.end());
+    for (USI t = 1; t < numThreads; t++) {
+        for (USI i = 0; i < NTPVT; i++) flashCalT.push_back(flashCal[i]->Clone());
+    }
+
+    maxNRdSSPT.resize(numThreads, 0);
+    index_maxNRdSSPT.resize(numThreads, 0);
+}
+
 /////////////////////////////////////////////////////////////////////
 // Basic PVT Model Information
 /////////////////////////////////////////////////////////////////////
@@ -1196,13 +1241,13 @@ OCP_DBL Bulk::CalFPR() const
     OCP_DBL tmp  = 0;
 
     if (numPhase == 3) {
-        for (OCP_USI n = 0; n < numBulk; n++) {
+        for (OCP_USI n = 0; n < numOwnedBulk; n++) {
             tmp = rockVp[n] * (1 - S[n * numPhase + 2]);
             ptmp += P[n] * tmp;
             vtmp += tmp;
         }
     } else if (numPhase < 3) {
-        for (OCP_USI n = 0; n < numBulk; n++) {
+        for (OCP_USI n = 0; n < numOwnedBulk; n++) {
             tmp = rockVp[n] * (S[n * numPhase]);
             ptmp += P[n] * tmp;
             vtmp += tmp;
@@ -1210,7 +1255,9 @@ OCP_DBL Bulk::CalFPR() const
     } else {
         OCP_ABORT("Number of phases is out of range!");
     }
-    return ptmp / vtmp;
+    OCP_DBL sum[2] = {ptmp, vtmp};
+    AllReduceSum(sum, 2);
+    return sum[0] / sum[1];
 }
 
 OCP_DBL Bulk::CalFTR() const
@@ -1220,12 +1267,14 @@ OCP_DBL Bulk::CalFTR() const
     OCP_DBL Ttmp = 0;
     OCP_DBL vtmp = 0;
 
-    for (OCP_USI n = 0; n < numBulk; n++) {
+    for (OCP_USI n = 0; n < numOwnedBulk; n++) {
         Ttmp += T[n] * v[n];
         vtmp += v[n];
     }
+    OCP_DBL sum[2] = {Ttmp, vtmp};
+    AllReduceSum(sum, 2);
 
-    return Ttmp / vtmp;
+    return sum[0] / sum[1];
 }
 
 /////////////////////////////////////////////////////////////////////
@@ -1235,8 +1284,8 @@ OCP_DBL Bulk::CalFTR() const
 OCP_DBL Bulk::CalNRdSmax(OCP_USI& index)
 {
     NRdSmax     = 0;
-    OCP_USI len = numBulk * numPhase;
-    for (USI n = 0; n < len; n++) {
+    OCP_USI len = numOwnedBulk * numPhase;
+    for (OCP_USI n = 0; n < len; n++) {
         if (fabs(NRdSmax) < fabs(dSNR[n])) {
             NRdSmax = dSNR[n];
             index   = n;
@@ -1246,6 +1295,26 @@ OCP_DBL Bulk::CalNRdSmax(OCP_USI& index)
     return NRdSmax;
 }
 
+void Bulk::ResetMaxNRdSSP()
+{
+    maxNRdSSP       = 0;
+    index_maxNRdSSP = 0;
+    fill(maxNRdSSPT.begin(), maxNRdSSPT.end(), 0.0);
+    fill(index_maxNRdSSPT.begin(), index_maxNRdSSPT.end(), 0);
+}
+
+void Bulk::ReduceMaxNRdSSP()
+{
+    // Bulks are distributed to threads in order with static schedule, so the result
+    // is the same as the one of serial loop.
+    for (USI t = 0; t < numThreads; t++) {
+        if (fabs(maxNRdSSP) < fabs(maxNRdSSPT[t])) {
+            maxNRdSSP       = maxNRdSSPT[t];
+            index_maxNRdSSP = index_maxNRdSSPT[t];
+        }
+    }
+}
+
 /// Return OCP_TRUE if no negative pressure and OCP_FALSE otherwise.
 OCP_INT Bulk::CheckP() const
 {
@@ -1344,7 +1413,7 @@ void Bulk::CalMaxChange()
     OCP_DBL tmp = 0;
     OCP_USI id;
 
-    for (OCP_USI n = 0; n < numBulk; n++) {
+    for (OCP_USI n = 0; n < numOwnedBulk; n++) {
 
         // dP
         tmp = fabs(P[n] - lP[n]);
@@ -1385,6 +1454,14 @@ void Bulk::CalMaxChange()
             eVmax = tmp;
         }
     }
+
+    OCP_DBL maxChange[5] = {dPmax, dTmax, dSmax, dNmax, eVmax};
+    AllReduceMax(maxChange, 5);
+    dPmax = maxChange[0];
+    dTmax = maxChange[1];
+    dSmax = maxChange[2];
+    dNmax = maxChange[3];
+    eVmax = maxChange[4];
 }
 
 /////////////////////////////////////////////////////////////////////
@@ -1423,6 +1500,33 @@ void Bulk::ShowFIMBulk(const OCP_BOOL& flag) const
     }
 }
 
+/////////////////////////////////////////////////////////////////////
+// Restart
+/////////////////////////////////////////////////////////////////////
+
+void Bulk::WriteRestart(ofstream& out) const
+{
+    WriteBinary(out, numBulk);
+    WriteBinary(out, numPhase);
+    WriteBinary(out, numCom);
+    stateArena.WriteRestart(out);
+    hLoss.WriteRestart(out);
+}
+
+void Bulk::ReadRestart(ifstream& in)
+{
+    OCP_USI nb;
+    USI     np, nc;
+    ReadBinary(in, nb);
+    ReadBinary(in, np);
+    ReadBinary(in, nc);
+    if (nb != numBulk || np != numPhase || nc != numCom) {
+        OCP_ABORT("Restart file does not match the model!");
+    }
+    stateArena.ReadRestart(in);
+    hLoss.ReadRestart(in);
+}
+
 /*----------------------------------------------------------------------------*/
 /*  Brief Change History of This File                                         */
 /*----------------------------------------------------------------------------*/
@@ -1431,4 +1535,8 @@ void Bulk::ShowFIMBulk(const OCP_BOOL& flag) const
 /*  Shizhe Li           Oct/01/2021      Create file                          */
 /*  Chensong Zhang      Oct/15/2021      Format file                          */
 /*  Chensong Zhang      Jan/09/2022      Update Doxygen                       */
+/*  OpenCAEPoro team    Oct/16/2026      Add restart                          */
+/*  OpenCAEPoro team    Oct/16/2026      Use stateless table lookup           */
+/*  OpenCAEPoro team    Oct/17/2026      Reorder active cells                 */
+/*  OpenCAEPoro team    Oct/17/2026      Distribute FIM among MPI processes   */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
@@ -10,6 +10,7 @@
  */
 
 // Standard header files
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <ctime>
@@ -39,63 +40,64 @@ void BulkConn::Setup(const Grid& myGrid)
     selfPtr.resize(numBulk);
     neighborNum.resize(numBulk);
 
-    vector<GPair> tmp1, tmp2;
-    USI           len;
-    OCP_USI       bIdb;
-
-    for (OCP_USI n = 0; n < myGrid.numGrid; n++) {
-        const GB_Pair& GBtmp = myGrid.map_All2Act[n];
-
-        if (GBtmp.IsAct()) {
-            bIdb = GBtmp.GetId();
-
-            // Get rid of inactive neighbor
-            tmp1 = myGrid.gNeighbor[n];
-            len  = tmp1.size();
-            tmp2.clear();
-            for (USI i = 0; i < len; i++) {
-                const GB_Pair& GBtmp2 = myGrid.map_All2Act[tmp1[i].id];
-
-                if (GBtmp2.IsAct()) {
-                    tmp1[i].id = GBtmp2.GetId();
-                    tmp2.push_back(tmp1[i]);
-                }
-            }
-            // Add Self
-            tmp2.push_back(GPair(bIdb, 0, 0.0, 0.0));
-            // Sort: Ascending
-            sort(tmp2.begin(), tmp2.end(), GPair::lessG);
-            // Find SelfPtr and Assign to neighbor and area
-            len = tmp2.size();
-            for (USI i = 0; i < len; i++) {
-                neighbor[bIdb].push_back(tmp2[i].id);
-                if (tmp2[i].id == bIdb) {
-                    selfPtr[bIdb] = i;
+    // Active neighbors of each bulk in ascending order, where the ones after the bulk
+    // itself give the connections of the bulk
+    vector<OCP_USI> connBegin(numBulk + 1, 0);
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for (OCP_USI bIdb = 0; bIdb < numBulk; bIdb++) {
+        const OCP_USI        n  = myGrid.map_Act2All[bIdb];
+        const vector<GPair>& gn = myGrid.gNeighbor[n];
+        vector<OCP_USI>&     nb = neighbor[bIdb];
+        nb.reserve(gn.size() + 1);
+        // Get rid of inactive neighbor and add self
+        for (const GPair& g : gn) {
+            const GB_Pair& GBtmp = myGrid.map_All2Act[g.id];
+            if (GBtmp.IsAct()) nb.push_back(GBtmp.GetId());
+        }
+        nb.push_back(bIdb);
+        // Sort: Ascending
+        sort(nb.begin(), nb.end());
+        selfPtr[bIdb]     = lower_bound(nb.begin(), nb.end(), bIdb) - nb.begin();
+        neighborNum[bIdb] = nb.size();
+        connBegin[bIdb]   = nb.size() - selfPtr[bIdb] - 1;
+    }
+    numConn            = ExclusiveScan(connBegin.data(), numBulk);
+    connBegin[numBulk] = numConn;
+
+    iteratorConn.resize(numConn);
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for (OCP_USI bIdb = 0; bIdb < numBulk; bIdb++) {
+        const vector<GPair>& gn = myGrid.gNeighbor[myGrid.map_Act2All[bIdb]];
+        for (USI j = selfPtr[bIdb] + 1; j < neighborNum[bIdb]; j++) {
+            const OCP_USI eIdb = neighbor[bIdb][j];
+            for (const GPair& g : gn) {
+                if (myGrid.map_Act2All[eIdb] == g.id) {
+                    iteratorConn[connBegin[bIdb] + j - selfPtr[bIdb] - 1] =
+                        BulkPair(bIdb, eIdb, g.direction, g.areaB, g.areaE);
+                    break;
                 }
             }
-            for (USI j = selfPtr[bIdb] + 1; j < len; j++) {
-                iteratorConn.push_back(BulkPair(bIdb, tmp2[j].id, tmp2[j].direction,
-                                                tmp2[j].areaB, tmp2[j].areaE));
-            }
-            neighborNum[bIdb] = len;
         }
     }
 
-    numConn = iteratorConn.size();
-
     // PrintConnectionInfoCoor(myGrid);
 }
 
 void BulkConn::CalAkd(const Bulk& myBulk)
 {
-    OCP_USI bId, eId;
-    OCP_DBL areaB, areaE;
-    OCP_DBL T1, T2;
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
     for (OCP_USI c = 0; c < numConn; c++) {
-        bId   = iteratorConn[c].bId;
-        eId   = iteratorConn[c].eId;
-        areaB = iteratorConn[c].areaB;
-        areaE = iteratorConn[c].areaE;
+        const OCP_USI bId   = iteratorConn[c].bId;
+        const OCP_USI eId   = iteratorConn[c].eId;
+        const OCP_DBL areaB = iteratorConn[c].areaB;
+        const OCP_DBL areaE = iteratorConn[c].areaE;
+        OCP_DBL       T1, T2;
         switch (iteratorConn[c].direction) {
             case 1:
                 T1 = myBulk.ntg[bId] * myBulk.rockKx[bId] * areaB;
@@ -116,6 +118,71 @@ void BulkConn::CalAkd(const Bulk& myBulk)
     }
 }
 
+/////////////////////////////////////////////////////////////////////
+// Matrix Pattern
+/////////////////////////////////////////////////////////////////////
+
+void BulkConn::SetupMatPattern()
+{
+    vector<USI> rowLen(numBulk, 1);
+
+    connPosB.resize(numConn);
+    connPosE.resize(numConn);
+    for (OCP_USI c = 0; c < numConn; c++) {
+        connPosB[c] = rowLen[iteratorConn[c].bId]++;
+        connPosE[c] = rowLen[iteratorConn[c].eId]++;
+    }
+
+    rowConnPtr.resize(numBulk + 1);
+    rowConnPtr[0] = 0;
+    for (OCP_USI n = 0; n < numBulk; n++) {
+        rowConnPtr[n + 1] = rowConnPtr[n] + rowLen[n] - 1;
+    }
+
+    rowConn.resize(2 * numConn);
+    for (OCP_USI c = 0; c < numConn; c++) {
+        rowConn[rowConnPtr[iteratorConn[c].bId] + connPosB[c] - 1] = c;
+        rowConn[rowConnPtr[iteratorConn[c].eId] + connPosE[c] - 1] = c;
+    }
+}
+
+void BulkConn::SetupMatRows(LinearSystem& ls) const
+{
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (OCP_USI n = 0; n < numBulk; n++) {
+        const USI len = rowConnPtr[n + 1] - rowConnPtr[n] + 1;
+        ls.NewRow(n, len);
+        for (USI k = 1; k < len; k++) {
+            const BulkPair& bp = iteratorConn[rowConn[rowConnPtr[n] + k - 1]];
+            ls.SetColId(n, k, bp.bId == n ? bp.eId : bp.bId);
+        }
+    }
+}
+
+void BulkConn::AssembleMatDiag(LinearSystem& ls) const
+{
+    // The block of bId (eId) in the row of eId (bId) is exactly the opposite of the
+    // contribution of the connection to the diagonal block of bId (eId), and they are
+    // added in the order of connections, which is the same as the serial assembling.
+    const USI bsize = ls.GetBlockSize();
+
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (OCP_USI n = 0; n < numBulk; n++) {
+        OCP_DBL* diag = ls.GetVal(n, 0);
+        for (OCP_USI k = rowConnPtr[n]; k < rowConnPtr[n + 1]; k++) {
+            const OCP_USI   c       = rowConn[k];
+            const BulkPair& bp      = iteratorConn[c];
+            const OCP_DBL*  offDiag = bp.bId == n ? ls.GetVal(bp.eId, connPosE[c])
+                                                  : ls.GetVal(bp.bId, connPosB[c]);
+            for (USI i = 0; i < bsize; i++) diag[i] -= offDiag[i];
+        }
+    }
+}
+
 void BulkConn::PrintConnectionInfo(const Grid& myGrid) const
 {
     for (OCP_USI i = 0; i < numBulk; i++) {
@@ -290,6 +357,36 @@ void BulkConn::CalResFIMS(vector<OCP_DBL>& res, const Bulk& myBulk, const OCP_DB
     }
 }
 
+/////////////////////////////////////////////////////////////////////
+// Restart
+/////////////////////////////////////////////////////////////////////
+
+void BulkConn::WriteRestart(ofstream& out) const
+{
+    WriteBinary(out, numConn);
+    WriteBinary(out, upblock);
+    WriteBinary(out, lupblock);
+    for (const auto* v : {&upblock_Rho, &upblock_Trans, &upblock_Velocity, &Adkt,
+                          &lupblock_Rho, &lupblock_Trans, &lupblock_Velocity, &lAdkt,
+                          &AdktP, &AdktT, &AdktS, &lAdktP, &lAdktT, &lAdktS}) {
+        WriteBinary(out, *v);
+    }
+}
+
+void BulkConn::ReadRestart(ifstream& in)
+{
+    OCP_USI nc;
+    ReadBinary(in, nc);
+    if (nc != numConn) OCP_ABORT("Restart file does not match the model!");
+    ReadBinary(in, upblock);
+    ReadBinary(in, lupblock);
+    for (auto* v : {&upblock_Rho, &upblock_Trans, &upblock_Velocity, &Adkt,
+                    &lupblock_Rho, &lupblock_Trans, &lupblock_Velocity, &lAdkt, &AdktP,
+                    &AdktT, &AdktS, &lAdktP, &lAdktT, &lAdktS}) {
+        ReadBinary(in, *v);
+    }
+}
+
 /*----------------------------------------------------------------------------*/
 /*  Brief Change History of This File                                         */
 /*----------------------------------------------------------------------------*/
@@ -297,4 +394,6 @@ void BulkConn::CalResFIMS(vector<OCP_DBL>& res, const Bulk& myBulk, const OCP_DB
 /*----------------------------------------------------------------------------*/
 /*  Shizhe Li           Oct/01/2021      Create file                          */
 /*  Chensong Zhang      Oct/15/2021      Format file                          */
+/*  OpenCAEPoro team    Oct/16/2026      Add restart                          */
+/*  OpenCAEPoro team    Oct/17/2026      Parallel setup of connections        */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
@@ -11,14 +11,6 @@
 
 #include "CornerGrid.hpp"
 
-Point3D& Point3D::operator=(const Point3D& other)
-{
-    x = other.x;
-    y = other.y;
-    z = other.z;
-    return *this;
-}
-
 Point3D Point3D::operator+(const Point3D& other) const
 {
     return Point3D(x + other.x, y + other.y, z + other.z);
@@ -564,69 +556,12 @@ OCP_DBL CalAreaNotQuadr(const HexahedronFace& FACE1, const HexahedronFace& FACE2
     return CalAreaNotQuadr;
 }
 
-void ConnGrid::Allocate(const USI& max_neighbor)
-{
-    nConn   = 0;
-    maxConn = max_neighbor;
-    halfConn.resize(maxConn);
-}
-
-void ConnGrid::AddHalfConn(const OCP_USI& n,
-                           const Point3D& area,
-                           const Point3D& d,
-                           const USI&     direction,
-                           const OCP_DBL& flag)
-{
-    if (nConn >= maxConn) {
-        maxConn *= 2;
-        halfConn.resize(maxConn);
-        // get larger space
-        if (maxConn > MAX_NEIGHBOR) {
-            // OCP_ABORT("Too many Neighbors!");
-        }
-    }
-    halfConn[nConn].Ad_dd         = area * d / (d * d) * flag;
-    halfConn[nConn].d             = d;
-    halfConn[nConn].neigh         = n;
-    halfConn[nConn].directionType = direction;
-    nConn++;
-
-    // cout << n << "   " << direction << "   " << halfConn[nConn-1].Ad_dd << endl;
-}
-
 void OCP_COORD::Allocate(const USI& Nx, const USI& Ny, const USI& Nz)
 {
     nx      = Nx;
     ny      = Ny;
     nz      = Nz;
-    numGrid = nx * ny * nz;
-
-    COORDDATA = new OCP_DBL**[3];
-    for (USI i = 0; i < 3; i++) {
-        COORDDATA[i] = new OCP_DBL*[2];
-        for (USI j = 0; j < 2; j++) {
-            COORDDATA[i][j] = new OCP_DBL[(nx + 1) * (ny + 1)];
-        }
-    }
-
-    ZCORNDATA = new OCP_DBL***[nx];
-    for (USI i = 0; i < nx; i++) {
-        ZCORNDATA[i] = new OCP_DBL**[ny];
-        for (USI j = 0; j < ny; j++) {
-            ZCORNDATA[i][j] = new OCP_DBL*[nz];
-            for (USI k = 0; k < nz; k++) {
-                ZCORNDATA[i][j][k] = new OCP_DBL[8];
-            }
-        }
-    }
-
-    cornerPoints = new Hexahedron**[nx];
-    for (USI i = 0; i < nx; i++) {
-        cornerPoints[i] = new Hexahedron*[ny];
-        for (USI j = 0; j < ny; j++) {
-            cornerPoints[i][j] = new Hexahedron[nz];
-        }
-    }
+    numGrid = static_cast<OCP_USI>(nx) * ny * nz;
 
     v.resize(numGrid);
     depth.resize(numGrid);
@@ -648,68 +583,100 @@ void OCP_COORD::InputData(const vector<OCP_DBL>& coord, const vector<OCP_DBL>& z
 
 OCP_BOOL OCP_COORD::InputCOORDDATA(const vector<OCP_DBL>& coord)
 {
-    // See Eclipse -- COORD
-    OCP_BOOL flag = OCP_FALSE;
-    OCP_USI  iter = 0;
-
-    for (USI J = 0; J < ny + 1; J++) {
-        for (USI I = 0; I < nx + 1; I++) {
-            // top
-            for (USI i = 0; i < 3; i++) {
-                COORDDATA[i][0][J * (nx + 1) + I] = coord[iter];
-                iter++;
-            }
-            // bottom
-            for (USI i = 0; i < 3; i++) {
-                COORDDATA[i][1][J * (nx + 1) + I] = coord[iter];
-                iter++;
-            }
-        }
-    }
-
-    flag = OCP_TRUE;
-    return flag;
+    // See Eclipse -- COORD, top and bottom points of each pillar
+    if (coord.size() < 6 * static_cast<size_t>(nx + 1) * (ny + 1)) return OCP_FALSE;
+    COORDDATA = coord.data();
+    return OCP_TRUE;
 }
 
 OCP_BOOL OCP_COORD::InputZCORNDATA(const vector<OCP_DBL>& zcorn)
 {
-    // See Eclipse -- ZCORN
-    OCP_BOOL flag = OCP_FALSE;
-    OCP_USI  iter = 0;
-
-    for (USI K = 0; K < nz; K++) {
-        for (USI J = 0; J < ny; J++) {
-            for (USI I = 0; I < nx; I++) {
-                ZCORNDATA[I][J][K][0] = zcorn[iter];
-                iter++;
-                ZCORNDATA[I][J][K][1] = zcorn[iter];
-                iter++;
-            }
-            for (USI I = 0; I < nx; I++) {
-                ZCORNDATA[I][J][K][3] = zcorn[iter];
-                iter++;
-                ZCORNDATA[I][J][K][2] = zcorn[iter];
-                iter++;
-            }
-        }
-        for (USI J = 0; J < ny; J++) {
-            for (USI I = 0; I < nx; I++) {
-                ZCORNDATA[I][J][K][4] = zcorn[iter];
-                iter++;
-                ZCORNDATA[I][J][K][5] = zcorn[iter];
-                iter++;
-            }
-            for (USI I = 0; I < nx; I++) {
-                ZCORNDATA[I][J][K][7] = zcorn[iter];
-                iter++;
-                ZCORNDATA[I][J][K][6] = zcorn[iter];
-                iter++;
-            }
-        }
+    // See Eclipse -- ZCORN, which is indexed in place by GetHexahedron
+    if (zcorn.size() < 8 * static_cast<size_t>(numGrid)) return OCP_FALSE;
+    ZCORNDATA = zcorn.data();
+    return OCP_TRUE;
+}
+
+/// Return the point at depth z on the pillar whose top and bottom points are in p.
+static inline Point3D PillarPoint(const OCP_DBL* p, const OCP_DBL& z)
+{
+    const OCP_DBL xtop = p[0], ytop = p[1], ztop = p[2];
+    const OCP_DBL xbottom = p[3], ybottom = p[4], zbottom = p[5];
+    return Point3D(xbottom - (zbottom - z) / (zbottom - ztop) * (xbottom - xtop),
+                   ybottom - (zbottom - z) / (zbottom - ztop) * (ybottom - ytop), z);
+}
+
+void OCP_COORD::GetHexahedron(const USI&  i,
+                              const USI&  j,
+                              const USI&  k,
+                              Hexahedron& h) const
+{
+    // pillars of corner points 0 and 4, 1 and 5, 2 and 6, 3 and 7
+    const OCP_DBL* c0 = COORDDATA + 6 * (static_cast<OCP_USI>(j) * (nx + 1) + i);
+    const OCP_DBL* c1 = c0 + 6;
+    const OCP_DBL* c3 = c0 + 6 * (nx + 1);
+    const OCP_DBL* c2 = c3 + 6;
+
+    // ZCORN has 2nx values in a row, 2ny rows in a layer, top and bottom of each k
+    const OCP_USI  row = 2 * nx;
+    const OCP_USI  lay = 4 * static_cast<OCP_USI>(nx) * ny;
+    const OCP_DBL* zt  = ZCORNDATA + 2 * k * lay + 2 * j * row + 2 * i;
+    const OCP_DBL* zb  = zt + lay;
+
+    h.p0 = PillarPoint(c0, zt[0]);
+    h.p4 = PillarPoint(c0, zb[0]);
+    h.p1 = PillarPoint(c1, zt[1]);
+    h.p5 = PillarPoint(c1, zb[1]);
+    h.p2 = PillarPoint(c2, zt[row + 1]);
+    h.p6 = PillarPoint(c2, zb[row + 1]);
+    h.p3 = PillarPoint(c3, zt[row]);
+    h.p7 = PillarPoint(c3, zb[row]);
+}
+
+const Hexahedron& OCP_COORD::GetBlock(const USI& i, const USI& j, const USI& k)
+{
+    if (k == curK || k + 1 == curK) return layer[k % 2][j * nx + i];
+    GetHexahedron(i, j, k, tmpHex);
+    return tmpHex;
+}
+
+void OCP_COORD::SetupLayer(const USI& k)
+{
+    curK                    = k;
+    const OCP_USI       nxny = nx * ny;
+    vector<Hexahedron>& cur  = layer[k % 2];
+    cur.resize(nxny);
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (OCP_USI m = 0; m < nxny; m++) {
+        Hexahedron& block = cur[m];
+        GetHexahedron(m % nx, m / nx, k, block);
+
+        //    calculate volumes and pore volumes
+        const OCP_USI cindex = k * nxny + m;
+        //
+        // NOTE: if there are several points not well ordered, the calculated
+        // volume will be negative.
+        //
+        v[cindex]      = VolumHexahedron(block); // NTG
+        v[cindex]      = fabs(v[cindex]);
+        center[cindex] = CenterHexahedron(block);
+        depth[cindex]  = center[cindex].z;
     }
+}
 
-    flag = OCP_TRUE;
-    return flag;
+void OCP_COORD::AddHalfConn(const OCP_USI& n,
+                            const Point3D& area,
+                            const Point3D& d,
+                            const USI&     direction,
+                            const OCP_DBL& flag)
+{
+    HalfConn hc;
+    hc.Ad_dd         = area * d / (d * d) * flag;
+    hc.neigh         = n;
+    hc.directionType = direction;
+    halfConn.push_back(hc);
 }
 
 void OCP_COORD::SetAllFlags(const HexahedronFace& oFace, const HexahedronFace& Face)
@@ -767,150 +734,232 @@ void OCP_COORD::SetAllFlags(const HexahedronFace& oFace, const HexahedronFace& F
     }
 }
 
-void OCP_COORD::SetupCornerPoints()
+OCP_DBL
+OCP_COORD::GetZCorn(const USI& i, const USI& j, const USI& k, const USI& c) const
 {
-    OCP_USI cindex, oindex; // current block index and the other block index
-    OCP_USI nxny = nx * ny;
+    // corner points 0 to 3 are at the top, 4 to 7 at the bottom, see GetHexahedron
+    const OCP_USI row = 2 * nx;
+    const OCP_USI lay = 4 * static_cast<OCP_USI>(nx) * ny;
+    const USI     xi  = (c % 4 == 1 || c % 4 == 2) ? 1 : 0;
+    const USI     yj  = (c % 4 >= 2) ? 1 : 0;
+    return ZCORNDATA[(2 * k + c / 4) * lay + (2 * j + yj) * row + 2 * i + xi];
+}
+
+/// Face of a block on pillars A and B shared by two neighboring columns.
+class ColumnFace
+{
+public:
+    OCP_DBL topA, botA, topB, botB; ///< Depths of the face on the pillars
+    OCP_DBL top, bot;               ///< Range of depths of the face
+    USI     k;                      ///< Layer of the block
+};
+
+void OCP_COORD::SetupFaultNeighbor()
+{
+    // Corners of the face on pillars A and B of side x+, x-, y+, y- in turn, where the
+    // first two sides are shared by column (i, j) and (i + 1, j), the last two are
+    // shared by column (i, j) and (i, j + 1)
+    const USI cornerTA[4] = {1, 0, 3, 0}, cornerBA[4] = {5, 4, 7, 4};
+    const USI cornerTB[4] = {2, 3, 2, 1}, cornerBB[4] = {6, 7, 6, 5};
+    const USI sideL[2]    = {SIDE_XP, SIDE_YP};
+    const USI sideR[2]    = {SIDE_XM, SIDE_YM};
+
+    vector<ColumnFace>         face[2];
+    vector<pair<OCP_USI, USI>> link; // (4 * block + side, layer of the neighbor)
+    const OCP_USI              nxny = nx * ny;
+    face[0].resize(nz);
+    face[1].resize(nz);
+
+    for (USI d = 0; d < 2; d++) {
+        const USI di = d == 0 ? 1 : 0;
+        const USI dj = d == 0 ? 0 : 1;
+        for (USI j = 0; j + dj < ny; j++) {
+            for (USI i = 0; i + di < nx; i++) {
+                // faces of column (i, j) and the neighboring column
+                for (USI s = 0; s < 2; s++) {
+                    const USI c  = 2 * d + s;
+                    const USI ic = i + s * di;
+                    const USI jc = j + s * dj;
+                    for (USI k = 0; k < nz; k++) {
+                        ColumnFace& f = face[s][k];
+                        f.topA        = GetZCorn(ic, jc, k, cornerTA[c]);
+                        f.botA        = GetZCorn(ic, jc, k, cornerBA[c]);
+                        f.topB        = GetZCorn(ic, jc, k, cornerTB[c]);
+                        f.botB        = GetZCorn(ic, jc, k, cornerBB[c]);
+                        f.top         = min(f.topA, f.topB);
+                        f.bot         = max(f.botA, f.botB);
+                        f.k           = k;
+                    }
+                    sort(face[s].begin(), face[s].end(),
+                         [](const ColumnFace& f1, const ColumnFace& f2) {
+                             if (f1.top == f2.top) return f1.k < f2.k;
+                             return f1.top < f2.top;
+                         });
+                }
 
-    // allocate memoery for connections
-    vector<ConnGrid> blockconn(numGrid);
-    for (OCP_USI iloop = 0; iloop < numGrid; iloop++) {
-        blockconn[iloop].Allocate(10);
+                // sweep the sorted faces, faces of the neighboring column ending above
+                // current face are skipped as they end above all the following ones
+                const OCP_USI bL = j * nx + i;
+                const OCP_USI bR = (j + dj) * nx + i + di;
+                USI           r0 = 0;
+                for (const ColumnFace& fL : face[0]) {
+                    while (r0 < nz && face[1][r0].bot <= fL.top) r0++;
+                    for (USI r = r0; r < nz && face[1][r].top < fL.bot; r++) {
+                        const ColumnFace& fR = face[1][r];
+                        // the same test as flagJump in SetAllFlags
+                        if ((fR.botA <= fL.topA && fR.botB <= fL.topB) ||
+                            (fR.topA >= fL.botA && fR.topB >= fL.botB))
+                            continue;
+                        link.push_back(
+                            make_pair(4 * (fL.k * nxny + bL) + sideL[d], fR.k));
+                        link.push_back(
+                            make_pair(4 * (fR.k * nxny + bR) + sideR[d], fL.k));
+                    }
+                }
+            }
+        }
     }
 
-    // setup each block including coordinates of points, center, depth, and volume
-    OCP_DBL xtop, ytop, ztop, xbottom, ybottom, zbottom, xvalue, yvalue, zvalue;
-    for (USI k = 0; k < nz; k++) {
-        for (USI j = 0; j < ny; j++) {
-            for (USI i = 0; i < nx; i++) {
-                //
-                // corner point 0 and 4
-                //
-                xtop    = COORDDATA[0][0][j * (nx + 1) + i];
-                ytop    = COORDDATA[1][0][j * (nx + 1) + i];
-                ztop    = COORDDATA[2][0][j * (nx + 1) + i];
-                xbottom = COORDDATA[0][1][j * (nx + 1) + i];
-                ybottom = COORDDATA[1][1][j * (nx + 1) + i];
-                zbottom = COORDDATA[2][1][j * (nx + 1) + i];
-
-                zvalue = ZCORNDATA[i][j][k][0];
-                xvalue =
-                    xbottom - (zbottom - zvalue) / (zbottom - ztop) * (xbottom - xtop);
-                yvalue =
-                    ybottom - (zbottom - zvalue) / (zbottom - ztop) * (ybottom - ytop);
-                cornerPoints[i][j][k].p0 = Point3D(xvalue, yvalue, zvalue);
-
-                zvalue = ZCORNDATA[i][j][k][4];
-                xvalue =
-                    xbottom - (zbottom - zvalue) / (zbottom - ztop) * (xbottom - xtop);
-                yvalue =
-                    ybottom - (zbottom - zvalue) / (zbottom - ztop) * (ybottom - ytop);
-                cornerPoints[i][j][k].p4 = Point3D(xvalue, yvalue, zvalue);
-                //
-                //    corner point 1 and 5
-                //
-                xtop    = COORDDATA[0][0][j * (nx + 1) + i + 1];
-                ytop    = COORDDATA[1][0][j * (nx + 1) + i + 1];
-                ztop    = COORDDATA[2][0][j * (nx + 1) + i + 1];
-                xbottom = COORDDATA[0][1][j * (nx + 1) + i + 1];
-                ybottom = COORDDATA[1][1][j * (nx + 1) + i + 1];
-                zbottom = COORDDATA[2][1][j * (nx + 1) + i + 1];
-
-                zvalue = ZCORNDATA[i][j][k][1];
-                xvalue =
-                    xbottom - (zbottom - zvalue) / (zbottom - ztop) * (xbottom - xtop);
-                yvalue =
-                    ybottom - (zbottom - zvalue) / (zbottom - ztop) * (ybottom - ytop);
-                cornerPoints[i][j][k].p1 = Point3D(xvalue, yvalue, zvalue);
-
-                zvalue = ZCORNDATA[i][j][k][5];
-                xvalue =
-                    xbottom - (zbottom - zvalue) / (zbottom - ztop) * (xbottom - xtop);
-                yvalue =
-                    ybottom - (zbottom - zvalue) / (zbottom - ztop) * (ybottom - ytop);
-                cornerPoints[i][j][k].p5 = Point3D(xvalue, yvalue, zvalue);
-                //
-                //    corner point 2 and 6
-                //
-                xtop    = COORDDATA[0][0][(j + 1) * (nx + 1) + i + 1];
-                ytop    = COORDDATA[1][0][(j + 1) * (nx + 1) + i + 1];
-                ztop    = COORDDATA[2][0][(j + 1) * (nx + 1) + i + 1];
-                xbottom = COORDDATA[0][1][(j + 1) * (nx + 1) + i + 1];
-                ybottom = COORDDATA[1][1][(j + 1) * (nx + 1) + i + 1];
-                zbottom = COORDDATA[2][1][(j + 1) * (nx + 1) + i + 1];
-
-                zvalue = ZCORNDATA[i][j][k][2];
-                xvalue =
-                    xbottom - (zbottom - zvalue) / (zbottom - ztop) * (xbottom - xtop);
-                yvalue =
-                    ybottom - (zbottom - zvalue) / (zbottom - ztop) * (ybottom - ytop);
-                cornerPoints[i][j][k].p2 = Point3D(xvalue, yvalue, zvalue);
-
-                zvalue = ZCORNDATA[i][j][k][6];
-                xvalue =
-                    xbottom - (zbottom - zvalue) / (zbottom - ztop) * (xbottom - xtop);
-                yvalue =
-                    ybottom - (zbottom - zvalue) / (zbottom - ztop) * (ybottom - ytop);
-                cornerPoints[i][j][k].p6 = Point3D(xvalue, yvalue, zvalue);
-                //
-                //    corner point 3 and 7
-                //
-                xtop    = COORDDATA[0][0][(j + 1) * (nx + 1) + i];
-                ytop    = COORDDATA[1][0][(j + 1) * (nx + 1) + i];
-                ztop    = COORDDATA[2][0][(j + 1) * (nx + 1) + i];
-                xbottom = COORDDATA[0][1][(j + 1) * (nx + 1) + i];
-                ybottom = COORDDATA[1][1][(j + 1) * (nx + 1) + i];
-                zbottom = COORDDATA[2][1][(j + 1) * (nx + 1) + i];
-
-                zvalue = ZCORNDATA[i][j][k][3];
-                xvalue =
-                    xbottom - (zbottom - zvalue) / (zbottom - ztop) * (xbottom - xtop);
-                yvalue =
-                    ybottom - (zbottom - zvalue) / (zbottom - ztop) * (ybottom - ytop);
-                cornerPoints[i][j][k].p3 = Point3D(xvalue, yvalue, zvalue);
-
-                zvalue = ZCORNDATA[i][j][k][7];
-                xvalue =
-                    xbottom - (zbottom - zvalue) / (zbottom - ztop) * (xbottom - xtop);
-                yvalue =
-                    ybottom - (zbottom - zvalue) / (zbottom - ztop) * (ybottom - ytop);
-                cornerPoints[i][j][k].p7 = Point3D(xvalue, yvalue, zvalue);
-
-                //    calculate volumes and pore volumes
-                cindex = k * nxny + j * nx + i;
-                //
-                // NOTE: if there are several points not well ordered, the calculated
-                // volume will be negative.
-                //
-                v[cindex]      = VolumHexahedron(cornerPoints[i][j][k]); // NTG
-                v[cindex]      = fabs(v[cindex]);
-                center[cindex] = CenterHexahedron(cornerPoints[i][j][k]);
-                depth[cindex]  = center[cindex].z;
+    // neighbors of each side of each block
+    sideBegin.assign(4 * numGrid + 1, 0);
+    for (const auto& l : link) sideBegin[l.first + 1]++;
+    for (OCP_USI n = 0; n < 4 * numGrid; n++) sideBegin[n + 1] += sideBegin[n];
+    sideK.resize(link.size());
+    vector<OCP_USI> pos(sideBegin.begin(), sideBegin.end() - 1);
+    for (const auto& l : link) sideK[pos[l.first]++] = l.second;
+    vector<pair<OCP_USI, USI>>().swap(link);
+    vector<OCP_USI>().swap(pos);
+
+    // same layer first, then layers above from near to far, then layers below
+    for (OCP_USI n = 0; n < 4 * numGrid; n++) {
+        const USI k = (n / 4) / nxny;
+        sort(sideK.begin() + sideBegin[n], sideK.begin() + sideBegin[n + 1],
+             [k](const USI& k1, const USI& k2) {
+                 const OCP_INT o1 = k1 <= k ? 2 * (k - k1) : 2 * (k1 - k) + 1;
+                 const OCP_INT o2 = k2 <= k ? 2 * (k - k2) : 2 * (k2 - k) + 1;
+                 return o1 < o2;
+             });
+    }
+}
+
+OCP_USI OCP_COORD::AddSideConn(const USI&            i,
+                               const USI&            j,
+                               const USI&            k,
+                               const USI&            s,
+                               const HexahedronFace& Face,
+                               const Point3D&        Pc2f)
+{
+    const USI     io   = s == SIDE_XM ? i - 1 : (s == SIDE_XP ? i + 1 : i);
+    const USI     jo   = s == SIDE_YM ? j - 1 : (s == SIDE_YP ? j + 1 : j);
+    const USI     dir  = s == SIDE_XM || s == SIDE_XP ? 1 : 2;
+    const OCP_USI nxny = nx * ny;
+    const OCP_USI n    = 4 * (k * nxny + j * nx + i) + s;
+
+    HexahedronFace oFace;         // the other face
+    HexahedronFace FaceP, oFaceP; // Projection of Face and the other face
+    Point3D        areaV;         // area vector of interface
+    OCP_DBL        areaP;         // area of projection of interface
+
+    for (OCP_USI m = sideBegin[n]; m < sideBegin[n + 1]; m++) {
+        const USI         ko     = sideK[m];
+        const OCP_USI     oindex = ko * nxny + jo * nx + io;
+        const Hexahedron& oblock = GetBlock(io, jo, ko);
+        switch (s) {
+            case SIDE_XM:
+                oFace.p0 = oblock.p1;
+                oFace.p1 = oblock.p5;
+                oFace.p2 = oblock.p6;
+                oFace.p3 = oblock.p2;
+                break;
+            case SIDE_XP:
+                oFace.p0 = oblock.p3;
+                oFace.p1 = oblock.p7;
+                oFace.p2 = oblock.p4;
+                oFace.p3 = oblock.p0;
+                break;
+            case SIDE_YM:
+                oFace.p0 = oblock.p2;
+                oFace.p1 = oblock.p6;
+                oFace.p2 = oblock.p7;
+                oFace.p3 = oblock.p3;
+                break;
+            default:
+                oFace.p0 = oblock.p0;
+                oFace.p1 = oblock.p4;
+                oFace.p2 = oblock.p5;
+                oFace.p3 = oblock.p1;
+                break;
+        }
+
+        // the faces overlap, so flagJump is false
+        SetAllFlags(oFace, Face);
+
+        // calculate the interface of two face
+        if (flagQuad) {
+            areaV = VectorFace(tmpFace);
+        } else if (dir == 1) {
+            FaceP.p0  = Point3D(Face.p3.y, Face.p3.z, 0);
+            FaceP.p1  = Point3D(Face.p0.y, Face.p0.z, 0);
+            FaceP.p2  = Point3D(Face.p1.y, Face.p1.z, 0);
+            FaceP.p3  = Point3D(Face.p2.y, Face.p2.z, 0);
+            oFaceP.p0 = Point3D(oFace.p3.y, oFace.p3.z, 0);
+            oFaceP.p1 = Point3D(oFace.p0.y, oFace.p0.z, 0);
+            oFaceP.p2 = Point3D(oFace.p1.y, oFace.p1.z, 0);
+            oFaceP.p3 = Point3D(oFace.p2.y, oFace.p2.z, 0);
+            areaP     = CalAreaNotQuadr(FaceP, oFaceP);
+            // attention the direction of vector
+            areaV = VectorFace(Face);
+            // correct
+            if (fabs(areaV.x) < 1E-6) {
+                OCP_WARNING("x is too small");
+            } else {
+                areaV.y = areaV.y / fabs(areaV.x) * areaP;
+                areaV.z = areaV.z / fabs(areaV.x) * areaP;
+                areaV.x = OCP_SIGN(areaV.x) * areaP;
+            }
+        } else {
+            FaceP.p0  = Point3D(Face.p0.x, Face.p0.z, 0);
+            FaceP.p1  = Point3D(Face.p3.x, Face.p3.z, 0);
+            FaceP.p2  = Point3D(Face.p2.x, Face.p2.z, 0);
+            FaceP.p3  = Point3D(Face.p1.x, Face.p1.z, 0);
+            oFaceP.p0 = Point3D(oFace.p0.x, oFace.p0.z, 0);
+            oFaceP.p1 = Point3D(oFace.p3.x, oFace.p3.z, 0);
+            oFaceP.p2 = Point3D(oFace.p2.x, oFace.p2.z, 0);
+            oFaceP.p3 = Point3D(oFace.p1.x, oFace.p1.z, 0);
+            areaP     = CalAreaNotQuadr(FaceP, oFaceP);
+            // attention the direction of vector
+            areaV = VectorFace(Face);
+            // correct
+            if (fabs(areaV.y) < 1E-6) {
+                OCP_WARNING("y is too small");
+            } else {
+                areaV.x = areaV.x / fabs(areaV.y) * areaP;
+                areaV.z = areaV.z / fabs(areaV.y) * areaP;
+                areaV.y = OCP_SIGN(areaV.y) * areaP;
             }
         }
+        AddHalfConn(oindex, areaV, Pc2f, dir, flagForward);
     }
+    return sideBegin[n + 1] - sideBegin[n];
+}
+
+void OCP_COORD::SetupCornerPoints()
+{
+    OCP_USI cindex, oindex; // current block index and the other block index
+    OCP_USI nxny = nx * ny;
+
+    // half connections of each block are stored in turn
+    halfConn.clear();
+    halfConn.reserve(6 * numGrid);
+    halfConnBegin.resize(numGrid + 1);
 
     // find neighbor and calculate transmissibility
     OCP_USI num_conn = 0; // record the num of connection, a->b & b->a are both included
     Point3D Pcenter, Pface, Pc2f; // center of Hexahedron
-    HexahedronFace Face, oFace;   // current face, the other face
-    HexahedronFace FaceP, oFaceP; // Projection of Face and the other face
+    HexahedronFace Face;          // current face
     Point3D        areaV;         // area vector of interface
-    OCP_DBL        areaP;         // area of projection of interface
-    OCP_INT        iznnc;
     Point3D        dxpoint, dypoint, dzpoint;
 
-    // test
-    // cornerPoints[13][1][72].p0; cornerPoints[13][1][72].p1;
-    // cornerPoints[13][1][72].p2; cornerPoints[13][1][72].p3;
-    // cornerPoints[13][1][72].p4; cornerPoints[13][1][72].p5;
-    // cornerPoints[13][1][72].p6; cornerPoints[13][1][72].p7;
-
-    // cornerPoints[13][2][74].p0; cornerPoints[13][2][74].p1;
-    // cornerPoints[13][2][74].p2; cornerPoints[13][2][74].p3;
-    // cornerPoints[13][2][74].p4; cornerPoints[13][2][74].p5;
-    // cornerPoints[13][2][74].p6; cornerPoints[13][2][74].p7;
-
     /////////////////////////////////////////////////////////////////////
     // Attention that The coordinate axis follows the right-hand rule ! //
     /////////////////////////////////////////////////////////////////////
@@ -926,18 +975,25 @@ void OCP_COORD::SetupCornerPoints()
     //       p1 ---- p2
 
     // Determine flagForward
-    if (COORDDATA[1][0][nx + 1] > COORDDATA[1][0][0])
+    if (COORDDATA[6 * (nx + 1) + 1] > COORDDATA[1])
         flagForward = 1.0;
     else
         flagForward = -1.0;
 
+    // find the overlapping faces of neighboring columns
+    SetupFaultNeighbor();
+
+    // setup each block including coordinates of points, center, depth, and volume
+    // layer by layer, where only layers k and k-1 are kept
     for (USI k = 0; k < nz; k++) {
+        SetupLayer(k);
         for (USI j = 0; j < ny; j++) {
             for (USI i = 0; i < nx; i++) {
                 // begin from each block
-                const Hexahedron& block = cornerPoints[i][j][k];
+                const Hexahedron& block = layer[k % 2][j * nx + i];
                 cindex                  = k * nxny + j * nx + i;
                 Pcenter                 = center[cindex];
+                halfConnBegin[cindex]   = halfConn.size();
 
                 // cout << "============= " << cindex << " =============" << endl;
                 //
@@ -952,167 +1008,7 @@ void OCP_COORD::SetupCornerPoints()
                 Pc2f    = Pface - Pcenter;
                 dxpoint = Pc2f;
 
-                if (i == 0) {
-                    // nothing to do
-                } else {
-
-                    const Hexahedron& leftblock = cornerPoints[i - 1][j][k];
-                    oindex                      = k * nxny + j * nx + i - 1;
-
-                    oFace.p0 = leftblock.p1;
-                    oFace.p1 = leftblock.p5;
-                    oFace.p2 = leftblock.p6;
-                    oFace.p3 = leftblock.p2;
-
-                    SetAllFlags(oFace, Face);
-
-                    // calculate the interface of two face
-                    if (flagJump) {
-                        // nothing to do
-                    } else {
-                        if (flagQuad) {
-                            areaV = VectorFace(tmpFace);
-                        } else {
-                            FaceP.p0  = Point3D(Face.p3.y, Face.p3.z, 0);
-                            FaceP.p1  = Point3D(Face.p0.y, Face.p0.z, 0);
-                            FaceP.p2  = Point3D(Face.p1.y, Face.p1.z, 0);
-                            FaceP.p3  = Point3D(Face.p2.y, Face.p2.z, 0);
-                            oFaceP.p0 = Point3D(oFace.p3.y, oFace.p3.z, 0);
-                            oFaceP.p1 = Point3D(oFace.p0.y, oFace.p0.z, 0);
-                            oFaceP.p2 = Point3D(oFace.p1.y, oFace.p1.z, 0);
-                            oFaceP.p3 = Point3D(oFace.p2.y, oFace.p2.z, 0);
-                            areaP     = CalAreaNotQuadr(FaceP, oFaceP);
-                            // attention the direction of vector
-                            areaV = VectorFace(Face);
-                            // correct
-                            if (fabs(areaV.x) < 1E-6) {
-                                OCP_WARNING("x is too small");
-                            } else {
-                                areaV.y = areaV.y / fabs(areaV.x) * areaP;
-                                areaV.z = areaV.z / fabs(areaV.x) * areaP;
-                                areaV.x = OCP_SIGN(areaV.x) * areaP;
-                            }
-                        }
-                        blockconn[cindex].AddHalfConn(oindex, areaV, Pc2f, 1,
-                                                      flagForward);
-                        num_conn++;
-                    }
-
-                    // then find all NNC for current block
-                    // check if upNNC and downNNC exist
-                    if ((flagp0 > 0) || (flagp3 > 0))
-                        upNNC = OCP_TRUE;
-                    else
-                        upNNC = OCP_FALSE;
-                    if ((flagp1 < 0) || (flagp2 < 0))
-                        downNNC = OCP_TRUE;
-                    else
-                        downNNC = OCP_FALSE;
-
-                    iznnc = -1;
-                    while (upNNC) {
-                        // if (-iznnc > k) break;
-                        if (-iznnc - static_cast<OCP_INT>(k) > 0) break;
-                        // find object block
-                        const Hexahedron& leftblock = cornerPoints[i - 1][j][k + iznnc];
-                        oindex   = (k + iznnc) * nxny + j * nx + i - 1;
-                        oFace.p0 = leftblock.p1;
-                        oFace.p1 = leftblock.p5;
-                        oFace.p2 = leftblock.p6;
-                        oFace.p3 = leftblock.p2;
-
-                        SetAllFlags(oFace, Face);
-
-                        // calculate the interface of two face
-                        if (flagJump) {
-                            // nothing to do
-                        } else {
-                            if (flagQuad) {
-                                areaV = VectorFace(tmpFace);
-                            } else {
-                                FaceP.p0  = Point3D(Face.p3.y, Face.p3.z, 0);
-                                FaceP.p1  = Point3D(Face.p0.y, Face.p0.z, 0);
-                                FaceP.p2  = Point3D(Face.p1.y, Face.p1.z, 0);
-                                FaceP.p3  = Point3D(Face.p2.y, Face.p2.z, 0);
-                                oFaceP.p0 = Point3D(oFace.p3.y, oFace.p3.z, 0);
-                                oFaceP.p1 = Point3D(oFace.p0.y, oFace.p0.z, 0);
-                                oFaceP.p2 = Point3D(oFace.p1.y, oFace.p1.z, 0);
-                                oFaceP.p3 = Point3D(oFace.p2.y, oFace.p2.z, 0);
-                                areaP     = CalAreaNotQuadr(FaceP, oFaceP);
-                                // attention the direction of vector
-                                areaV = VectorFace(Face);
-                                // correct
-                                if (fabs(areaV.x) < 1E-6) {
-                                    OCP_WARNING("x is too small");
-                                } else {
-                                    areaV.y = areaV.y / fabs(areaV.x) * areaP;
-                                    areaV.z = areaV.z / fabs(areaV.x) * areaP;
-                                    areaV.x = OCP_SIGN(areaV.x) * areaP;
-                                }
-                            }
-                            blockconn[cindex].AddHalfConn(oindex, areaV, Pc2f, 1,
-                                                          flagForward);
-                            num_conn++;
-                        }
-                        iznnc--;
-                        if ((flagp0 > 0) || (flagp3 > 0))
-                            upNNC = OCP_TRUE;
-                        else
-                            upNNC = OCP_FALSE;
-                    }
-
-                    iznnc = 1;
-                    while (downNNC) {
-                        if (k + iznnc > nz - 1) break;
-                        // find object block
-                        const Hexahedron& leftblock = cornerPoints[i - 1][j][k + iznnc];
-                        oindex   = (k + iznnc) * nxny + j * nx + i - 1;
-                        oFace.p0 = leftblock.p1;
-                        oFace.p1 = leftblock.p5;
-                        oFace.p2 = leftblock.p6;
-                        oFace.p3 = leftblock.p2;
-
-                        SetAllFlags(oFace, Face);
-
-                        // calculate the interface of two face
-                        if (flagJump) {
-                            // nothing to do
-                        } else {
-                            if (flagQuad) {
-                                areaV = VectorFace(tmpFace);
-                            } else {
-                                FaceP.p0  = Point3D(Face.p3.y, Face.p3.z, 0);
-                                FaceP.p1  = Point3D(Face.p0.y, Face.p0.z, 0);
-                                FaceP.p2  = Point3D(Face.p1.y, Face.p1.z, 0);
-                                FaceP.p3  = Point3D(Face.p2.y, Face.p2.z, 0);
-                                oFaceP.p0 = Point3D(oFace.p3.y, oFace.p3.z, 0);
-                                oFaceP.p1 = Point3D(oFace.p0.y, oFace.p0.z, 0);
-                                oFaceP.p2 = Point3D(oFace.p1.y, oFace.p1.z, 0);
-                                oFaceP.p3 = Point3D(oFace.p2.y, oFace.p2.z, 0);
-                                areaP     = CalAreaNotQuadr(FaceP, oFaceP);
-                                // attention the direction of vector
-                                areaV = VectorFace(Face);
-                                // correct
-                                if (fabs(areaV.x) < 1E-6) {
-                                    OCP_WARNING("x is too small");
-                                } else {
-                                    areaV.y = areaV.y / fabs(areaV.x) * areaP;
-                                    areaV.z = areaV.z / fabs(areaV.x) * areaP;
-                                    areaV.x = OCP_SIGN(areaV.x) * areaP;
-                                }
-                            }
-                            blockconn[cindex].AddHalfConn(oindex, areaV, Pc2f, 1,
-                                                          flagForward);
-                            num_conn++;
-                        }
-                        iznnc++;
-
-                        if ((flagp1 < 0) || (flagp2 < 0))
-                            downNNC = OCP_TRUE;
-                        else
-                            downNNC = OCP_FALSE;
-                    }
-                }
+                if (i > 0) num_conn += AddSideConn(i, j, k, SIDE_XM, Face, Pc2f);
 
                 //
                 // (x+) direction
@@ -1125,169 +1021,7 @@ void OCP_COORD::SetupCornerPoints()
                 Pc2f    = Pface - Pcenter;
                 dxpoint = Pc2f - dxpoint;
 
-                if (i == nx - 1) {
-                    // nothing to do
-                } else {
-
-                    const Hexahedron& rightblock = cornerPoints[i + 1][j][k];
-                    oindex                       = k * nxny + j * nx + i + 1;
-
-                    oFace.p0 = rightblock.p3;
-                    oFace.p1 = rightblock.p7;
-                    oFace.p2 = rightblock.p4;
-                    oFace.p3 = rightblock.p0;
-
-                    SetAllFlags(oFace, Face);
-
-                    // calculate the interface of two face
-                    if (flagJump) {
-                        // nothing to do
-                    } else {
-                        if (flagQuad) {
-                            areaV = VectorFace(tmpFace);
-                        } else {
-                            FaceP.p0  = Point3D(Face.p3.y, Face.p3.z, 0);
-                            FaceP.p1  = Point3D(Face.p0.y, Face.p0.z, 0);
-                            FaceP.p2  = Point3D(Face.p1.y, Face.p1.z, 0);
-                            FaceP.p3  = Point3D(Face.p2.y, Face.p2.z, 0);
-                            oFaceP.p0 = Point3D(oFace.p3.y, oFace.p3.z, 0);
-                            oFaceP.p1 = Point3D(oFace.p0.y, oFace.p0.z, 0);
-                            oFaceP.p2 = Point3D(oFace.p1.y, oFace.p1.z, 0);
-                            oFaceP.p3 = Point3D(oFace.p2.y, oFace.p2.z, 0);
-                            areaP     = CalAreaNotQuadr(FaceP, oFaceP);
-                            // attention the direction of vector
-                            areaV = VectorFace(Face);
-                            // correct
-                            if (fabs(areaV.x) < 1E-6) {
-                                OCP_WARNING("x is too small");
-                            } else {
-                                areaV.y = areaV.y / fabs(areaV.x) * areaP;
-                                areaV.z = areaV.z / fabs(areaV.x) * areaP;
-                                areaV.x = OCP_SIGN(areaV.x) * areaP;
-                            }
-                        }
-                        blockconn[cindex].AddHalfConn(oindex, areaV, Pc2f, 1,
-                                                      flagForward);
-                        num_conn++;
-                    }
-
-                    // then find all NNC for current block
-                    if ((flagp0 > 0) || (flagp3 > 0))
-                        upNNC = OCP_TRUE;
-                    else
-                        upNNC = OCP_FALSE;
-                    if ((flagp1 < 0) || (flagp2 < 0))
-                        downNNC = OCP_TRUE;
-                    else
-                        downNNC = OCP_FALSE;
-
-                    iznnc = -1;
-                    while (upNNC) {
-                        // if (-iznnc > k) break;
-                        if (-iznnc - static_cast<OCP_INT>(k) > 0) break;
-                        // find object block
-                        const Hexahedron& rightblock =
-                            cornerPoints[i + 1][j][k + iznnc];
-                        oindex   = (k + iznnc) * nxny + j * nx + i + 1;
-                        oFace.p0 = rightblock.p3;
-                        oFace.p1 = rightblock.p7;
-                        oFace.p2 = rightblock.p4;
-                        oFace.p3 = rightblock.p0;
-
-                        SetAllFlags(oFace, Face);
-
-                        // calculate the interface of two face
-                        if (flagJump) {
-                            // nothing to do
-                        } else {
-                            if (flagQuad) {
-                                areaV = VectorFace(tmpFace);
-                            } else {
-                                FaceP.p0  = Point3D(Face.p3.y, Face.p3.z, 0);
-                                FaceP.p1  = Point3D(Face.p0.y, Face.p0.z, 0);
-                                FaceP.p2  = Point3D(Face.p1.y, Face.p1.z, 0);
-                                FaceP.p3  = Point3D(Face.p2.y, Face.p2.z, 0);
-                                oFaceP.p0 = Point3D(oFace.p3.y, oFace.p3.z, 0);
-                                oFaceP.p1 = Point3D(oFace.p0.y, oFace.p0.z, 0);
-                                oFaceP.p2 = Point3D(oFace.p1.y, oFace.p1.z, 0);
-                                oFaceP.p3 = Point3D(oFace.p2.y, oFace.p2.z, 0);
-                                areaP     = CalAreaNotQuadr(FaceP, oFaceP);
-                                // attention the direction of vector
-                                areaV = VectorFace(Face);
-                                // correct
-                                if (fabs(areaV.x) < 1E-6) {
-                                    OCP_WARNING("x is too small");
-                                } else {
-                                    areaV.y = areaV.y / fabs(areaV.x) * areaP;
-                                    areaV.z = areaV.z / fabs(areaV.x) * areaP;
-                                    areaV.x = OCP_SIGN(areaV.x) * areaP;
-                                }
-                            }
-                            blockconn[cindex].AddHalfConn(oindex, areaV, Pc2f, 1,
-                                                          flagForward);
-                            num_conn++;
-                        }
-                        iznnc--;
-
-                        if ((flagp0 > 0) || (flagp3 > 0))
-                            upNNC = OCP_TRUE;
-                        else
-                            upNNC = OCP_FALSE;
-                    }
-
-                    iznnc = 1;
-                    while (downNNC) {
-                        if (k + iznnc > nz - 1) break;
-                        // find object block
-                        const Hexahedron& rightblock =
-                            cornerPoints[i + 1][j][k + iznnc];
-                        oindex   = (k + iznnc) * nxny + j * nx + i + 1;
-                        oFace.p0 = rightblock.p3;
-                        oFace.p1 = rightblock.p7;
-                        oFace.p2 = rightblock.p4;
-                        oFace.p3 = rightblock.p0;
-
-                        SetAllFlags(oFace, Face);
-
-                        // calculate the interface of two face
-                        if (flagJump) {
-                            // nothing to do
-                        } else {
-                            if (flagQuad) {
-                                areaV = VectorFace(tmpFace);
-                            } else {
-                                FaceP.p0  = Point3D(Face.p3.y, Face.p3.z, 0);
-                                FaceP.p1  = Point3D(Face.p0.y, Face.p0.z, 0);
-                                FaceP.p2  = Point3D(Face.p1.y, Face.p1.z, 0);
-                                FaceP.p3  = Point3D(Face.p2.y, Face.p2.z, 0);
-                                oFaceP.p0 = Point3D(oFace.p3.y, oFace.p3.z, 0);
-                                oFaceP.p1 = Point3D(oFace.p0.y, oFace.p0.z, 0);
-                                oFaceP.p2 = Point3D(oFace.p1.y, oFace.p1.z, 0);
-                                oFaceP.p3 = Point3D(oFace.p2.y, oFace.p2.z, 0);
-                                areaP     = CalAreaNotQuadr(FaceP, oFaceP);
-                                // attention the direction of vector
-                                areaV = VectorFace(Face);
-                                // correct
-                                if (fabs(areaV.x) < 1E-6) {
-                                    OCP_WARNING("x is too small");
-                                } else {
-                                    areaV.y = areaV.y / fabs(areaV.x) * areaP;
-                                    areaV.z = areaV.z / fabs(areaV.x) * areaP;
-                                    areaV.x = OCP_SIGN(areaV.x) * areaP;
-                                }
-                            }
-                            blockconn[cindex].AddHalfConn(oindex, areaV, Pc2f, 1,
-                                                          flagForward);
-                            num_conn++;
-                        }
-                        iznnc++;
-
-                        if ((flagp1 < 0) || (flagp2 < 0))
-                            downNNC = OCP_TRUE;
-                        else
-                            downNNC = OCP_FALSE;
-                    }
-                }
+                if (i < nx - 1) num_conn += AddSideConn(i, j, k, SIDE_XP, Face, Pc2f);
 
                 //
                 // (y-) direction
@@ -1300,167 +1034,7 @@ void OCP_COORD::SetupCornerPoints()
                 Pc2f    = Pface - Pcenter;
                 dypoint = Pc2f;
 
-                if (j == 0) {
-                    // nothing to do
-                } else {
-
-                    const Hexahedron& backblock = cornerPoints[i][j - 1][k];
-                    oindex                      = k * nxny + (j - 1) * nx + i;
-
-                    oFace.p0 = backblock.p2;
-                    oFace.p1 = backblock.p6;
-                    oFace.p2 = backblock.p7;
-                    oFace.p3 = backblock.p3;
-
-                    SetAllFlags(oFace, Face);
-
-                    // calculate the interface of two face
-                    if (flagJump) {
-                        // nothing to do
-                    } else {
-                        if (flagQuad) {
-                            areaV = VectorFace(tmpFace);
-                        } else {
-                            FaceP.p0  = Point3D(Face.p0.x, Face.p0.z, 0);
-                            FaceP.p1  = Point3D(Face.p3.x, Face.p3.z, 0);
-                            FaceP.p2  = Point3D(Face.p2.x, Face.p2.z, 0);
-                            FaceP.p3  = Point3D(Face.p1.x, Face.p1.z, 0);
-                            oFaceP.p0 = Point3D(oFace.p0.x, oFace.p0.z, 0);
-                            oFaceP.p1 = Point3D(oFace.p3.x, oFace.p3.z, 0);
-                            oFaceP.p2 = Point3D(oFace.p2.x, oFace.p2.z, 0);
-                            oFaceP.p3 = Point3D(oFace.p1.x, oFace.p1.z, 0);
-                            areaP     = CalAreaNotQuadr(FaceP, oFaceP);
-                            // attention the direction of vector
-                            areaV = VectorFace(Face);
-                            // correct
-                            if (fabs(areaV.y) < 1E-6) {
-                                OCP_WARNING("y is too small");
-                            } else {
-                                areaV.x = areaV.x / fabs(areaV.y) * areaP;
-                                areaV.z = areaV.z / fabs(areaV.y) * areaP;
-                                areaV.y = OCP_SIGN(areaV.y) * areaP;
-                            }
-                        }
-                        blockconn[cindex].AddHalfConn(oindex, areaV, Pc2f, 2,
-                                                      flagForward);
-                        num_conn++;
-                    }
-
-                    // then find all NNC for current block
-                    if ((flagp0 > 0) || (flagp3 > 0))
-                        upNNC = OCP_TRUE;
-                    else
-                        upNNC = OCP_FALSE;
-                    if ((flagp1 < 0) || (flagp2 < 0))
-                        downNNC = OCP_TRUE;
-                    else
-                        downNNC = OCP_FALSE;
-
-                    iznnc = -1;
-                    while (upNNC) {
-                        // if (-iznnc > k) break;
-                        if (-iznnc - static_cast<OCP_INT>(k) > 0) break;
-                        // find object block
-                        const Hexahedron& backblock = cornerPoints[i][j - 1][k + iznnc];
-                        oindex   = (k + iznnc) * nxny + (j - 1) * nx + i;
-                        oFace.p0 = backblock.p2;
-                        oFace.p1 = backblock.p6;
-                        oFace.p2 = backblock.p7;
-                        oFace.p3 = backblock.p3;
-
-                        SetAllFlags(oFace, Face);
-
-                        // calculate the interface of two face
-                        if (flagJump) {
-                            // nothing to do
-                        } else {
-                            if (flagQuad) {
-                                areaV = VectorFace(tmpFace);
-                            } else {
-                                FaceP.p0  = Point3D(Face.p0.x, Face.p0.z, 0);
-                                FaceP.p1  = Point3D(Face.p3.x, Face.p3.z, 0);
-                                FaceP.p2  = Point3D(Face.p2.x, Face.p2.z, 0);
-                                FaceP.p3  = Point3D(Face.p1.x, Face.p1.z, 0);
-                                oFaceP.p0 = Point3D(oFace.p0.x, oFace.p0.z, 0);
-                                oFaceP.p1 = Point3D(oFace.p3.x, oFace.p3.z, 0);
-                                oFaceP.p2 = Point3D(oFace.p2.x, oFace.p2.z, 0);
-                                oFaceP.p3 = Point3D(oFace.p1.x, oFace.p1.z, 0);
-                                areaP     = CalAreaNotQuadr(FaceP, oFaceP);
-                                // attention the direction of vector
-                                areaV = VectorFace(Face);
-                                // correct
-                                if (fabs(areaV.y) < 1E-6) {
-                                    OCP_WARNING("y is too small");
-                                } else {
-                                    areaV.x = areaV.x / fabs(areaV.y) * areaP;
-                                    areaV.z = areaV.z / fabs(areaV.y) * areaP;
-                                    areaV.y = OCP_SIGN(areaV.y) * areaP;
-                                }
-                            }
-                            blockconn[cindex].AddHalfConn(oindex, areaV, Pc2f, 2,
-                                                          flagForward);
-                            num_conn++;
-                        }
-                        iznnc--;
-
-                        if ((flagp0 > 0) || (flagp3 > 0))
-                            upNNC = OCP_TRUE;
-                        else
-                            upNNC = OCP_FALSE;
-                    }
-
-                    iznnc = 1;
-                    while (downNNC) {
-                        if (k + iznnc > nz - 1) break;
-                        // find object block
-                        const Hexahedron& backblock = cornerPoints[i][j - 1][k + iznnc];
-                        oindex   = (k + iznnc) * nxny + (j - 1) * nx + i;
-                        oFace.p0 = backblock.p2;
-                        oFace.p1 = backblock.p6;
-                        oFace.p2 = backblock.p7;
-                        oFace.p3 = backblock.p3;
-
-                        SetAllFlags(oFace, Face);
-
-                        // calculate the interface of two face
-                        if (flagJump) {
-                            // nothing to do
-                        } else {
-                            if (flagQuad) {
-                                areaV = VectorFace(tmpFace);
-                            } else {
-                                FaceP.p0  = Point3D(Face.p0.x, Face.p0.z, 0);
-                                FaceP.p1  = Point3D(Face.p3.x, Face.p3.z, 0);
-                                FaceP.p2  = Point3D(Face.p2.x, Face.p2.z, 0);
-                                FaceP.p3  = Point3D(Face.p1.x, Face.p1.z, 0);
-                                oFaceP.p0 = Point3D(oFace.p0.x, oFace.p0.z, 0);
-                                oFaceP.p1 = Point3D(oFace.p3.x, oFace.p3.z, 0);
-                                oFaceP.p2 = Point3D(oFace.p2.x, oFace.p2.z, 0);
-                                oFaceP.p3 = Point3D(oFace.p1.x, oFace.p1.z, 0);
-                                areaP     = CalAreaNotQuadr(FaceP, oFaceP);
-                                // attention the direction of vector
-                                areaV = VectorFace(Face);
-                                // correct
-                                if (fabs(areaV.y) < 1E-6) {
-                                    OCP_WARNING("y is too small");
-                                } else {
-                                    areaV.x = areaV.x / fabs(areaV.y) * areaP;
-                                    areaV.z = areaV.z / fabs(areaV.y) * areaP;
-                                    areaV.y = OCP_SIGN(areaV.y) * areaP;
-                                }
-                            }
-                            blockconn[cindex].AddHalfConn(oindex, areaV, Pc2f, 2,
-                                                          flagForward);
-                            num_conn++;
-                        }
-                        iznnc++;
-
-                        if ((flagp1 < 0) || (flagp2 < 0))
-                            downNNC = OCP_TRUE;
-                        else
-                            downNNC = OCP_FALSE;
-                    }
-                }
+                if (j > 0) num_conn += AddSideConn(i, j, k, SIDE_YM, Face, Pc2f);
 
                 //
                 // (y+) direction
@@ -1473,169 +1047,7 @@ void OCP_COORD::SetupCornerPoints()
                 Pc2f    = Pface - Pcenter;
                 dypoint = Pc2f - dypoint;
 
-                if (j == ny - 1) {
-                    // nothing to do
-                } else {
-
-                    const Hexahedron& frontblock = cornerPoints[i][j + 1][k];
-                    oindex                       = k * nxny + (j + 1) * nx + i;
-
-                    oFace.p0 = frontblock.p0;
-                    oFace.p1 = frontblock.p4;
-                    oFace.p2 = frontblock.p5;
-                    oFace.p3 = frontblock.p1;
-
-                    SetAllFlags(oFace, Face);
-
-                    // calculate the interface of two face
-                    if (flagJump) {
-                        // nothing to do
-                    } else {
-                        if (flagQuad) {
-                            areaV = VectorFace(tmpFace);
-                        } else {
-                            FaceP.p0  = Point3D(Face.p0.x, Face.p0.z, 0);
-                            FaceP.p1  = Point3D(Face.p3.x, Face.p3.z, 0);
-                            FaceP.p2  = Point3D(Face.p2.x, Face.p2.z, 0);
-                            FaceP.p3  = Point3D(Face.p1.x, Face.p1.z, 0);
-                            oFaceP.p0 = Point3D(oFace.p0.x, oFace.p0.z, 0);
-                            oFaceP.p1 = Point3D(oFace.p3.x, oFace.p3.z, 0);
-                            oFaceP.p2 = Point3D(oFace.p2.x, oFace.p2.z, 0);
-                            oFaceP.p3 = Point3D(oFace.p1.x, oFace.p1.z, 0);
-                            areaP     = CalAreaNotQuadr(FaceP, oFaceP);
-                            // attention the direction of vector
-                            areaV = VectorFace(Face);
-                            // correct
-                            if (fabs(areaV.y) < 1E-6) {
-                                OCP_WARNING("y is too small");
-                            } else {
-                                areaV.x = areaV.x / fabs(areaV.y) * areaP;
-                                areaV.z = areaV.z / fabs(areaV.y) * areaP;
-                                areaV.y = OCP_SIGN(areaV.y) * areaP;
-                            }
-                        }
-                        blockconn[cindex].AddHalfConn(oindex, areaV, Pc2f, 2,
-                                                      flagForward);
-                        num_conn++;
-                    }
-
-                    // then find all NNC for current block
-                    if ((flagp0 > 0) || (flagp3 > 0))
-                        upNNC = OCP_TRUE;
-                    else
-                        upNNC = OCP_FALSE;
-                    if ((flagp1 < 0) || (flagp2 < 0))
-                        downNNC = OCP_TRUE;
-                    else
-                        downNNC = OCP_FALSE;
-
-                    iznnc = -1;
-                    while (upNNC) {
-                        // if (-iznnc > k) break;
-                        if (-iznnc - static_cast<OCP_INT>(k) > 0) break;
-                        // find object block
-                        const Hexahedron& frontblock =
-                            cornerPoints[i][j + 1][k + iznnc];
-                        oindex   = (k + iznnc) * nxny + (j + 1) * nx + i;
-                        oFace.p0 = frontblock.p0;
-                        oFace.p1 = frontblock.p4;
-                        oFace.p2 = frontblock.p5;
-                        oFace.p3 = frontblock.p1;
-
-                        SetAllFlags(oFace, Face);
-
-                        // calculate the interface of two face
-                        if (flagJump) {
-                            // nothing to do
-                        } else {
-                            if (flagQuad) {
-                                areaV = VectorFace(tmpFace);
-                            } else {
-                                FaceP.p0  = Point3D(Face.p0.x, Face.p0.z, 0);
-                                FaceP.p1  = Point3D(Face.p3.x, Face.p3.z, 0);
-                                FaceP.p2  = Point3D(Face.p2.x, Face.p2.z, 0);
-                                FaceP.p3  = Point3D(Face.p1.x, Face.p1.z, 0);
-                                oFaceP.p0 = Point3D(oFace.p0.x, oFace.p0.z, 0);
-                                oFaceP.p1 = Point3D(oFace.p3.x, oFace.p3.z, 0);
-                                oFaceP.p2 = Point3D(oFace.p2.x, oFace.p2.z, 0);
-                                oFaceP.p3 = Point3D(oFace.p1.x, oFace.p1.z, 0);
-                                areaP     = CalAreaNotQuadr(FaceP, oFaceP);
-                                // attention the direction of vector
-                                areaV = VectorFace(Face);
-                                // correct
-                                if (fabs(areaV.y) < 1E-6) {
-                                    OCP_WARNING("y is too small");
-                                } else {
-                                    areaV.x = areaV.x / fabs(areaV.y) * areaP;
-                                    areaV.z = areaV.z / fabs(areaV.y) * areaP;
-                                    areaV.y = OCP_SIGN(areaV.y) * areaP;
-                                }
-                            }
-                            blockconn[cindex].AddHalfConn(oindex, areaV, Pc2f, 2,
-                                                          flagForward);
-                            num_conn++;
-                        }
-                        iznnc--;
-
-                        if ((flagp0 > 0) || (flagp3 > 0))
-                            upNNC = OCP_TRUE;
-                        else
-                            upNNC = OCP_FALSE;
-                    }
-
-                    iznnc = 1;
-                    while (downNNC) {
-                        if (k + iznnc > nz - 1) break;
-                        // find object block
-                        const Hexahedron& frontblock =
-                            cornerPoints[i][j + 1][k + iznnc];
-                        oindex   = (k + iznnc) * nxny + (j + 1) * nx + i;
-                        oFace.p0 = frontblock.p0;
-                        oFace.p1 = frontblock.p4;
-                        oFace.p2 = frontblock.p5;
-                        oFace.p3 = frontblock.p1;
-
-                        SetAllFlags(oFace, Face);
-
-                        // calculate the interface of two face
-                        if (flagJump) {
-                            // nothing to do
-                        } else {
-                            if (flagQuad) {
-                                areaV = VectorFace(tmpFace);
-                            } else {
-                                FaceP.p0  = Point3D(Face.p0.x, Face.p0.z, 0);
-                                FaceP.p1  = Point3D(Face.p3.x, Face.p3.z, 0);
-                                FaceP.p2  = Point3D(Face.p2.x, Face.p2.z, 0);
-                                FaceP.p3  = Point3D(Face.p1.x, Face.p1.z, 0);
-                                oFaceP.p0 = Point3D(oFace.p0.x, oFace.p0.z, 0);
-                                oFaceP.p1 = Point3D(oFace.p3.x, oFace.p3.z, 0);
-                                oFaceP.p2 = Point3D(oFace.p2.x, oFace.p2.z, 0);
-                                oFaceP.p3 = Point3D(oFace.p1.x, oFace.p1.z, 0);
-                                areaP     = CalAreaNotQuadr(FaceP, oFaceP);
-                                // attention the direction of vector
-                                areaV = VectorFace(Face);
-                                // correct
-                                if (fabs(areaV.y) < 1E-6) {
-                                    OCP_WARNING("y is too small");
-                                } else {
-                                    areaV.x = areaV.x / fabs(areaV.y) * areaP;
-                                    areaV.z = areaV.z / fabs(areaV.y) * areaP;
-                                    areaV.y = OCP_SIGN(areaV.y) * areaP;
-                                }
-                            }
-                            blockconn[cindex].AddHalfConn(oindex, areaV, Pc2f, 2,
-                                                          flagForward);
-                            num_conn++;
-                        }
-                        iznnc++;
-
-                        if ((flagp1 < 0) || (flagp2 < 0))
-                            downNNC = OCP_TRUE;
-                        else
-                            downNNC = OCP_FALSE;
-                    }
-                }
+                if (j < ny - 1) num_conn += AddSideConn(i, j, k, SIDE_YP, Face, Pc2f);
 
                 //
                 // (z-) direction
@@ -1655,7 +1067,7 @@ void OCP_COORD::SetupCornerPoints()
 
                     tmpFace = Face;
                     areaV   = VectorFace(tmpFace);
-                    blockconn[cindex].AddHalfConn(oindex, areaV, Pc2f, 3, flagForward);
+                    AddHalfConn(oindex, areaV, Pc2f, 3, flagForward);
                     num_conn++;
                 }
 
@@ -1678,7 +1090,7 @@ void OCP_COORD::SetupCornerPoints()
 
                     tmpFace = Face;
                     areaV   = VectorFace(tmpFace);
-                    blockconn[cindex].AddHalfConn(oindex, areaV, Pc2f, 3, flagForward);
+                    AddHalfConn(oindex, areaV, Pc2f, 3, flagForward);
                     num_conn++;
                 }
 
@@ -1697,46 +1109,66 @@ void OCP_COORD::SetupCornerPoints()
         }
     }
 
+    halfConnBegin[numGrid] = halfConn.size();
+    layer[0].clear();
+    layer[1].clear();
+    vector<OCP_USI>().swap(sideBegin);
+    vector<USI>().swap(sideK);
+
     OCP_ASSERT(num_conn % 2 == 0, "Wrong Conn!");
     numConnMax = num_conn / 2;
-    connect.resize(numConnMax);
     //
     //    calculate the x,y,z direction transmissibilities of each block and save them
     //
-    // make the connections
-    OCP_USI iter_conn = 0;
-    for (OCP_USI n = 0; n < numGrid; n++) {
-        for (USI j = 0; j < blockconn[n].nConn; j++) {
-            OCP_USI nn = blockconn[n].halfConn[j].neigh;
-            if (nn < n) continue;
-            USI jj;
-            for (jj = 0; jj < blockconn[nn].nConn; jj++) {
-                if (blockconn[nn].halfConn[jj].neigh == n) {
-                    break;
+    // make the connections, which are counted for each block first, then the ones of
+    // each block are placed after the ones of previous blocks
+    vector<OCP_USI> connBegin(numGrid + 1, 0);
+    for (USI pass = 0; pass < 2; pass++) {
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+        for (OCP_USI n = 0; n < numGrid; n++) {
+            OCP_USI iter_conn = connBegin[n];
+            for (OCP_USI j = halfConnBegin[n]; j < halfConnBegin[n + 1]; j++) {
+                OCP_USI nn = halfConn[j].neigh;
+                if (nn < n) continue;
+                OCP_USI jj;
+                for (jj = halfConnBegin[nn]; jj < halfConnBegin[nn + 1]; jj++) {
+                    if (halfConn[jj].neigh == n) {
+                        break;
+                    }
+                }
+                if (jj == halfConnBegin[nn + 1]) {
+                    continue;
+                }
+                if (halfConn[j].Ad_dd <= 0 || halfConn[jj].Ad_dd <= 0) {
+                    // OCP_FALSE connection
+                    continue;
                 }
-            }
-            if (jj == blockconn[nn].nConn) {
-                continue;
-            }
-            if (blockconn[n].halfConn[j].Ad_dd <= 0 ||
-                blockconn[nn].halfConn[jj].Ad_dd <= 0) {
-                // OCP_FALSE connection
-                continue;
-            }
 
-            //
-            // now, blockconn[n].halfConn[j]
-            //     blockconn[nn].halfConn[jj]
-            //     are a pair of connections
-            connect[iter_conn].begin         = n;
-            connect[iter_conn].Ad_dd_begin   = blockconn[n].halfConn[j].Ad_dd;
-            connect[iter_conn].end           = nn;
-            connect[iter_conn].Ad_dd_end     = blockconn[nn].halfConn[jj].Ad_dd;
-            connect[iter_conn].directionType = blockconn[n].halfConn[j].directionType;
-            iter_conn++;
+                //
+                // now, halfConn[j]
+                //     halfConn[jj]
+                //     are a pair of connections
+                if (pass == 1) {
+                    connect[iter_conn].begin         = n;
+                    connect[iter_conn].Ad_dd_begin   = halfConn[j].Ad_dd;
+                    connect[iter_conn].end           = nn;
+                    connect[iter_conn].Ad_dd_end     = halfConn[jj].Ad_dd;
+                    connect[iter_conn].directionType = halfConn[j].directionType;
+                }
+                iter_conn++;
+            }
+            if (pass == 0) connBegin[n] = iter_conn;
+        }
+        if (pass == 0) {
+            numConn            = ExclusiveScan(connBegin.data(), numGrid);
+            connBegin[numGrid] = numConn;
+            connect.resize(numConn);
         }
     }
-    numConn = iter_conn;
+    vector<HalfConn>().swap(halfConn);
+    vector<OCP_USI>().swap(halfConnBegin);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1745,4 +1177,9 @@ void OCP_COORD::SetupCornerPoints()
 /*  Author              Date             Actions                              */
 /*----------------------------------------------------------------------------*/
 /*  Shizhe Li           Nov/19/2021      Create file                          */
+/*  OpenCAEPoro team    Oct/17/2026      Flat storage and layer-by-layer setup*/
+/*  OpenCAEPoro team    Oct/17/2026      Sweep faces of columns for NNC       */
+/*  OpenCAEPoro team    Oct/17/2026      Parallel setup with prefix sums      */
+/*  OpenCAEPoro team    Oct/17/2026      Add 64-bit global index option       */
+/*  OpenCAEPoro team    Oct/17/2026      Use implicit copy of Point3D         */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
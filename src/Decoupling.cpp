@@ -417,14 +417,46 @@ static void decouple_trueabf(dBSRmat* A, REAL* diaginv, dBSRmat* B)
 }
 
 /// Applying a decoupling algorithm for linear systems of FIM
+// Decoupling with the matrices of last decoupling
+static void decouple_reuse(dBSRmat* A, const REAL* diaginv, dBSRmat* B)
+{
+    // members of A
+    const INT  ROW = A->ROW;
+    const INT  NNZ = A->NNZ;
+    const INT  nb  = A->nb;
+    const INT  nb2 = nb * nb;
+    const INT* IA  = A->IA;
+    const INT* JA  = A->JA;
+    REAL*      val = A->val;
+
+    // Create a link to dBSRmat 'B'
+    INT*  IAb  = B->IA;
+    INT*  JAb  = B->JA;
+    REAL* valb = B->val;
+    memcpy(IAb, IA, (ROW + 1) * sizeof(INT));
+    memcpy(JAb, JA, NNZ * sizeof(INT));
+
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (INT i = 0; i < ROW; ++i) {
+        for (INT k = IA[i]; k < IA[i + 1]; ++k) {
+            fasp_blas_smat_mul(diaginv + i * nb2, val + k * nb2, valb + k * nb2, nb);
+        }
+    }
+}
+
 void VectorFaspSolver::Decoupling(dBSRmat* Absr,
                                   dvector* b,
                                   dBSRmat* Asc,
                                   dvector* fsc,
                                   ivector* order,
                                   double*  Dmatvec,
-                                  int      decoupleType)
+                                  int      decoupleType,
+                                  bool     reuse)
 {
+    OCP_PROFILE(PROF_DECOUPLE);
+
     int              nrow = Absr->ROW;
     int              nb   = Absr->nb;
     double*          Dmat = Dmatvec;
@@ -441,36 +473,41 @@ void VectorFaspSolver::Decoupling(dBSRmat* Absr,
     }
 
     // With decoupling
-    switch (decoupleType) {
-        case 2:
-            decouple_anl(Absr, Dmat, Asc);
-            break;
-        case 3:
-            decouple_quasi(Absr, Dmat, Asc);
-            break;
-        case 4:
-            decouple_trueabf(Absr, Dmat, Asc);
-            break;
-        case 5:
-            decouple_abftrue(Absr, Dmat, Asc);
-            break;
-        case 6:
-            decouple_abftrue(Absr, Dmat, Asc);
-            break;
-        case 7:
-            decouple_truetrans_alg(Absr, Dmat, Asc);
-            break;
-        case 8:
-            decouple_truetrans(Absr, Dmat, Asc);
-            break;
-        case 9:
-            decouple_true_scale(Absr, Dmat, Asc);
-            break;
-        case 10:
-            decouple_rotate(Absr, Dmat, Asc);
-            break;
-        default: // case 1:
-            decouple_abf(Absr, Dmat, Asc);
+    if (reuse) {
+        decouple_reuse(Absr, Dmat, Asc);
+    } else {
+        fill(Dmat, Dmat + nrow * nb * nb, 0.0);
+        switch (decoupleType) {
+            case 2:
+                decouple_anl(Absr, Dmat, Asc);
+                break;
+            case 3:
+                decouple_quasi(Absr, Dmat, Asc);
+                break;
+            case 4:
+                decouple_trueabf(Absr, Dmat, Asc);
+                break;
+            case 5:
+                decouple_abftrue(Absr, Dmat, Asc);
+                break;
+            case 6:
+                decouple_abftrue(Absr, Dmat, Asc);
+                break;
+            case 7:
+                decouple_truetrans_alg(Absr, Dmat, Asc);
+                break;
+            case 8:
+                decouple_truetrans(Absr, Dmat, Asc);
+                break;
+            case 9:
+                decouple_true_scale(Absr, Dmat, Asc);
+                break;
+            case 10:
+                decouple_rotate(Absr, Dmat, Asc);
+                break;
+            default: // case 1:
+                decouple_abf(Absr, Dmat, Asc);
+        }
     }
 
     diagA.diag.row = nrow * nb * nb;
@@ -487,4 +524,5 @@ void VectorFaspSolver::Decoupling(dBSRmat* Absr,
 /*  Shizhe Li           Oct/15/2021      Create file                          */
 /*  Chensong Zhang      Nov/09/2021      Restruct decoupling methods          */
 /*  Chensong Zhang      Nov/30/2021      Add null decoupling                  */
+/*  OpenCAEPoro team    Oct/16/2026      Reuse decoupling matrices            */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
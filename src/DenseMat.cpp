@@ -10,8 +10,55 @@
  */
 
 #include "DenseMat.hpp"
+#include "DenseKernel.hpp"
 
-void CalEigenSY(const int& N, float* A, float* w, float* work, const int& lwork)
+// Standard header files
+#include <utility>
+
+/// Kernel for dimension N of LUSolve, where 1 <= N <= DENSE_FIXED_MAX.
+template <int... I>
+static int FixedLU(integer_sequence<int, I...>,
+                   const int& N,
+                   const int& nrhs,
+                   double*    A,
+                   double*    b,
+                   int*       pivot)
+{
+    static int (*const kernel[])(const int&, double*, double*, int*) = {
+        &FixedLUSolve<I + 1>...};
+    return kernel[N - 1](nrhs, A, b, pivot);
+}
+
+/// Kernel for dimension N of SYSSolve, where 1 <= N <= DENSE_FIXED_MAX. Returns false
+/// if A is not positive definite, which needs the pivoting of dsysv.
+template <int... I>
+static bool FixedSYS(integer_sequence<int, I...>,
+                     const int&    N,
+                     const int&    nrhs,
+                     const char&   uplo,
+                     const double* A,
+                     double*       b)
+{
+    static bool (*const chol[])(const int&, const char&, const double*, double*) = {
+        &FixedCholSolve<I + 1>...};
+    return chol[N - 1](nrhs, uplo, A, b);
+}
+
+/// Kernel for dimension N of CalEigenSY, where 1 <= N <= DENSE_FIXED_MAX. Returns
+/// false if QL iterations do not converge.
+template <int... I>
+static bool FixedEigen(integer_sequence<int, I...>,
+                       const int&   N,
+                       const char&  uplo,
+                       const float* A,
+                       float*       w)
+{
+    static bool (*const kernel[])(const char&, const float*, float*) = {
+        &FixedEigenSY<I + 1, float>...};
+    return kernel[N - 1](uplo, A, w);
+}
+
+int CalEigenSY(const int& N, float* A, float* w, float* work, const int& lwork)
 {
     int  info;
     int  iwork[1] = {0};
@@ -19,10 +66,15 @@ void CalEigenSY(const int& N, float* A, float* w, float* work, const int& lwork)
     char uplo{'U'};
     char Nonly{'N'};
 
+    if (N >= 1 && N <= DENSE_FIXED_MAX &&
+        FixedEigen(make_integer_sequence<int, DENSE_FIXED_MAX>(), N, uplo, A, w))
+        return 0;
+
     ssyevd_(&Nonly, &uplo, &N, A, &N, w, work, &lwork, iwork, &liwork, &info);
     if (info > 0) {
         cout << "failed to compute eigenvalues!" << endl;
     }
+    return info;
 }
 
 // void MinEigenS(const int& N, float* a, float* w)
@@ -222,7 +274,12 @@ void LUSolve(const int& nrhs, const int& N, double* A, double* b, int* pivot)
 {
     int info;
 
-    dgesv_(&N, &nrhs, A, &N, pivot, b, &N, &info);
+    if (N >= 1 && N <= DENSE_FIXED_MAX) {
+        info = FixedLU(make_integer_sequence<int, DENSE_FIXED_MAX>(), N, nrhs, A, b,
+                       pivot);
+    } else {
+        dgesv_(&N, &nrhs, A, &N, pivot, b, &N, &info);
+    }
 
     if (info < 0) {
         cout << "Wrong Input !" << endl;
@@ -242,6 +299,10 @@ int SYSSolve(const int&  nrhs,
 {
     int info;
 
+    if (N >= 1 && N <= DENSE_FIXED_MAX &&
+        FixedSYS(make_integer_sequence<int, DENSE_FIXED_MAX>(), N, nrhs, *uplo, A, b))
+        return 0;
+
     dsysv_(uplo, &N, &nrhs, A, &N, pivot, b, &N, work, &lwork, &info);
     if (info < 0) {
         cout << "Wrong Input !" << endl;
@@ -258,4 +319,6 @@ int SYSSolve(const int&  nrhs,
 /*  Author              Date             Actions                              */
 /*----------------------------------------------------------------------------*/
 /*  Shizhe Li           Oct/21/2021      Create file                          */
+/*  OpenCAEPoro team    Oct/17/2026      Add fixed-size kernels               */
+/*  OpenCAEPoro team    Oct/17/2026      Remove LDLT, report QL failures      */
 /*----------------------------------------------------------------------------*/
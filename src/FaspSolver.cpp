@@ -9,10 +9,19 @@
  *-----------------------------------------------------------------------------------
  */
 
+#include <climits>
 #include <math.h>
 
 #include "FaspSolver.hpp"
 
+/// FASP stores indices of rows, nonzeros and values of matrices in INT.
+static void CheckFaspSize(const OCP_ULL& dim, const OCP_ULL& nval)
+{
+    if (dim > INT_MAX || nval > INT_MAX) {
+        OCP_ABORT("Linear system is too large for FASP, use the native solver!");
+    }
+}
+
 void FaspSolver::SetupParam(const string& dir, const string& file)
 {
     solveDir  = dir;
@@ -37,6 +46,18 @@ void FaspSolver::SetupParam(const string& dir, const string& file)
         ifs.close(); // if file has been opened, close it first
         fasp_param_input(myfile.data(), &inParam);
     }
+
+    // Sharing-setup types are their base types with setup reuse
+    PCReuseParam reuse;
+    reuse.Read(myfile);
+    reuse.printLevel = inParam.print_level;
+    if (inParam.precond_type == PC_FASP1_SHARE ||
+        inParam.precond_type == PC_FASP4_SHARE) {
+        inParam.precond_type -= PC_FASP1_SHARE - PC_FASP1;
+        if (reuse.maxReuse == 0) reuse.maxReuse = PC_SHARE_MAX_REUSE;
+    }
+    pcReuse.SetupParam(reuse);
+
     fasp_param_init(&inParam, &itParam, &amgParam, &iluParam, &swzParam);
 }
 
@@ -48,6 +69,7 @@ void ScalarFaspSolver::Allocate(const vector<USI>& rowCapacity,
     for (OCP_USI n = 0; n < maxDim; n++) {
         nnz += rowCapacity[n];
     }
+    CheckFaspSize(maxDim, nnz);
     A = fasp_dcsr_create(maxDim, maxDim, nnz);
 }
 
@@ -119,7 +141,7 @@ void ScalarFaspSolver::InitParam()
     inParam.AMG_smooth_restriction = ON;
 }
 
-void ScalarFaspSolver::AssembleMat(const vector<vector<USI>>&     colId,
+void ScalarFaspSolver::AssembleMat(const vector<vector<OCP_USI>>& colId,
                                    const vector<vector<OCP_DBL>>& val,
                                    const OCP_USI&                 dim,
                                    const USI&                     blockDim,
@@ -185,6 +207,7 @@ OCP_INT ScalarFaspSolver::Solve()
 
     // Preconditioned Krylov methods
     if (solver_type >= 1 && solver_type <= 20) {
+        OCP_PROFILE(PROF_KRYLOV);
 
         // Using no preconditioner for Krylov iterative methods
         if (precond_type == PREC_NULL) {
@@ -283,6 +306,8 @@ void VectorFaspSolver::Allocate(const vector<USI>& rowCapacity,
     for (OCP_USI n = 0; n < maxDim; n++) {
         nnz += rowCapacity[n];
     }
+    CheckFaspSize(static_cast<OCP_ULL>(maxDim) * blockDim,
+                  static_cast<OCP_ULL>(nnz) * blockDim * blockDim);
     A     = fasp_dbsr_create(maxDim, maxDim, nnz, blockDim, 0);
     Asc   = fasp_dbsr_create(maxDim, maxDim, nnz, blockDim, 0);
     fsc   = fasp_dvec_create(maxDim * blockDim);
@@ -359,7 +384,7 @@ void VectorFaspSolver::InitParam()
     inParam.AMG_smooth_restriction = ON;
 }
 
-void VectorFaspSolver::AssembleMat(const vector<vector<USI>>&     colId,
+void VectorFaspSolver::AssembleMat(const vector<vector<OCP_USI>>& colId,
                                    const vector<vector<OCP_DBL>>& val,
                                    const OCP_USI&                 dim,
                                    const USI&                     blockDim,
@@ -453,100 +478,122 @@ OCP_INT VectorFaspSolver::Solve()
     // Preconditioned Krylov methods
     if (solver_type >= 1 && solver_type <= 10) {
 
-        // Preconditioned Krylov methods in BSR format
-        switch (precond_type) {
-            case PC_NULL:
-                status = fasp_solver_dbsr_krylov(&A, &b, &x, &itParam);
-                break;
-            case PC_DIAG:
-                status = fasp_solver_dbsr_krylov_diag(&A, &b, &x, &itParam);
-                break;
-            case PC_BILU:
-                status = fasp_solver_dbsr_krylov_ilu(&A, &b, &x, &itParam, &iluParam);
-                break;
+        // Setup stage: ILU factors and decoupling matrices are rebuilt or reused, a
+        // failed solve with a reused setup is repeated with a rebuilt one
+        GetWallTime timer;
+        do {
+            fasp_dvec_set(x.row, &x, 0);
+            const OCP_BOOL rebuild = pcReuse.IfRebuild(A.ROW, A.NNZ);
+            timer.Start();
+            if (precond_type == PC_BILU) {
+                if (rebuild) {
+                    OCP_PROFILE(PROF_PC_SETUP);
+                    if (iluReady) fasp_ilu_data_free(&LU);
+                    iluReady = fasp_ilu_dbsr_setup(&A, &LU, &iluParam) >= 0;
+                }
+            }
+#if WITH_FASP4BLKOIL || WITH_FASPCPR
+            else if (precond_type != PC_NULL && precond_type != PC_DIAG) {
+                Decoupling(&A, &b, &Asc, &fsc, &order, Dmat.data(), decoup_type,
+                           !rebuild);
+            }
+            // AMG hierarchies inside FASP are shared until the iterations exceed it
+            const INT resetIter = pcReuse.GetIterLimit();
+#endif
+            if (rebuild) pcReuse.RecordSetup(timer.Stop());
+
+            // Preconditioned Krylov methods in BSR format, AMG setups inside FASP
+            // are timed as Krylov iterations
+            timer.Start();
+            OCP_PROFILE(PROF_KRYLOV);
+            switch (precond_type) {
+                case PC_NULL:
+                    status = fasp_solver_dbsr_krylov(&A, &b, &x, &itParam);
+                    break;
+                case PC_DIAG:
+                    status = fasp_solver_dbsr_krylov_diag(&A, &b, &x, &itParam);
+                    break;
+                case PC_BILU:
+                    if (iluReady) {
+                        precond pc;
+                        pc.data = &LU;
+                        pc.fct  = fasp_precond_dbsr_ilu;
+                        status  = fasp_solver_dbsr_itsolver(&A, &b, &x, &pc, &itParam);
+                    } else {
+                        status = ERROR_SOLVER_ILUSETUP;
+                    }
+                    break;
 
 #if WITH_FASPCPR //! FASPCPR solver (i.e., CPR or ASCPR preconditioners) added by
                  //! zhaoli, 2022.12.11
-            case PC_FASP1:
-                Decoupling(&A, &b, &Asc, &fsc, &order, Dmat.data(), decoup_type);
-                status = FASP_BSRSOL_ASCPR(&Asc, &fsc, &x, &itParam, &iluParam,
-                                           &amgParam, 0);
-                break;
-
-            case PC_FASP1_SHARE:
-                Decoupling(&A, &b, &Asc, &fsc, &order, Dmat.data(), decoup_type);
-                status = FASP_BSRSOL_ASCPR(&Asc, &fsc, &x, &itParam, &iluParam,
-                                           &amgParam, RESET_CONST);
-                break;
+                case PC_FASP1:
+                    status = FASP_BSRSOL_ASCPR(&Asc, &fsc, &x, &itParam, &iluParam,
+                                               &amgParam, resetIter);
+                    break;
 #endif
 
 #if WITH_FASP4BLKOIL
-            case PC_FASP1:
-                Decoupling(&A, &b, &Asc, &fsc, &order, Dmat.data(), decoup_type);
-#if WITH_FASP4CUDA // zhaoli 2022.04.04
-                status = fasp_solver_dbsr_krylov_FASP1_cuda_interface(
-                    &Asc, &fsc, &x, &itParam, &iluParam, &amgParam, NULL, &order);
-#else
-                status = fasp_solver_dbsr_krylov_FASP1a(
-                    &Asc, &fsc, &x, &itParam, &iluParam, &amgParam, NULL, &order);
-#endif
-                break;
-            case PC_FASP1_SHARE: // zhaoli 2021.03.24
-                Decoupling(&A, &b, &Asc, &fsc, &order, Dmat.data(), decoup_type);
+                case PC_FASP1:
+                    if (pcReuse.IfEnabled()) {
 #if WITH_FASP4CUDA
-                status = fasp_solver_dbsr_krylov_FASP1_cuda_share_interface(
-                    &Asc, &fsc, &x, &itParam, &iluParam, &amgParam, NULL, &order,
-                    RESET_CONST);
+                        status = fasp_solver_dbsr_krylov_FASP1_cuda_share_interface(
+                            &Asc, &fsc, &x, &itParam, &iluParam, &amgParam, NULL,
+                            &order, resetIter);
 #else
-                status = fasp_solver_dbsr_krylov_FASP1a_share_interface(
-                    &Asc, &fsc, &x, &itParam, &iluParam, &amgParam, NULL, &order,
-                    RESET_CONST);
+                        status = fasp_solver_dbsr_krylov_FASP1a_share_interface(
+                            &Asc, &fsc, &x, &itParam, &iluParam, &amgParam, NULL,
+                            &order, resetIter);
 #endif
-                break;
-            case PC_FASP2:
-                Decoupling(&A, &b, &Asc, &fsc, &order, Dmat.data(), decoup_type);
-                status = fasp_solver_dbsr_krylov_FASP2(
-                    &Asc, &fsc, &x, &itParam, &iluParam, &amgParam, NULL, &order);
-                break;
-            case PC_FASP3:
-                Decoupling(&A, &b, &Asc, &fsc, &order, Dmat.data(), decoup_type);
-                status = fasp_solver_dbsr_krylov_FASP3(
-                    &Asc, &fsc, &x, &itParam, &iluParam, &amgParam, NULL, &order);
-                break;
-            case PC_FASP4:
-                Decoupling(&A, &b, &Asc, &fsc, &order, Dmat.data(), decoup_type);
-#if WITH_FASP4CUDA
-                status = fasp_solver_dbsr_krylov_FASP4_cuda(
-                    &Asc, &fsc, &x, &itParam, &iluParam, &amgParam, NULL, &order);
+                        break;
+                    }
+#if WITH_FASP4CUDA // zhaoli 2022.04.04
+                    status = fasp_solver_dbsr_krylov_FASP1_cuda_interface(
+                        &Asc, &fsc, &x, &itParam, &iluParam, &amgParam, NULL, &order);
 #else
-                status = fasp_solver_dbsr_krylov_FASP4(
-                    &Asc, &fsc, &x, &itParam, &iluParam, &amgParam, NULL, &order);
+                    status = fasp_solver_dbsr_krylov_FASP1a(
+                        &Asc, &fsc, &x, &itParam, &iluParam, &amgParam, NULL, &order);
 #endif
-                break;
-            case PC_FASP4_SHARE: // zhaoli 2021.04.24
-                Decoupling(&A, &b, &Asc, &fsc, &order, Dmat.data(), decoup_type);
+                    break;
+                case PC_FASP2:
+                    status = fasp_solver_dbsr_krylov_FASP2(
+                        &Asc, &fsc, &x, &itParam, &iluParam, &amgParam, NULL, &order);
+                    break;
+                case PC_FASP3:
+                    status = fasp_solver_dbsr_krylov_FASP3(
+                        &Asc, &fsc, &x, &itParam, &iluParam, &amgParam, NULL, &order);
+                    break;
+                case PC_FASP4:
+                    if (pcReuse.IfEnabled()) {
 #if WITH_FASP4CUDA // zhaoli 2022.08.03
-                status = fasp_solver_dbsr_krylov_FASP4_cuda_share_interface(
-                    &Asc, &fsc, &x, &itParam, &iluParam, &amgParam, NULL, &order,
-                    RESET_CONST);
+                        status = fasp_solver_dbsr_krylov_FASP4_cuda_share_interface(
+                            &Asc, &fsc, &x, &itParam, &iluParam, &amgParam, NULL,
+                            &order, resetIter);
 #else
-                status = fasp_solver_dbsr_krylov_FASP4_share_interface(
-                    &Asc, &fsc, &x, &itParam, &iluParam, &amgParam, NULL, &order,
-                    RESET_CONST);
+                        status = fasp_solver_dbsr_krylov_FASP4_share_interface(
+                            &Asc, &fsc, &x, &itParam, &iluParam, &amgParam, NULL,
+                            &order, resetIter);
 #endif
-                break;
-            case PC_FASP5:
-                Decoupling(&A, &b, &Asc, &fsc, &order, Dmat.data(), decoup_type);
-                status = fasp_solver_dbsr_krylov_FASP5(
-                    &Asc, &fsc, &x, &itParam, &iluParam, &amgParam, NULL, &order);
-                break;
+                        break;
+                    }
+#if WITH_FASP4CUDA
+                    status = fasp_solver_dbsr_krylov_FASP4_cuda(
+                        &Asc, &fsc, &x, &itParam, &iluParam, &amgParam, NULL, &order);
+#else
+                    status = fasp_solver_dbsr_krylov_FASP4(
+                        &Asc, &fsc, &x, &itParam, &iluParam, &amgParam, NULL, &order);
 #endif
-            default:
-                OCP_WARNING("fasp4blkoil was not linked correctly!");
-                OCP_ABORT("Preconditioner type " + to_string(precond_type) +
-                          " not supported!");
-        }
-        fill(Dmat.begin(), Dmat.end(), 0.0);
+                    break;
+                case PC_FASP5:
+                    status = fasp_solver_dbsr_krylov_FASP5(
+                        &Asc, &fsc, &x, &itParam, &iluParam, &amgParam, NULL, &order);
+                    break;
+#endif
+                default:
+                    OCP_WARNING("fasp4blkoil was not linked correctly!");
+                    OCP_ABORT("Preconditioner type " + to_string(precond_type) +
+                              " not supported!");
+            }
+        } while (pcReuse.RecordSolve(status, timer.Stop()));
     }
 
 #if WITH_MUMPS // use MUMPS directly
@@ -617,4 +664,8 @@ OCP_INT VectorFaspSolver::Solve()
 /*  Shizhe Li           Nov/22/2021      Create file                          */
 /*  Chensong Zhang      Jan/19/2022      Set FASP4BLKOIL as optional          */
 /*  Li Zhao             Apr/04/2022      Set FASP4CUDA   as optional          */
+/*  OpenCAEPoro team    Oct/16/2026      Reuse setups of preconditioners      */
+/*  OpenCAEPoro team    Oct/17/2026      Add 64-bit global index option       */
+/*  OpenCAEPoro team    Oct/17/2026      Retry failed solves with a new setup */
+/*  OpenCAEPoro team    Oct/17/2026      Time PC setup apart from Krylov      */
 /*----------------------------------------------------------------------------*/
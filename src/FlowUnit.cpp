@@ -18,7 +18,8 @@
 void FlowUnit_W::CalKrPc(const OCP_DBL* S_in,
                          OCP_DBL*       kr_out,
                          OCP_DBL*       pc_out,
-                         const OCP_USI& bId)
+                         const OCP_USI& bId,
+                         USI*           hint) const
 {
     kr_out[0] = 1;
     pc_out[0] = 0;
@@ -29,7 +30,8 @@ void FlowUnit_W::CalKrPcDeriv(const OCP_DBL* S_in,
                               OCP_DBL*       pc_out,
                               OCP_DBL*       dkrdS,
                               OCP_DBL*       dPcjdS,
-                              const OCP_USI& bId)
+                              const OCP_USI& bId,
+                              USI*           hint) const
 {
     kr_out[0] = 1;
     pc_out[0] = 0;
@@ -45,20 +47,19 @@ FlowUnit_OW::FlowUnit_OW(const ParamReservoir& rs_param, const USI& i)
 {
     SWOF.Setup(rs_param.SWOF_T.data[i]);
     Swco = SWOF.GetCol(0)[0];
-
-    data.resize(4, 0);
-    cdata.resize(4, 0);
 }
 
 void FlowUnit_OW::CalKrPc(const OCP_DBL* S_in,
                           OCP_DBL*       kr_out,
                           OCP_DBL*       pc_out,
-                          const OCP_USI& bId)
+                          const OCP_USI& bId,
+                          USI*           hint) const
 {
+    OCP_DBL data[MAX_SATCOL], cdata[MAX_SATCOL];
     OCP_DBL Sw = S_in[1];
 
     // three phase black oil model using stone 2
-    SWOF.Eval_All(0, Sw, data, cdata);
+    SWOF.Eval_All(0, Sw, data, cdata, &hint[0]);
     OCP_DBL krw  = data[1];
     OCP_DBL kro  = data[2];
     OCP_DBL Pcwo = -data[3];
@@ -74,10 +75,12 @@ void FlowUnit_OW::CalKrPcDeriv(const OCP_DBL* S_in,
                                OCP_DBL*       pc_out,
                                OCP_DBL*       dkrdS,
                                OCP_DBL*       dPcjdS,
-                               const OCP_USI& bId)
+                               const OCP_USI& bId,
+                               USI*           hint) const
 {
+    OCP_DBL data[MAX_SATCOL], cdata[MAX_SATCOL];
     OCP_DBL Sw = S_in[1];
-    SWOF.Eval_All(0, Sw, data, cdata);
+    SWOF.Eval_All(0, Sw, data, cdata, &hint[0]);
     OCP_DBL krw      = data[1];
     OCP_DBL dKrwdSw  = cdata[1];
     OCP_DBL krow     = data[2];
@@ -110,20 +113,19 @@ FlowUnit_OG::FlowUnit_OG(const ParamReservoir& rs_param, const USI& i)
     SGOF.Setup(rs_param.SGOF_T.data[i]);
 
     kroMax = SGOF.GetCol(2)[0];
-
-    data.resize(4, 0);
-    cdata.resize(4, 0);
 }
 
 void FlowUnit_OG::CalKrPc(const OCP_DBL* S_in,
                           OCP_DBL*       kr_out,
                           OCP_DBL*       pc_out,
-                          const OCP_USI& bId)
+                          const OCP_USI& bId,
+                          USI*           hint) const
 {
+    OCP_DBL data[MAX_SATCOL], cdata[MAX_SATCOL];
     OCP_DBL Sg = S_in[1];
 
     // three phase black oil model using stone 2
-    SGOF.Eval_All(0, Sg, data, cdata);
+    SGOF.Eval_All(0, Sg, data, cdata, &hint[1]);
     OCP_DBL krg  = data[1];
     OCP_DBL kro  = data[2];
     OCP_DBL Pcgo = data[3];
@@ -139,7 +141,8 @@ void FlowUnit_OG::CalKrPcDeriv(const OCP_DBL* S_in,
                                OCP_DBL*       pc_out,
                                OCP_DBL*       dkrdS,
                                OCP_DBL*       dPcjdS,
-                               const OCP_USI& bId)
+                               const OCP_USI& bId,
+                               USI*           hint) const
 {
     OCP_ABORT("Not Completed Now!");
 }
@@ -188,9 +191,6 @@ FlowUnit_ODGW01::FlowUnit_ODGW01(const ParamReservoir& rs_param, const USI& i)
     kroMax = SWOF.GetCol(2)[0];
     Swco   = SWOF.GetCol(0)[0];
 
-    data.resize(4, 0);
-    cdata.resize(4, 0);
-
     Generate_SWPCWG();
 
     Scm.resize(3, 0);
@@ -205,18 +205,20 @@ FlowUnit_ODGW01::FlowUnit_ODGW01(const ParamReservoir& rs_param, const USI& i)
 void FlowUnit_ODGW01::CalKrPc(const OCP_DBL* S_in,
                               OCP_DBL*       kr_out,
                               OCP_DBL*       pc_out,
-                              const OCP_USI& bId)
+                              const OCP_USI& bId,
+                              USI*           hint) const
 {
+    OCP_DBL data[MAX_SATCOL], cdata[MAX_SATCOL];
     const OCP_DBL Sg = S_in[1];
     const OCP_DBL Sw = S_in[2];
 
     // three phase black oil model using stone 2
-    SWOF.Eval_All(0, Sw, data, cdata);
+    SWOF.Eval_All(0, Sw, data, cdata, &hint[0]);
     const OCP_DBL krw  = data[1];
     const OCP_DBL krow = data[2];
     const OCP_DBL Pcwo = -data[3];
 
-    SGOF.Eval_All(0, Sg, data, cdata);
+    SGOF.Eval_All(0, Sg, data, cdata, &hint[1]);
     const OCP_DBL krg  = data[1];
     const OCP_DBL krog = data[2];
     const OCP_DBL Pcgo = data[3];
@@ -237,13 +239,15 @@ void FlowUnit_ODGW01::CalKrPcDeriv(const OCP_DBL* S_in,
                                    OCP_DBL*       pc_out,
                                    OCP_DBL*       dkrdS,
                                    OCP_DBL*       dPcjdS,
-                                   const OCP_USI& bId)
+                                   const OCP_USI& bId,
+                                   USI*           hint) const
 {
+    OCP_DBL data[MAX_SATCOL], cdata[MAX_SATCOL];
     OCP_DBL Sg = S_in[1];
     OCP_DBL Sw = S_in[2];
 
     // three phase black oil model using stone 2
-    SWOF.Eval_All(0, Sw, data, cdata);
+    SWOF.Eval_All(0, Sw, data, cdata, &hint[0]);
     OCP_DBL krw      = data[1];
     OCP_DBL dKrwdSw  = cdata[1];
     OCP_DBL krow     = data[2];
@@ -251,7 +255,7 @@ void FlowUnit_ODGW01::CalKrPcDeriv(const OCP_DBL* S_in,
     OCP_DBL Pcwo     = -data[3];
     OCP_DBL dPcwdSw  = -cdata[3];
 
-    SGOF.Eval_All(0, Sg, data, cdata);
+    SGOF.Eval_All(0, Sg, data, cdata, &hint[1]);
     OCP_DBL krg      = data[1];
     OCP_DBL dKrgdSg  = cdata[1];
     OCP_DBL krog     = data[2];
@@ -395,21 +399,24 @@ void FlowUnit_ODGW01_Miscible::SetupScale(const OCP_USI& bId,
 void FlowUnit_ODGW01_Miscible::CalKrPc(const OCP_DBL* S_in,
                                        OCP_DBL*       kr_out,
                                        OCP_DBL*       pc_out,
-                                       const OCP_USI& bId)
+                                       const OCP_USI& bId,
+                                       USI*           hint) const
 {
+    OCP_DBL data[MAX_SATCOL], cdata[MAX_SATCOL];
+    OCP_DBL Fk, Fp;
     if (!misTerm->CalFkFp(bId, Fk, Fp)) {
-        FlowUnit_ODGW01::CalKrPc(S_in, kr_out, pc_out, bId);
+        FlowUnit_ODGW01::CalKrPc(S_in, kr_out, pc_out, bId, hint);
     } else {
         OCP_DBL So = S_in[0];
         OCP_DBL Sg = S_in[1];
         OCP_DBL Sw = S_in[2];
 
-        SWOF.Eval_All(0, Sw, data, cdata);
+        SWOF.Eval_All(0, Sw, data, cdata, &hint[0]);
         const OCP_DBL krw  = data[1];
         OCP_DBL       krow = data[2];
         const OCP_DBL Pcwo = -data[3];
 
-        SGOF.Eval_All(0, Sg, data, cdata);
+        SGOF.Eval_All(0, Sg, data, cdata, &hint[1]);
         OCP_DBL       krg  = data[1];
         OCP_DBL       krog = data[2];
         const OCP_DBL Pcgo = data[3] * Fp;
@@ -441,16 +448,20 @@ void FlowUnit_ODGW01_Miscible::CalKrPcDeriv(const OCP_DBL* S_in,
                                             OCP_DBL*       pc_out,
                                             OCP_DBL*       dkrdS,
                                             OCP_DBL*       dPcjdS,
-                                            const OCP_USI& bId)
+                                            const OCP_USI& bId,
+                                            USI*           hint) const
 {
+    OCP_DBL data[MAX_SATCOL], cdata[MAX_SATCOL];
+    OCP_DBL Fk, Fp;
     if (!misTerm->CalFkFp(bId, Fk, Fp)) {
-        FlowUnit_ODGW01::CalKrPcDeriv(S_in, kr_out, pc_out, dkrdS, dPcjdS, bId);
+        FlowUnit_ODGW01::CalKrPcDeriv(S_in, kr_out, pc_out, dkrdS, dPcjdS, bId,
+                                      hint);
     } else {
         const OCP_DBL So = S_in[0];
         const OCP_DBL Sg = S_in[1];
         const OCP_DBL Sw = S_in[2];
 
-        SWOF.Eval_All(0, Sw, data, cdata);
+        SWOF.Eval_All(0, Sw, data, cdata, &hint[0]);
         const OCP_DBL krw      = data[1];
         const OCP_DBL dKrwdSw  = cdata[1];
         const OCP_DBL krow     = data[2];
@@ -458,7 +469,7 @@ void FlowUnit_ODGW01_Miscible::CalKrPcDeriv(const OCP_DBL* S_in,
         const OCP_DBL Pcwo     = -data[3];
         const OCP_DBL dPcwdSw  = -cdata[3];
 
-        SGOF.Eval_All(0, Sg, data, cdata);
+        SGOF.Eval_All(0, Sg, data, cdata, &hint[1]);
         OCP_DBL       krg      = data[1];
         const OCP_DBL dKrgdSg  = cdata[1];
         const OCP_DBL krog     = data[2];
@@ -528,30 +539,29 @@ FlowUnit_ODGW02::FlowUnit_ODGW02(const ParamReservoir& rs_param, const USI& i)
     kroMax = SOF3.GetCol(1).back();
     Swco   = SWFN.GetCol(0)[0];
 
-    data.resize(3, 0);
-    cdata.resize(3, 0);
-
     Generate_SWPCWG();
 }
 
 void FlowUnit_ODGW02::CalKrPc(const OCP_DBL* S_in,
                               OCP_DBL*       kr_out,
                               OCP_DBL*       pc_out,
-                              const OCP_USI& bId)
+                              const OCP_USI& bId,
+                              USI*           hint) const
 {
+    OCP_DBL data[MAX_SATCOL], cdata[MAX_SATCOL];
     OCP_DBL So = S_in[0];
     OCP_DBL Sg = S_in[1];
     OCP_DBL Sw = S_in[2];
 
-    SWFN.Eval_All(0, Sw, data, cdata);
+    SWFN.Eval_All(0, Sw, data, cdata, &hint[0]);
     OCP_DBL krw  = data[1];
     OCP_DBL Pcwo = -data[2];
 
-    SGFN.Eval_All(0, Sg, data, cdata);
+    SGFN.Eval_All(0, Sg, data, cdata, &hint[1]);
     OCP_DBL krg  = data[1];
     OCP_DBL Pcgo = data[2];
 
-    SOF3.Eval_All(0, So, data, cdata);
+    SOF3.Eval_All(0, So, data, cdata, &hint[2]);
     OCP_DBL krow = data[1];
     OCP_DBL krog = data[2];
 
@@ -571,25 +581,27 @@ void FlowUnit_ODGW02::CalKrPcDeriv(const OCP_DBL* S_in,
                                    OCP_DBL*       pc_out,
                                    OCP_DBL*       dkrdS,
                                    OCP_DBL*       dPcjdS,
-                                   const OCP_USI& bId)
+                                   const OCP_USI& bId,
+                                   USI*           hint) const
 {
+    OCP_DBL data[MAX_SATCOL], cdata[MAX_SATCOL];
     OCP_DBL So = S_in[0];
     OCP_DBL Sg = S_in[1];
     OCP_DBL Sw = S_in[2];
 
-    SWFN.Eval_All(0, Sw, data, cdata);
+    SWFN.Eval_All(0, Sw, data, cdata, &hint[0]);
     OCP_DBL krw      = data[1];
     OCP_DBL dKrwdSw  = cdata[1];
     OCP_DBL Pcwo     = -data[2];
     OCP_DBL dPcwodSw = -cdata[2];
 
-    SGFN.Eval_All(0, Sg, data, cdata);
+    SGFN.Eval_All(0, Sg, data, cdata, &hint[1]);
     OCP_DBL krg      = data[1];
     OCP_DBL dKrgdSg  = cdata[1];
     OCP_DBL Pcgo     = data[2];
     OCP_DBL dPcgodSg = cdata[2];
 
-    SOF3.Eval_All(0, So, data, cdata);
+    SOF3.Eval_All(0, So, data, cdata, &hint[2]);
     OCP_DBL krow     = data[1];
     OCP_DBL dKrowdSo = cdata[1];
     OCP_DBL krog     = data[2];
@@ -695,4 +707,5 @@ void FlowUnit_ODGW02::Generate_SWPCWG()
 /*----------------------------------------------------------------------------*/
 /*  Shizhe Li           Oct/01/2021      Create file                          */
 /*  Chensong Zhang      Oct/15/2021      Format file                          */
+/*  OpenCAEPoro team    Oct/17/2026      Keep no state in CalKrPc             */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
@@ -75,6 +75,9 @@ void Grid::InputParam(const ParamReservoir& rs_param, const ParamOutput& output_
     // Initial Properties
     SwatInit = rs_param.Swat;
 
+    // Ordering of active cells
+    gridOrder = rs_param.gridOrder;
+
     // Output
     useVTK = output_param.outVTKParam.useVTK;
 }
@@ -124,76 +127,51 @@ void Grid::CalDepthVOrthogonalGrid()
 {
     depth.resize(numGrid, 0);
     const OCP_USI nxny = nx * ny;
-    // 0th layer
-    for (USI j = 0; j < ny; j++) {
-        for (USI i = 0; i < nx; i++) {
-            OCP_USI id = j * nx + i;
-            depth[id]  = tops[id] + dz[id] / 2;
-        }
-    }
-    // 1th - (nz-1)th layer
-    for (USI k = 1; k < nz; k++) {
-        OCP_USI knxny = k * nxny;
-        for (USI j = 0; j < ny; j++) {
-            for (USI i = 0; i < nx; i++) {
-                OCP_USI id = knxny + j * nx + i;
-                depth[id]  = depth[id - nxny] + dz[id - nxny] / 2 + dz[id] / 2;
-            }
+    // columns are independent, and the depth goes down layer by layer in each column
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (OCP_USI id = 0; id < nxny; id++) {
+        depth[id] = tops[id] + dz[id] / 2;
+        for (USI k = 1; k < nz; k++) {
+            const OCP_USI n = k * nxny + id;
+            depth[n]        = depth[n - nxny] + dz[n - nxny] / 2 + dz[n] / 2;
         }
     }
 
     v.resize(numGrid);
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
     for (OCP_USI i = 0; i < numGrid; i++) v[i] = dx[i] * dy[i] * dz[i];
 }
 
 void Grid::SetupNeighborOrthogonalGrid()
 {
     gNeighbor.resize(numGrid);
-    // PreAllocate
-    for (OCP_USI n = 0; n < numGrid; n++) {
-        gNeighbor[n].reserve(6);
-    }
 
-    // Begin Id and End Id in Grid, bIdg < eIdg
-    OCP_USI       bIdg, eIdg;
-    OCP_DBL       areaB, areaE;
-    USI           direction;
     const OCP_USI nxny = nx * ny;
-
-    for (USI k = 0; k < nz; k++) {
-        for (USI j = 0; j < ny; j++) {
-            for (USI i = 0; i < nx; i++) {
-
-                bIdg = k * nxny + j * nx + i;
-                // right  --  x-direction
-                if (i < nx - 1) {
-                    direction = 1;
-                    eIdg      = bIdg + 1;
-                    areaB     = 2 * dy[bIdg] * dz[bIdg] / dx[bIdg];
-                    areaE     = 2 * dy[eIdg] * dz[eIdg] / dx[eIdg];
-                    gNeighbor[bIdg].push_back(GPair(eIdg, direction, areaB, areaE));
-                    gNeighbor[eIdg].push_back(GPair(bIdg, direction, areaE, areaB));
-                }
-                // front  --  y-direction
-                if (j < ny - 1) {
-                    direction = 2;
-                    eIdg      = bIdg + nx;
-                    areaB     = 2 * dz[bIdg] * dx[bIdg] / dy[bIdg];
-                    areaE     = 2 * dz[eIdg] * dx[eIdg] / dy[eIdg];
-                    gNeighbor[bIdg].push_back(GPair(eIdg, direction, areaB, areaE));
-                    gNeighbor[eIdg].push_back(GPair(bIdg, direction, areaE, areaB));
-                }
-                // down --   z-direction
-                if (k < nz - 1) {
-                    direction = 3;
-                    eIdg      = bIdg + nxny;
-                    areaB     = 2 * dx[bIdg] * dy[bIdg] / dz[bIdg];
-                    areaE     = 2 * dx[eIdg] * dy[eIdg] / dz[eIdg];
-                    gNeighbor[bIdg].push_back(GPair(eIdg, direction, areaB, areaE));
-                    gNeighbor[eIdg].push_back(GPair(bIdg, direction, areaE, areaB));
-                }
-            }
-        }
+    // Effective area of cell n in x, y, z-direction
+    auto areaX = [this](const OCP_USI& n) { return 2 * dy[n] * dz[n] / dx[n]; };
+    auto areaY = [this](const OCP_USI& n) { return 2 * dz[n] * dx[n] / dy[n]; };
+    auto areaZ = [this](const OCP_USI& n) { return 2 * dx[n] * dy[n] / dz[n]; };
+
+    // Neighbors of each cell are in the order of z-, y-, x-, x+, y+, z+
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (OCP_USI n = 0; n < numGrid; n++) {
+        const USI      i  = n % nx;
+        const USI      j  = n / nx % ny;
+        const USI      k  = n / nxny;
+        vector<GPair>& nb = gNeighbor[n];
+        nb.reserve(6);
+        if (k > 0) nb.push_back(GPair(n - nxny, 3, areaZ(n), areaZ(n - nxny)));
+        if (j > 0) nb.push_back(GPair(n - nx, 2, areaY(n), areaY(n - nx)));
+        if (i > 0) nb.push_back(GPair(n - 1, 1, areaX(n), areaX(n - 1)));
+        if (i < nx - 1) nb.push_back(GPair(n + 1, 1, areaX(n), areaX(n + 1)));
+        if (j < ny - 1) nb.push_back(GPair(n + nx, 2, areaY(n), areaY(n + nx)));
+        if (k < nz - 1) nb.push_back(GPair(n + nxny, 3, areaZ(n), areaZ(n + nxny)));
     }
 }
 
@@ -220,24 +198,39 @@ void Grid::SetupBasicCornerGrid(const OCP_COORD& CoTmp)
 
 void Grid::SetupNeighborCornerGrid(const OCP_COORD& CoTmp)
 {
+    // Connections of each cell in the order of CoTmp.connect, where 2c and 2c+1 are
+    // connection c from the beginning and the ending cell respectively
+    vector<OCP_USI> connBegin(numGrid + 1, 0);
+    vector<OCP_USI> connOfGrid(2 * CoTmp.numConn);
+    for (OCP_USI c = 0; c < CoTmp.numConn; c++) {
+        connBegin[CoTmp.connect[c].begin]++;
+        connBegin[CoTmp.connect[c].end]++;
+    }
+    connBegin[numGrid] = ExclusiveScan(connBegin.data(), numGrid);
+    vector<OCP_USI> pos(connBegin.begin(), connBegin.end() - 1);
+    for (OCP_USI c = 0; c < CoTmp.numConn; c++) {
+        connOfGrid[pos[CoTmp.connect[c].begin]++] = 2 * c;
+        connOfGrid[pos[CoTmp.connect[c].end]++]   = 2 * c + 1;
+    }
+    vector<OCP_USI>().swap(pos);
+
     gNeighbor.resize(numGrid);
-    // PreAllocate
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
     for (OCP_USI n = 0; n < numGrid; n++) {
-        gNeighbor[n].reserve(10);
-    }
-
-    OCP_USI bIdg, eIdg;
-    OCP_DBL areaB, areaE;
-    USI     direction;
-    for (OCP_USI n = 0; n < CoTmp.numConn; n++) {
-        const GeneralConnect& ConnTmp = CoTmp.connect[n];
-        direction                     = ConnTmp.directionType;
-        bIdg                          = ConnTmp.begin;
-        eIdg                          = ConnTmp.end;
-        areaB                         = ConnTmp.Ad_dd_begin;
-        areaE                         = ConnTmp.Ad_dd_end;
-        gNeighbor[bIdg].push_back(GPair(eIdg, direction, areaB, areaE));
-        gNeighbor[eIdg].push_back(GPair(bIdg, direction, areaE, areaB));
+        vector<GPair>& nb = gNeighbor[n];
+        nb.reserve(connBegin[n + 1] - connBegin[n]);
+        for (OCP_USI m = connBegin[n]; m < connBegin[n + 1]; m++) {
+            const GeneralConnect& ConnTmp = CoTmp.connect[connOfGrid[m] / 2];
+            if (connOfGrid[m] % 2 == 0) {
+                nb.push_back(GPair(ConnTmp.end, ConnTmp.directionType,
+                                   ConnTmp.Ad_dd_begin, ConnTmp.Ad_dd_end));
+            } else {
+                nb.push_back(GPair(ConnTmp.begin, ConnTmp.directionType,
+                                   ConnTmp.Ad_dd_end, ConnTmp.Ad_dd_begin));
+            }
+        }
     }
 }
 
@@ -249,25 +242,38 @@ void Grid::SetupNeighborCornerGrid(const OCP_COORD& CoTmp)
 //  Note: Inactive cells do NOT participate simumlation; other rules can be given.
 void Grid::CalActiveGridIsoT(const OCP_DBL& e1, const OCP_DBL& e2)
 {
-    map_Act2All.reserve(numGrid);
+    // Active cells are numbered by the prefix sums of their indicators
+    vector<OCP_USI> actId(numGrid);
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (OCP_USI n = 0; n < numGrid; n++) {
+        if (ACTNUM[n] == 0 || poro[n] * ntg[n] < e1 || v[n] < e2) ACTNUM[n] = 0;
+        actId[n] = ACTNUM[n] == 0 ? 0 : 1;
+    }
+    activeGridNum = ExclusiveScan(actId.data(), numGrid);
+
+    map_Act2All.resize(activeGridNum);
     map_All2Act.resize(numGrid);
-    OCP_USI count = 0;
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
     for (OCP_USI n = 0; n < numGrid; n++) {
-        if (ACTNUM[n] == 0 || poro[n] * ntg[n] < e1 || v[n] < e2) {
+        if (ACTNUM[n] == 0) {
             map_All2Act[n] = GB_Pair(OCP_FALSE, 0);
-            ACTNUM[n]      = 0;
-            continue;
+        } else {
+            map_Act2All[actId[n]] = n;
+            map_All2Act[n]        = GB_Pair(OCP_TRUE, actId[n]);
         }
-        map_Act2All.push_back(n);
-        map_All2Act[n] = GB_Pair(OCP_TRUE, count);
-        count++;
     }
-    activeGridNum = count;
+    ReorderActiveGrid();
     if (numGrid > activeGridNum) {
         cout << "  Number of inactive cells is " << (numGrid - activeGridNum) << " ("
              << (numGrid - activeGridNum) * 100.0 / numGrid << "%)" << endl;
     }
 
+    ownedGridNum = activeGridNum;
+
     // fluid grid = active grid
     fluidGridNum = activeGridNum;
     map_All2Flu  = map_All2Act;
@@ -275,39 +281,248 @@ void Grid::CalActiveGridIsoT(const OCP_DBL& e1, const OCP_DBL& e2)
 
 void Grid::CalActiveGridT(const OCP_DBL& e1, const OCP_DBL& e2)
 {
-    map_Act2All.reserve(numGrid);
+    // Active and fluid cells are numbered by the prefix sums of their indicators
+    vector<OCP_USI> actId(numGrid);
+    vector<OCP_USI> fluId(numGrid);
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (OCP_USI n = 0; n < numGrid; n++) {
+        if (ACTNUM[n] == 0 || v[n] < e1) ACTNUM[n] = 0;
+        actId[n] = ACTNUM[n] == 0 ? 0 : 1;
+        fluId[n] = ACTNUM[n] == 0 || poro[n] * ntg[n] < e2 ? 0 : 1;
+    }
+    activeGridNum = ExclusiveScan(actId.data(), numGrid);
+    fluidGridNum  = ExclusiveScan(fluId.data(), numGrid);
+
+    map_Act2All.resize(activeGridNum);
     map_All2Act.resize(numGrid);
     map_All2Flu.resize(numGrid);
-    OCP_USI activeCount = 0;
-    OCP_USI fluidCount  = 0;
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
     for (OCP_USI n = 0; n < numGrid; n++) {
-        if (ACTNUM[n] == 0 || v[n] < e1) {
+        if (ACTNUM[n] == 0) {
             map_All2Act[n] = GB_Pair(OCP_FALSE, 0);
             map_All2Flu[n] = GB_Pair(OCP_FALSE, 0);
-            ACTNUM[n]      = 0;
+            continue;
+        }
+        map_Act2All[actId[n]] = n;
+        map_All2Act[n]        = GB_Pair(OCP_TRUE, actId[n]);
+        if (poro[n] * ntg[n] < e2) {
+            map_All2Flu[n] = GB_Pair(OCP_FALSE, 0);
         } else {
-            if (poro[n] * ntg[n] < e2) {
-                map_All2Flu[n] = GB_Pair(OCP_FALSE, 0);
-            } else {
-                map_All2Flu[n] = GB_Pair(OCP_TRUE, fluidCount);
-                fluidCount++;
-            }
-            map_Act2All.push_back(n);
-            map_All2Act[n] = GB_Pair(OCP_TRUE, activeCount);
-            activeCount++;
+            map_All2Flu[n] = GB_Pair(OCP_TRUE, fluId[n]);
         }
     }
-    activeGridNum = activeCount;
+    ReorderActiveGrid();
     if (numGrid > activeGridNum) {
         cout << "  Number of inactive cells is " << (numGrid - activeGridNum) << " ("
              << (numGrid - activeGridNum) * 100.0 / numGrid << "%)" << endl;
     }
-
-    fluidGridNum = fluidCount;
+    ownedGridNum = activeGridNum;
     // temp
     // output num of fluid grid
 }
 
+void Grid::ReorderActiveGrid()
+{
+    if (gridOrder == ORDER_NATURAL || activeGridNum == 0) return;
+
+    // order[a] is the current index of the a-th active cell in new ordering
+    vector<OCP_USI> order;
+    switch (gridOrder) {
+        case ORDER_RCM:
+            CalOrderRCM(order);
+            break;
+        case ORDER_HILBERT:
+            CalOrderHilbert(order);
+            break;
+        default:
+            OCP_ABORT("WRONG Ordering of Grid!");
+    }
+
+    vector<OCP_USI> act2All(activeGridNum);
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (OCP_USI a = 0; a < activeGridNum; a++) {
+        act2All[a]              = map_Act2All[order[a]];
+        map_All2Act[act2All[a]] = GB_Pair(OCP_TRUE, a);
+    }
+    map_Act2All.swap(act2All);
+}
+
+void Grid::CalOrderRCM(vector<OCP_USI>& order) const
+{
+    // Connections between active cells in CSR form
+    vector<OCP_USI> xadj(activeGridNum + 1, 0);
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (OCP_USI a = 0; a < activeGridNum; a++) {
+        for (const GPair& g : gNeighbor[map_Act2All[a]]) {
+            if (map_All2Act[g.id].IsAct()) xadj[a]++;
+        }
+    }
+    xadj[activeGridNum] = ExclusiveScan(xadj.data(), activeGridNum);
+    vector<OCP_USI> adj(xadj[activeGridNum]);
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (OCP_USI a = 0; a < activeGridNum; a++) {
+        OCP_USI m = xadj[a];
+        for (const GPair& g : gNeighbor[map_Act2All[a]]) {
+            if (map_All2Act[g.id].IsAct()) adj[m++] = map_All2Act[g.id].GetId();
+        }
+    }
+    auto lessDeg = [&xadj](const OCP_USI& a1, const OCP_USI& a2) {
+        const OCP_USI d1 = xadj[a1 + 1] - xadj[a1];
+        const OCP_USI d2 = xadj[a2 + 1] - xadj[a2];
+        return d1 < d2 || (d1 == d2 && a1 < a2);
+    };
+
+    // Breadth-first search from root through cells not numbered yet, which returns the
+    // number of levels and the beginning of the last level in queue
+    vector<OCP_BOOL> numbered(activeGridNum, OCP_FALSE);
+    vector<OCP_USI>  mark(activeGridNum, 0); // the last search visiting each cell
+    vector<OCP_USI>  queue;
+    OCP_USI          stamp = 0;
+
+    auto bfs = [&](const OCP_USI& root, OCP_USI& lastBegin) {
+        stamp++;
+        queue.assign(1, root);
+        mark[root]       = stamp;
+        OCP_USI numLevel = 0;
+        for (OCP_USI b = 0, e; b < queue.size(); b = e) {
+            e         = queue.size();
+            lastBegin = b;
+            numLevel++;
+            for (OCP_USI q = b; q < e; q++) {
+                for (OCP_USI m = xadj[queue[q]]; m < xadj[queue[q] + 1]; m++) {
+                    if (!numbered[adj[m]] && mark[adj[m]] != stamp) {
+                        mark[adj[m]] = stamp;
+                        queue.push_back(adj[m]);
+                    }
+                }
+            }
+        }
+        return numLevel;
+    };
+
+    order.clear();
+    order.reserve(activeGridNum);
+    for (OCP_USI s = 0; s < activeGridNum; s++) {
+        if (numbered[s]) continue;
+
+        // Pseudo-peripheral cell of the component as the root, see George and Liu,
+        // ACM Trans. Math. Softw. 5 (1979), 284-295.
+        OCP_USI root = s;
+        OCP_USI lastBegin = 0;
+        OCP_USI numLevel  = bfs(root, lastBegin);
+        while (OCP_TRUE) {
+            const OCP_USI x =
+                *min_element(queue.begin() + lastBegin, queue.end(), lessDeg);
+            const OCP_USI n = bfs(x, lastBegin);
+            if (n <= numLevel) break;
+            root     = x;
+            numLevel = n;
+        }
+
+        // Cuthill-McKee: neighbors are numbered in ascending order of degrees
+        numbered[root] = OCP_TRUE;
+        order.push_back(root);
+        for (OCP_USI b = order.size() - 1; b < order.size(); b++) {
+            const OCP_USI e = order.size();
+            for (OCP_USI m = xadj[order[b]]; m < xadj[order[b] + 1]; m++) {
+                if (!numbered[adj[m]]) {
+                    numbered[adj[m]] = OCP_TRUE;
+                    order.push_back(adj[m]);
+                }
+            }
+            sort(order.begin() + e, order.end(), lessDeg);
+        }
+    }
+    reverse(order.begin(), order.end());
+}
+
+/// Return the index of point (x[0], x[1], x[2]) along a Hilbert curve, where each
+/// coordinate has b bits, see J. Skilling, AIP Conf. Proc. 707 (2004), 381-387.
+static OCP_ULL HilbertIndex(USI x[3], const USI& b)
+{
+    // Inverse undo excess work
+    for (USI q = 1U << (b - 1); q > 1; q >>= 1) {
+        const USI p = q - 1;
+        for (USI i = 0; i < 3; i++) {
+            if (x[i] & q) {
+                x[0] ^= p;
+            } else {
+                const USI t = (x[0] ^ x[i]) & p;
+                x[0] ^= t;
+                x[i] ^= t;
+            }
+        }
+    }
+    // Gray encode
+    for (USI i = 1; i < 3; i++) x[i] ^= x[i - 1];
+    USI t = 0;
+    for (USI q = 1U << (b - 1); q > 1; q >>= 1) {
+        if (x[2] & q) t ^= q - 1;
+    }
+    for (USI i = 0; i < 3; i++) x[i] ^= t;
+
+    // Interleave the bits of transposed index
+    OCP_ULL h = 0;
+    for (OCP_INT l = b - 1; l >= 0; l--) {
+        for (USI i = 0; i < 3; i++) h = (h << 1) | ((x[i] >> l) & 1);
+    }
+    return h;
+}
+
+void Grid::CalOrderHilbert(vector<OCP_USI>& order) const
+{
+    USI b = 1; // bits of each coordinate
+    while ((1U << b) < max(nx, max(ny, nz))) b++;
+    // A key holds 63 bits, so coordinates of larger grids are coarsened and cells
+    // sharing a key keep their natural order
+    const USI shift = b > 21 ? b - 21 : 0;
+    b -= shift;
+
+    vector<pair<OCP_ULL, OCP_USI>> key(activeGridNum);
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (OCP_USI a = 0; a < activeGridNum; a++) {
+        const OCP_USI n    = map_Act2All[a];
+        const OCP_USI nxy  = static_cast<OCP_USI>(nx) * ny;
+        USI           x[3] = {static_cast<USI>(n % nx) >> shift,
+                              static_cast<USI>(n / nx % ny) >> shift,
+                              static_cast<USI>(n / nxy) >> shift};
+        key[a]             = make_pair(HilbertIndex(x, b), a);
+    }
+    sort(key.begin(), key.end());
+
+    order.resize(activeGridNum);
+    for (OCP_USI a = 0; a < activeGridNum; a++) order[a] = key[a].second;
+}
+
+/// Active cells out of act are inactive for calling process afterwards.
+//  Note: map_All2Flu keeps the global activity of cells, so that a fluid cell which is
+//  inactive in map_All2Act belongs to other processes.
+void Grid::RestrictActiveGrid(const vector<OCP_USI>& act, const OCP_USI& numOwned)
+{
+    vector<GB_Pair> all2Act(numGrid, GB_Pair(OCP_FALSE, 0));
+    vector<OCP_USI> act2All(act.size());
+    for (OCP_USI a = 0; a < act.size(); a++) {
+        act2All[a]          = map_Act2All[act[a]];
+        all2Act[act2All[a]] = GB_Pair(OCP_TRUE, a);
+    }
+    map_Act2All.swap(act2All);
+    map_All2Act.swap(all2Act);
+    activeGridNum = act.size();
+    ownedGridNum  = numOwned;
+}
+
 void Grid::SetupGridLocation()
 {
     gLocation.resize(numGrid);
@@ -326,10 +541,12 @@ void Grid::SetupGridLocation()
 OCP_INT Grid::GetActIndex(const USI& I, const USI& J, const USI& K) const
 {
     const OCP_USI& n = K * nx * ny + J * nx + I;
-    if (map_All2Flu[n].IsAct()) {
-        return map_All2Act[n].GetId();
-    } else {
+    if (!map_All2Flu[n].IsAct()) {
         return -1;
+    } else if (!map_All2Act[n].IsAct() || map_All2Act[n].GetId() >= ownedGridNum) {
+        return -2;
+    } else {
+        return map_All2Act[n].GetId();
     }
 }
 
@@ -395,18 +612,20 @@ void Grid::SetHexaherdronGridCorner(const OCP_COORD& mycord)
 
     polyhedronGrid.reserve(numGrid);
     OCPpolyhedron tmpP(8);
+    Hexahedron    block;
 
     for (USI k = 0; k < nz; k++) {
         for (USI j = 0; j < ny; j++) {
             for (USI i = 0; i < nx; i++) {
-                tmpP.Points.push_back(mycord.cornerPoints[i][j][k].p4);
-                tmpP.Points.push_back(mycord.cornerPoints[i][j][k].p5);
-                tmpP.Points.push_back(mycord.cornerPoints[i][j][k].p6);
-                tmpP.Points.push_back(mycord.cornerPoints[i][j][k].p7);
-                tmpP.Points.push_back(mycord.cornerPoints[i][j][k].p0);
-                tmpP.Points.push_back(mycord.cornerPoints[i][j][k].p1);
-                tmpP.Points.push_back(mycord.cornerPoints[i][j][k].p2);
-                tmpP.Points.push_back(mycord.cornerPoints[i][j][k].p3);
+                mycord.GetHexahedron(i, j, k, block);
+                tmpP.Points.push_back(block.p4);
+                tmpP.Points.push_back(block.p5);
+                tmpP.Points.push_back(block.p6);
+                tmpP.Points.push_back(block.p7);
+                tmpP.Points.push_back(block.p0);
+                tmpP.Points.push_back(block.p1);
+                tmpP.Points.push_back(block.p2);
+                tmpP.Points.push_back(block.p3);
                 polyhedronGrid.push_back(tmpP);
                 tmpP.Points.clear();
             }
@@ -500,4 +719,10 @@ void Grid::CalNumDigutIJK()
 /*  Shizhe Li           Oct/01/2021      Create file                          */
 /*  Chensong Zhang      Oct/15/2021      Format file                          */
 /*  Chensong Zhang      Jan/16/2022      Fix Doxygen                          */
+/*  OpenCAEPoro team    Oct/17/2026      Build corner points on demand        */
+/*  OpenCAEPoro team    Oct/17/2026      Parallel setup with prefix sums      */
+/*  OpenCAEPoro team    Oct/17/2026      Reorder active cells                 */
+/*  OpenCAEPoro team    Oct/17/2026      Add 64-bit global index option       */
+/*  OpenCAEPoro team    Oct/17/2026      Coarsen Hilbert keys of large grids  */
+/*  OpenCAEPoro team    Oct/17/2026      Distribute FIM among MPI processes   */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
@@ -78,6 +78,8 @@ void IsothermalSolver::Prepare(Reservoir& rs, OCPControl& ctrl)
 /// Assemble linear systems for IMPEC and FIM.
 void IsothermalSolver::AssembleMat(const Reservoir& rs, OCPControl& ctrl)
 {
+    OCP_PROFILE(PROF_ASSEMBLE);
+
     const OCP_DBL dt = ctrl.GetCurDt();
 
     GetWallTime timer;
@@ -106,6 +108,8 @@ void IsothermalSolver::AssembleMat(const Reservoir& rs, OCPControl& ctrl)
 /// Solve linear systems for IMPEC and FIM.
 void IsothermalSolver::SolveLinearSystem(Reservoir& rs, OCPControl& ctrl)
 {
+    OCP_PROFILE(PROF_LINEAR_SOLVE);
+
     switch (method) {
         case IMPEC:
             impec.SolveLinearSystem(LSolver, rs, ctrl);
@@ -127,6 +131,8 @@ void IsothermalSolver::SolveLinearSystem(Reservoir& rs, OCPControl& ctrl)
 /// Update physical properties for IMPEC and FIM.
 OCP_BOOL IsothermalSolver::UpdateProperty(Reservoir& rs, OCPControl& ctrl)
 {
+    OCP_PROFILE(PROF_UPDATE);
+
     OCP_BOOL flag;
 
     GetWallTime timer;
@@ -0,0 +1,125 @@
+/*! \file    LinearCapture.cpp
+ *  \brief   CapturedSystem class definition
+ *  \author  OpenCAEPoro team
+ *  \date    Oct/16/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the OpenCAEPoro team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+// Standard header files
+#include <algorithm>
+#include <limits>
+
+// OpenCAEPoro header files
+#include "LinearCapture.hpp"
+#include "UtilError.hpp"
+#include "UtilRestart.hpp"
+
+/// Read a value from a capture file.
+template <typename T>
+static void ReadValue(ifstream& in, T& v)
+{
+    in.read(reinterpret_cast<char*>(&v), sizeof(T));
+    if (!in) OCP_ABORT("Capture file is truncated!");
+}
+
+/// Read a vector of any size from a capture file, its size goes first.
+template <typename T>
+static void ReadVector(ifstream& in, vector<T>& v)
+{
+    OCP_ULL n;
+    ReadValue(in, n);
+    v.resize(n);
+    if (n > 0) in.read(reinterpret_cast<char*>(v.data()), n * sizeof(T));
+    if (!in) OCP_ABORT("Capture file is truncated!");
+}
+
+/// Write indices as 64-bit integers, whatever the width of OCP_USI is.
+static void WriteIndex(ofstream& out, const vector<OCP_USI>& v)
+{
+    WriteBinary(out, vector<OCP_ULL>(v.begin(), v.end()));
+}
+
+/// Read indices stored as 64-bit integers.
+static void ReadIndex(ifstream& in, vector<OCP_USI>& v)
+{
+    vector<OCP_ULL> tmp;
+    ReadVector(in, tmp);
+    for (const auto& i : tmp) {
+        if (i > numeric_limits<OCP_USI>::max()) {
+            OCP_ABORT("Capture file is too large, use 64-bit indices!");
+        }
+    }
+    v.assign(tmp.begin(), tmp.end());
+}
+
+void CapturedSystem::WriteHeader(ofstream& out)
+{
+    out.write(CAPTURE_MAGIC, sizeof(CAPTURE_MAGIC));
+    WriteBinary(out, CAPTURE_VERSION);
+}
+
+OCP_BOOL CapturedSystem::ReadHeader(ifstream& in)
+{
+    char magic[sizeof(CAPTURE_MAGIC)];
+    USI  version = 0;
+    in.read(magic, sizeof(magic));
+    in.read(reinterpret_cast<char*>(&version), sizeof(version));
+    return in && equal(magic, magic + sizeof(magic), CAPTURE_MAGIC) &&
+           version == CAPTURE_VERSION;
+}
+
+void CapturedSystem::Write(ofstream& out) const
+{
+    WriteBinary(out, tstep);
+    WriteBinary(out, iterNR);
+    WriteBinary(out, method);
+    WriteBinary(out, time);
+    WriteBinary(out, dt);
+    WriteBinary(out, static_cast<OCP_ULL>(dim));
+    WriteBinary(out, blockDim);
+    WriteIndex(out, rowPtr);
+    WriteIndex(out, colIdx);
+    WriteBinary(out, val);
+    WriteBinary(out, b);
+    out.flush();
+}
+
+OCP_BOOL CapturedSystem::Read(ifstream& in)
+{
+    // a clean end of file is met before a new system
+    if (in.peek() == ifstream::traits_type::eof()) return OCP_FALSE;
+
+    ReadValue(in, tstep);
+    ReadValue(in, iterNR);
+    ReadValue(in, method);
+    ReadValue(in, time);
+    ReadValue(in, dt);
+    OCP_ULL n;
+    ReadValue(in, n);
+    ReadValue(in, blockDim);
+    ReadIndex(in, rowPtr);
+    ReadIndex(in, colIdx);
+    ReadVector(in, val);
+    ReadVector(in, b);
+    dim = static_cast<OCP_USI>(n);
+
+    const OCP_USI nnz = rowPtr.empty() ? 0 : rowPtr.back();
+    if (rowPtr.size() != n + 1 || colIdx.size() != nnz ||
+        val.size() != nnz * blockDim * blockDim || b.size() != dim * blockDim) {
+        OCP_ABORT("Capture file is corrupted!");
+    }
+    return OCP_TRUE;
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  OpenCAEPoro team    Oct/16/2026      Create file                          */
+/*  OpenCAEPoro team    Oct/17/2026      Store indices as 64-bit integers     */
+/*----------------------------------------------------------------------------*/
@@ -9,6 +9,7 @@
  */
 
 #include "LinearSystem.hpp"
+#include "UtilMPI.hpp"
 
 void LinearSystem::AllocateRowMem(const OCP_USI& dimMax, const USI& nb)
 {
@@ -56,6 +57,13 @@ void LinearSystem::AllocateColMem(const vector<USI>&            bulk2bulk,
 
 void LinearSystem::ClearData()
 {
+    if (patternFrozen) {
+        // values are overwritten in the next assembly, only reset the filling state
+        fill(rowFill.begin(), rowFill.end(), 0);
+        fill(b.begin(), b.end(), 0.0);
+        dim = 0;
+        return;
+    }
     for (OCP_USI i = 0; i < maxDim; i++) {
         colId[i].clear(); // actually, only parts of bulks needs to be clear
         val[i].clear();
@@ -67,6 +75,59 @@ void LinearSystem::ClearData()
     // next step, so u will not be set to zero. u.assign(maxDim, 0);
 }
 
+void LinearSystem::AssembleMatLinearSolver()
+{
+    if (patternFrozen) {
+        // values have been written into the matrix of linear solver already
+        if (dim != patternDim)
+            OCP_ABORT("Dimension does not match the frozen pattern!");
+        for (OCP_USI n = 0; n < dim; n++) {
+            if (rowPtr[n] + rowFill[n] != rowPtr[n + 1])
+                OCP_ABORT("Row does not match the frozen pattern!");
+        }
+        return;
+    }
+
+    LS->AssembleMat(colId, val, dim, blockDim, b, u);
+    if (ifFrozenPattern) FreezePattern();
+}
+
+void LinearSystem::SetFrozenPattern(const OCP_BOOL& flag)
+{
+    // only linear solvers which expose their matrix storage support it
+    ifFrozenPattern = flag && LS->GetMatValue() != nullptr;
+    patternFrozen   = OCP_FALSE;
+}
+
+void LinearSystem::CheckPattern(const OCP_ULL& key)
+{
+    if (key != patternKey) {
+        patternKey    = key;
+        patternFrozen = OCP_FALSE;
+        // setups of preconditioners depend on the pattern
+        LS->ResetPC();
+    }
+}
+
+void LinearSystem::FreezePattern()
+{
+    patternDim = dim;
+    rowPtr.resize(dim + 1);
+    rowPtr[0] = 0;
+    for (OCP_USI n = 0; n < dim; n++) {
+        rowPtr[n + 1] = rowPtr[n] + colId[n].size();
+    }
+    colIdx.resize(rowPtr[dim]);
+    for (OCP_USI n = 0; n < dim; n++) {
+        copy(colId[n].begin(), colId[n].end(), colIdx.begin() + rowPtr[n]);
+        colId[n].clear();
+        val[n].clear();
+    }
+    rowFill.assign(dim, 0);
+    valPtr        = LS->GetMatValue();
+    patternFrozen = OCP_TRUE;
+}
+
 void LinearSystem::AssembleRhsAccumulate(const vector<OCP_DBL>& rhs)
 {
     OCP_USI nrow = dim * blockDim;
@@ -93,29 +154,46 @@ void LinearSystem::OutputLinearSystem(const string& fileA, const string& fileb)
     if (blockDim != 1) {
         outA << blockDim << "\n";
     }
-    // IA
-    OCP_USI rowId = 1;
-    for (OCP_USI i = 0; i < dim; i++) {
+    if (patternFrozen) {
+        // IA
+        for (OCP_USI i = 0; i <= dim; i++) {
+            outA << rowPtr[i] + 1 << "\n";
+        }
+        // JA
+        for (OCP_USI k = 0; k < rowPtr[dim]; k++) {
+            outA << colIdx[k] + 1 << "\n";
+        }
+        // val
+        const OCP_USI len = rowPtr[dim] * blockSize;
+        for (OCP_USI k = 0; k < len; k++) {
+            outA << valPtr[k] << "\n";
+        }
+        outA.close();
+    } else {
+        // IA
+        OCP_USI rowId = 1;
+        for (OCP_USI i = 0; i < dim; i++) {
+            outA << rowId << "\n";
+            rowId += colId[i].size();
+        }
         outA << rowId << "\n";
-        rowId += colId[i].size();
-    }
-    outA << rowId << "\n";
-    // JA
-    USI rowSize = 0;
-    for (OCP_USI i = 0; i < dim; i++) {
-        rowSize = colId[i].size();
-        for (USI j = 0; j < rowSize; j++) {
-            outA << colId[i][j] + 1 << "\n";
+        // JA
+        USI rowSize = 0;
+        for (OCP_USI i = 0; i < dim; i++) {
+            rowSize = colId[i].size();
+            for (USI j = 0; j < rowSize; j++) {
+                outA << colId[i][j] + 1 << "\n";
+            }
         }
-    }
-    // val
-    for (OCP_USI i = 0; i < dim; i++) {
-        rowSize = val[i].size();
-        for (USI j = 0; j < rowSize; j++) {
-            outA << val[i][j] << "\n";
+        // val
+        for (OCP_USI i = 0; i < dim; i++) {
+            rowSize = val[i].size();
+            for (USI j = 0; j < rowSize; j++) {
+                outA << val[i][j] << "\n";
+            }
         }
+        outA.close();
     }
-    outA.close();
 
     // out b
     OCP_USI  nRow = dim * blockDim;
@@ -138,9 +216,40 @@ void LinearSystem::OutputSolution(const string& fileU) const
     outu.close();
 }
 
+void LinearSystem::GetCapturedSystem(CapturedSystem& sys) const
+{
+    sys.dim      = dim;
+    sys.blockDim = blockDim;
+    sys.rowPtr.resize(dim + 1);
+    if (patternFrozen) {
+        copy(rowPtr.begin(), rowPtr.begin() + dim + 1, sys.rowPtr.begin());
+        sys.colIdx.assign(colIdx.begin(), colIdx.begin() + rowPtr[dim]);
+        sys.val.assign(valPtr, valPtr + rowPtr[dim] * blockSize);
+    } else {
+        sys.rowPtr[0] = 0;
+        sys.colIdx.clear();
+        sys.val.clear();
+        for (OCP_USI i = 0; i < dim; i++) {
+            sys.rowPtr[i + 1] = sys.rowPtr[i] + colId[i].size();
+            sys.colIdx.insert(sys.colIdx.end(), colId[i].begin(), colId[i].end());
+            sys.val.insert(sys.val.end(), val[i].begin(),
+                           val[i].begin() + colId[i].size() * blockSize);
+        }
+    }
+    sys.b.assign(b.begin(), b.begin() + dim * blockDim);
+}
+
 void LinearSystem::CheckEquation() const
 {
     // check A
+    if (patternFrozen) {
+        const OCP_USI len = rowPtr[dim] * blockSize;
+        for (OCP_USI k = 0; k < len; k++) {
+            if (!isfinite(valPtr[k])) {
+                OCP_ABORT("NAN or INF in MAT");
+            }
+        }
+    }
     for (OCP_USI n = 0; n < dim; n++) {
         for (auto v : val[n]) {
             if (!isfinite(v)) {
@@ -173,19 +282,23 @@ void LinearSystem::SetupLinearSolver(const USI&    i,
                                      const string& file)
 {
     solveDir = dir;
-    switch (i) {
-        case SCALARFASP:
-            // Fasp
-            LS = new ScalarFaspSolver;
-            break;
-        case VECTORFASP:
-            // Blcok Fasp
-            LS = new VectorFaspSolver;
-            break;
-        default:
-            OCP_ABORT("Wrong Linear Solver type!");
-            break;
+    if (i != SCALARFASP && i != VECTORFASP) {
+        OCP_ABORT("Wrong Linear Solver type!");
+    }
+    if (GetMPISize() > 1 || NativeParam::IfSelected(dir + file)) {
+        // Native block solvers, scalar problems use 1*1 blocks, and only they solve
+        // systems distributed among processes
+        LS = new NativeSolver;
+    }
+#if WITH_FASP
+    else if (i == SCALARFASP) {
+        // Fasp
+        LS = new ScalarFaspSolver;
+    } else {
+        // Blcok Fasp
+        LS = new VectorFaspSolver;
     }
+#endif
     LS->SetupParam(dir, file);
     LS->Allocate(rowCapacity, maxDim, blockDim);
 }
@@ -197,4 +310,10 @@ void LinearSystem::SetupLinearSolver(const USI&    i,
 /*----------------------------------------------------------------------------*/
 /*  Shizhe Li           Oct/01/2021      Create file                          */
 /*  Shizhe Li           Nov/22/2021      renamed to LinearSystem              */
+/*  OpenCAEPoro team    Oct/16/2026      Add frozen sparsity pattern          */
+/*  OpenCAEPoro team    Oct/16/2026      Select native solvers                */
+/*  OpenCAEPoro team    Oct/16/2026      Reset preconditioners with pattern   */
+/*  OpenCAEPoro team    Oct/16/2026      Capture linear systems               */
+/*  OpenCAEPoro team    Oct/17/2026      Drop initial guesses of captures     */
+/*  OpenCAEPoro team    Oct/17/2026      Distribute FIM among MPI processes   */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
@@ -158,6 +158,9 @@ MixtureComp::MixtureComp(const ComponentParam& param, const USI& tarId)
     EoSctrl.RR.tol   = stod(param.RRparam[1]);
     EoSctrl.RR.tol2  = EoSctrl.RR.tol * EoSctrl.RR.tol;
 
+    flashCache.SetUseCache(param.flashCache);
+    flashCache.SetParam(param.cacheParam);
+
     AllocateEoS();
     AllocatePhase();
     AllocateMethod();
@@ -877,6 +880,8 @@ void MixtureComp::AllocateEoS()
     // Allocate Memoery for EoS variables
     Ai.resize(NC);
     Bi.resize(NC);
+    Aij.resize(NC * NC);
+    Axj.resize(NPmax * NC);
     Aj.resize(NPmax);
     Bj.resize(NPmax);
     Zj.resize(NPmax);
@@ -934,37 +939,60 @@ void MixtureComp::CalAiBi()
         Ai[i] = OmegaA[i] * Pri / pow(Tri, 2) * pow((1 + mwi * (1 - sqrt(Tri))), 2);
         Bi[i] = OmegaB[i] * Pri / Tri;
     }
+
+    // Calculate Aij, which is shared by all phases at the same P and T
+    // Axj is used to store sqrt(Ai) here
+    for (USI i = 0; i < NC; i++) Axj[i] = sqrt(Ai[i]);
+    for (USI i = 0; i < NC; i++) {
+        for (USI k = 0; k < NC; k++) {
+            Aij[i * NC + k] = Axj[i] * Axj[k] * (1 - BIC[i * NC + k]);
+        }
+    }
 }
 
 void MixtureComp::CalAjBj(OCP_DBL& AjT, OCP_DBL& BjT, const vector<OCP_DBL>& xj) const
 {
+    CalAjBj(AjT, BjT, xj.data());
+}
+
+void MixtureComp::CalAjBj(OCP_DBL&       AjT,
+                          OCP_DBL&       BjT,
+                          const OCP_DBL* xj,
+                          OCP_DBL*       AxT) const
+{
+    // Aj = xj^T * Aij * xj, where Aij * xj is kept for fugacity if required
     AjT = 0;
     BjT = 0;
 
-    for (USI i1 = 0; i1 < NC; i1++) {
-        BjT += Bi[i1] * xj[i1];
-        AjT += xj[i1] * xj[i1] * Ai[i1] * (1 - BIC[i1 * NC + i1]);
+    for (USI i = 0; i < NC; i++) {
+        const OCP_DBL* Ai_i = &Aij[i * NC];
+        OCP_DBL        tmp  = 0;
+        OCP_SIMD_SUM(tmp)
+        for (USI k = 0; k < NC; k++) tmp += Ai_i[k] * xj[k];
 
-        for (USI i2 = 0; i2 < i1; i2++) {
-            AjT +=
-                2 * xj[i1] * xj[i2] * sqrt(Ai[i1] * Ai[i2]) * (1 - BIC[i1 * NC + i2]);
-        }
+        if (AxT != nullptr) AxT[i] = tmp;
+        AjT += xj[i] * tmp;
+        BjT += Bi[i] * xj[i];
     }
 }
 
-void MixtureComp::CalAjBj(OCP_DBL& AjT, OCP_DBL& BjT, const OCP_DBL* xj) const
+void MixtureComp::CalPhiEoS(OCP_DBL*       phiT,
+                            const OCP_DBL& aj,
+                            const OCP_DBL& bj,
+                            const OCP_DBL& zj,
+                            const OCP_DBL* AxT) const
 {
-    AjT = 0;
-    BjT = 0;
-
-    for (USI i1 = 0; i1 < NC; i1++) {
-        BjT += Bi[i1] * xj[i1];
-        AjT += xj[i1] * xj[i1] * Ai[i1] * (1 - BIC[i1 * NC + i1]);
-
-        for (USI i2 = 0; i2 < i1; i2++) {
-            AjT +=
-                2 * xj[i1] * xj[i2] * sqrt(Ai[i1] * Ai[i2]) * (1 - BIC[i1 * NC + i2]);
-        }
+    // Terms independent of components are evaluated once
+    const OCP_DBL c0 = (zj - 1) / bj;
+    const OCP_DBL c1 = log(zj - bj);
+    const OCP_DBL c2 =
+        aj / delta1M2 / bj * log((zj + delta1 * bj) / (zj + delta2 * bj));
+    const OCP_DBL c3 = 2 / aj;
+    const OCP_DBL c4 = 1 / bj;
+
+    OCP_SIMD
+    for (USI i = 0; i < NC; i++) {
+        phiT[i] = exp(Bi[i] * c0 - c1 - c2 * (AxT[i] * c3 - Bi[i] * c4));
     }
 }
 
@@ -994,76 +1022,20 @@ void MixtureComp::CalFugPhi(vector<OCP_DBL>&       phiT,
                             vector<OCP_DBL>&       fugT,
                             const vector<OCP_DBL>& xj)
 {
-    OCP_DBL aj, bj, zj;
-    CalAjBj(aj, bj, xj);
-    SolEoS(zj, aj, bj);
-
-    const OCP_DBL m1 = delta1;
-    const OCP_DBL m2 = delta2;
-    // const OCP_DBL m1Mm2 = delta1M2;
-
-    OCP_DBL tmp;
-    for (USI i = 0; i < NC; i++) {
-        tmp = 0;
-        for (USI k = 0; k < NC; k++) {
-            tmp += 2 * (1 - BIC[i * NC + k]) * sqrt(Ai[i] * Ai[k]) * xj[k];
-        }
-        phiT[i] = exp(Bi[i] / bj * (zj - 1) - log(zj - bj) -
-                      aj / (m1 - m2) / bj * (tmp / aj - Bi[i] / bj) *
-                          log((zj + m1 * bj) / (zj + m2 * bj)));
-        fugT[i] = phiT[i] * xj[i] * P;
-    }
-
-    //   OCP_DBL       tmp01 = log(zj - bj);
-    //   OCP_DBL       tmp02 = aj / (m1Mm2) / bj * log((zj + m1 * bj) / (zj + m2 * bj));
-
-    // for (USI i = 0; i < NC; i++) {
-    //	tmp = 0;
-    //	for (int k = 0; k < NC; k++) {
-    //		tmp += 2 * (1 - BIC[i * NC + k]) * sqrt(Ai[i] * Ai[k]) * xj[k];
-    //	}
-    //       phiT[i] = exp(Bi[i] / bj * (zj - 1) - tmp01 - tmp02 * (tmp / aj - Bi[i] /
-    //       bj));
-    //	fugT[i] = phiT[i] * xj[i] * P;
-    //}
-
-    Asta = aj;
-    Bsta = bj;
-    Zsta = zj;
+    CalFugPhi(phiT.data(), fugT.data(), xj.data());
 }
 
 void MixtureComp::CalFugPhi(OCP_DBL* phiT, OCP_DBL* fugT, const OCP_DBL* xj)
 {
-    OCP_DBL aj, bj, zj;
-    CalAjBj(aj, bj, xj);
+    OCP_DBL  aj, bj, zj;
+    OCP_DBL* AxT = &Axj[0];
+    CalAjBj(aj, bj, xj, AxT);
     SolEoS(zj, aj, bj);
+    CalPhiEoS(phiT, aj, bj, zj, AxT);
 
-    const OCP_DBL m1    = delta1;
-    const OCP_DBL m2    = delta2;
-    const OCP_DBL m1Mm2 = delta1M2;
-
-    // OCP_DBL tmp01 = log(zj - bj);
-    // OCP_DBL tmp02 = aj / (m1Mm2) / bj * log((zj + m1 * bj) / (zj + m2 * bj));
-
-    OCP_DBL tmp;
     for (USI i = 0; i < NC; i++) {
-        tmp = 0;
-        for (USI k = 0; k < NC; k++) {
-            tmp += 2 * (1 - BIC[i * NC + k]) * sqrt(Ai[i] * Ai[k]) * xj[k];
-        }
-        phiT[i] = exp(Bi[i] / bj * (zj - 1) - log(zj - bj) -
-                      aj / (m1Mm2) / bj * (tmp / aj - Bi[i] / bj) *
-                          log((zj + m1 * bj) / (zj + m2 * bj)));
         fugT[i] = phiT[i] * xj[i] * P;
     }
-    // for (USI i = 0; i < NC; i++) {
-    //    tmp = 0;
-    //    for (int k = 0; k < NC; k++) {
-    //        tmp += 2 * (1 - BIC[i * NC + k]) * sqrt(Ai[i] * Ai[k]) * xj[k];
-    //    }
-    //    phiT[i] = exp(Bi[i] / bj * (zj - 1) - tmp01 - tmp02 * (tmp / aj - Bi[i] /
-    //    bj)); fugT[i] = phiT[i] * xj[i] * P;
-    //}
 
     Asta = aj;
     Bsta = bj;
@@ -1072,27 +1044,14 @@ void MixtureComp::CalFugPhi(OCP_DBL* phiT, OCP_DBL* fugT, const OCP_DBL* xj)
 
 void MixtureComp::CalFugPhi(OCP_DBL* fugT, const OCP_DBL* xj)
 {
-    OCP_DBL aj, bj, zj;
-    CalAjBj(aj, bj, xj);
+    OCP_DBL  aj, bj, zj;
+    OCP_DBL* AxT = &Axj[0];
+    CalAjBj(aj, bj, xj, AxT);
     SolEoS(zj, aj, bj);
+    CalPhiEoS(fugT, aj, bj, zj, AxT);
 
-    const OCP_DBL m1    = delta1;
-    const OCP_DBL m2    = delta2;
-    const OCP_DBL m1Mm2 = delta1M2;
-
-    // OCP_DBL tmp01 = log(zj - bj);
-    // OCP_DBL tmp02 = aj / (m1Mm2) / bj * log((zj + m1 * bj) / (zj + m2 * bj));
-
-    OCP_DBL tmp;
     for (USI i = 0; i < NC; i++) {
-        tmp = 0;
-        for (USI k = 0; k < NC; k++) {
-            tmp += 2 * (1 - BIC[i * NC + k]) * sqrt(Ai[i] * Ai[k]) * xj[k];
-        }
-        tmp     = exp(Bi[i] / bj * (zj - 1) - log(zj - bj) -
-                      aj / (m1Mm2) / bj * (tmp / aj - Bi[i] / bj) *
-                          log((zj + m1 * bj) / (zj + m2 * bj)));
-        fugT[i] = tmp * xj[i] * P;
+        fugT[i] *= xj[i] * P;
     }
 
     Asta = aj;
@@ -1102,45 +1061,22 @@ void MixtureComp::CalFugPhi(OCP_DBL* fugT, const OCP_DBL* xj)
 
 void MixtureComp::CalFugPhiAll()
 {
-    OCP_DBL       tmp; // , tmp01, tmp02;
-    const OCP_DBL m1    = delta1;
-    const OCP_DBL m2    = delta2;
-    const OCP_DBL m1Mm2 = delta1M2;
-
+    // Aj, Bj and Aij * xj of all phases first, then roots of EoS, then fugacity
+    for (USI j = 0; j < NP; j++) {
+        CalAjBj(Aj[j], Bj[j], x[j].data(), &Axj[j * NC]);
+    }
+    for (USI j = 0; j < NP; j++) {
+        SolEoS(Zj[j], Aj[j], Bj[j]);
+    }
     for (USI j = 0; j < NP; j++) {
         const vector<OCP_DBL>& xj   = x[j];
         vector<OCP_DBL>&       phiT = phi[j];
         vector<OCP_DBL>&       fugT = fug[j];
-        OCP_DBL&               aj   = Aj[j];
-        OCP_DBL&               bj   = Bj[j];
-        OCP_DBL&               zj   = Zj[j];
-
-        CalAjBj(aj, bj, xj);
-        SolEoS(zj, aj, bj);
 
+        CalPhiEoS(phiT.data(), Aj[j], Bj[j], Zj[j], &Axj[j * NC]);
         for (USI i = 0; i < NC; i++) {
-            tmp = 0;
-            for (USI k = 0; k < NC; k++) {
-                tmp += 2 * (1 - BIC[i * NC + k]) * sqrt(Ai[i] * Ai[k]) * xj[k];
-            }
-            phiT[i] = exp(Bi[i] / bj * (zj - 1) - log(zj - bj) -
-                          aj / (m1Mm2) / bj * (tmp / aj - Bi[i] / bj) *
-                              log((zj + m1 * bj) / (zj + m2 * bj)));
             fugT[i] = phiT[i] * xj[i] * P;
         }
-
-        // tmp01 = log(zj - bj);
-        // tmp02 = aj / (m1Mm2) / bj * log((zj + m1 * bj) / (zj + m2 * bj));
-        // for (USI i = 0; i < NC; i++) {
-        //	tmp = 0;
-        //	for (int k = 0; k < NC; k++) {
-        //		tmp += 2 * (1 - BIC[i * NC + k]) * sqrt(Ai[i] * Ai[k]) * xj[k];
-        //	}
-        //          phiT[i] =
-        //              exp(Bi[i] / bj * (zj - 1) - tmp01 - tmp02 * (tmp / aj - Bi[i] /
-        //              bj));
-        //	fugT[i] = phiT[i] * xj[i] * P;
-        //}
     }
 }
 
@@ -1282,11 +1218,17 @@ void MixtureComp::PhaseEquilibrium()
     switch (ftype) {
         case 0:
             // flash from single phase
+            CalAiBi();
+            if (SplitFromCache()) {
+                flagSkip = OCP_FALSE;
+                ePEC     = EoSctrl.NRsp.realTol;
+                break;
+            }
+            OCP_PROFILE_COUNT(PROF_FLASH_STA, 1);
             flagSkip = OCP_TRUE;
             NP       = 1;
             nu[0]    = 1;
             x[0]     = zi;
-            CalAiBi();
             CalAjBj(Aj[0], Bj[0], x[0]);
             SolEoS(Zj[0], Aj[0], Bj[0]);
             CalKwilson();
@@ -1297,6 +1239,7 @@ void MixtureComp::PhaseEquilibrium()
             }
             if (NP > 1) {
                 flagSkip = OCP_FALSE;
+                InsertToCache();
             }
             // record error
             if (NP == 1) {
@@ -1318,6 +1261,7 @@ void MixtureComp::PhaseEquilibrium()
             break;
         case 1:
             // Skip Phase Stability analysis, only single phase exists
+            OCP_PROFILE_COUNT(PROF_FLASH_SKIP, 1);
             flagSkip = OCP_TRUE;
             NP       = 1;
             nu[0]    = 1;
@@ -1331,12 +1275,14 @@ void MixtureComp::PhaseEquilibrium()
 
         case 2:
             // Skip Phase Stability analysis, two phases exist
+            OCP_PROFILE_COUNT(PROF_FLASH_SKIP, 1);
             flagSkip = OCP_FALSE;
             NP       = 2;
             Yt       = 1.01;
             CalAiBi();
             CalKwilson();
             PhaseSplit();
+            InsertToCache();
 
             if (EoSctrl.NRsp.conflag)
                 ePEC = EoSctrl.NRsp.realTol;
@@ -1384,6 +1330,8 @@ OCP_BOOL MixtureComp::PhaseStable()
     }
     itersSSMSTA += EoSctrl.SSMsta.curIt;
     itersNRSTA += EoSctrl.NRsta.curIt;
+    OCP_PROFILE_COUNT(PROF_SSM_STA_ITER, EoSctrl.SSMsta.curIt);
+    OCP_PROFILE_COUNT(PROF_NR_STA_ITER, EoSctrl.NRsta.curIt);
     countsSSMSTA++;
     countsNRSTA++;
     return flag;
@@ -1655,7 +1603,7 @@ void MixtureComp::CalFugXSTA()
     for (USI i = 0; i < NC; i++) {
         tmp = 0;
         for (USI k = 0; k < NC; k++) {
-            tmp += Y[k] * (1 - BIC[i * NC + k]) * sqrt(Ai[i] * Ai[k]);
+            tmp += Y[k] * Aij[i * NC + k];
         }
         Ax[i] = 2 * tmp;
         Zx[i] = ((bj - zj) * Ax[i] + ((aj + m1Tm2 * (3 * bj * bj + 2 * bj)) +
@@ -1679,7 +1627,7 @@ void MixtureComp::CalFugXSTA()
         E = -aj / ((m1Mm2)*bj) * (Ax[i] / aj - Bx[i] / bj);
 
         for (USI k = 0; k < NC; k++) {
-            aik = (1 - BIC[i * NC + k]) * sqrt(Ai[i] * Ai[k]);
+            aik = Aij[i * NC + k];
 
             // Cxk = -Y[i] * (Zx[k] - Bx[k]) / ((zj - bj) * (zj - bj));
             Cxk = ((zj - bj) * delta(i, k) - Y[i] * (Zx[k] - Bx[k])) * P /
@@ -1761,6 +1709,8 @@ void MixtureComp::PhaseSplit()
 
     itersSSMSP += EoSctrl.SSMsp.curIt;
     itersNRSP += EoSctrl.NRsp.curIt;
+    OCP_PROFILE_COUNT(PROF_SSM_SP_ITER, EoSctrl.SSMsp.curIt);
+    OCP_PROFILE_COUNT(PROF_NR_SP_ITER, EoSctrl.NRsp.curIt);
     itersRR += EoSctrl.RR.curIt;
     countsSSMSP++;
     countsNRSP++;
@@ -1856,7 +1806,9 @@ void MixtureComp::SplitSSM2(const OCP_BOOL& flag)
     USI     maxIt         = EoSctrl.SSMsp.maxIt;
 
     if (!flag) {
-        if (lNP == 2) {
+        if (ifKsGiven) {
+            // Ks has been given
+        } else if (lNP == 2) {
             Ks[NP - 2] = lKs;
         } else {
             if (Yt < 1.1 || OCP_TRUE) {
@@ -2183,7 +2135,7 @@ void MixtureComp::CalFugNAll(const OCP_BOOL& Znflag)
         for (USI i = 0; i < NC; i++) {
             tmp = 0;
             for (USI m = 0; m < NC; m++) {
-                tmp += (1 - BIC[i * NC + m]) * sqrt(Ai[i] * Ai[m]) * xj[m];
+                tmp += Aij[i * NC + m] * xj[m];
             }
             An[i] = 2 / nu[j] * (tmp - aj);
             Bn[i] = 1 / nu[j] * (Bi[i] - bj);
@@ -2209,14 +2161,14 @@ void MixtureComp::CalFugNAll(const OCP_BOOL& Znflag)
             // D = Bi[i] / bj * (zj - 1);
             tmp = 0;
             for (USI k = 0; k < NC; k++) {
-                tmp += (1 - BIC[i * NC + k]) * sqrt(Ai[i] * Ai[k]) * xj[k];
+                tmp += Aij[i * NC + k] * xj[k];
             }
             E = -aj / ((delta1 - delta2) * bj) * (2 * tmp / aj - Bi[i] / bj);
 
             for (USI k = 0; k <= i; k++) {
                 // k th components
 
-                aik = (1 - BIC[i * NC + k]) * sqrt(Ai[i] * Ai[k]);
+                aik = Aij[i * NC + k];
 
                 Cnk = P / (zj - bj) / (zj - bj) *
                       ((zj - bj) / nu[j] * (delta(i, k) - xj[i]) -
@@ -2462,7 +2414,7 @@ void MixtureComp::CalFugXAll()
         for (USI i = 0; i < NC; i++) {
             tmp = 0;
             for (USI k = 0; k < NC; k++) {
-                tmp += xj[k] * (1 - BIC[i * NC + k]) * sqrt(Ai[i] * Ai[k]);
+                tmp += xj[k] * Aij[i * NC + k];
             }
             Ax[i] = 2 * tmp;
             Zx[i] =
@@ -2488,7 +2440,7 @@ void MixtureComp::CalFugXAll()
             E = -aj / ((delta1 - delta2) * bj) * (Ax[i] / aj - Bx[i] / bj);
 
             for (USI k = 0; k < NC; k++) {
-                aik = (1 - BIC[i * NC + k]) * sqrt(Ai[i] * Ai[k]);
+                aik = Aij[i * NC + k];
 
                 // kth components
                 Cxk = ((zj - bj) * delta(i, k) - xj[i] * (Zx[k] - Bx[k])) * P /
@@ -2554,7 +2506,7 @@ void MixtureComp::CalFugPAll(const OCP_BOOL& Zpflag)
 
             tmp = 0;
             for (USI m = 0; m < NC; m++) {
-                tmp += (1 - BIC[i * NC + m]) * sqrt(Ai[i] * Ai[m]) * xj[m];
+                tmp += Aij[i * NC + m] * xj[m];
             }
 
             E = -aj / ((delta1 - delta2) * bj) * (2 * tmp / aj - Bi[i] / bj);
@@ -2598,7 +2550,7 @@ void MixtureComp::CalVjpVfpVfn_partial()
         for (USI i = 0; i < NC; i++) {
             tmp = 0;
             for (USI m = 0; m < NC; m++) {
-                tmp += (1 - BIC[i * NC + m]) * sqrt(Ai[i] * Ai[m]) * xj[m];
+                tmp += Aij[i * NC + m] * xj[m];
             }
             An[i] = 2 / nu[j] * (tmp - aj);
             Bn[i] = 1 / nu[j] * (Bi[i] - bj);
@@ -2779,7 +2731,7 @@ void MixtureComp::CalVjpVfpVfx_partial()
         for (USI i = 0; i < NC; i++) {
             tmp = 0;
             for (USI k = 0; k < NC; k++) {
-                tmp += xj[k] * (1 - BIC[i * NC + k]) * sqrt(Ai[i] * Ai[k]);
+                tmp += xj[k] * Aij[i * NC + k];
             }
             Ax[i] = 2 * tmp;
             Zx[i] =
@@ -3056,7 +3008,7 @@ void MixtureComp::CalXiPNX_partial()
         for (USI i = 0; i < NC; i++) {
             tmp = 0;
             for (USI k = 0; k < NC; k++) {
-                tmp += xj[k] * (1 - BIC[i * NC + k]) * sqrt(Ai[i] * Ai[k]);
+                tmp += xj[k] * Aij[i * NC + k];
             }
             Ax[i] = 2 * tmp;
             Zx[i] =
@@ -3229,7 +3181,7 @@ void MixtureComp::CalXiPNX_full01()
         for (USI i = 0; i < NC; i++) {
             tmp = 0;
             for (USI k = 0; k < NC; k++) {
-                tmp += xj[k] * (1 - BIC[i * NC + k]) * sqrt(Ai[i] * Ai[k]);
+                tmp += xj[k] * Aij[i * NC + k];
             }
             Ax[i] = 2 * tmp;
             Zx[i] =
@@ -3324,7 +3276,7 @@ void MixtureComp::CalXiPNX_full02()
         for (USI i = 0; i < NC; i++) {
             tmp = 0;
             for (USI k = 0; k < NC; k++) {
-                tmp += xj[k] * (1 - BIC[i * NC + k]) * sqrt(Ai[i] * Ai[k]);
+                tmp += xj[k] * Aij[i * NC + k];
             }
             Ax[i] = 2 * tmp;
             Zx[i] =
@@ -3788,7 +3740,7 @@ void MixtureComp::CalVfiVfp_full01()
         for (USI i = 0; i < NC; i++) {
             tmp = 0;
             for (USI m = 0; m < NC; m++) {
-                tmp += (1 - BIC[i * NC + m]) * sqrt(Ai[i] * Ai[m]) * xj[m];
+                tmp += Aij[i * NC + m] * xj[m];
             }
             An[i] = 2 / nu[0] * (tmp - aj);
             Bn[i] = 1 / nu[0] * (Bi[i] - bj);
@@ -3927,7 +3879,7 @@ void MixtureComp::CalVfiVfp_full02()
         for (USI i = 0; i < NC; i++) {
             tmp = 0;
             for (USI m = 0; m < NC; m++) {
-                tmp += (1 - BIC[i * NC + m]) * sqrt(Ai[i] * Ai[m]) * xj[m];
+                tmp += Aij[i * NC + m] * xj[m];
             }
             An[i] = 2 / nu[0] * (tmp - aj);
             Bn[i] = 1 / nu[0] * (Bi[i] - bj);
@@ -5119,6 +5071,23 @@ void MixtureComp::OutMixtureIters() const
          << itersRR * 1.0 / countsRR << endl;
 }
 
+void MixtureComp::AddMixtureIters(const Mixture* src)
+{
+    const MixtureComp* mc = static_cast<const MixtureComp*>(src);
+
+    itersSSMSTA += mc->itersSSMSTA;
+    itersNRSTA += mc->itersNRSTA;
+    itersSSMSP += mc->itersSSMSP;
+    itersNRSP += mc->itersNRSP;
+    itersRR += mc->itersRR;
+    countsSSMSTA += mc->countsSSMSTA;
+    countsNRSTA += mc->countsNRSTA;
+    countsSSMSP += mc->countsSSMSP;
+    countsNRSP += mc->countsNRSP;
+    countsRR += mc->countsRR;
+    countsFailed += mc->countsFailed;
+}
+
 /////////////////////////////////////////////////////////////////////
 // Optional Features
 /////////////////////////////////////////////////////////////////////
@@ -5131,6 +5100,9 @@ void MixtureComp::SetupOptionalFeatures(OptionalFeatures& optFeatures,
         skipSta->Setup(numBulk, numPhase - 1, numCom - 1);
         AllocateSkip();
     }
+    if (flashCache.IfUseCache()) {
+        flashCache.Setup(NC);
+    }
     misTerm = &optFeatures.miscible;
     if (misTerm->IfUseMiscible() == ifUseMiscible == OCP_TRUE) {
         misTerm->Setup(numBulk);
@@ -5168,7 +5140,7 @@ void MixtureComp::CalPhiNSkip()
     for (USI i = 0; i < NC; i++) {
         tmp = 0;
         for (USI m = 0; m < NC; m++) {
-            tmp += (1 - BIC[i * NC + m]) * sqrt(Ai[i] * Ai[m]) * xj[m];
+            tmp += Aij[i * NC + m] * xj[m];
         }
         An[i]  = 2 / nu[0] * (tmp - aj);
         Bn[i]  = 1 / nu[0] * (Bi[i] - bj);
@@ -5189,14 +5161,14 @@ void MixtureComp::CalPhiNSkip()
         // D = Bi[i] / bj * (zj - 1);
         tmp = 0;
         for (USI k = 0; k < NC; k++) {
-            tmp += (1 - BIC[i * NC + k]) * sqrt(Ai[i] * Ai[k]) * xj[k];
+            tmp += Aij[i * NC + k] * xj[k];
         }
         E = -aj / ((delta1 - delta2) * bj) * (2 * tmp / aj - Bi[i] / bj);
 
         for (USI k = 0; k <= i; k++) {
             // k th components
 
-            aik = (1 - BIC[i * NC + k]) * sqrt(Ai[i] * Ai[k]);
+            aik = Aij[i * NC + k];
 
             Cnk = (Bn[k] - Znj[k]) / ((zj - bj) * (zj - bj));
             Dnk = Bi[i] / bj * (Znj[k] - (Bi[k] - bj) * (zj - 1) / (nu[0] * bj));
@@ -5247,12 +5219,58 @@ void MixtureComp::CalSkipForNextStep()
         }
 #endif // DEBUG
 
-        CalEigenSY(NC, &skipMatSTA[0], &eigenSkip[0], &eigenWork[0], 2 * NC + 1);
-        skipSta->AssignValue(bulkId, eigenSkip[0], P, T, zi);
+        // Stability analysis can not be skipped without the min eigenvalue
+        const int info =
+            CalEigenSY(NC, &skipMatSTA[0], &eigenSkip[0], &eigenWork[0], 2 * NC + 1);
+        if (info == 0) {
+            skipSta->AssignValue(bulkId, eigenSkip[0], P, T, zi);
+        } else {
+            flagSkip = OCP_FALSE;
+        }
     }
     skipSta->SetFlagSkip(bulkId, flagSkip);
 }
 
+/////////////////////////////////////////////////////////////////////
+// Flash Cache
+/////////////////////////////////////////////////////////////////////
+
+OCP_BOOL MixtureComp::SplitFromCache()
+{
+    // Only two-phase splits are cached
+    if (!flashCache.IfUseCache() || NPmax != 2) return OCP_FALSE;
+    if (!flashCache.Find(P, T, zi, Ks[0])) {
+        OCP_PROFILE_COUNT(PROF_FLASH_MISS, 1);
+        return OCP_FALSE;
+    }
+
+    NP        = 2;
+    Yt        = 1.01;
+    ifKsGiven = OCP_TRUE;
+    PhaseSplit();
+    ifKsGiven = OCP_FALSE;
+
+    // Two phases with lower Gibbs energy mean that single phase is unstable
+    if (NP == 2 && EoSctrl.NRsp.conflag && GibbsEnergyE < GibbsEnergyB) {
+        OCP_PROFILE_COUNT(PROF_FLASH_HIT, 1);
+        InsertToCache();
+        return OCP_TRUE;
+    }
+    OCP_PROFILE_COUNT(PROF_FLASH_MISS, 1);
+    return OCP_FALSE;
+}
+
+void MixtureComp::InsertToCache()
+{
+    if (!flashCache.IfUseCache() || NP != 2 || !EoSctrl.NRsp.conflag) return;
+
+    // Ks is not used after phase splitting
+    for (USI i = 0; i < NC; i++) {
+        Ks[0][i] = x[0][i] / x[1][i];
+    }
+    flashCache.Insert(P, T, zi, Ks[0]);
+}
+
 /////////////////////////////////////////////////////////////////////
 // Miscible
 /////////////////////////////////////////////////////////////////////
@@ -5291,4 +5309,8 @@ void MixtureComp::CalSurfaceTension()
 /*  Author              Date             Actions                              */
 /*----------------------------------------------------------------------------*/
 /*  Shizhe Li           Jan/05/2022      Create file                          */
+/*  OpenCAEPoro team    Oct/16/2026      Precompute Aij for EoS kernels       */
+/*  OpenCAEPoro team    Oct/16/2026      Add flash cache                      */
+/*  OpenCAEPoro team    Oct/17/2026      Add KVCACHE keyword                  */
+/*  OpenCAEPoro team    Oct/17/2026      Check failures of eigenvalues        */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
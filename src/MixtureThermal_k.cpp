@@ -40,11 +40,12 @@ MixtureThermal_K01::MixtureThermal_K01(const ParamReservoir& param, const USI& t
                       " th Region!");
         }
         useViscTab = OCP_TRUE;
-        visc.Setup(param.comsParam.viscTab.data[tarId]);
+        vector<vector<OCP_DBL>> viscTab = param.comsParam.viscTab.data[tarId];
         // unit convert: F -> R
-        for (auto& v : visc.GetCol(0)) {
+        for (auto& v : viscTab[0]) {
             v += CONV5;
         }
+        visc.Setup(viscTab);
     }
 
     if (param.comsParam.cp.activity)
@@ -611,4 +612,5 @@ void MixtureThermal_K01::SetupWellOpt(WellOpt&                  opt,
 /*  Author              Date             Actions                              */
 /*----------------------------------------------------------------------------*/
 /*  Shizhe Li           NOV/10/2022      Create file                          */
+/*  OpenCAEPoro team    Oct/16/2026      Use stateless table lookup           */
 /*----------------------------------------------------------------------------*/
@@ -0,0 +1,506 @@
+/*! \file    NativeAMG.cpp
+ *  \brief   NativeAMG class definition
+ *  \author  OpenCAEPoro team
+ *  \date    Oct/16/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the OpenCAEPoro team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+// Standard header files
+#include <algorithm>
+#include <cmath>
+#include <set>
+
+// OpenCAEPoro header files
+#include "NativeAMG.hpp"
+#include "UtilError.hpp"
+#include "UtilOpenMP.hpp"
+#include "UtilProfiler.hpp"
+
+/// Max size of coarsest level solved by dense LU.
+const OCP_USI AMG_MAX_DENSE = 1000;
+/// Num of rows of each chunk of Gauss-Seidel smoother.
+const OCP_USI AMG_CHUNK = 256;
+/// Num of smoothing sweeps on coarsest level if it is not solved by LU.
+const USI AMG_COARSE_SWEEP = 10;
+
+/////////////////////////////////////////////////////////////////////
+// Sparse matrices with 1*1 blocks
+/////////////////////////////////////////////////////////////////////
+
+/// Initialize a sparse matrix with 1*1 blocks and n rows.
+static void InitScalar(const OCP_USI& n, BSRMatrix& A)
+{
+    A.nrow = n;
+    A.nb   = 1;
+    A.nb2  = 1;
+    A.rowPtr.assign(n + 1, 0);
+}
+
+/// T = A^T, where A has ncol columns.
+static void Transpose(const BSRMatrix& A, const OCP_USI& ncol, BSRMatrix& T)
+{
+    InitScalar(ncol, T);
+    const OCP_USI nnz = A.GetNnz();
+    for (OCP_USI k = 0; k < nnz; k++) T.rowPtr[A.colIdx[k] + 1]++;
+    for (OCP_USI j = 0; j < ncol; j++) T.rowPtr[j + 1] += T.rowPtr[j];
+    T.colIdx.resize(nnz);
+    T.val.resize(nnz);
+
+    // entries of each row of T are in increasing order of columns
+    vector<OCP_USI> pos(T.rowPtr.begin(), T.rowPtr.end() - 1);
+    for (OCP_USI i = 0; i < A.nrow; i++) {
+        for (OCP_USI k = A.rowPtr[i]; k < A.rowPtr[i + 1]; k++) {
+            const OCP_USI p = pos[A.colIdx[k]]++;
+            T.colIdx[p]     = i;
+            T.val[p]        = A.val[k];
+        }
+    }
+}
+
+/// Build the pattern of C = A * B, where B has ncol columns.
+static void SpGEMMSymbolic(const BSRMatrix& A,
+                           const BSRMatrix& B,
+                           const OCP_USI&   ncol,
+                           BSRMatrix&       C)
+{
+    InitScalar(A.nrow, C);
+#ifdef USE_OPENMP
+#pragma omp parallel
+#endif
+    {
+        vector<OCP_USI> mark(ncol, A.nrow);
+        // count the entries of each row
+#ifdef USE_OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (OCP_USI i = 0; i < A.nrow; i++) {
+            OCP_USI num = 0;
+            for (OCP_USI k = A.rowPtr[i]; k < A.rowPtr[i + 1]; k++) {
+                const OCP_USI j = A.colIdx[k];
+                for (OCP_USI q = B.rowPtr[j]; q < B.rowPtr[j + 1]; q++) {
+                    if (mark[B.colIdx[q]] != i) {
+                        mark[B.colIdx[q]] = i;
+                        num++;
+                    }
+                }
+            }
+            C.rowPtr[i + 1] = num;
+        }
+#ifdef USE_OPENMP
+#pragma omp single
+#endif
+        {
+            for (OCP_USI i = 0; i < A.nrow; i++) C.rowPtr[i + 1] += C.rowPtr[i];
+            C.colIdx.resize(C.rowPtr[A.nrow]);
+            C.val.resize(C.rowPtr[A.nrow]);
+        }
+        // fill the columns in the same order
+        fill(mark.begin(), mark.end(), A.nrow);
+#ifdef USE_OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (OCP_USI i = 0; i < A.nrow; i++) {
+            OCP_USI p = C.rowPtr[i];
+            for (OCP_USI k = A.rowPtr[i]; k < A.rowPtr[i + 1]; k++) {
+                const OCP_USI j = A.colIdx[k];
+                for (OCP_USI q = B.rowPtr[j]; q < B.rowPtr[j + 1]; q++) {
+                    if (mark[B.colIdx[q]] != i) {
+                        mark[B.colIdx[q]] = i;
+                        C.colIdx[p++]     = B.colIdx[q];
+                    }
+                }
+            }
+        }
+    }
+}
+
+/// Compute the values of C = A * B, the pattern of C is given.
+static void SpGEMMNumeric(const BSRMatrix& A,
+                          const BSRMatrix& B,
+                          const OCP_USI&   ncol,
+                          BSRMatrix&       C)
+{
+#ifdef USE_OPENMP
+#pragma omp parallel
+#endif
+    {
+        vector<OCP_USI> pos(ncol);
+#ifdef USE_OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (OCP_USI i = 0; i < A.nrow; i++) {
+            for (OCP_USI p = C.rowPtr[i]; p < C.rowPtr[i + 1]; p++) {
+                pos[C.colIdx[p]] = p;
+                C.val[p]         = 0;
+            }
+            for (OCP_USI k = A.rowPtr[i]; k < A.rowPtr[i + 1]; k++) {
+                const OCP_USI j = A.colIdx[k];
+                for (OCP_USI q = B.rowPtr[j]; q < B.rowPtr[j + 1]; q++) {
+                    C.val[pos[B.colIdx[q]]] += A.val[k] * B.val[q];
+                }
+            }
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////
+// NativeAMG
+/////////////////////////////////////////////////////////////////////
+
+void NativeAMG::Setup(const BSRMatrix& A)
+{
+    const OCP_USI nnz     = A.GetNnz();
+    OCP_BOOL      rebuild = numLevel == 0 || numReuse >= amgParam.maxReuse;
+    if (!rebuild) {
+        const BSRMatrix& A0 = level[0].A;
+        rebuild = A0.nrow != A.nrow || A0.GetNnz() != nnz ||
+                  !equal(A0.rowPtr.begin(), A0.rowPtr.end(), A.rowPtr.begin()) ||
+                  !equal(A0.colIdx.begin(), A0.colIdx.end(), A.colIdx.begin());
+    }
+
+    if (level.empty()) level.resize(1);
+    BSRMatrix& A0 = level[0].A;
+    if (rebuild) {
+        InitScalar(A.nrow, A0);
+        copy(A.rowPtr.begin(), A.rowPtr.begin() + A.nrow + 1, A0.rowPtr.begin());
+        A0.colIdx.assign(A.colIdx.begin(), A.colIdx.begin() + nnz);
+    }
+    A0.val.assign(A.val.begin(), A.val.begin() + nnz);
+
+    if (rebuild) {
+        // build prolongations and patterns of coarse matrices
+        numReuse = 0;
+        coarseVal.clear();
+        numLevel = 1;
+        while (numLevel < amgParam.maxLevel && Coarsen(numLevel - 1)) numLevel++;
+    } else {
+        numReuse++;
+        for (USI l = 0; l + 1 < numLevel; l++) {
+            AMGLevel& lv = level[l];
+            SpGEMMNumeric(lv.A, lv.P, lv.R.nrow, lv.AP);
+            SpGEMMNumeric(lv.R, lv.AP, lv.R.nrow, level[l + 1].A);
+        }
+    }
+    for (USI l = 0; l < numLevel; l++) SetupSmoother(l);
+}
+
+OCP_BOOL NativeAMG::Coarsen(const USI& l)
+{
+    if (level.size() < l + 2) level.resize(l + 2);
+    const BSRMatrix& A = level[l].A;
+    const OCP_USI    n = A.nrow;
+    if (n <= min(amgParam.coarseDof, AMG_MAX_DENSE)) return OCP_FALSE;
+
+    // j is a strong connection of i if -a_ij >= theta * max_k(-a_ik)
+    vector<char> strong(A.GetNnz(), 0);
+    for (OCP_USI i = 0; i < n; i++) {
+        OCP_DBL amax = 0;
+        for (OCP_USI k = A.rowPtr[i]; k < A.rowPtr[i + 1]; k++) {
+            if (A.colIdx[k] != i) amax = max(amax, -A.val[k]);
+        }
+        for (OCP_USI k = A.rowPtr[i]; k < A.rowPtr[i + 1]; k++) {
+            strong[k] = A.colIdx[k] != i && amax > 0 &&
+                        -A.val[k] >= amgParam.strong * amax;
+        }
+    }
+    vector<OCP_INT> cf;
+    const OCP_USI   nc = Split(A, strong, cf);
+    // stop if the coarsening is too slow
+    if (nc == 0 || 10 * nc > 9 * n) return OCP_FALSE;
+
+    // direct interpolation, positive couplings are lumped to the diagonal
+    AMGLevel& lv = level[l];
+    InitScalar(n, lv.P);
+    lv.P.colIdx.clear();
+    lv.P.val.clear();
+    for (OCP_USI i = 0; i < n; i++) {
+        if (cf[i] >= 0) {
+            lv.P.colIdx.push_back(cf[i]);
+            lv.P.val.push_back(1);
+            lv.P.rowPtr[i + 1] = lv.P.colIdx.size();
+            continue;
+        }
+        OCP_DBL aii = 0, sumN = 0, sumC = 0;
+        for (OCP_USI k = A.rowPtr[i]; k < A.rowPtr[i + 1]; k++) {
+            const OCP_USI j = A.colIdx[k];
+            if (j == i || A.val[k] > 0) aii += A.val[k];
+            else sumN += A.val[k];
+            if (strong[k] && cf[j] >= 0) sumC += A.val[k];
+        }
+        if (sumC < 0 && aii != 0) {
+            const OCP_DBL alpha = -sumN / sumC / aii;
+            for (OCP_USI k = A.rowPtr[i]; k < A.rowPtr[i + 1]; k++) {
+                const OCP_USI j = A.colIdx[k];
+                if (strong[k] && cf[j] >= 0) {
+                    lv.P.colIdx.push_back(cf[j]);
+                    lv.P.val.push_back(alpha * A.val[k]);
+                }
+            }
+        }
+        lv.P.rowPtr[i + 1] = lv.P.colIdx.size();
+    }
+
+    Transpose(lv.P, nc, lv.R);
+    AMGLevel& lc = level[l + 1];
+    SpGEMMSymbolic(lv.A, lv.P, nc, lv.AP);
+    SpGEMMNumeric(lv.A, lv.P, nc, lv.AP);
+    SpGEMMSymbolic(lv.R, lv.AP, nc, lc.A);
+    SpGEMMNumeric(lv.R, lv.AP, nc, lc.A);
+    return OCP_TRUE;
+}
+
+OCP_USI NativeAMG::Split(const BSRMatrix&    A,
+                         const vector<char>& strong,
+                         vector<OCP_INT>&    cf) const
+{
+    const OCP_USI n = A.nrow;
+
+    // transpose of strong connections: rows which depend on each row strongly
+    vector<OCP_USI> stPtr(n + 1, 0);
+    for (OCP_USI k = 0; k < A.GetNnz(); k++) {
+        if (strong[k]) stPtr[A.colIdx[k] + 1]++;
+    }
+    for (OCP_USI i = 0; i < n; i++) stPtr[i + 1] += stPtr[i];
+    vector<OCP_USI> stIdx(stPtr[n]);
+    vector<OCP_USI> pos(stPtr.begin(), stPtr.end() - 1);
+    for (OCP_USI i = 0; i < n; i++) {
+        for (OCP_USI k = A.rowPtr[i]; k < A.rowPtr[i + 1]; k++) {
+            if (strong[k]) stIdx[pos[A.colIdx[k]]++] = i;
+        }
+    }
+
+    // first pass of Ruge-Stuben: the undecided row which most rows depend on becomes
+    // C, and rows depending on it become F. Ties are broken by the smaller index.
+    const OCP_INT UNDECIDED = -1, FPT = -2, CPT = 0;
+    cf.assign(n, UNDECIDED);
+    vector<OCP_USI>             lambda(n);
+    set<pair<OCP_USI, OCP_USI>> queue;
+    for (OCP_USI i = 0; i < n; i++) {
+        lambda[i] = stPtr[i + 1] - stPtr[i];
+        if (lambda[i] == 0) {
+            // no row depends on it, it is interpolated or smoothed only
+            cf[i] = FPT;
+        } else {
+            queue.insert(make_pair(lambda[i], n - 1 - i));
+        }
+    }
+    auto update = [&](const OCP_USI& i, const OCP_USI& value) {
+        queue.erase(make_pair(lambda[i], n - 1 - i));
+        lambda[i] = value;
+        queue.insert(make_pair(lambda[i], n - 1 - i));
+    };
+    while (!queue.empty()) {
+        const OCP_USI i = n - 1 - queue.rbegin()->second;
+        queue.erase(prev(queue.end()));
+        cf[i] = CPT;
+        for (OCP_USI p = stPtr[i]; p < stPtr[i + 1]; p++) {
+            const OCP_USI j = stIdx[p];
+            if (cf[j] != UNDECIDED) continue;
+            cf[j] = FPT;
+            queue.erase(make_pair(lambda[j], n - 1 - j));
+            for (OCP_USI k = A.rowPtr[j]; k < A.rowPtr[j + 1]; k++) {
+                const OCP_USI m = A.colIdx[k];
+                if (strong[k] && cf[m] == UNDECIDED) update(m, lambda[m] + 1);
+            }
+        }
+        for (OCP_USI k = A.rowPtr[i]; k < A.rowPtr[i + 1]; k++) {
+            const OCP_USI m = A.colIdx[k];
+            if (strong[k] && cf[m] == UNDECIDED && lambda[m] > 0) {
+                update(m, lambda[m] - 1);
+            }
+        }
+    }
+
+    // second pass: strongly connected F rows should share a strong C row, or one
+    // of them becomes C
+    vector<OCP_USI> mark(n, n);
+    for (OCP_USI i = 0; i < n; i++) {
+        if (cf[i] != FPT) continue;
+        for (OCP_USI k = A.rowPtr[i]; k < A.rowPtr[i + 1]; k++) {
+            if (strong[k] && cf[A.colIdx[k]] == CPT) mark[A.colIdx[k]] = i;
+        }
+        for (OCP_USI k = A.rowPtr[i]; k < A.rowPtr[i + 1]; k++) {
+            const OCP_USI j = A.colIdx[k];
+            if (!strong[k] || cf[j] != FPT) continue;
+            OCP_BOOL share = OCP_FALSE;
+            for (OCP_USI q = A.rowPtr[j]; q < A.rowPtr[j + 1]; q++) {
+                if (strong[q] && mark[A.colIdx[q]] == i) {
+                    share = OCP_TRUE;
+                    break;
+                }
+            }
+            if (!share) {
+                cf[j]   = CPT;
+                mark[j] = i;
+            }
+        }
+    }
+
+    // numbering of C rows
+    OCP_USI nc = 0;
+    for (OCP_USI i = 0; i < n; i++) cf[i] = cf[i] == CPT ? nc++ : -1;
+    return nc;
+}
+
+void NativeAMG::SetupSmoother(const USI& l)
+{
+    AMGLevel&        lv = level[l];
+    const BSRMatrix& A  = lv.A;
+    const OCP_USI    n  = A.nrow;
+
+    lv.dinv.assign(n, 0);
+    for (OCP_USI i = 0; i < n; i++) {
+        for (OCP_USI k = A.rowPtr[i]; k < A.rowPtr[i + 1]; k++) {
+            if (A.colIdx[k] == i) lv.dinv[i] += A.val[k];
+        }
+        if (lv.dinv[i] != 0) lv.dinv[i] = 1 / lv.dinv[i];
+    }
+    lv.x.resize(n);
+    lv.b.resize(n);
+    lv.r.resize(n);
+    lv.xold.resize(n);
+    if (l + 1 < numLevel) return;
+
+    // the coarsest level is factorized by LU with partial pivoting
+    coarseLU = n <= AMG_MAX_DENSE;
+    if (!coarseLU) return;
+    // LU factors are kept if the coarsest level is unchanged
+    if (A.val == coarseVal) return;
+    coarseVal = A.val;
+    coarseMat.assign(n * n, 0);
+    coarsePiv.resize(n);
+    for (OCP_USI i = 0; i < n; i++) {
+        for (OCP_USI k = A.rowPtr[i]; k < A.rowPtr[i + 1]; k++) {
+            coarseMat[i * n + A.colIdx[k]] += A.val[k];
+        }
+    }
+    for (OCP_USI k = 0; k < n; k++) {
+        OCP_USI p = k;
+        for (OCP_USI i = k + 1; i < n; i++) {
+            if (fabs(coarseMat[i * n + k]) > fabs(coarseMat[p * n + k])) p = i;
+        }
+        coarsePiv[k] = p;
+        if (coarseMat[p * n + k] == 0) {
+            // singular coarsest level is smoothed instead
+            coarseLU = OCP_FALSE;
+            coarseVal.clear();
+            return;
+        }
+        if (p != k) {
+            swap_ranges(&coarseMat[k * n], &coarseMat[k * n] + n, &coarseMat[p * n]);
+        }
+        const OCP_DBL d = 1 / coarseMat[k * n + k];
+        for (OCP_USI i = k + 1; i < n; i++) {
+            const OCP_DBL f = coarseMat[i * n + k] * d;
+            coarseMat[i * n + k] = f;
+            if (f == 0) continue;
+            for (OCP_USI j = k + 1; j < n; j++) {
+                coarseMat[i * n + j] -= f * coarseMat[k * n + j];
+            }
+        }
+    }
+}
+
+void NativeAMG::Apply(const OCP_DBL* b, OCP_DBL* x) const
+{
+    const AMGLevel& lv = level[0];
+    copy(b, b + lv.A.nrow, lv.b.begin());
+    VCycle(0);
+    copy(lv.x.begin(), lv.x.end(), x);
+}
+
+void NativeAMG::VCycle(const USI& l) const
+{
+    if (l + 1 == numLevel) {
+        CoarseSolve();
+        return;
+    }
+
+    const AMGLevel& lv = level[l];
+    const AMGLevel& lc = level[l + 1];
+    fill(lv.x.begin(), lv.x.end(), 0.0);
+    for (USI m = 0; m < amgParam.preSmooth; m++) Smooth(l, OCP_TRUE);
+
+    lv.A.Residual(lv.b.data(), lv.x.data(), lv.r.data());
+    lv.R.SpMV(lv.r.data(), lc.b.data());
+    VCycle(l + 1);
+    lv.P.SpMV(lc.x.data(), lv.r.data());
+    const OCP_USI n = lv.A.nrow;
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (OCP_USI i = 0; i < n; i++) lv.x[i] += lv.r[i];
+
+    for (USI m = 0; m < amgParam.postSmooth; m++) Smooth(l, OCP_FALSE);
+}
+
+void NativeAMG::Smooth(const USI& l, const OCP_BOOL& forward) const
+{
+    const AMGLevel&  lv     = level[l];
+    const BSRMatrix& A      = lv.A;
+    const OCP_USI    n      = A.nrow;
+    const OCP_USI    nChunk = (n + AMG_CHUNK - 1) / AMG_CHUNK;
+    const OCP_DBL*   b      = lv.b.data();
+    OCP_DBL*         x      = lv.x.data();
+    OCP_DBL*         xold   = lv.xold.data();
+
+    copy(x, x + n, xold);
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (OCP_USI c = 0; c < nChunk; c++) {
+        // Gauss-Seidel in the chunk, rows out of the chunk use last sweep
+        const OCP_USI bId = c * AMG_CHUNK;
+        const OCP_USI eId = min(n, bId + AMG_CHUNK);
+        for (OCP_USI m = 0; m < eId - bId; m++) {
+            const OCP_USI i = forward ? bId + m : eId - 1 - m;
+            OCP_DBL       s = b[i];
+            for (OCP_USI k = A.rowPtr[i]; k < A.rowPtr[i + 1]; k++) {
+                const OCP_USI j = A.colIdx[k];
+                if (j == i) continue;
+                s -= A.val[k] * (j >= bId && j < eId ? x[j] : xold[j]);
+            }
+            x[i] = s * lv.dinv[i];
+        }
+    }
+}
+
+void NativeAMG::CoarseSolve() const
+{
+    const USI       l  = numLevel - 1;
+    const AMGLevel& lv = level[l];
+    const OCP_USI   n  = lv.A.nrow;
+
+    if (!coarseLU) {
+        fill(lv.x.begin(), lv.x.end(), 0.0);
+        for (USI m = 0; m < AMG_COARSE_SWEEP; m++) Smooth(l, m % 2 == 0);
+        return;
+    }
+
+    OCP_DBL* x = lv.x.data();
+    copy(lv.b.begin(), lv.b.end(), x);
+    for (OCP_USI k = 0; k < n; k++) {
+        if (coarsePiv[k] != k) swap(x[k], x[coarsePiv[k]]);
+    }
+    for (OCP_USI k = 0; k < n; k++) {
+        for (OCP_USI i = k + 1; i < n; i++) x[i] -= coarseMat[i * n + k] * x[k];
+    }
+    for (OCP_USI k = n; k-- > 0;) {
+        for (OCP_USI j = k + 1; j < n; j++) x[k] -= coarseMat[k * n + j] * x[j];
+        x[k] /= coarseMat[k * n + k];
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  OpenCAEPoro team    Oct/16/2026      Create file                          */
+/*  OpenCAEPoro team    Oct/17/2026      Time PC setup apart from Krylov      */
+/*  OpenCAEPoro team    Oct/17/2026      Keep LU factors of same coarse level */
+/*----------------------------------------------------------------------------*/
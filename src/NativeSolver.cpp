@@ -0,0 +1,570 @@
+/*! \file    NativeSolver.cpp
+ *  \brief   NativeSolver class definition
+ *  \author  OpenCAEPoro team
+ *  \date    Oct/16/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the OpenCAEPoro team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+// Standard header files
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+// OpenCAEPoro header files
+#include "NativeSolver.hpp"
+#include "Partition.hpp"
+#include "UtilError.hpp"
+#include "UtilMPI.hpp"
+#include "UtilOpenMP.hpp"
+#include "UtilProfiler.hpp"
+#include "UtilTiming.hpp"
+
+/////////////////////////////////////////////////////////////////////
+// Vector operations
+/////////////////////////////////////////////////////////////////////
+
+/// Length of blocks of reductions.
+static const OCP_USI REDUCE_BLOCK = 4096;
+
+/// Return the dot product of x and y, summed up over all processes.
+//  Note: Partial sums of blocks of fixed length are added up in order, so the result
+//  does not depend on the number of threads, unlike an OpenMP reduction.
+static OCP_DBL Dot(const OCP_USI& n, const OCP_DBL* x, const OCP_DBL* y)
+{
+    const OCP_USI   nb = (n + REDUCE_BLOCK - 1) / REDUCE_BLOCK;
+    vector<OCP_DBL> part(nb);
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static) if (nb > 1)
+#endif
+    for (OCP_USI k = 0; k < nb; k++) {
+        const OCP_USI e = min(n, (k + 1) * REDUCE_BLOCK);
+        OCP_DBL       s = 0;
+        OCP_SIMD_SUM(s)
+        for (OCP_USI i = k * REDUCE_BLOCK; i < e; i++) s += x[i] * y[i];
+        part[k] = s;
+    }
+    OCP_DBL s = 0;
+    for (OCP_USI k = 0; k < nb; k++) s += part[k];
+    return AllReduceSum(s);
+}
+
+/// Return the Euclidean norm of x.
+static OCP_DBL Norm2(const OCP_USI& n, const OCP_DBL* x) { return sqrt(Dot(n, x, x)); }
+
+/// y = a * x + y.
+static void Axpy(const OCP_USI& n, const OCP_DBL& a, const OCP_DBL* x, OCP_DBL* y)
+{
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (OCP_USI i = 0; i < n; i++) y[i] += a * x[i];
+}
+
+/// y = a * x.
+static void Scale(const OCP_USI& n, const OCP_DBL& a, const OCP_DBL* x, OCP_DBL* y)
+{
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (OCP_USI i = 0; i < n; i++) y[i] = a * x[i];
+}
+
+/////////////////////////////////////////////////////////////////////
+// NativeParam
+/////////////////////////////////////////////////////////////////////
+
+OCP_BOOL NativeParam::Read(const string& file)
+{
+    ifstream ifs(file);
+    if (!ifs.is_open()) return OCP_FALSE;
+
+    string line;
+    while (getline(ifs, line)) {
+        line = line.substr(0, line.find('%'));
+        istringstream iss(line);
+        string        key, eq, value;
+        if (!(iss >> key >> eq >> value) || eq != "=") continue;
+
+        char*         end = nullptr;
+        const OCP_DBL v   = strtod(value.c_str(), &end);
+        if (end == value.c_str()) continue;
+        if (key == "print_level") {
+            printLevel = static_cast<USI>(v);
+        } else if (key == "solver_type") {
+            solverType = static_cast<USI>(v);
+        } else if (key == "decoup_type") {
+            decoupType = static_cast<USI>(v);
+        } else if (key == "precond_type") {
+            precondType = static_cast<USI>(v);
+        } else if (key == "itsolver_tol") {
+            tol = v;
+        } else if (key == "itsolver_maxit") {
+            maxIter = static_cast<USI>(v);
+        } else if (key == "itsolver_restart") {
+            restart = static_cast<USI>(v);
+        } else if (key == "AMG_levels") {
+            amg.maxLevel = static_cast<USI>(v);
+        } else if (key == "AMG_coarse_dof") {
+            amg.coarseDof = static_cast<OCP_USI>(v);
+        } else if (key == "AMG_strong_threshold") {
+            amg.strong = v;
+        } else if (key == "AMG_presmooth_iter") {
+            amg.preSmooth = static_cast<USI>(v);
+        } else if (key == "AMG_postsmooth_iter") {
+            amg.postSmooth = static_cast<USI>(v);
+        } else if (key == "AMG_reuse") {
+            amg.maxReuse = static_cast<USI>(v);
+        }
+    }
+    if (restart == 0) restart = 30;
+    reuse.Read(file);
+    return OCP_TRUE;
+}
+
+OCP_BOOL NativeParam::IfSelected(const string& file)
+{
+#if WITH_FASP
+    NativeParam param;
+    param.precondType = 0;
+    param.Read(file);
+    return param.precondType == PC_NATIVE_BILU || param.precondType == PC_NATIVE_CPR;
+#else
+    (void)file;
+    return OCP_TRUE;
+#endif
+}
+
+/////////////////////////////////////////////////////////////////////
+// NativeSolver
+/////////////////////////////////////////////////////////////////////
+
+void NativeSolver::SetupParam(const string& dir, const string& file)
+{
+    InitParam();
+    const string myfile = dir + file;
+    if (!param.Read(myfile)) {
+        cout << "The input file " << myfile << " is missing!" << endl;
+        cout << "Using the default parameters of native solvers" << endl;
+    }
+    if (param.precondType != PC_NATIVE_BILU && param.precondType != PC_NATIVE_CPR) {
+        OCP_WARNING("Preconditioner type " + to_string(param.precondType) +
+                    " is not available, native CPR is used!");
+        param.precondType = PC_NATIVE_CPR;
+    }
+    amg.SetupParam(param.amg);
+    pcReuse.SetupParam(param.reuse);
+}
+
+void NativeSolver::Allocate(const vector<USI>& rowCapacity,
+                            const OCP_USI&     maxDim,
+                            const USI&         blockDim)
+{
+    OCP_USI nnz = 0;
+    for (OCP_USI n = 0; n < maxDim; n++) {
+        nnz += rowCapacity[n];
+    }
+    A.Allocate(maxDim, nnz, blockDim);
+    Asc.Allocate(maxDim, nnz, blockDim);
+    fsc.resize(maxDim * blockDim);
+    Dmat.resize(maxDim * blockDim * blockDim);
+    if (param.precondType == PC_NATIVE_CPR) {
+        Ap.Allocate(maxDim, nnz, 1);
+        rp.resize(maxDim);
+        zp.resize(maxDim);
+        rc.resize(2 * maxDim * blockDim);
+    }
+}
+
+void NativeSolver::AssembleMat(const vector<vector<OCP_USI>>& colId,
+                               const vector<vector<OCP_DBL>>& val,
+                               const OCP_USI&                 dim,
+                               const USI&                     blockDim,
+                               vector<OCP_DBL>&               rhs,
+                               vector<OCP_DBL>&               u)
+{
+    b = rhs.data();
+    x = u.data();
+
+    A.nrow              = dim;
+    const USI blockSize = blockDim * blockDim;
+    A.rowPtr[0]         = 0;
+    for (OCP_USI i = 0; i < dim; i++) {
+        const OCP_USI bId = A.rowPtr[i];
+        A.rowPtr[i + 1]   = bId + colId[i].size();
+        copy(colId[i].begin(), colId[i].end(), A.colIdx.begin() + bId);
+        copy(val[i].begin(), val[i].begin() + colId[i].size() * blockSize,
+             A.val.begin() + bId * blockSize);
+    }
+}
+
+OCP_INT NativeSolver::Solve()
+{
+    const OCP_USI n = A.nrow * A.nb;
+
+    // rows of ghost bulks are incomplete, they belong to other processes
+    ZeroGhost(b);
+
+    GetWallTime timer;
+    OCP_INT     status;
+    do {
+        // a failed solve with a reused setup is repeated with a rebuilt one
+        fill(x, x + n, 0.0);
+        // all processes rebuild the setup if one of them does
+        const OCP_BOOL rebuild =
+            AllReduceMax(static_cast<int>(pcReuse.IfRebuild(A.nrow, A.GetNnz())));
+        timer.Start();
+        BSRMatrix*     mat = &A;
+        const OCP_DBL* f   = b;
+        if (param.decoupType != 0) {
+            Decouple(rebuild);
+            mat = &Asc;
+            f   = fsc.data();
+        }
+        if (rebuild) {
+            SetGhostIdentity(*mat);
+            SetupPC();
+            pcReuse.RecordSetup(timer.Stop());
+        }
+
+        timer.Start();
+        OCP_PROFILE(PROF_KRYLOV);
+        if (param.solverType == NATIVE_BICGSTAB) {
+            status = BiCGStab(*mat, f, x);
+        } else {
+            status = GMRES(*mat, f, x);
+        }
+    } while (pcReuse.RecordSolve(status, timer.Stop()));
+    ExchangeGhost(x);
+
+    if (status < 0 && param.printLevel > 0) {
+        cout << "\n### WARNING: Solver does not converge!\n" << endl;
+    }
+    return status;
+}
+
+void NativeSolver::Decouple(const OCP_BOOL& rebuild)
+{
+    OCP_PROFILE(PROF_DECOUPLE);
+
+    Asc.CopyPattern(A);
+    const USI nb  = A.nb;
+    const USI nb2 = A.nb2;
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (OCP_USI i = 0; i < A.nrow; i++) {
+        // the diagonal block is the first one of each row
+        const OCP_USI bId = A.rowPtr[i];
+        const OCP_USI eId = A.rowPtr[i + 1];
+        OCP_DBL*      D   = &Dmat[i * nb2];
+        if (rebuild) {
+            copy(&A.val[bId * nb2], &A.val[bId * nb2] + nb2, D);
+            if (A.colIdx[bId] != i || !BlockInverse(nb, D)) {
+                // keep the row if its diagonal block is not invertible
+                fill(D, D + nb2, 0.0);
+                for (USI j = 0; j < nb; j++) D[j * nb + j] = 1;
+            }
+        }
+        for (OCP_USI k = bId; k < eId; k++) {
+            BlockMult(nb, D, &A.val[k * nb2], &Asc.val[k * nb2]);
+        }
+        BlockMatVec(nb, D, b + i * nb, &fsc[i * nb]);
+    }
+}
+
+void NativeSolver::SetupPC()
+{
+    OCP_PROFILE(PROF_PC_SETUP);
+
+    pcMat = param.decoupType != 0 ? &Asc : &A;
+    if (!bilu.Setup(*pcMat)) {
+        OCP_WARNING("Singular diagonal block in block ILU(0)!");
+    }
+    if (param.precondType != PC_NATIVE_CPR) return;
+
+    // pressure block: the first entry of each block of decoupled system
+    const BSRMatrix& mat = *pcMat;
+    const OCP_USI    nnz = mat.GetNnz();
+    Ap.nrow              = mat.nrow;
+    copy(mat.rowPtr.begin(), mat.rowPtr.begin() + mat.nrow + 1, Ap.rowPtr.begin());
+    copy(mat.colIdx.begin(), mat.colIdx.begin() + nnz, Ap.colIdx.begin());
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (OCP_USI k = 0; k < nnz; k++) Ap.val[k] = mat.val[k * mat.nb2];
+    amg.Setup(Ap);
+}
+
+void NativeSolver::ApplyPC(const OCP_DBL* r, OCP_DBL* z) const
+{
+    const BSRMatrix& mat = *pcMat;
+    const USI        nb  = mat.nb;
+    const OCP_USI    n   = mat.nrow;
+
+    if (param.precondType != PC_NATIVE_CPR) {
+        bilu.Apply(r, z);
+        ZeroGhost(z);
+        return;
+    }
+
+    // first stage: z = P * Ap^{-1} * P^T * r by a V-cycle of AMG
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (OCP_USI i = 0; i < n; i++) rp[i] = r[i * nb];
+    amg.Apply(rp.data(), zp.data());
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (OCP_USI i = 0; i < n; i++) {
+        fill(z + i * nb, z + i * nb + nb, 0.0);
+        z[i * nb] = zp[i];
+    }
+
+    // second stage: z += (LU)^{-1} * (r - A * z)
+    mat.Residual(r, z, rc.data());
+    OCP_DBL* t = rc.data() + n * nb;
+    bilu.Apply(rc.data(), t);
+    Axpy(n * nb, 1.0, t, z);
+    ZeroGhost(z);
+}
+
+OCP_BOOL NativeSolver::IfDistributed() const
+{
+    return part != nullptr && part->IfDistributed();
+}
+
+/// Rows of ghost bulks are incomplete, as their connections to bulks of other
+/// processes are missing. They are replaced by identity rows, then the preconditioner
+/// is block Jacobi over processes, since the entries of ghost bulks of r are zeros.
+//  Note: Rows of ghost bulks are not used by SpMV and Residual either.
+void NativeSolver::SetGhostIdentity(BSRMatrix& mat) const
+{
+    if (!IfDistributed()) return;
+
+    const USI nb  = mat.nb;
+    const USI nb2 = mat.nb2;
+    for (OCP_USI i = part->GetOwnedNum(); i < part->GetLocalNum(); i++) {
+        const OCP_USI bId = mat.rowPtr[i];
+        const OCP_USI eId = mat.rowPtr[i + 1];
+        fill(&mat.val[bId * nb2], &mat.val[eId * nb2], 0.0);
+        // the diagonal block is the first one of each row
+        for (USI j = 0; j < nb; j++) mat.val[bId * nb2 + j * nb + j] = 1;
+    }
+}
+
+void NativeSolver::ExchangeGhost(OCP_DBL* v) const
+{
+    if (IfDistributed()) part->ExchangeGhost(v, A.nb * sizeof(OCP_DBL));
+}
+
+void NativeSolver::ZeroGhost(OCP_DBL* v) const
+{
+    if (IfDistributed()) {
+        fill(v + part->GetOwnedNum() * A.nb, v + part->GetLocalNum() * A.nb, 0.0);
+    }
+}
+
+void NativeSolver::SpMV(const BSRMatrix& mat, const OCP_DBL* x, OCP_DBL* y) const
+{
+    if (IfDistributed()) {
+        xg.assign(x, x + mat.nrow * mat.nb);
+        ExchangeGhost(xg.data());
+        x = xg.data();
+    }
+    mat.SpMV(x, y);
+    ZeroGhost(y);
+}
+
+void NativeSolver::Residual(const BSRMatrix& mat,
+                            const OCP_DBL*   f,
+                            const OCP_DBL*   x,
+                            OCP_DBL*         r) const
+{
+    if (IfDistributed()) {
+        xg.assign(x, x + mat.nrow * mat.nb);
+        ExchangeGhost(xg.data());
+        x = xg.data();
+    }
+    mat.Residual(f, x, r);
+    ZeroGhost(r);
+}
+
+OCP_INT NativeSolver::GMRES(const BSRMatrix& mat, const OCP_DBL* f, OCP_DBL* u)
+{
+    const OCP_USI n = mat.nrow * mat.nb;
+    const USI     m = param.restart;
+
+    // Krylov basis V, work vectors z and w
+    work.resize((m + 3) * n);
+    OCP_DBL* V = work.data();
+    OCP_DBL* z = V + (m + 1) * n;
+    OCP_DBL* w = z + n;
+
+    vector<OCP_DBL> H((m + 1) * m, 0);
+    vector<OCP_DBL> g(m + 1, 0), cs(m, 0), sn(m, 0), y(m, 0);
+
+    numIters           = 0;
+    const OCP_DBL normf = Norm2(n, f);
+    if (normf == 0) return 0;
+
+    Residual(mat, f, u, V);
+    OCP_DBL  beta = Norm2(n, V);
+    OCP_BOOL conv = beta <= param.tol * normf;
+    while (!conv && numIters < param.maxIter) {
+        Scale(n, 1 / beta, V, V);
+        fill(g.begin(), g.end(), 0.0);
+        g[0] = beta;
+
+        USI j = 0;
+        while (j < m && numIters < param.maxIter) {
+            // w = A * M^{-1} * v_j, orthogonalized by modified Gram-Schmidt
+            ApplyPC(V + j * n, z);
+            SpMV(mat, z, w);
+            for (USI i = 0; i <= j; i++) {
+                H[i * m + j] = Dot(n, w, V + i * n);
+                Axpy(n, -H[i * m + j], V + i * n, w);
+            }
+            const OCP_DBL h = Norm2(n, w);
+            H[(j + 1) * m + j] = h;
+            if (h > 0) Scale(n, 1 / h, w, V + (j + 1) * n);
+
+            // Givens rotations
+            for (USI i = 0; i < j; i++) {
+                const OCP_DBL t  = cs[i] * H[i * m + j] + sn[i] * H[(i + 1) * m + j];
+                H[(i + 1) * m + j] = -sn[i] * H[i * m + j] + cs[i] * H[(i + 1) * m + j];
+                H[i * m + j]       = t;
+            }
+            const OCP_DBL d = sqrt(H[j * m + j] * H[j * m + j] + h * h);
+            cs[j]           = d > 0 ? H[j * m + j] / d : 1;
+            sn[j]           = d > 0 ? h / d : 0;
+            H[j * m + j]    = d;
+            g[j + 1]        = -sn[j] * g[j];
+            g[j]            = cs[j] * g[j];
+
+            j++;
+            numIters++;
+            if (fabs(g[j]) <= param.tol * normf || h == 0) break;
+        }
+
+        // u += M^{-1} * V * y, where H * y = g
+        for (USI i = j; i-- > 0;) {
+            OCP_DBL s = g[i];
+            for (USI k = i + 1; k < j; k++) s -= H[i * m + k] * y[k];
+            y[i] = H[i * m + i] != 0 ? s / H[i * m + i] : 0;
+        }
+        fill(w, w + n, 0.0);
+        for (USI i = 0; i < j; i++) Axpy(n, y[i], V + i * n, w);
+        ApplyPC(w, z);
+        Axpy(n, 1.0, z, u);
+
+        // restart with the true residual
+        Residual(mat, f, u, V);
+        beta = Norm2(n, V);
+        conv = beta <= param.tol * normf;
+        if (j == 0) break;
+    }
+
+    if (param.printLevel > 0) {
+        cout << "Native GMRES: " << numIters << " iterations, relative residual "
+             << beta / normf << endl;
+    }
+    return conv ? static_cast<OCP_INT>(numIters) : -1;
+}
+
+OCP_INT NativeSolver::BiCGStab(const BSRMatrix& mat, const OCP_DBL* f, OCP_DBL* u)
+{
+    const OCP_USI n = mat.nrow * mat.nb;
+
+    work.resize(8 * n);
+    OCP_DBL* r    = work.data();
+    OCP_DBL* rhat = r + n;
+    OCP_DBL* p    = rhat + n;
+    OCP_DBL* v    = p + n;
+    OCP_DBL* s    = v + n;
+    OCP_DBL* t    = s + n;
+    OCP_DBL* ph   = t + n;
+    OCP_DBL* sh   = ph + n;
+
+    numIters           = 0;
+    const OCP_DBL normf = Norm2(n, f);
+    if (normf == 0) return 0;
+
+    Residual(mat, f, u, r);
+    copy(r, r + n, rhat);
+    fill(p, p + n, 0.0);
+    fill(v, v + n, 0.0);
+
+    OCP_DBL  rho = 1, alpha = 1, omega = 1;
+    OCP_DBL  res  = Norm2(n, r);
+    OCP_BOOL conv = res <= param.tol * normf;
+    while (!conv && numIters < param.maxIter) {
+        const OCP_DBL rhoNew = Dot(n, rhat, r);
+        if (rhoNew == 0 || omega == 0) break;
+        const OCP_DBL beta = (rhoNew / rho) * (alpha / omega);
+        rho                = rhoNew;
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (OCP_USI i = 0; i < n; i++) p[i] = r[i] + beta * (p[i] - omega * v[i]);
+
+        ApplyPC(p, ph);
+        SpMV(mat, ph, v);
+        const OCP_DBL rv = Dot(n, rhat, v);
+        if (rv == 0) break;
+        alpha = rho / rv;
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (OCP_USI i = 0; i < n; i++) s[i] = r[i] - alpha * v[i];
+        numIters++;
+
+        res = Norm2(n, s);
+        if (res <= param.tol * normf) {
+            Axpy(n, alpha, ph, u);
+            conv = OCP_TRUE;
+            break;
+        }
+
+        ApplyPC(s, sh);
+        SpMV(mat, sh, t);
+        const OCP_DBL tt = Dot(n, t, t);
+        omega            = tt > 0 ? Dot(n, t, s) / tt : 0;
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (OCP_USI i = 0; i < n; i++) {
+            u[i] += alpha * ph[i] + omega * sh[i];
+            r[i] = s[i] - omega * t[i];
+        }
+        res  = Norm2(n, r);
+        conv = res <= param.tol * normf;
+    }
+
+    if (param.printLevel > 0) {
+        cout << "Native BiCGStab: " << numIters << " iterations, relative residual "
+             << res / normf << endl;
+    }
+    return conv ? static_cast<OCP_INT>(numIters) : -1;
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  OpenCAEPoro team    Oct/16/2026      Create file                          */
+/*  OpenCAEPoro team    Oct/16/2026      Add CPR preconditioner               */
+/*  OpenCAEPoro team    Oct/16/2026      Reuse setups of preconditioners      */
+/*  OpenCAEPoro team    Oct/17/2026      Add 64-bit global index option       */
+/*  OpenCAEPoro team    Oct/17/2026      Retry failed solves with a new setup */
+/*  OpenCAEPoro team    Oct/17/2026      Time PC setup apart from Krylov      */
+/*  OpenCAEPoro team    Oct/17/2026      Sum dot products in fixed blocks     */
+/*  OpenCAEPoro team    Oct/17/2026      Distribute FIM among MPI processes   */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,148 @@
+/*! \file    NonlinearAccel.cpp
+ *  \brief   NonlinearAccel class definition
+ *  \author  OpenCAEPoro team
+ *  \date    Oct/16/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the OpenCAEPoro team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+// Standard header files
+#include <cmath>
+
+// OpenCAEPoro header files
+#include "DenseMat.hpp"
+#include "NonlinearAccel.hpp"
+
+// Line search
+const OCP_DBL LS_ALPHA    = 1E-4; ///< Fraction of decrease required by the update
+const OCP_DBL LS_MIN_STEP = 0.25; ///< Min fraction of the update tried
+
+// Anderson acceleration
+const USI     AA_DEPTH     = 3;    ///< Num of recent updates mixed
+const OCP_DBL AA_SLOW_RATE = 0.5;  ///< Updates are mixed after slower reductions
+const OCP_DBL AA_REG       = 1E-8; ///< Relative regularization of least squares
+const OCP_DBL AA_MAX_COEF  = 10;   ///< Larger coefficients restart the acceleration
+
+void NonlinearAccel::BeginIter(const OCPRes& res)
+{
+    resBegin = GetResNorm(res);
+    lambda   = 1;
+    fallback = OCP_FALSE;
+    if (resHist.empty()) resHist.push_back(resBegin);
+
+    // The mixed update which increases the residual is not used again
+    const USI nIter = resHist.size();
+    if (accelerated && nIter > 1 && resHist[nIter - 1] > resHist[nIter - 2]) {
+        RestartAA();
+        numAARestart++;
+    }
+}
+
+OCP_DBL NonlinearAccel::LineSearch(const OCPRes& res)
+{
+    if (fallback || GetResNorm(res) <= (1 - LS_ALPHA * lambda) * resBegin) return 0;
+
+    if (lambda / 2 < LS_MIN_STEP) {
+        // Backtracking fails, so the full update is applied
+        numLSFallback++;
+        fallback = OCP_TRUE;
+        lambda   = 1;
+        return lambda;
+    }
+    numBacktrack++;
+    lambda /= 2;
+    return lambda;
+}
+
+void NonlinearAccel::Accelerate(vector<OCP_DBL>& f, const vector<OCP_DBL>& w)
+{
+    const OCP_USI n = f.size();
+    if (fLast.size() == n && aLast.size() == n) {
+        dF.push_back(f);
+        Daxpy(n, -1.0, fLast.data(), dF.back().data());
+        dX.push_back(aLast);
+        if (dF.size() > AA_DEPTH) {
+            dF.pop_front();
+            dX.pop_front();
+        }
+    }
+    fLast       = f;
+    accelerated = OCP_FALSE;
+
+    const USI m = dF.size();
+    if (m == 0) return;
+
+    // Newton iterations converging fast are not mixed
+    const USI nIter = resHist.size();
+    if (nIter > 1 && resHist[nIter - 1] < AA_SLOW_RATE * resHist[nIter - 2]) return;
+
+    // Weighted least squares min ||f - dF * gamma|| by normal equations
+    vector<OCP_DBL> A(m * m, 0);
+    vector<OCP_DBL> gamma(m, 0);
+    vector<int>     pivot(m);
+    for (USI i = 0; i < m; i++) {
+        for (OCP_USI k = 0; k < n; k++) {
+            const OCP_DBL wdf = w[k] * w[k] * dF[i][k];
+            gamma[i] += wdf * f[k];
+            for (USI j = i; j < m; j++) A[i * m + j] += wdf * dF[j][k];
+        }
+    }
+    OCP_DBL diag = 0;
+    for (USI i = 0; i < m; i++) {
+        for (USI j = 0; j < i; j++) A[i * m + j] = A[j * m + i];
+        diag = max(diag, A[i * m + i]);
+    }
+    if (diag <= 0) return;
+    for (USI i = 0; i < m; i++) A[i * m + i] += AA_REG * diag;
+    LUSolve(1, m, A.data(), gamma.data(), pivot.data());
+
+    for (USI i = 0; i < m; i++) {
+        if (!(fabs(gamma[i]) <= AA_MAX_COEF)) {
+            RestartAA();
+            numAARestart++;
+            return;
+        }
+    }
+
+    // f - (dX + dF) * gamma
+    for (USI i = 0; i < m; i++) {
+        Daxpy(n, -gamma[i], dX[i].data(), f.data());
+        Daxpy(n, -gamma[i], dF[i].data(), f.data());
+    }
+    accelerated = OCP_TRUE;
+    numAccel++;
+}
+
+void NonlinearAccel::Reset()
+{
+    resHist.clear();
+    RestartAA();
+    fLast.clear();
+    aLast.clear();
+}
+
+OCP_DBL NonlinearAccel::GetResNorm(const OCPRes& res)
+{
+    OCP_DBL norm = 0;
+    for (const auto& r : res.resRelV) norm += r * r;
+    return sqrt(norm);
+}
+
+void NonlinearAccel::RestartAA()
+{
+    dF.clear();
+    dX.clear();
+    accelerated = OCP_FALSE;
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  OpenCAEPoro team    Oct/16/2026      Create file                          */
+/*  OpenCAEPoro team    Oct/17/2026      Rename shadowed iteration count      */
+/*----------------------------------------------------------------------------*/
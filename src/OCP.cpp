@@ -72,6 +72,10 @@ void OpenCAEPoro::InitReservoir()
     timer.Start();
 
     solver.InitReservoir(reservoir);
+    if (!control.GetRestartFile().empty()) {
+        // Resume from a restart file instead of initial states
+        solver.ReadRestart(reservoir, control);
+    }
 
     double finalTime = timer.Stop() / 1000;
     if (control.printLevel >= PRINT_MIN) {
@@ -137,6 +141,16 @@ void OpenCAEPoro::OutputResults() const
          << static_cast<double>(control.iterLS_total) / control.iterNR_total << " ("
          << control.iterLS_total << " succeeded + " << control.wastedIterLS
          << " wasted)" << endl;
+    const NonlinearAccel& nl = control.nlAccel;
+    if (nl.IfLineSearch()) {
+        cout << " - Line search backtracks ..." << setw(fixWidth)
+             << nl.GetNumBacktrack() << " (" << nl.GetNumLSFallback()
+             << " full steps kept)" << endl;
+    }
+    if (nl.IfAnderson()) {
+        cout << " - Anderson mixed steps ....." << setw(fixWidth) << nl.GetNumAccel()
+             << " (" << nl.GetNumAARestart() << " restarts)" << endl;
+    }
 
     // print time usages
     cout << "Simulation time:             " << setw(fixWidth) << control.totalSimTime
@@ -169,4 +183,7 @@ void OpenCAEPoro::OutputResults() const
 /*----------------------------------------------------------------------------*/
 /*  Shizhe Li           Oct/01/2021      Create file                          */
 /*  Chensong Zhang      Dec/05/2021      Format file                          */
+/*  OpenCAEPoro team    Oct/16/2026      Add restart                          */
+/*  OpenCAEPoro team    Oct/16/2026      Print statistics of nonlinear solver */
+/*  OpenCAEPoro team    Oct/17/2026      Fall back to newton if unsupported   */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
@@ -101,6 +101,60 @@ void FastControl::ReadParam(const USI& argc, const char* optset[])
                 printLevel = MIN(MAX(stoi(value), PRINT_NONE), PRINT_ALL);
                 break;
 
+            case Map_Str2Int("restart", 7):
+                restartFile = value;
+                break;
+
+            case Map_Str2Int("checkpt", 7):
+                checkpointFile = value;
+                break;
+
+            case Map_Str2Int("capture", 7):
+                captureFile = value;
+                break;
+
+            case Map_Str2Int("capsteps", 8):
+                pos = value.find(':');
+                if (pos == string::npos) OCP_ABORT("Wrong capsteps: use first:last");
+                captureBegin = stoi(value.substr(0, pos));
+                captureEnd   = stoi(value.substr(pos + 1));
+                break;
+
+            case Map_Str2Int("dtCtrl", 6):
+                if (value == "classic") {
+                    dtControl = DTCTRL_CLASSIC;
+                } else if (value == "adaptive") {
+                    dtControl = DTCTRL_ADAPTIVE;
+                } else {
+                    OCP_ABORT("Wrong dtCtrl: use classic or adaptive");
+                }
+                break;
+
+            case Map_Str2Int("nlSolver", 8):
+                if (value == "newton") {
+                    nlSolver = NLSOLVER_NEWTON;
+                } else if (value == "appleyard") {
+                    nlSolver = NLSOLVER_APPLEYARD;
+                } else if (value == "linesearch") {
+                    nlSolver = NLSOLVER_LINESEARCH;
+                } else if (value == "anderson") {
+                    nlSolver = NLSOLVER_ANDERSON;
+                } else {
+                    OCP_ABORT("Wrong nlSolver: use newton, appleyard, linesearch or "
+                              "anderson");
+                }
+                break;
+
+            case Map_Str2Int("profile", 7):
+                if (value == "on") {
+                    profile = OCP_TRUE;
+                } else if (value == "off") {
+                    profile = OCP_FALSE;
+                } else {
+                    OCP_ABORT("Wrong profile: use on or off");
+                }
+                break;
+
             default:
                 OCP_ABORT("Unknown Options: " + key + "   See -h");
                 break;
@@ -185,10 +239,9 @@ void OCPControl::InitTime(const USI& i)
     OCP_DBL dt = criticalTime[i + 1] - current_time;
     if (dt <= 0) OCP_ABORT("Non-positive time stepsize!");
 
-    static OCP_BOOL firstflag = OCP_TRUE;
-    if (wellChange || firstflag) {
+    if (wellChange || firstTime) {
         current_dt = min(dt, ctrlTime.timeInit);
-        firstflag  = OCP_FALSE;
+        firstTime  = OCP_FALSE;
     } else {
         current_dt = min(dt, init_dt);
     }
@@ -220,6 +273,27 @@ void OCPControl::SetupFastControl(const USI& argc, const char* optset[])
         }
     }
     printLevel = ctrlFast.printLevel;
+    dtCtrl.SetMode(ctrlFast.dtControl);
+    // Only FIM of isothermal models supports strategies other than Newton
+    if (ctrlFast.nlSolver != NLSOLVER_NEWTON &&
+        (model != ISOTHERMALMODEL || method != FIM)) {
+        OCP_WARNING("nlSolver only works with isothermal FIM, newton is used!");
+        ctrlFast.nlSolver = NLSOLVER_NEWTON;
+    }
+    nlAccel.SetMode(ctrlFast.nlSolver);
+    // Profiles are written by the first process only
+    OCPProfiler::Instance().Enable(ctrlFast.profile && GetMPIRank() == 0);
+
+    // Bulks are distributed among processes for isothermal FIM only
+    if (GetMPISize() > 1) {
+        if (model != ISOTHERMALMODEL || method != FIM) {
+            OCP_ABORT("More than one process only works with isothermal FIM!");
+        }
+        if (!ctrlFast.restartFile.empty() || !ctrlFast.checkpointFile.empty() ||
+            !ctrlFast.captureFile.empty() || ctrlFast.nlSolver != NLSOLVER_NEWTON) {
+            OCP_ABORT("Restart, capture and nlSolver need only one process!");
+        }
+    }
 }
 
 void OCPControl::UpdateIters()
@@ -229,6 +303,7 @@ void OCPControl::UpdateIters()
     iterLS_total += iterLS;
     iterNR = 0;
     iterLS = 0;
+    ResetNRHistory();
 }
 
 void OCPControl::ResetIterNRLS()
@@ -237,6 +312,7 @@ void OCPControl::ResetIterNRLS()
     iterNR = 0;
     wastedIterLS += iterLS;
     iterLS = 0;
+    ResetNRHistory();
 }
 
 OCP_BOOL OCPControl::Check(Reservoir& rs, initializer_list<string> il)
@@ -259,6 +335,8 @@ OCP_BOOL OCPControl::Check(Reservoir& rs, initializer_list<string> il)
         else
             OCP_ABORT("Check iterm not recognized!");
 
+        // 0: pass, 1: fail, 2: cut time step, 3: cut time step by CFL
+        OCP_INT action = 0;
         switch (flag) {
             // Bulk
             case BULK_SUCCESS:
@@ -267,19 +345,34 @@ OCP_BOOL OCPControl::Check(Reservoir& rs, initializer_list<string> il)
             case BULK_NEGATIVE_TEMPERATURE:
             case BULK_NEGATIVE_COMPONENTS_MOLES:
             case BULK_OUTRANGED_VOLUME_ERROR:
-                current_dt *= ctrlTime.cutFacNR;
-                return OCP_FALSE;
+                action = 2;
+                break;
             case BULK_OUTRANGED_CFL:
-                current_dt /= (rs.bulk.GetMaxCFL() + 1);
-                return OCP_FALSE;
+                action = 3;
+                break;
             // Well
             case WELL_SUCCESS:
                 break;
             case WELL_NEGATIVE_PRESSURE:
-                current_dt *= ctrlTime.cutFacNR;
-                return OCP_FALSE;
+                action = 2;
+                break;
             case WELL_SWITCH_TO_BHPMODE:
             case WELL_CROSSFLOW:
+                action = 1;
+                break;
+            default:
+                break;
+        }
+
+        // All processes take the most severe action to keep the same time step
+        switch (AllReduceMax(action)) {
+            case 1:
+                return OCP_FALSE;
+            case 2:
+                CutTimeStep(ctrlTime.cutFacNR);
+                return OCP_FALSE;
+            case 3:
+                CutTimeStep(1 / (AllReduceMax(rs.bulk.GetMaxCFL()) + 1));
                 return OCP_FALSE;
             default:
                 break;
@@ -295,6 +388,7 @@ void OCPControl::CalNextTimeStep(Reservoir& rs, initializer_list<string> il)
     current_time += current_dt;
 
     OCP_DBL factor = ctrlTime.maxIncreFac;
+    OCP_DBL ratio  = 1 / TINY; // min ratio of limits to changes
 
     const OCP_DBL dPmax = max(rs.bulk.GetdPmax(), rs.allWells.GetdBHPmax());
     const OCP_DBL dTmax = rs.bulk.GetdTmax();
@@ -304,16 +398,16 @@ void OCPControl::CalNextTimeStep(Reservoir& rs, initializer_list<string> il)
 
     for (auto& s : il) {
         if (s == "dP") {
-            if (dPmax > TINY) factor = min(factor, ctrlPreTime.dPlim / dPmax);
+            if (dPmax > TINY) ratio = min(ratio, ctrlPreTime.dPlim / dPmax);
         } else if (s == "dT") {
             // no input now -- no value
-            if (dTmax > TINY) factor = min(factor, ctrlPreTime.dTlim / dTmax);
+            if (dTmax > TINY) ratio = min(ratio, ctrlPreTime.dTlim / dTmax);
         } else if (s == "dN") {
-            if (dNmax > TINY) factor = min(factor, ctrlPreTime.dNlim / dNmax);
+            if (dNmax > TINY) ratio = min(ratio, ctrlPreTime.dNlim / dNmax);
         } else if (s == "dS") {
-            if (dSmax > TINY) factor = min(factor, ctrlPreTime.dSlim / dSmax);
+            if (dSmax > TINY) ratio = min(ratio, ctrlPreTime.dSlim / dSmax);
         } else if (s == "eV") {
-            if (eVmax > TINY) factor = min(factor, ctrlPreTime.eVlim / eVmax);
+            if (eVmax > TINY) ratio = min(ratio, ctrlPreTime.eVlim / eVmax);
         } else if (s == "iter") {
             if (iterNR < 5)
                 factor = min(factor, 2.0);
@@ -324,9 +418,17 @@ void OCPControl::CalNextTimeStep(Reservoir& rs, initializer_list<string> il)
         }
     }
 
+    if (dtCtrl.IfEnabled()) {
+        // PI control of changes
+        factor = min(factor, dtCtrl.GetFactor(ratio));
+    } else {
+        factor = min(factor, ratio);
+    }
+
     factor = max(ctrlTime.minChopFac, factor);
 
     current_dt *= factor;
+    if (dtCtrl.IfEnabled()) current_dt = min(current_dt, dtCtrl.GetMaxDt(current_time));
     if (current_dt > ctrlTime.timeMax) current_dt = ctrlTime.timeMax;
     if (current_dt < ctrlTime.timeMin) current_dt = ctrlTime.timeMin;
 
@@ -336,6 +438,105 @@ void OCPControl::CalNextTimeStep(Reservoir& rs, initializer_list<string> il)
     if (current_dt > dt) current_dt = dt;
 }
 
+void OCPControl::CutTimeStep(const OCP_DBL& fac, const OCP_BOOL& byNR)
+{
+    if (!dtCtrl.IfEnabled()) {
+        current_dt *= fac;
+        return;
+    }
+    current_dt *= dtCtrl.Cut(current_time, current_dt, fac, byNR, ctrlNR.NRtol,
+                             ctrlNR.maxNRiter);
+    if (printLevel >= PRINT_SOME) {
+        const auto& cut = dtCtrl.GetCuts().back();
+        cout << "Time step " << cut.dt << " Days at " << cut.time << " Days is cut by "
+             << cut.factor << " after " << cut.iterNR << " Newton iterations" << endl;
+    }
+}
+
+void OCPControl::RecordNRResidual(const OCPRes& res)
+{
+    // The residual part of the convergence test in FinishNR of FIM methods
+    const OCP_DBL r = min({res.maxRelRes_V / max(res.maxRelRes0_V, TINY),
+                           res.maxRelRes_V, res.maxRelRes_N});
+    dtCtrl.RecordNR(max(r, res.maxWellRelRes_mol));
+    nlAccel.EndIter(res);
+}
+
+void OCPControl::ResetNRHistory()
+{
+    const vector<OCP_DBL>& resHist = nlAccel.GetResHistory();
+    if (printLevel >= PRINT_MORE && !resHist.empty()) {
+        cout << "### DEBUG: Residuals of Newton iterations:" << scientific
+             << setprecision(2);
+        for (const auto& r : resHist) cout << " " << r;
+        cout << endl;
+        cout.unsetf(ios::floatfield);
+    }
+    dtCtrl.ResetNR();
+    nlAccel.Reset();
+}
+
+void OCPControl::WriteRestart(ofstream& out) const
+{
+    for (const auto* v : {&init_dt, &current_dt, &last_dt, &current_time}) {
+        WriteBinary(out, *v);
+    }
+    for (const auto* v : {&numTstep, &iterLS_total, &iterNR_total, &wastedIterNR,
+                          &wastedIterLS}) {
+        WriteBinary(out, *v);
+    }
+    dtCtrl.WriteRestart(out);
+}
+
+void OCPControl::ReadRestart(ifstream& in)
+{
+    for (auto* v : {&init_dt, &current_dt, &last_dt, &current_time}) {
+        ReadBinary(in, *v);
+    }
+    for (auto* v : {&numTstep, &iterLS_total, &iterNR_total, &wastedIterNR,
+                    &wastedIterLS}) {
+        ReadBinary(in, *v);
+    }
+    dtCtrl.ReadRestart(in);
+
+    // Restart files are written at critical times, which may belong to another
+    // schedule if the input file has been changed after them
+    const USI n = criticalTime.size();
+    for (startTstep = 0; startTstep < n - 1; startTstep++) {
+        if (fabs(criticalTime[startTstep] - current_time) < TINY) break;
+    }
+    if (startTstep == n - 1) {
+        OCP_ABORT("Restart time is not a critical time of the input file!");
+    }
+    firstTime = OCP_FALSE;
+}
+
+void OCPControl::CaptureLinearSystem(const LinearSystem& ls)
+{
+    const USI step = numTstep + 1;
+    if (ctrlFast.captureFile.empty() || step < ctrlFast.captureBegin) return;
+    if (ctrlFast.captureEnd > 0 && step > ctrlFast.captureEnd) return;
+
+    if (!captureOut.is_open()) {
+        captureOut.open(ctrlFast.captureFile, ios::binary);
+        if (!captureOut.is_open()) {
+            OCP_WARNING("Can not open " + ctrlFast.captureFile);
+            ctrlFast.captureFile.clear();
+            return;
+        }
+        CapturedSystem::WriteHeader(captureOut);
+    }
+
+    CapturedSystem sys;
+    sys.tstep  = step;
+    sys.iterNR = iterNR;
+    sys.method = method;
+    sys.time   = current_time;
+    sys.dt     = current_dt;
+    ls.GetCapturedSystem(sys);
+    sys.Write(captureOut);
+}
+
 /*----------------------------------------------------------------------------*/
 /*  Brief Change History of This File                                         */
 /*----------------------------------------------------------------------------*/
@@ -343,4 +544,13 @@ void OCPControl::CalNextTimeStep(Reservoir& rs, initializer_list<string> il)
 /*----------------------------------------------------------------------------*/
 /*  Shizhe Li           Oct/01/2021      Create file                          */
 /*  Chensong Zhang      Oct/15/2021      Format file                          */
+/*  OpenCAEPoro team    Oct/16/2026      Add restart                          */
+/*  OpenCAEPoro team    Oct/16/2026      Capture linear systems               */
+/*  OpenCAEPoro team    Oct/16/2026      Add adaptive time step control       */
+/*  OpenCAEPoro team    Oct/16/2026      Add nonlinear strategies             */
+/*  OpenCAEPoro team    Oct/17/2026      Fall back to newton if unsupported   */
+/*  OpenCAEPoro team    Oct/17/2026      Add run-time switch of profiler      */
+/*  OpenCAEPoro team    Oct/17/2026      Save controller state in restart     */
+/*  OpenCAEPoro team    Oct/17/2026      Print time step cuts as messages     */
+/*  OpenCAEPoro team    Oct/17/2026      Distribute FIM among MPI processes   */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
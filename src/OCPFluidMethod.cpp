@@ -83,6 +83,8 @@ void IsoT_IMPEC::SolveLinearSystem(LinearSystem& ls, Reservoir& rs, OCPControl&
 #endif // DEBUG
 
     ls.AssembleMatLinearSolver();
+    // Capture the linear system for offline benchmarks if required
+    ctrl.CaptureLinearSystem(ls);
 
 #ifdef DEBUG
     // ls.OutputLinearSystem("testA_IMPEC.out", "testb_IMPEC.out");
@@ -164,64 +166,45 @@ void IsoT_IMPEC::FinishStep(Reservoir& rs, OCPControl& ctrl)
 
 void IsoT_IMPEC::AllocateReservoir(Reservoir& rs)
 {
-    Bulk&         bk = rs.bulk;
-    const OCP_USI nb = bk.numBulk;
-    const USI     np = bk.numPhase;
-    const USI     nc = bk.numCom;
+    Bulk&          bk    = rs.bulk;
+    OCPStateArena& state = bk.stateArena;
+    const OCP_USI  nb    = bk.numBulk;
+    const USI      np    = bk.numPhase;
+    const USI      nc    = bk.numCom;
 
     // Rock
-    bk.poro.resize(nb);
-    bk.rockVp.resize(nb);
-
-    bk.lporo.resize(nb);
-    bk.lrockVp.resize(nb);
+    state.Add(bk.poro, bk.lporo, nb);
+    state.Add(bk.rockVp, bk.lrockVp, nb);
 
     // derivatives
-    bk.poroP.resize(nb);
-    bk.lporoP.resize(nb);
+    state.Add(bk.poroP, bk.lporoP, nb);
 
     // Fluid
-    bk.phaseNum.resize(nb);
-    bk.Nt.resize(nb);
-    bk.Ni.resize(nb * nc);
-    bk.vf.resize(nb);
-    bk.T.resize(nb);
-    bk.P.resize(nb);
+    state.Add(bk.phaseNum, bk.lphaseNum, nb);
+    state.Add(bk.Nt, bk.lNt, nb);
+    state.Add(bk.Ni, bk.lNi, nb * nc);
+    state.Add(bk.vf, bk.lvf, nb);
+    state.Add(bk.T, bk.lT, nb);
+    state.Add(bk.Pj, bk.lPj, nb * np);
+    state.Add(bk.phaseExist, bk.lphaseExist, nb * np);
+    state.Add(bk.S, bk.lS, nb * np);
+    state.Add(bk.vj, bk.lvj, nb * np);
+    state.Add(bk.xij, bk.lxij, nb * np * nc);
+    state.Add(bk.rho, bk.lrho, nb * np);
+    state.Add(bk.xi, bk.lxi, nb * np);
+    state.Add(bk.mu, bk.lmu, nb * np);
     bk.Pb.resize(nb);
-    bk.Pj.resize(nb * np);
-    bk.Pc.resize(nb * np);
-    bk.phaseExist.resize(nb * np);
-    bk.S.resize(nb * np);
-    bk.vj.resize(nb * np);
-    bk.xij.resize(nb * np * nc);
-    bk.rho.resize(nb * np);
-    bk.xi.resize(nb * np);
-    bk.mu.resize(nb * np);
-    bk.kr.resize(nb * np);
-
-    bk.lphaseNum.resize(nb);
-    bk.lNt.resize(nb);
-    bk.lNi.resize(nb * nc);
-    bk.lvf.resize(nb);
-    bk.lT.resize(nb);
-    bk.lP.resize(nb);
-    bk.lPj.resize(nb * np);
-    bk.lPc.resize(nb * np);
-    bk.lphaseExist.resize(nb * np);
-    bk.lS.resize(nb * np);
-    bk.vj.resize(nb * np);
-    bk.lxij.resize(nb * np * nc);
-    bk.lrho.resize(nb * np);
-    bk.lxi.resize(nb * np);
-    bk.lmu.resize(nb * np);
-    bk.lkr.resize(nb * np);
+
+    // P, Pc and kr are saved but not restored when the time step is repeated
+    state.Add(bk.P, bk.lP, nb, SAVED_STATE);
+    state.Add(bk.Pc, bk.lPc, nb * np, SAVED_STATE);
+    state.Add(bk.kr, bk.lkr, nb * np, SAVED_STATE);
 
     // derivatives
-    bk.vfP.resize(nb);
-    bk.vfi.resize(nb * nc);
+    state.Add(bk.vfP, bk.lvfP, nb);
+    state.Add(bk.vfi, bk.lvfi, nb * nc);
 
-    bk.lvfP.resize(nb);
-    bk.lvfi.resize(nb * nc);
+    state.Setup();
 
     // others
     bk.cfl.resize(nb * np);
@@ -263,12 +246,18 @@ void IsoT_IMPEC::InitFlash(Bulk& bk) const
 
 void IsoT_IMPEC::CalFlash(Bulk& bk)
 {
+    OCP_PROFILE(PROF_FLASH);
+
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static) num_threads(bk.numThreads)
+#endif
     for (OCP_USI n = 0; n < bk.numBulk; n++) {
 
-        bk.flashCal[bk.PVTNUM[n]]->FlashIMPEC(bk.P[n], bk.T[n], &bk.Ni[n * bk.numCom],
-                                              bk.phaseNum[n],
-                                              &bk.xij[n * bk.numPhase * bk.numCom], n);
+        bk.GetFlashCal(bk.PVTNUM[n])
+            ->FlashIMPEC(bk.P[n], bk.T[n], &bk.Ni[n * bk.numCom], bk.phaseNum[n],
+                         &bk.xij[n * bk.numPhase * bk.numCom], n);
         PassFlashValue(bk, n);
+        OCP_PROFILE_COUNT(PROF_FLASH_BULK, 1);
     }
 }
 
@@ -278,48 +267,64 @@ void IsoT_IMPEC::PassFlashValue(Bulk& bk, const OCP_USI& n) const
     const USI     nc     = bk.numCom;
     const OCP_USI bIdp   = n * np;
     const USI     pvtnum = bk.PVTNUM[n];
+    Mixture*      flash  = bk.GetFlashCal(pvtnum);
 
     bk.phaseNum[n] = 0;
-    bk.Nt[n]       = bk.flashCal[pvtnum]->GetNt();
-    bk.vf[n]       = bk.flashCal[pvtnum]->GetVf();
+    bk.Nt[n]       = flash->GetNt();
+    bk.vf[n]       = flash->GetVf();
 
     for (USI j = 0; j < np; j++) {
         // Important! Saturation must be passed no matter if the phase exists. This is
         // because it will be used to calculate relative permeability and capillary
         // pressure at each time step. Make sure that all saturations are updated at
         // each step!
-        bk.phaseExist[bIdp + j] = bk.flashCal[pvtnum]->GetPhaseExist(j);
-        bk.S[bIdp + j]          = bk.flashCal[pvtnum]->GetS(j);
+        bk.phaseExist[bIdp + j] = flash->GetPhaseExist(j);
+        bk.S[bIdp + j]          = flash->GetS(j);
         if (bk.phaseExist[bIdp + j]) {
             bk.phaseNum[n]++;
             for (USI i = 0; i < nc; i++) {
-                bk.xij[bIdp * nc + j * nc + i] = bk.flashCal[pvtnum]->GetXij(j, i);
+                bk.xij[bIdp * nc + j * nc + i] = flash->GetXij(j, i);
             }
-            bk.vj[bIdp + j]  = bk.flashCal[pvtnum]->GetVj(j);
-            bk.rho[bIdp + j] = bk.flashCal[pvtnum]->GetRho(j);
-            bk.xi[bIdp + j]  = bk.flashCal[pvtnum]->GetXi(j);
-            bk.mu[bIdp + j]  = bk.flashCal[pvtnum]->GetMu(j);
+            bk.vj[bIdp + j]  = flash->GetVj(j);
+            bk.rho[bIdp + j] = flash->GetRho(j);
+            bk.xi[bIdp + j]  = flash->GetXi(j);
+            bk.mu[bIdp + j]  = flash->GetMu(j);
         }
     }
 
-    bk.vfP[n] = bk.flashCal[pvtnum]->GetVfP();
+    bk.vfP[n] = flash->GetVfP();
     for (USI i = 0; i < nc; i++) {
-        bk.vfi[n * nc + i] = bk.flashCal[pvtnum]->GetVfi(i);
+        bk.vfi[n * nc + i] = flash->GetVfi(i);
     }
 }
 
 void IsoT_IMPEC::CalKrPc(Bulk& bk) const
 {
-    for (OCP_USI n = 0; n < bk.numBulk; n++) {
-        OCP_USI bId = n * bk.numPhase;
-        bk.flow[bk.SATNUM[n]]->CalKrPc(&bk.S[bId], &bk.kr[bId], &bk.Pc[bId], n);
-        for (USI j = 0; j < bk.numPhase; j++)
-            bk.Pj[n * bk.numPhase + j] = bk.P[n] + bk.Pc[n * bk.numPhase + j];
+    OCP_PROFILE(PROF_KRPC);
+
+#ifdef USE_OPENMP
+#pragma omp parallel num_threads(bk.numThreads)
+#endif
+    {
+        USI hint[NUM_KRPC_HINT] = {0}; // cursors of saturation tables
+
+#ifdef USE_OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (OCP_USI n = 0; n < bk.numBulk; n++) {
+            OCP_USI bId = n * bk.numPhase;
+            bk.flow[bk.SATNUM[n]]->CalKrPc(&bk.S[bId], &bk.kr[bId], &bk.Pc[bId], n,
+                                           hint);
+            for (USI j = 0; j < bk.numPhase; j++)
+                bk.Pj[n * bk.numPhase + j] = bk.P[n] + bk.Pc[n * bk.numPhase + j];
+        }
     }
 }
 
 void IsoT_IMPEC::CalFlux(Reservoir& rs) const
 {
+    OCP_PROFILE(PROF_CALFLUX);
+
     CalBulkFlux(rs);
     rs.allWells.CalFlux(rs.bulk);
 }
@@ -701,7 +706,7 @@ void IsoT_IMPEC::GetSolution(Reservoir& rs, const vector<OCP_DBL>& u)
     }
 
     // Well
-    USI wId = nb;
+    OCP_USI wId = nb;
     for (auto& wl : rs.allWells.wells) {
         if (wl.IsOpen()) {
             wl.SetBHP(u[wId]);
@@ -742,29 +747,8 @@ void IsoT_IMPEC::ResetToLastTimeStep02(Reservoir& rs, OCPControl& ctrl)
 
 void IsoT_IMPEC::ResetToLastTimeStep03(Reservoir& rs, OCPControl& ctrl)
 {
-    Bulk& bk = rs.bulk;
-    // Rock
-    bk.rockVp = bk.lrockVp;
-    bk.poro   = bk.lporo;
-    bk.poroP  = bk.lporoP;
-
-    // Fluid
-    bk.phaseNum   = bk.lphaseNum;
-    bk.Nt         = bk.lNt;
-    bk.Ni         = bk.lNi;
-    bk.vf         = bk.lvf;
-    bk.Pj         = bk.lPj;
-    bk.phaseExist = bk.lphaseExist;
-    bk.S          = bk.lS;
-    bk.vj         = bk.lvj;
-    bk.xij        = bk.lxij;
-    bk.rho        = bk.lrho;
-    bk.xi         = bk.lxi;
-    bk.mu         = bk.lmu;
-
-    // derivatives
-    bk.vfP = bk.lvfP;
-    bk.vfi = bk.lvfi;
+    // Bulk: rock, fluid and derivatives
+    rs.bulk.stateArena.RestoreState();
 
     // Bulk Conn
     rs.conn.upblock          = rs.conn.lupblock;
@@ -781,34 +765,8 @@ void IsoT_IMPEC::ResetToLastTimeStep03(Reservoir& rs, OCPControl& ctrl)
 
 void IsoT_IMPEC::UpdateLastTimeStep(Reservoir& rs) const
 {
-
-    Bulk& bk = rs.bulk;
-
-    // Rock
-    bk.lporo   = bk.poro;
-    bk.lporoP  = bk.poroP;
-    bk.lrockVp = bk.rockVp;
-
-    // Fluid
-    bk.lphaseNum   = bk.phaseNum;
-    bk.lNt         = bk.Nt;
-    bk.lNi         = bk.Ni;
-    bk.lvf         = bk.vf;
-    bk.lP          = bk.P;
-    bk.lPj         = bk.Pj;
-    bk.lPc         = bk.Pc;
-    bk.lphaseExist = bk.phaseExist;
-    bk.lS          = bk.S;
-    bk.lvj         = bk.vj;
-    bk.lxij        = bk.xij;
-    bk.lrho        = bk.rho;
-    bk.lxi         = bk.xi;
-    bk.lmu         = bk.mu;
-    bk.lkr         = bk.kr;
-
-    // derivatives
-    bk.lvfP = bk.vfP;
-    bk.lvfi = bk.vfi;
+    // Bulk: rock, fluid and derivatives
+    rs.bulk.stateArena.SaveState();
 
     BulkConn& conn = rs.conn;
 
@@ -831,6 +789,8 @@ void IsoT_FIM::Setup(Reservoir& rs, LinearSystem& ls, const OCPControl& ctrl)
     AllocateReservoir(rs);
     // Allocate memory for linear system
     AllocateLinearSystem(ls, rs, ctrl);
+    // Matrix pattern only changes with the set of open wells
+    ls.SetFrozenPattern(OCP_TRUE);
 }
 
 void IsoT_FIM::InitReservoir(Reservoir& rs) const
@@ -843,6 +803,8 @@ void IsoT_FIM::InitReservoir(Reservoir& rs) const
     // Initialize fluid properties
     InitFlash(rs.bulk);
     CalKrPc(rs.bulk);
+    // Receive states of ghost bulks from their owners
+    rs.bulk.stateArena.ExchangeGhost(rs.partition, rs.bulk.numBulk);
     // Initialize well pressure
     rs.allWells.InitBHP(rs.bulk);
     // Update variables at last time step
@@ -861,6 +823,8 @@ void IsoT_FIM::AssembleMat(LinearSystem&    ls,
                            const Reservoir& rs,
                            const OCP_DBL&   dt) const
 {
+    // Rebuild the frozen pattern if the set of open wells changes
+    ls.CheckPattern(rs.allWells.GetOpenWellSetId());
     // Assemble matrix
 #ifdef OCP_OLD_FIM
     AssembleMatBulks(ls, rs, dt);
@@ -874,9 +838,7 @@ void IsoT_FIM::AssembleMat(LinearSystem&    ls,
     ls.AssembleRhsCopy(rs.bulk.res.resAbs);
 }
 
-void IsoT_FIM::SolveLinearSystem(LinearSystem& ls,
-                                 Reservoir&    rs,
-                                 OCPControl&   ctrl) const
+void IsoT_FIM::SolveLinearSystem(LinearSystem& ls, Reservoir& rs, OCPControl& ctrl)
 {
 #ifdef DEBUG
     // Check if inf or nan occurs in A and b
@@ -885,6 +847,8 @@ void IsoT_FIM::SolveLinearSystem(LinearSystem& ls,
 
     // Assemble external linear solver with internal A and b
     ls.AssembleMatLinearSolver();
+    // Capture the linear system for offline benchmarks if required
+    ctrl.CaptureLinearSystem(ls);
     // Solve linear system
     GetWallTime Timer;
     Timer.Start();
@@ -905,8 +869,16 @@ void IsoT_FIM::SolveLinearSystem(LinearSystem& ls,
     ls.CheckSolution();
 #endif // DEBUG
 
+    // Mix the update with recent ones or save the iterate for the line search
+    NonlinearAccel&  nl = ctrl.nlAccel;
+    vector<OCP_DBL>& u  = ls.GetSolution();
+    nl.BeginIter(rs.bulk.res);
+    if (nl.IfAnderson()) nl.Accelerate(u, CalUpdateWeight(rs, u, ctrl));
+    if (nl.IfLineSearch()) SaveIterate(rs, u);
+
     // Get solution from linear system to Reservoir
-    GetSolution(rs, ls.GetSolution(), ctrl);
+    GetSolution(rs, u, ctrl);
+    if (nl.IfAnderson()) nl.RecordUpdate(GetAppliedUpdate(rs, u));
     // rs.PrintSolFIM(ctrl.workDir + "testPNi.out");
     ls.ClearData();
 }
@@ -915,29 +887,42 @@ OCP_BOOL IsoT_FIM::UpdateProperty(Reservoir& rs, OCPControl& ctrl)
 {
     OCP_DBL& dt = ctrl.current_dt;
 
-    if (!ctrl.Check(rs, {"BulkNi", "BulkP"})) {
-        ResetToLastTimeStep(rs, ctrl);
-        cout << "Cut time step size and repeat! current dt = " << fixed
-             << setprecision(3) << dt << " days\n";
-        return OCP_FALSE;
-    }
+    while (OCP_TRUE) {
+        if (!ctrl.Check(rs, {"BulkNi", "BulkP"})) {
+            ResetToLastTimeStep(rs, ctrl);
+            cout << "Cut time step size and repeat! current dt = " << fixed
+                 << setprecision(3) << dt << " days\n";
+            return OCP_FALSE;
+        }
 
-    // Update fluid property
-    CalFlash(rs.bulk);
-    CalKrPc(rs.bulk);
-    // Update rock property
-    CalRock(rs.bulk);
-    // Update well property
-    rs.allWells.CalTrans(rs.bulk);
-    rs.allWells.CalFlux(rs.bulk);
-    // Update residual
-    CalRes(rs, dt, OCP_FALSE);
+        // Update fluid property
+        CalFlash(rs.bulk);
+        CalKrPc(rs.bulk);
+        // Update rock property
+        CalRock(rs.bulk);
+        // Receive states of ghost bulks from their owners
+        rs.bulk.stateArena.ExchangeGhost(rs.partition, rs.bulk.numBulk);
+        // Update well property
+        rs.allWells.CalTrans(rs.bulk);
+        rs.allWells.CalFlux(rs.bulk);
+        // Update residual
+        CalRes(rs, dt, OCP_FALSE);
+
+        // Backtrack if the residual does not decrease enough
+        if (!ctrl.nlAccel.IfLineSearch()) break;
+        const OCP_DBL lambda = ctrl.nlAccel.LineSearch(rs.bulk.res);
+        if (lambda <= 0) break;
+        RetryIterate(rs, lambda, ctrl);
+    }
 
     return OCP_TRUE;
 }
 
 OCP_BOOL IsoT_FIM::FinishNR(Reservoir& rs, OCPControl& ctrl)
 {
+    // Record the residual for time step control
+    ctrl.RecordNRResidual(rs.bulk.res);
+
     OCP_USI dSn;
 
     const OCP_DBL NRdSmax = rs.GetNRdSmax(dSn);
@@ -957,8 +942,8 @@ OCP_BOOL IsoT_FIM::FinishNR(Reservoir& rs, OCPControl& ctrl)
         } else {
             return OCP_TRUE;
         }
-    } else if (ctrl.iterNR >= ctrl.ctrlNR.maxNRiter) {
-        ctrl.current_dt *= ctrl.ctrlTime.cutFacNR;
+    } else if (ctrl.iterNR >= ctrl.ctrlNR.maxNRiter || ctrl.IfNRStalled()) {
+        ctrl.CutTimeStep(ctrl.ctrlTime.cutFacNR, OCP_TRUE);
         ResetToLastTimeStep(rs, ctrl);
         cout << "### WARNING: NR not fully converged! Cut time step size and repeat!  "
                 "current dt = "
@@ -979,90 +964,57 @@ void IsoT_FIM::FinishStep(Reservoir& rs, OCPControl& ctrl)
 
 void IsoT_FIM::AllocateReservoir(Reservoir& rs)
 {
-    Bulk&         bk = rs.bulk;
-    const OCP_USI nb = bk.numBulk;
-    const USI     np = bk.numPhase;
-    const USI     nc = bk.numCom;
+    Bulk&          bk    = rs.bulk;
+    OCPStateArena& state = bk.stateArena;
+    const OCP_USI  nb    = bk.numBulk;
+    const USI      np    = bk.numPhase;
+    const USI      nc    = bk.numCom;
 
     // Rock
-    bk.poro.resize(nb);
-    bk.rockVp.resize(nb);
-
-    bk.lporo.resize(nb);
-    bk.lrockVp.resize(nb);
+    state.Add(bk.poro, bk.lporo, nb);
+    state.Add(bk.rockVp, bk.lrockVp, nb);
 
     // derivatives
-    bk.poroP.resize(nb);
-    bk.lporoP.resize(nb);
+    state.Add(bk.poroP, bk.lporoP, nb);
 
     // Fluid
-    bk.phaseNum.resize(nb);
-    bk.Nt.resize(nb);
-    bk.Ni.resize(nb * nc);
-    bk.vf.resize(nb);
-    bk.T.resize(nb);
-    bk.P.resize(nb);
+    state.Add(bk.phaseNum, bk.lphaseNum, nb);
+    state.Add(bk.Nt, bk.lNt, nb);
+    state.Add(bk.Ni, bk.lNi, nb * nc);
+    state.Add(bk.vf, bk.lvf, nb);
+    state.Add(bk.T, bk.lT, nb);
+    state.Add(bk.P, bk.lP, nb);
+    state.Add(bk.Pj, bk.lPj, nb * np);
+    state.Add(bk.Pc, bk.lPc, nb * np);
+    state.Add(bk.phaseExist, bk.lphaseExist, nb * np);
+    state.Add(bk.S, bk.lS, nb * np);
+    state.Add(bk.xij, bk.lxij, nb * np * nc);
+    state.Add(bk.rho, bk.lrho, nb * np);
+    state.Add(bk.xi, bk.lxi, nb * np);
+    state.Add(bk.mu, bk.lmu, nb * np);
+    state.Add(bk.kr, bk.lkr, nb * np);
     bk.Pb.resize(nb);
-    bk.Pj.resize(nb * np);
-    bk.Pc.resize(nb * np);
-    bk.phaseExist.resize(nb * np);
-    bk.S.resize(nb * np);
-    bk.xij.resize(nb * np * nc);
-    bk.rho.resize(nb * np);
-    bk.xi.resize(nb * np);
-    bk.mu.resize(nb * np);
-    bk.kr.resize(nb * np);
-
-    bk.lphaseNum.resize(nb);
-    bk.lNt.resize(nb);
-    bk.lNi.resize(nb * nc);
-    bk.lvf.resize(nb);
-    bk.lT.resize(nb);
-    bk.lP.resize(nb);
-    bk.lPj.resize(nb * np);
-    bk.lPc.resize(nb * np);
-    bk.lphaseExist.resize(nb * np);
-    bk.lS.resize(nb * np);
-    bk.lxij.resize(nb * np * nc);
-    bk.lrho.resize(nb * np);
-    bk.lxi.resize(nb * np);
-    bk.lmu.resize(nb * np);
-    bk.lkr.resize(nb * np);
 
     // derivatives
-    bk.vfP.resize(nb);
-    bk.vfi.resize(nb * nc);
-    bk.rhoP.resize(nb * np);
-    bk.rhox.resize(nb * nc * np);
-    bk.xiP.resize(nb * np);
-    bk.xix.resize(nb * nc * np);
-    bk.muP.resize(nb * np);
-    bk.mux.resize(nb * nc * np);
-    bk.dPcj_dS.resize(nb * np * np);
-    bk.dKr_dS.resize(nb * np * np);
-
-    bk.lvfP.resize(nb);
-    bk.lvfi.resize(nb * nc);
-    bk.lrhoP.resize(nb * np);
-    bk.lrhox.resize(nb * nc * np);
-    bk.lxiP.resize(nb * np);
-    bk.lxix.resize(nb * nc * np);
-    bk.lmuP.resize(nb * np);
-    bk.lmux.resize(nb * nc * np);
-    bk.ldPcj_dS.resize(nb * np * np);
-    bk.ldKr_dS.resize(nb * np * np);
+    state.Add(bk.vfP, bk.lvfP, nb);
+    state.Add(bk.vfi, bk.lvfi, nb * nc);
+    state.Add(bk.rhoP, bk.lrhoP, nb * np);
+    state.Add(bk.rhox, bk.lrhox, nb * nc * np);
+    state.Add(bk.xiP, bk.lxiP, nb * np);
+    state.Add(bk.xix, bk.lxix, nb * nc * np);
+    state.Add(bk.muP, bk.lmuP, nb * np);
+    state.Add(bk.mux, bk.lmux, nb * nc * np);
+    state.Add(bk.dPcj_dS, bk.ldPcj_dS, nb * np * np);
+    state.Add(bk.dKr_dS, bk.ldKr_dS, nb * np * np);
 
     // FIM-Specified
     bk.maxLendSdP = (nc + 1) * (nc + 1) * np;
-    bk.dSec_dPri.resize(nb * bk.maxLendSdP);
-    bk.bRowSizedSdP.resize(nb);
-    bk.pSderExist.resize(nb * np);
-    bk.pVnumCom.resize(nb * np);
+    state.Add(bk.dSec_dPri, bk.ldSec_dPri, nb * bk.maxLendSdP);
+    state.Add(bk.bRowSizedSdP, bk.lbRowSizedSdP, nb);
+    state.Add(bk.pSderExist, bk.lpSderExist, nb * np);
+    state.Add(bk.pVnumCom, bk.lpVnumCom, nb * np);
 
-    bk.ldSec_dPri.resize(nb * bk.maxLendSdP);
-    bk.lbRowSizedSdP.resize(nb);
-    bk.lpSderExist.resize(nb * np);
-    bk.lpVnumCom.resize(nb * np);
+    state.Setup();
 
     // Allocate Residual
     bk.res.Setup_IsoT(nb, rs.allWells.numWell, nc);
@@ -1081,6 +1033,7 @@ void IsoT_FIM::AllocateReservoir(Reservoir& rs)
     conn.upblock.resize(conn.numConn * np);
     conn.upblock_Rho.resize(conn.numConn * np);
     conn.upblock_Velocity.resize(conn.numConn * np);
+    conn.SetupMatPattern();
 }
 
 void IsoT_FIM::AllocateLinearSystem(LinearSystem&     ls,
@@ -1090,6 +1043,7 @@ void IsoT_FIM::AllocateLinearSystem(LinearSystem&     ls,
     ls.AllocateRowMem(rs.GetBulkNum() + rs.GetWellNum(), rs.GetComNum() + 1);
     ls.AllocateColMem(rs.conn.GetNeighborNum(), rs.allWells.GetWell2Bulk());
     ls.SetupLinearSolver(VECTORFASP, ctrl.GetWorkDir(), ctrl.GetLsFile());
+    ls.SetPartition(&rs.GetPartition());
 }
 
 void IsoT_FIM::InitFlash(Bulk& bk) const
@@ -1107,16 +1061,23 @@ void IsoT_FIM::InitFlash(Bulk& bk) const
 
 void IsoT_FIM::CalFlash(Bulk& bk)
 {
-    bk.maxNRdSSP       = 0;
-    bk.index_maxNRdSSP = 0;
+    OCP_PROFILE(PROF_FLASH);
+
+    bk.ResetMaxNRdSSP();
 
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static) num_threads(bk.numThreads)
+#endif
     for (OCP_USI n = 0; n < bk.numBulk; n++) {
 
-        bk.flashCal[bk.PVTNUM[n]]->FlashFIM(bk.P[n], bk.T[n], &bk.Ni[n * bk.numCom],
-                                            &bk.S[n * bk.numPhase], bk.phaseNum[n],
-                                            &bk.xij[n * bk.numPhase * bk.numCom], n);
+        bk.GetFlashCal(bk.PVTNUM[n])
+            ->FlashFIM(bk.P[n], bk.T[n], &bk.Ni[n * bk.numCom], &bk.S[n * bk.numPhase],
+                       bk.phaseNum[n], &bk.xij[n * bk.numPhase * bk.numCom], n);
         PassFlashValue(bk, n);
+        OCP_PROFILE_COUNT(PROF_FLASH_BULK, 1);
     }
+
+    bk.ReduceMaxNRdSSP();
 }
 
 void IsoT_FIM::PassFlashValue(Bulk& bk, const OCP_USI& n) const
@@ -1125,88 +1086,105 @@ void IsoT_FIM::PassFlashValue(Bulk& bk, const OCP_USI& n) const
     const USI     nc     = bk.numCom;
     const OCP_USI bIdp   = n * np;
     const USI     pvtnum = bk.PVTNUM[n];
+    const USI     tid    = GetThreadId();
+    Mixture*      flash  = bk.GetFlashCal(pvtnum);
     USI           len    = 0;
 
     bk.phaseNum[n] = 0;
-    bk.Nt[n]       = bk.flashCal[pvtnum]->GetNt();
-    bk.vf[n]       = bk.flashCal[pvtnum]->GetVf();
+    bk.Nt[n]       = flash->GetNt();
+    bk.vf[n]       = flash->GetVf();
 
     for (USI j = 0; j < np; j++) {
         // Important! Saturation must be passed no matter if the phase exists. This is
         // because it will be used to calculate relative permeability and capillary
         // pressure at each time step. Make sure that all saturations are updated at
         // each step!
-        bk.S[bIdp + j]    = bk.flashCal[pvtnum]->GetS(j);
+        bk.S[bIdp + j]    = flash->GetS(j);
         bk.dSNR[bIdp + j] = bk.S[bIdp + j] - bk.dSNR[bIdp + j];
         if (bk.phaseExist[bIdp + j]) {
-            if (fabs(bk.maxNRdSSP) < fabs(bk.dSNR[bIdp + j] - bk.dSNRP[bIdp + j])) {
-                bk.maxNRdSSP       = bk.dSNR[bIdp + j] - bk.dSNRP[bIdp + j];
-                bk.index_maxNRdSSP = n;
+            if (fabs(bk.maxNRdSSPT[tid]) <
+                fabs(bk.dSNR[bIdp + j] - bk.dSNRP[bIdp + j])) {
+                bk.maxNRdSSPT[tid]       = bk.dSNR[bIdp + j] - bk.dSNRP[bIdp + j];
+                bk.index_maxNRdSSPT[tid] = n;
             }
         }
 
-        bk.phaseExist[bIdp + j] = bk.flashCal[pvtnum]->GetPhaseExist(j);
+        bk.phaseExist[bIdp + j] = flash->GetPhaseExist(j);
         if (bk.phaseExist[bIdp + j]) {
             bk.phaseNum[n]++;
-            bk.rho[bIdp + j] = bk.flashCal[pvtnum]->GetRho(j);
-            bk.xi[bIdp + j]  = bk.flashCal[pvtnum]->GetXi(j);
-            bk.mu[bIdp + j]  = bk.flashCal[pvtnum]->GetMu(j);
+            bk.rho[bIdp + j] = flash->GetRho(j);
+            bk.xi[bIdp + j]  = flash->GetXi(j);
+            bk.mu[bIdp + j]  = flash->GetMu(j);
 
             // Derivatives
-            bk.rhoP[bIdp + j] = bk.flashCal[pvtnum]->GetRhoP(j);
-            bk.xiP[bIdp + j]  = bk.flashCal[pvtnum]->GetXiP(j);
-            bk.muP[bIdp + j]  = bk.flashCal[pvtnum]->GetMuP(j);
+            bk.rhoP[bIdp + j] = flash->GetRhoP(j);
+            bk.xiP[bIdp + j]  = flash->GetXiP(j);
+            bk.muP[bIdp + j]  = flash->GetMuP(j);
 
             for (USI i = 0; i < nc; i++) {
-                bk.xij[bIdp * nc + j * nc + i]  = bk.flashCal[pvtnum]->GetXij(j, i);
-                bk.rhox[bIdp * nc + j * nc + i] = bk.flashCal[pvtnum]->GetRhoX(j, i);
-                bk.xix[bIdp * nc + j * nc + i]  = bk.flashCal[pvtnum]->GetXiX(j, i);
-                bk.mux[bIdp * nc + j * nc + i]  = bk.flashCal[pvtnum]->GetMuX(j, i);
+                bk.xij[bIdp * nc + j * nc + i]  = flash->GetXij(j, i);
+                bk.rhox[bIdp * nc + j * nc + i] = flash->GetRhoX(j, i);
+                bk.xix[bIdp * nc + j * nc + i]  = flash->GetXiX(j, i);
+                bk.mux[bIdp * nc + j * nc + i]  = flash->GetMuX(j, i);
             }
         }
 
-        bk.pSderExist[bIdp + j] = bk.flashCal[pvtnum]->GetPSderExist(j);
-        bk.pVnumCom[bIdp + j]   = bk.flashCal[pvtnum]->GetPVnumCom(j);
+        bk.pSderExist[bIdp + j] = flash->GetPSderExist(j);
+        bk.pVnumCom[bIdp + j]   = flash->GetPVnumCom(j);
         if (bk.pSderExist[bIdp + j]) len++;
         len += bk.pVnumCom[bIdp + j];
     }
 
-    bk.vfP[n] = bk.flashCal[pvtnum]->GetVfP();
+    bk.vfP[n] = flash->GetVfP();
     for (USI i = 0; i < nc; i++) {
-        bk.vfi[n * nc + i] = bk.flashCal[pvtnum]->GetVfi(i);
+        bk.vfi[n * nc + i] = flash->GetVfi(i);
     }
 
 #ifdef OCP_OLD_FIM
     Dcopy(bk.maxLendSdP, &bk.dSec_dPri[n * bk.maxLendSdP],
-          &bk.flashCal[pvtnum]->GetDXsDXp()[0]);
+          &flash->GetDXsDXp()[0]);
 #else
     bk.bRowSizedSdP[n] = len;
     len *= (nc + 1);
-    Dcopy(len, &bk.dSec_dPri[n * bk.maxLendSdP], &bk.flashCal[pvtnum]->GetDXsDXp()[0]);
+    Dcopy(len, &bk.dSec_dPri[n * bk.maxLendSdP], &flash->GetDXsDXp()[0]);
 #endif // OCP_OLD_FIM
 }
 
 void IsoT_FIM::CalKrPc(Bulk& bk) const
 {
+    OCP_PROFILE(PROF_KRPC);
+
     const USI& np = bk.numPhase;
-    for (OCP_USI n = 0; n < bk.numBulk; n++) {
-        const OCP_USI bId = n * np;
-        bk.flow[bk.SATNUM[n]]->CalKrPcDeriv(&bk.S[bId], &bk.kr[bId], &bk.Pc[bId],
-                                            &bk.dKr_dS[bId * np], &bk.dPcj_dS[bId * np],
-                                            n);
-        for (USI j = 0; j < np; j++) bk.Pj[bId + j] = bk.P[n] + bk.Pc[bId + j];
+#ifdef USE_OPENMP
+#pragma omp parallel num_threads(bk.numThreads)
+#endif
+    {
+        USI hint[NUM_KRPC_HINT] = {0}; // cursors of saturation tables
+
+#ifdef USE_OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (OCP_USI n = 0; n < bk.numBulk; n++) {
+            const OCP_USI bId = n * np;
+            bk.flow[bk.SATNUM[n]]->CalKrPcDeriv(&bk.S[bId], &bk.kr[bId], &bk.Pc[bId],
+                                                &bk.dKr_dS[bId * np],
+                                                &bk.dPcj_dS[bId * np], n, hint);
+            for (USI j = 0; j < np; j++) bk.Pj[bId + j] = bk.P[n] + bk.Pc[bId + j];
+        }
     }
 }
 
 void IsoT_FIM::CalRes(Reservoir& rs, const OCP_DBL& dt, const OCP_BOOL& resetRes0) const
 {
-    const Bulk& bk   = rs.bulk;
-    const USI   nb   = bk.numBulk;
-    const USI   np   = bk.numPhase;
-    const USI   nc   = bk.numCom;
-    const USI   len  = nc + 1;
-    OCPRes&     Res  = bk.res;
-    BulkConn&   conn = rs.conn;
+    OCP_PROFILE(PROF_CALRES);
+
+    const Bulk&   bk   = rs.bulk;
+    const OCP_USI nb   = bk.numBulk;
+    const USI     np   = bk.numPhase;
+    const USI     nc   = bk.numCom;
+    const USI     len  = nc + 1;
+    OCPRes&       Res  = bk.res;
+    BulkConn&     conn = rs.conn;
 
     Res.SetZero();
 
@@ -1360,8 +1338,9 @@ void IsoT_FIM::CalRes(Reservoir& rs, const OCP_DBL& dt, const OCP_BOOL& resetRes
     }
 
     // Calculate RelRes
+    // Note: Residuals of ghost bulks are incomplete, they are checked by their owners
     OCP_DBL tmp;
-    for (OCP_USI n = 0; n < nb; n++) {
+    for (OCP_USI n = 0; n < bk.numOwnedBulk; n++) {
 
         for (USI i = 0; i < len; i++) {
             tmp = fabs(Res.resAbs[n * len + i] / bk.rockVp[n]);
@@ -1384,6 +1363,12 @@ void IsoT_FIM::CalRes(Reservoir& rs, const OCP_DBL& dt, const OCP_BOOL& resetRes
         Res.resRelN[n] = sqrt(Res.resRelN[n]);
     }
 
+    OCP_DBL maxRes[3] = {Res.maxRelRes_V, Res.maxRelRes_N, Res.maxWellRelRes_mol};
+    AllReduceMax(maxRes, 3);
+    Res.maxRelRes_V       = maxRes[0];
+    Res.maxRelRes_N       = maxRes[1];
+    Res.maxWellRelRes_mol = maxRes[2];
+
     Dscalar(Res.resAbs.size(), -1.0, Res.resAbs.data());
     if (resetRes0) Res.SetInitRes();
 }
@@ -1403,167 +1388,177 @@ void IsoT_FIM::AssembleMatBulks(LinearSystem&    ls,
     const USI       bsize2 = ncol * ncol2;
 
     ls.AddDim(nb);
+    conn.SetupMatRows(ls);
 
-    vector<OCP_DBL> bmat(bsize, 0);
     // Accumulation term
-    for (USI i = 1; i < ncol; i++) {
-        bmat[i * ncol + i] = 1;
-    }
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
     for (OCP_USI n = 0; n < nb; n++) {
-        bmat[0] = bk.v[n] * bk.poroP[n] - bk.vfP[n];
+        OCP_DBL* bmat = ls.GetVal(n, 0);
+        bmat[0]       = bk.v[n] * bk.poroP[n] - bk.vfP[n];
         for (USI i = 0; i < nc; i++) {
             bmat[i + 1] = -bk.vfi[n * nc + i];
         }
-        ls.NewDiag(n, bmat);
+        for (USI i = 1; i < ncol; i++) {
+            bmat[i * ncol + i] = 1;
+        }
     }
 
     // flux term
-    OCP_DBL         Akd;
-    OCP_DBL         transJ, transIJ;
-    vector<OCP_DBL> dFdXpB(bsize, 0);  // begin bulk: dF / dXp
-    vector<OCP_DBL> dFdXpE(bsize, 0);  // end   bulk: dF / dXp
-    vector<OCP_DBL> dFdXsB(bsize2, 0); // begin bulk: dF / dXs
-    vector<OCP_DBL> dFdXsE(bsize2, 0); // end   bulk: dF / dXs
-    OCP_DBL*        dFdXpU;            // up    bulk: dF / dXp
-    OCP_DBL*        dFdXpD;            // down  bulk: dF / dXp
-    OCP_DBL*        dFdXsU;            // up    bulk: dF / dXs
-    OCP_DBL*        dFdXsD;            // down  bulk: dF / dXs
-
-    OCP_USI  bId, eId, uId;
-    OCP_USI  bId_np_j, eId_np_j, uId_np_j, dId_np_j;
-    OCP_BOOL phaseExistBj, phaseExistEj, phaseExistDj;
-    OCP_DBL  kr, mu, xi, xij, xiP, muP, rhox, xix, mux;
-    OCP_DBL  dP, dGamma;
-    OCP_DBL  rhoWghtU, rhoWghtD;
-    OCP_DBL  tmp;
-
-    for (OCP_USI c = 0; c < conn.numConn; c++) {
+#ifdef USE_OPENMP
+#pragma omp parallel
+#endif
+    {
+        vector<OCP_DBL> bmat(bsize, 0);
+        OCP_DBL         Akd;
+        OCP_DBL         transJ, transIJ;
+        vector<OCP_DBL> dFdXpB(bsize, 0);  // begin bulk: dF / dXp
+        vector<OCP_DBL> dFdXpE(bsize, 0);  // end   bulk: dF / dXp
+        vector<OCP_DBL> dFdXsB(bsize2, 0); // begin bulk: dF / dXs
+        vector<OCP_DBL> dFdXsE(bsize2, 0); // end   bulk: dF / dXs
+        OCP_DBL*        dFdXpU;            // up    bulk: dF / dXp
+        OCP_DBL*        dFdXpD;            // down  bulk: dF / dXp
+        OCP_DBL*        dFdXsU;            // up    bulk: dF / dXs
+        OCP_DBL*        dFdXsD;            // down  bulk: dF / dXs
+
+        OCP_USI  bId, eId, uId;
+        OCP_USI  bId_np_j, eId_np_j, uId_np_j, dId_np_j;
+        OCP_BOOL phaseExistBj, phaseExistEj, phaseExistDj;
+        OCP_DBL  kr, mu, xi, xij, xiP, muP, rhox, xix, mux;
+        OCP_DBL  dP, dGamma;
+        OCP_DBL  rhoWghtU, rhoWghtD;
+        OCP_DBL  tmp;
+
+#ifdef USE_OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (OCP_USI c = 0; c < conn.numConn; c++) {
 
-        fill(dFdXpB.begin(), dFdXpB.end(), 0.0);
-        fill(dFdXpE.begin(), dFdXpE.end(), 0.0);
-        fill(dFdXsB.begin(), dFdXsB.end(), 0.0);
-        fill(dFdXsE.begin(), dFdXsE.end(), 0.0);
+            fill(dFdXpB.begin(), dFdXpB.end(), 0.0);
+            fill(dFdXpE.begin(), dFdXpE.end(), 0.0);
+            fill(dFdXsB.begin(), dFdXsB.end(), 0.0);
+            fill(dFdXsE.begin(), dFdXsE.end(), 0.0);
 
-        bId    = conn.iteratorConn[c].BId();
-        eId    = conn.iteratorConn[c].EId();
-        Akd    = CONV1 * CONV2 * conn.iteratorConn[c].Area();
-        dGamma = GRAVITY_FACTOR * (bk.depth[bId] - bk.depth[eId]);
+            bId    = conn.iteratorConn[c].BId();
+            eId    = conn.iteratorConn[c].EId();
+            Akd    = CONV1 * CONV2 * conn.iteratorConn[c].Area();
+            dGamma = GRAVITY_FACTOR * (bk.depth[bId] - bk.depth[eId]);
 
-        for (USI j = 0; j < np; j++) {
-            uId      = conn.upblock[c * np + j];
-            uId_np_j = uId * np + j;
-            if (!bk.phaseExist[uId_np_j]) continue;
-            bId_np_j     = bId * np + j;
-            eId_np_j     = eId * np + j;
-            phaseExistBj = bk.phaseExist[bId_np_j];
-            phaseExistEj = bk.phaseExist[eId_np_j];
-
-            if (bId == uId) {
-                dFdXpU       = &dFdXpB[0];
-                dFdXpD       = &dFdXpE[0];
-                dFdXsU       = &dFdXsB[0];
-                dFdXsD       = &dFdXsE[0];
-                phaseExistDj = phaseExistEj;
-                dId_np_j     = eId_np_j;
-            } else {
-                dFdXpU       = &dFdXpE[0];
-                dFdXpD       = &dFdXpB[0];
-                dFdXsU       = &dFdXsE[0];
-                dFdXsD       = &dFdXsB[0];
-                phaseExistDj = phaseExistBj;
-                dId_np_j     = bId_np_j;
-            }
-            if (phaseExistDj) {
-                rhoWghtU = 0.5;
-                rhoWghtD = 0.5;
-            } else {
-                rhoWghtU = 1;
-                rhoWghtD = 0;
-            }
+            for (USI j = 0; j < np; j++) {
+                uId      = conn.upblock[c * np + j];
+                uId_np_j = uId * np + j;
+                if (!bk.phaseExist[uId_np_j]) continue;
+                bId_np_j     = bId * np + j;
+                eId_np_j     = eId * np + j;
+                phaseExistBj = bk.phaseExist[bId_np_j];
+                phaseExistEj = bk.phaseExist[eId_np_j];
 
-            dP = bk.Pj[bId_np_j] - bk.Pj[eId_np_j] -
-                 conn.upblock_Rho[c * np + j] * dGamma;
-            xi     = bk.xi[uId_np_j];
-            kr     = bk.kr[uId_np_j];
-            mu     = bk.mu[uId_np_j];
-            muP    = bk.muP[uId_np_j];
-            xiP    = bk.xiP[uId_np_j];
-            transJ = Akd * kr / mu;
+                if (bId == uId) {
+                    dFdXpU       = &dFdXpB[0];
+                    dFdXpD       = &dFdXpE[0];
+                    dFdXsU       = &dFdXsB[0];
+                    dFdXsD       = &dFdXsE[0];
+                    phaseExistDj = phaseExistEj;
+                    dId_np_j     = eId_np_j;
+                } else {
+                    dFdXpU       = &dFdXpE[0];
+                    dFdXpD       = &dFdXpB[0];
+                    dFdXsU       = &dFdXsE[0];
+                    dFdXsD       = &dFdXsB[0];
+                    phaseExistDj = phaseExistBj;
+                    dId_np_j     = bId_np_j;
+                }
+                if (phaseExistDj) {
+                    rhoWghtU = 0.5;
+                    rhoWghtD = 0.5;
+                } else {
+                    rhoWghtU = 1;
+                    rhoWghtD = 0;
+                }
 
-            for (USI i = 0; i < nc; i++) {
-                xij     = bk.xij[uId_np_j * nc + i];
-                transIJ = xij * xi * transJ;
+                dP = bk.Pj[bId_np_j] - bk.Pj[eId_np_j] -
+                     conn.upblock_Rho[c * np + j] * dGamma;
+                xi     = bk.xi[uId_np_j];
+                kr     = bk.kr[uId_np_j];
+                mu     = bk.mu[uId_np_j];
+                muP    = bk.muP[uId_np_j];
+                xiP    = bk.xiP[uId_np_j];
+                transJ = Akd * kr / mu;
 
-                // dP
-                dFdXpB[(i + 1) * ncol] += transIJ;
-                dFdXpE[(i + 1) * ncol] -= transIJ;
+                for (USI i = 0; i < nc; i++) {
+                    xij     = bk.xij[uId_np_j * nc + i];
+                    transIJ = xij * xi * transJ;
 
-                tmp = transJ * xiP * xij * dP;
-                tmp += -transIJ * muP / mu * dP;
-                dFdXpU[(i + 1) * ncol] +=
-                    (tmp - transIJ * rhoWghtU * bk.rhoP[uId_np_j] * dGamma);
-                dFdXpD[(i + 1) * ncol] +=
-                    -transIJ * rhoWghtD * bk.rhoP[dId_np_j] * dGamma;
+                    // dP
+                    dFdXpB[(i + 1) * ncol] += transIJ;
+                    dFdXpE[(i + 1) * ncol] -= transIJ;
 
-                // dS
-                for (USI k = 0; k < np; k++) {
-                    dFdXsB[(i + 1) * ncol2 + k] +=
-                        transIJ * bk.dPcj_dS[bId_np_j * np + k];
-                    dFdXsE[(i + 1) * ncol2 + k] -=
-                        transIJ * bk.dPcj_dS[eId_np_j * np + k];
-                    dFdXsU[(i + 1) * ncol2 + k] +=
-                        Akd * bk.dKr_dS[uId_np_j * np + k] / mu * xi * xij * dP;
-                }
-                // dxij
-                for (USI k = 0; k < nc; k++) {
-                    rhox = bk.rhox[uId_np_j * nc + k];
-                    xix  = bk.xix[uId_np_j * nc + k];
-                    mux  = bk.mux[uId_np_j * nc + k];
-                    tmp  = -transIJ * rhoWghtU * rhox * dGamma;
-                    tmp += transJ * xix * xij * dP;
-                    tmp += -transIJ * mux / mu * dP;
-                    dFdXsU[(i + 1) * ncol2 + np + j * nc + k] += tmp;
-                    dFdXsD[(i + 1) * ncol2 + np + j * nc + k] +=
-                        -transIJ * rhoWghtD * bk.rhox[dId_np_j * nc + k] * dGamma;
+                    tmp = transJ * xiP * xij * dP;
+                    tmp += -transIJ * muP / mu * dP;
+                    dFdXpU[(i + 1) * ncol] +=
+                        (tmp - transIJ * rhoWghtU * bk.rhoP[uId_np_j] * dGamma);
+                    dFdXpD[(i + 1) * ncol] +=
+                        -transIJ * rhoWghtD * bk.rhoP[dId_np_j] * dGamma;
+
+                    // dS
+                    for (USI k = 0; k < np; k++) {
+                        dFdXsB[(i + 1) * ncol2 + k] +=
+                            transIJ * bk.dPcj_dS[bId_np_j * np + k];
+                        dFdXsE[(i + 1) * ncol2 + k] -=
+                            transIJ * bk.dPcj_dS[eId_np_j * np + k];
+                        dFdXsU[(i + 1) * ncol2 + k] +=
+                            Akd * bk.dKr_dS[uId_np_j * np + k] / mu * xi * xij * dP;
+                    }
+                    // dxij
+                    for (USI k = 0; k < nc; k++) {
+                        rhox = bk.rhox[uId_np_j * nc + k];
+                        xix  = bk.xix[uId_np_j * nc + k];
+                        mux  = bk.mux[uId_np_j * nc + k];
+                        tmp  = -transIJ * rhoWghtU * rhox * dGamma;
+                        tmp += transJ * xix * xij * dP;
+                        tmp += -transIJ * mux / mu * dP;
+                        dFdXsU[(i + 1) * ncol2 + np + j * nc + k] += tmp;
+                        dFdXsD[(i + 1) * ncol2 + np + j * nc + k] +=
+                            -transIJ * rhoWghtD * bk.rhox[dId_np_j * nc + k] * dGamma;
+                    }
+                    dFdXsU[(i + 1) * ncol2 + np + j * nc + i] += transJ * xi * dP;
                 }
-                dFdXsU[(i + 1) * ncol2 + np + j * nc + i] += transJ * xi * dP;
             }
-        }
 
-        // Assemble
-        bmat = dFdXpB;
-        DaABpbC(ncol, ncol, ncol2, 1, dFdXsB.data(), &bk.dSec_dPri[bId * bsize2], 1,
-                bmat.data());
-        Dscalar(bsize, dt, bmat.data());
-        // Begin - Begin -- add
-        ls.AddDiag(bId, bmat);
-        // End - Begin -- insert
-        Dscalar(bsize, -1, bmat.data());
-        ls.NewOffDiag(eId, bId, bmat);
+            // Assemble
+            bmat = dFdXpB;
+            DaABpbC(ncol, ncol, ncol2, 1, dFdXsB.data(), &bk.dSec_dPri[bId * bsize2], 1,
+                    bmat.data());
+            Dscalar(bsize, dt, bmat.data());
+            // End - Begin -- insert
+            Dscalar(bsize, -1, bmat.data());
+            Dcopy(bsize, ls.GetVal(eId, conn.connPosE[c]), bmat.data());
 
 #ifdef OCP_NANCHECK
-        if (!CheckNan(bmat.size(), &bmat[0])) {
-            OCP_ABORT("INF or INF in bmat !");
-        }
+            if (!CheckNan(bmat.size(), &bmat[0])) {
+                OCP_ABORT("INF or INF in bmat !");
+            }
 #endif
 
-        // End
-        bmat = dFdXpE;
-        DaABpbC(ncol, ncol, ncol2, 1, dFdXsE.data(), &bk.dSec_dPri[eId * bsize2], 1,
-                bmat.data());
-        Dscalar(bsize, dt, bmat.data());
-        // Begin - End -- insert
-        ls.NewOffDiag(bId, eId, bmat);
-        // End - End -- add
-        Dscalar(bsize, -1, bmat.data());
-        ls.AddDiag(eId, bmat);
+            // End
+            bmat = dFdXpE;
+            DaABpbC(ncol, ncol, ncol2, 1, dFdXsE.data(), &bk.dSec_dPri[eId * bsize2], 1,
+                    bmat.data());
+            Dscalar(bsize, dt, bmat.data());
+            // Begin - End -- insert
+            Dcopy(bsize, ls.GetVal(bId, conn.connPosB[c]), bmat.data());
 
 #ifdef OCP_NANCHECK
-        if (!CheckNan(bmat.size(), &bmat[0])) {
-            OCP_ABORT("INF or INF in bmat !");
-        }
+            if (!CheckNan(bmat.size(), &bmat[0])) {
+                OCP_ABORT("INF or INF in bmat !");
+            }
 #endif
+        }
     }
+
+    // Begin - Begin, End - End -- add
+    conn.AssembleMatDiag(ls);
 }
 
 void IsoT_FIM::AssembleMatBulksNew(LinearSystem&    ls,
@@ -1582,260 +1577,270 @@ void IsoT_FIM::AssembleMatBulksNew(LinearSystem&    ls,
     const USI       lendSdP = bk.maxLendSdP;
 
     ls.AddDim(nb);
+    conn.SetupMatRows(ls);
 
-    vector<OCP_DBL> bmat(bsize, 0);
     // Accumulation term
-    for (USI i = 1; i < ncol; i++) {
-        bmat[i * ncol + i] = 1;
-    }
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
     for (OCP_USI n = 0; n < nb; n++) {
-        bmat[0] = bk.v[n] * bk.poroP[n] - bk.vfP[n];
+        OCP_DBL* bmat = ls.GetVal(n, 0);
+        bmat[0]       = bk.v[n] * bk.poroP[n] - bk.vfP[n];
         for (USI i = 0; i < nc; i++) {
             bmat[i + 1] = -bk.vfi[n * nc + i];
         }
-        ls.NewDiag(n, bmat);
+        for (USI i = 1; i < ncol; i++) {
+            bmat[i * ncol + i] = 1;
+        }
     }
 
     // flux term
-    OCP_DBL          Akd;
-    OCP_DBL          transJ, transIJ;
-    vector<OCP_DBL>  dFdXpB(bsize, 0);
-    vector<OCP_DBL>  dFdXpE(bsize, 0);
-    vector<OCP_DBL>  dFdXsB(bsize2, 0);
-    vector<OCP_DBL>  dFdXsE(bsize2, 0);
-    vector<OCP_BOOL> phaseExistB(np, OCP_FALSE);
-    vector<OCP_BOOL> phaseExistE(np, OCP_FALSE);
-    OCP_BOOL         phaseExistU;
-    vector<OCP_BOOL> phasedS_B(np, OCP_FALSE);
-    vector<OCP_BOOL> phasedS_E(np, OCP_FALSE);
-    vector<USI>      pVnumComB(np, 0);
-    vector<USI>      pVnumComE(np, 0);
-    USI              ncolB, ncolE;
-
-    OCP_USI bId, eId, uId;
-    OCP_USI bId_np_j, eId_np_j, uId_np_j;
-    OCP_DBL kr, mu, xi, xij, rhoP, xiP, muP, rhox, xix, mux;
-    OCP_DBL dP, dGamma;
-    OCP_DBL tmp;
-
-    for (OCP_USI c = 0; c < conn.numConn; c++) {
-        bId = conn.iteratorConn[c].BId();
-        eId = conn.iteratorConn[c].EId();
-        Akd = CONV1 * CONV2 * conn.iteratorConn[c].Area();
-        fill(dFdXpB.begin(), dFdXpB.end(), 0.0);
-        fill(dFdXpE.begin(), dFdXpE.end(), 0.0);
-        fill(dFdXsB.begin(), dFdXsB.end(), 0.0);
-        fill(dFdXsE.begin(), dFdXsE.end(), 0.0);
-        dGamma = GRAVITY_FACTOR * (bk.depth[bId] - bk.depth[eId]);
+#ifdef USE_OPENMP
+#pragma omp parallel
+#endif
+    {
+        vector<OCP_DBL> bmat(bsize, 0);
+        OCP_DBL          Akd;
+        OCP_DBL          transJ, transIJ;
+        vector<OCP_DBL>  dFdXpB(bsize, 0);
+        vector<OCP_DBL>  dFdXpE(bsize, 0);
+        vector<OCP_DBL>  dFdXsB(bsize2, 0);
+        vector<OCP_DBL>  dFdXsE(bsize2, 0);
+        vector<OCP_BOOL> phaseExistB(np, OCP_FALSE);
+        vector<OCP_BOOL> phaseExistE(np, OCP_FALSE);
+        OCP_BOOL         phaseExistU;
+        vector<OCP_BOOL> phasedS_B(np, OCP_FALSE);
+        vector<OCP_BOOL> phasedS_E(np, OCP_FALSE);
+        vector<USI>      pVnumComB(np, 0);
+        vector<USI>      pVnumComE(np, 0);
+        USI              ncolB, ncolE;
+
+        OCP_USI bId, eId, uId;
+        OCP_USI bId_np_j, eId_np_j, uId_np_j;
+        OCP_DBL kr, mu, xi, xij, rhoP, xiP, muP, rhox, xix, mux;
+        OCP_DBL dP, dGamma;
+        OCP_DBL tmp;
+
+#ifdef USE_OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (OCP_USI c = 0; c < conn.numConn; c++) {
+            bId = conn.iteratorConn[c].BId();
+            eId = conn.iteratorConn[c].EId();
+            Akd = CONV1 * CONV2 * conn.iteratorConn[c].Area();
+            fill(dFdXpB.begin(), dFdXpB.end(), 0.0);
+            fill(dFdXpE.begin(), dFdXpE.end(), 0.0);
+            fill(dFdXsB.begin(), dFdXsB.end(), 0.0);
+            fill(dFdXsE.begin(), dFdXsE.end(), 0.0);
+            dGamma = GRAVITY_FACTOR * (bk.depth[bId] - bk.depth[eId]);
 
-        USI jxB = 0;
-        USI jxE = 0;
-        ncolB   = 0;
-        ncolE   = 0;
+            USI jxB = 0;
+            USI jxE = 0;
+            ncolB   = 0;
+            ncolE   = 0;
 
-        for (USI j = 0; j < np; j++) {
-            phaseExistB[j] = bk.phaseExist[bId * np + j];
-            phaseExistE[j] = bk.phaseExist[eId * np + j];
-            phasedS_B[j]   = bk.pSderExist[bId * np + j];
-            phasedS_E[j]   = bk.pSderExist[eId * np + j];
-            if (phasedS_B[j]) jxB++;
-            if (phasedS_E[j]) jxE++;
-            pVnumComB[j] = bk.pVnumCom[bId * np + j];
-            pVnumComE[j] = bk.pVnumCom[eId * np + j];
-            ncolB += pVnumComB[j];
-            ncolE += pVnumComE[j];
-        }
-        ncolB += jxB;
-        ncolE += jxE;
+            for (USI j = 0; j < np; j++) {
+                phaseExistB[j] = bk.phaseExist[bId * np + j];
+                phaseExistE[j] = bk.phaseExist[eId * np + j];
+                phasedS_B[j]   = bk.pSderExist[bId * np + j];
+                phasedS_E[j]   = bk.pSderExist[eId * np + j];
+                if (phasedS_B[j]) jxB++;
+                if (phasedS_E[j]) jxE++;
+                pVnumComB[j] = bk.pVnumCom[bId * np + j];
+                pVnumComE[j] = bk.pVnumCom[eId * np + j];
+                ncolB += pVnumComB[j];
+                ncolE += pVnumComE[j];
+            }
+            ncolB += jxB;
+            ncolE += jxE;
 
-        for (USI j = 0; j < np; j++) {
-            uId = conn.upblock[c * np + j];
+            for (USI j = 0; j < np; j++) {
+                uId = conn.upblock[c * np + j];
 
-            phaseExistU = (uId == bId ? phaseExistB[j] : phaseExistE[j]);
-            if (!phaseExistU) {
-                jxB += pVnumComB[j];
-                jxE += pVnumComE[j];
-                continue;
-            }
+                phaseExistU = (uId == bId ? phaseExistB[j] : phaseExistE[j]);
+                if (!phaseExistU) {
+                    jxB += pVnumComB[j];
+                    jxE += pVnumComE[j];
+                    continue;
+                }
 
-            bId_np_j = bId * np + j;
-            eId_np_j = eId * np + j;
-            uId_np_j = uId * np + j;
-            dP       = bk.Pj[bId_np_j] - bk.Pj[eId_np_j] -
-                 conn.upblock_Rho[c * np + j] * dGamma;
-            xi     = bk.xi[uId_np_j];
-            kr     = bk.kr[uId_np_j];
-            mu     = bk.mu[uId_np_j];
-            muP    = bk.muP[uId_np_j];
-            xiP    = bk.xiP[uId_np_j];
-            rhoP   = bk.rhoP[uId_np_j];
-            transJ = Akd * kr / mu;
+                bId_np_j = bId * np + j;
+                eId_np_j = eId * np + j;
+                uId_np_j = uId * np + j;
+                dP       = bk.Pj[bId_np_j] - bk.Pj[eId_np_j] -
+                     conn.upblock_Rho[c * np + j] * dGamma;
+                xi     = bk.xi[uId_np_j];
+                kr     = bk.kr[uId_np_j];
+                mu     = bk.mu[uId_np_j];
+                muP    = bk.muP[uId_np_j];
+                xiP    = bk.xiP[uId_np_j];
+                rhoP   = bk.rhoP[uId_np_j];
+                transJ = Akd * kr / mu;
 
-            for (USI i = 0; i < nc; i++) {
-                xij     = bk.xij[uId_np_j * nc + i];
-                transIJ = xij * xi * transJ;
+                for (USI i = 0; i < nc; i++) {
+                    xij     = bk.xij[uId_np_j * nc + i];
+                    transIJ = xij * xi * transJ;
 
-                // Pressure -- Primary var
-                dFdXpB[(i + 1) * ncol] += transIJ;
-                dFdXpE[(i + 1) * ncol] -= transIJ;
+                    // Pressure -- Primary var
+                    dFdXpB[(i + 1) * ncol] += transIJ;
+                    dFdXpE[(i + 1) * ncol] -= transIJ;
 
-                tmp = xij * transJ * xiP * dP;
-                tmp += -transIJ * muP / mu * dP;
-                if (!phaseExistE[j]) {
-                    tmp += transIJ * (-rhoP * dGamma);
-                    dFdXpB[(i + 1) * ncol] += tmp;
-                } else if (!phaseExistB[j]) {
-                    tmp += transIJ * (-rhoP * dGamma);
-                    dFdXpE[(i + 1) * ncol] += tmp;
-                } else {
-                    dFdXpB[(i + 1) * ncol] +=
-                        transIJ * (-bk.rhoP[bId_np_j] * dGamma) / 2;
-                    dFdXpE[(i + 1) * ncol] +=
-                        transIJ * (-bk.rhoP[eId_np_j] * dGamma) / 2;
-                    if (bId == uId) {
+                    tmp = xij * transJ * xiP * dP;
+                    tmp += -transIJ * muP / mu * dP;
+                    if (!phaseExistE[j]) {
+                        tmp += transIJ * (-rhoP * dGamma);
                         dFdXpB[(i + 1) * ncol] += tmp;
-                    } else {
+                    } else if (!phaseExistB[j]) {
+                        tmp += transIJ * (-rhoP * dGamma);
                         dFdXpE[(i + 1) * ncol] += tmp;
-                    }
-                }
-
-                // Second var
-                USI j1SB = 0;
-                USI j1SE = 0;
-                if (bId == uId) {
-                    // Saturation
-                    for (USI j1 = 0; j1 < np; j1++) {
-                        if (phasedS_B[j1]) {
-                            dFdXsB[(i + 1) * ncolB + j1SB] +=
-                                transIJ * bk.dPcj_dS[bId_np_j * np + j1];
-                            tmp = Akd * xij * xi / mu * bk.dKr_dS[uId_np_j * np + j1] *
-                                  dP;
-                            dFdXsB[(i + 1) * ncolB + j1SB] += tmp;
-                            j1SB++;
-                        }
-                        if (phasedS_E[j1]) {
-                            dFdXsE[(i + 1) * ncolE + j1SE] -=
-                                transIJ * bk.dPcj_dS[eId_np_j * np + j1];
-                            j1SE++;
-                        }
-                    }
-                    // Cij
-                    if (!phaseExistE[j]) {
-                        for (USI k = 0; k < pVnumComB[j]; k++) {
-                            rhox = bk.rhox[uId_np_j * nc + k];
-                            xix  = bk.xix[uId_np_j * nc + k];
-                            mux  = bk.mux[uId_np_j * nc + k];
-                            tmp  = -transIJ * rhox * dGamma;
-                            tmp += xij * transJ * xix * dP;
-                            tmp += -transIJ * mux / mu * dP;
-                            dFdXsB[(i + 1) * ncolB + jxB + k] += tmp;
-                        }
-                        // WARNING !!!
-                        if (i < pVnumComB[j])
-                            dFdXsB[(i + 1) * ncolB + jxB + i] += xi * transJ * dP;
                     } else {
-                        for (USI k = 0; k < pVnumComB[j]; k++) {
-                            rhox = bk.rhox[bId_np_j * nc + k] / 2;
-                            xix  = bk.xix[uId_np_j * nc + k];
-                            mux  = bk.mux[uId_np_j * nc + k];
-                            tmp  = -transIJ * rhox * dGamma;
-                            tmp += xij * transJ * xix * dP;
-                            tmp += -transIJ * mux / mu * dP;
-                            dFdXsB[(i + 1) * ncolB + jxB + k] += tmp;
-                            dFdXsE[(i + 1) * ncolE + jxE + k] +=
-                                -transIJ * bk.rhox[eId_np_j * nc + k] / 2 * dGamma;
+                        dFdXpB[(i + 1) * ncol] +=
+                            transIJ * (-bk.rhoP[bId_np_j] * dGamma) / 2;
+                        dFdXpE[(i + 1) * ncol] +=
+                            transIJ * (-bk.rhoP[eId_np_j] * dGamma) / 2;
+                        if (bId == uId) {
+                            dFdXpB[(i + 1) * ncol] += tmp;
+                        } else {
+                            dFdXpE[(i + 1) * ncol] += tmp;
                         }
-                        // WARNING !!!
-                        if (i < pVnumComB[j])
-                            dFdXsB[(i + 1) * ncolB + jxB + i] += xi * transJ * dP;
                     }
-                } else {
-                    // Saturation
-                    for (USI j1 = 0; j1 < np; j1++) {
-                        if (phasedS_B[j1]) {
-                            dFdXsB[(i + 1) * ncolB + j1SB] +=
-                                transIJ * bk.dPcj_dS[bId_np_j * np + j1];
-                            j1SB++;
-                        }
-                        if (phasedS_E[j1]) {
-                            dFdXsE[(i + 1) * ncolE + j1SE] -=
-                                transIJ * bk.dPcj_dS[eId_np_j * np + j1];
-                            tmp = Akd * xij * xi / mu * bk.dKr_dS[uId_np_j * np + j1] *
-                                  dP;
-                            dFdXsE[(i + 1) * ncolE + j1SE] += tmp;
-                            j1SE++;
+
+                    // Second var
+                    USI j1SB = 0;
+                    USI j1SE = 0;
+                    if (bId == uId) {
+                        // Saturation
+                        for (USI j1 = 0; j1 < np; j1++) {
+                            if (phasedS_B[j1]) {
+                                dFdXsB[(i + 1) * ncolB + j1SB] +=
+                                    transIJ * bk.dPcj_dS[bId_np_j * np + j1];
+                                tmp = Akd * xij * xi / mu *
+                                      bk.dKr_dS[uId_np_j * np + j1] * dP;
+                                dFdXsB[(i + 1) * ncolB + j1SB] += tmp;
+                                j1SB++;
+                            }
+                            if (phasedS_E[j1]) {
+                                dFdXsE[(i + 1) * ncolE + j1SE] -=
+                                    transIJ * bk.dPcj_dS[eId_np_j * np + j1];
+                                j1SE++;
+                            }
                         }
-                    }
-                    // Cij
-                    if (!phaseExistB[j]) {
-                        for (USI k = 0; k < pVnumComE[j]; k++) {
-                            rhox = bk.rhox[uId_np_j * nc + k];
-                            xix  = bk.xix[uId_np_j * nc + k];
-                            mux  = bk.mux[uId_np_j * nc + k];
-                            tmp  = -transIJ * rhox * dGamma;
-                            tmp += xij * transJ * xix * dP;
-                            tmp += -transIJ * mux / mu * dP;
-                            dFdXsE[(i + 1) * ncolE + jxE + k] += tmp;
+                        // Cij
+                        if (!phaseExistE[j]) {
+                            for (USI k = 0; k < pVnumComB[j]; k++) {
+                                rhox = bk.rhox[uId_np_j * nc + k];
+                                xix  = bk.xix[uId_np_j * nc + k];
+                                mux  = bk.mux[uId_np_j * nc + k];
+                                tmp  = -transIJ * rhox * dGamma;
+                                tmp += xij * transJ * xix * dP;
+                                tmp += -transIJ * mux / mu * dP;
+                                dFdXsB[(i + 1) * ncolB + jxB + k] += tmp;
+                            }
+                            // WARNING !!!
+                            if (i < pVnumComB[j])
+                                dFdXsB[(i + 1) * ncolB + jxB + i] += xi * transJ * dP;
+                        } else {
+                            for (USI k = 0; k < pVnumComB[j]; k++) {
+                                rhox = bk.rhox[bId_np_j * nc + k] / 2;
+                                xix  = bk.xix[uId_np_j * nc + k];
+                                mux  = bk.mux[uId_np_j * nc + k];
+                                tmp  = -transIJ * rhox * dGamma;
+                                tmp += xij * transJ * xix * dP;
+                                tmp += -transIJ * mux / mu * dP;
+                                dFdXsB[(i + 1) * ncolB + jxB + k] += tmp;
+                                dFdXsE[(i + 1) * ncolE + jxE + k] +=
+                                    -transIJ * bk.rhox[eId_np_j * nc + k] / 2 * dGamma;
+                            }
+                            // WARNING !!!
+                            if (i < pVnumComB[j])
+                                dFdXsB[(i + 1) * ncolB + jxB + i] += xi * transJ * dP;
                         }
-                        // WARNING !!!
-                        if (i < pVnumComE[j])
-                            dFdXsE[(i + 1) * ncolE + jxE + i] += xi * transJ * dP;
                     } else {
-                        for (USI k = 0; k < pVnumComE[j]; k++) {
-                            rhox = bk.rhox[eId_np_j * nc + k] / 2;
-                            xix  = bk.xix[uId_np_j * nc + k];
-                            mux  = bk.mux[uId_np_j * nc + k];
-                            tmp  = -transIJ * rhox * dGamma;
-                            tmp += xij * transJ * xix * dP;
-                            tmp += -transIJ * mux / mu * dP;
-                            dFdXsE[(i + 1) * ncolE + jxE + k] += tmp;
-                            dFdXsB[(i + 1) * ncolB + jxB + k] +=
-                                -transIJ * bk.rhox[bId_np_j * nc + k] / 2 * dGamma;
+                        // Saturation
+                        for (USI j1 = 0; j1 < np; j1++) {
+                            if (phasedS_B[j1]) {
+                                dFdXsB[(i + 1) * ncolB + j1SB] +=
+                                    transIJ * bk.dPcj_dS[bId_np_j * np + j1];
+                                j1SB++;
+                            }
+                            if (phasedS_E[j1]) {
+                                dFdXsE[(i + 1) * ncolE + j1SE] -=
+                                    transIJ * bk.dPcj_dS[eId_np_j * np + j1];
+                                tmp = Akd * xij * xi / mu *
+                                      bk.dKr_dS[uId_np_j * np + j1] * dP;
+                                dFdXsE[(i + 1) * ncolE + j1SE] += tmp;
+                                j1SE++;
+                            }
+                        }
+                        // Cij
+                        if (!phaseExistB[j]) {
+                            for (USI k = 0; k < pVnumComE[j]; k++) {
+                                rhox = bk.rhox[uId_np_j * nc + k];
+                                xix  = bk.xix[uId_np_j * nc + k];
+                                mux  = bk.mux[uId_np_j * nc + k];
+                                tmp  = -transIJ * rhox * dGamma;
+                                tmp += xij * transJ * xix * dP;
+                                tmp += -transIJ * mux / mu * dP;
+                                dFdXsE[(i + 1) * ncolE + jxE + k] += tmp;
+                            }
+                            // WARNING !!!
+                            if (i < pVnumComE[j])
+                                dFdXsE[(i + 1) * ncolE + jxE + i] += xi * transJ * dP;
+                        } else {
+                            for (USI k = 0; k < pVnumComE[j]; k++) {
+                                rhox = bk.rhox[eId_np_j * nc + k] / 2;
+                                xix  = bk.xix[uId_np_j * nc + k];
+                                mux  = bk.mux[uId_np_j * nc + k];
+                                tmp  = -transIJ * rhox * dGamma;
+                                tmp += xij * transJ * xix * dP;
+                                tmp += -transIJ * mux / mu * dP;
+                                dFdXsE[(i + 1) * ncolE + jxE + k] += tmp;
+                                dFdXsB[(i + 1) * ncolB + jxB + k] +=
+                                    -transIJ * bk.rhox[bId_np_j * nc + k] / 2 * dGamma;
+                            }
+                            // WARNING !!!
+                            if (i < pVnumComE[j])
+                                dFdXsE[(i + 1) * ncolE + jxE + i] += xi * transJ * dP;
                         }
-                        // WARNING !!!
-                        if (i < pVnumComE[j])
-                            dFdXsE[(i + 1) * ncolE + jxE + i] += xi * transJ * dP;
                     }
                 }
+                jxB += pVnumComB[j];
+                jxE += pVnumComE[j];
             }
-            jxB += pVnumComB[j];
-            jxE += pVnumComE[j];
-        }
 
-        // Assemble
-        bmat = dFdXpB;
-        DaABpbC(ncol, ncol, ncolB, 1, dFdXsB.data(), &bk.dSec_dPri[bId * lendSdP], 1,
-                bmat.data());
-        Dscalar(bsize, dt, bmat.data());
-        // Begin - Begin -- add
-        ls.AddDiag(bId, bmat);
-        // End - Begin -- insert
-        Dscalar(bsize, -1, bmat.data());
-        ls.NewOffDiag(eId, bId, bmat);
+            // Assemble
+            bmat = dFdXpB;
+            DaABpbC(ncol, ncol, ncolB, 1, dFdXsB.data(),
+                    &bk.dSec_dPri[bId * lendSdP], 1, bmat.data());
+            Dscalar(bsize, dt, bmat.data());
+            // End - Begin -- insert
+            Dscalar(bsize, -1, bmat.data());
+            Dcopy(bsize, ls.GetVal(eId, conn.connPosE[c]), bmat.data());
 
 #ifdef OCP_NANCHECK
-        if (!CheckNan(bmat.size(), &bmat[0])) {
-            OCP_ABORT("INF or NAN in bmat !");
-        }
+            if (!CheckNan(bmat.size(), &bmat[0])) {
+                OCP_ABORT("INF or NAN in bmat !");
+            }
 #endif
 
-        bmat = dFdXpE;
-        DaABpbC(ncol, ncol, ncolE, 1, dFdXsE.data(), &bk.dSec_dPri[eId * lendSdP], 1,
-                bmat.data());
+            bmat = dFdXpE;
+            DaABpbC(ncol, ncol, ncolE, 1, dFdXsE.data(),
+                    &bk.dSec_dPri[eId * lendSdP], 1, bmat.data());
 
-        Dscalar(bsize, dt, bmat.data());
-        // Begin - End -- insert
-        ls.NewOffDiag(bId, eId, bmat);
-        // End - End -- add
-        Dscalar(bsize, -1, bmat.data());
-        ls.AddDiag(eId, bmat);
+            Dscalar(bsize, dt, bmat.data());
+            // Begin - End -- insert
+            Dcopy(bsize, ls.GetVal(bId, conn.connPosB[c]), bmat.data());
 
 #ifdef OCP_NANCHECK
-        if (!CheckNan(bmat.size(), &bmat[0])) {
-            OCP_ABORT("INF or INF in bmat !");
-        }
+            if (!CheckNan(bmat.size(), &bmat[0])) {
+                OCP_ABORT("INF or INF in bmat !");
+            }
 #endif
+        }
     }
+
+    // Begin - Begin, End - End -- add
+    conn.AssembleMatDiag(ls);
 }
 
 void IsoT_FIM::AssembleMatBulksNewS(LinearSystem&    ls,
@@ -2750,14 +2755,12 @@ void IsoT_FIM::GetSolution(Reservoir&             rs,
     OCP_DBL         chopmin = 1;
     OCP_DBL         choptmp = 0;
 
-    bk.dSNR       = bk.S;
-    bk.NRphaseNum = bk.phaseNum;
-    bk.NRdPmax    = 0;
-    bk.NRdNmax    = 0;
+    bk.dSNR.assign(bk.S.begin(), bk.S.end());
+    bk.NRphaseNum.assign(bk.phaseNum.begin(), bk.phaseNum.end());
+    bk.NRdPmax = 0;
+    bk.NRdNmax = 0;
 
     for (OCP_USI n = 0; n < nb; n++) {
-        // const vector<OCP_DBL>& scm = satcm[SATNUM[n]];
-
         chopmin = 1;
         // compute the chop
         fill(dtmp.begin(), dtmp.end(), 0.0);
@@ -2785,9 +2788,13 @@ void IsoT_FIM::GetSolution(Reservoir&             rs,
                 choptmp = 0.9 * bk.S[n * np + j] / fabs(dtmp[js]);
             }
 
-            // if (fabs(S[n_np_j] - scm[j]) > TINY &&
-            //     (S[n_np_j] - scm[j]) / (choptmp * dtmp[js]) < 0)
-            //     choptmp *= min(1.0, -((S[n_np_j] - scm[j]) / (choptmp * dtmp[js])));
+            // Appleyard chop: stop at the critical saturation instead of crossing it
+            if (ctrl.nlAccel.IfAppleyard() && bk.satcm[bk.SATNUM[n]].size() == np) {
+                const OCP_DBL dS  = choptmp * dtmp[js];
+                const OCP_DBL dSc = bk.satcm[bk.SATNUM[n]][j] - bk.S[n * np + j];
+                if (fabs(dSc) > TINY && fabs(dS) > fabs(dSc) && dSc * dS > 0)
+                    choptmp *= dSc / dS;
+            }
 
             chopmin = min(chopmin, choptmp);
             js++;
@@ -2856,45 +2863,88 @@ void IsoT_FIM::GetSolution(Reservoir&             rs,
     }
 }
 
+void IsoT_FIM::SaveIterate(const Reservoir& rs, const vector<OCP_DBL>& u)
+{
+    rs.bulk.stateArena.CopyState(itState);
+    itBHP.clear();
+    for (const auto& wl : rs.allWells.wells) {
+        if (wl.IsOpen()) itBHP.push_back(wl.BHP());
+    }
+    itU = u;
+}
+
+void IsoT_FIM::RetryIterate(Reservoir&        rs,
+                            const OCP_DBL&    lambda,
+                            const OCPControl& ctrl)
+{
+    rs.bulk.stateArena.PasteState(itState);
+    USI w = 0;
+    for (auto& wl : rs.allWells.wells) {
+        if (wl.IsOpen()) wl.SetBHP(itBHP[w++]);
+    }
+
+    // Chops are calculated again from the saved iterate
+    itWork.resize(itU.size());
+    for (OCP_USI i = 0; i < itU.size(); i++) itWork[i] = lambda * itU[i];
+    GetSolution(rs, itWork, ctrl);
+}
+
+const vector<OCP_DBL>& IsoT_FIM::CalUpdateWeight(const Reservoir&        rs,
+                                                  const vector<OCP_DBL>& u,
+                                                  const OCPControl&      ctrl)
+{
+    const Bulk&   bk  = rs.bulk;
+    const OCP_USI nb  = bk.numBulk;
+    const USI     nc  = bk.numCom;
+    const USI     col = nc + 1;
+    const OCP_DBL wP  = 1 / ctrl.ctrlNR.NRdPmax;
+
+    // Pressure is scaled by the max change in a Newton iteration, moles by Nt
+    itWork.assign(u.size(), 0);
+    for (OCP_USI n = 0; n < nb; n++) {
+        itWork[n * col] = wP;
+        for (USI i = 0; i < nc; i++) itWork[n * col + 1 + i] = 1 / bk.Nt[n];
+    }
+    OCP_USI wId = nb * col;
+    for (const auto& wl : rs.allWells.wells) {
+        if (wl.IsOpen()) {
+            itWork[wId] = wP;
+            wId += col;
+        }
+    }
+    return itWork;
+}
+
+const vector<OCP_DBL>& IsoT_FIM::GetAppliedUpdate(const Reservoir&        rs,
+                                                   const vector<OCP_DBL>& u)
+{
+    const Bulk&   bk  = rs.bulk;
+    const OCP_USI nb  = bk.numBulk;
+    const USI     nc  = bk.numCom;
+    const USI     col = nc + 1;
+
+    // Moles are chopped in GetSolution, pressure and BHP are not
+    itWork.assign(u.size(), 0);
+    for (OCP_USI n = 0; n < nb; n++) {
+        itWork[n * col] = u[n * col];
+        for (USI i = 0; i < nc; i++) itWork[n * col + 1 + i] = bk.dNNR[n * nc + i];
+    }
+    OCP_USI wId = nb * col;
+    for (const auto& wl : rs.allWells.wells) {
+        if (wl.IsOpen()) {
+            itWork[wId] = u[wId];
+            wId += col;
+        }
+    }
+    return itWork;
+}
+
 void IsoT_FIM::ResetToLastTimeStep(Reservoir& rs, OCPControl& ctrl)
 {
     Bulk& bk = rs.bulk;
 
-    // Rock
-    bk.poro   = bk.lporo;
-    bk.poroP  = bk.lporoP;
-    bk.rockVp = bk.lrockVp;
-    // Fluid
-    bk.phaseNum   = bk.lphaseNum;
-    bk.Nt         = bk.lNt;
-    bk.Ni         = bk.lNi;
-    bk.vf         = bk.lvf;
-    bk.P          = bk.lP;
-    bk.Pj         = bk.lPj;
-    bk.Pc         = bk.lPc;
-    bk.phaseExist = bk.lphaseExist;
-    bk.S          = bk.lS;
-    bk.xij        = bk.lxij;
-    bk.rho        = bk.lrho;
-    bk.xi         = bk.lxi;
-    bk.mu         = bk.lmu;
-    bk.kr         = bk.lkr;
-    // derivatives
-    bk.vfP     = bk.lvfP;
-    bk.vfi     = bk.lvfi;
-    bk.rhoP    = bk.lrhoP;
-    bk.rhox    = bk.lrhox;
-    bk.xiP     = bk.lxiP;
-    bk.xix     = bk.lxix;
-    bk.muP     = bk.lmuP;
-    bk.mux     = bk.lmux;
-    bk.dPcj_dS = bk.ldPcj_dS;
-    bk.dKr_dS  = bk.ldKr_dS;
-    // FIM-Specified
-    bk.bRowSizedSdP = bk.lbRowSizedSdP;
-    bk.dSec_dPri    = bk.ldSec_dPri;
-    bk.pSderExist   = bk.lpSderExist;
-    bk.pVnumCom     = bk.lpVnumCom;
+    // Rock, Fluid, derivatives and FIM-Specified
+    bk.stateArena.RestoreState();
 
     // Wells
     rs.allWells.ResetBHP();
@@ -2914,46 +2964,8 @@ void IsoT_FIM::ResetToLastTimeStep(Reservoir& rs, OCPControl& ctrl)
 
 void IsoT_FIM::UpdateLastTimeStep(Reservoir& rs) const
 {
-    Bulk& bk = rs.bulk;
-
-    // Rock
-    bk.lporo   = bk.poro;
-    bk.lporoP  = bk.poroP;
-    bk.lrockVp = bk.rockVp;
-
-    // Fluid
-    bk.lphaseNum   = bk.phaseNum;
-    bk.lNt         = bk.Nt;
-    bk.lNi         = bk.Ni;
-    bk.lvf         = bk.vf;
-    bk.lP          = bk.P;
-    bk.lPj         = bk.Pj;
-    bk.lPc         = bk.Pc;
-    bk.lphaseExist = bk.phaseExist;
-    bk.lS          = bk.S;
-    bk.lxij        = bk.xij;
-    bk.lrho        = bk.rho;
-    bk.lxi         = bk.xi;
-    bk.lmu         = bk.mu;
-    bk.lkr         = bk.kr;
-
-    // derivatives
-    bk.lvfP     = bk.vfP;
-    bk.lvfi     = bk.vfi;
-    bk.lrhoP    = bk.rhoP;
-    bk.lrhox    = bk.rhox;
-    bk.lxiP     = bk.xiP;
-    bk.lxix     = bk.xix;
-    bk.lmuP     = bk.muP;
-    bk.lmux     = bk.mux;
-    bk.ldPcj_dS = bk.dPcj_dS;
-    bk.ldKr_dS  = bk.dKr_dS;
-
-    // FIM-Specified
-    bk.lbRowSizedSdP = bk.bRowSizedSdP;
-    bk.ldSec_dPri    = bk.dSec_dPri;
-    bk.lpSderExist   = bk.pSderExist;
-    bk.lpVnumCom     = bk.pVnumCom;
+    // Rock, Fluid, derivatives and FIM-Specified
+    rs.bulk.stateArena.SaveState();
 
     rs.allWells.UpdateLastTimeStepBHP();
     rs.optFeatures.UpdateLastTimeStep();
@@ -2970,6 +2982,7 @@ void IsoT_FIMn::Setup(Reservoir& rs, LinearSystem& ls, const OCPControl& ctrl)
     AllocateReservoir(rs);
     // Allocate memory for internal matrix structure
     IsoT_FIM::AllocateLinearSystem(ls, rs, ctrl);
+    ls.SetFrozenPattern(OCP_TRUE);
 }
 
 void IsoT_FIMn::InitReservoir(Reservoir& rs) const
@@ -2999,6 +3012,7 @@ void IsoT_FIMn::AssembleMat(LinearSystem&    ls,
                             const Reservoir& rs,
                             const OCP_DBL&   dt) const
 {
+    ls.CheckPattern(rs.allWells.GetOpenWellSetId());
     AssembleMatBulksNew(ls, rs, dt);
     AssembleMatWellsNew(ls, rs, dt);
     ls.AssembleRhsAccumulate(rs.bulk.res.resAbs);
@@ -3014,6 +3028,8 @@ void IsoT_FIMn::SolveLinearSystem(LinearSystem& ls,
 #endif // DEBUG
 
     ls.AssembleMatLinearSolver();
+    // Capture the linear system for offline benchmarks if required
+    ctrl.CaptureLinearSystem(ls);
 
     GetWallTime Timer;
     Timer.Start();
@@ -3067,6 +3083,9 @@ OCP_BOOL IsoT_FIMn::UpdateProperty(Reservoir& rs, OCPControl& ctrl)
 /// Finish a Newton-Raphson iteration.
 OCP_BOOL IsoT_FIMn::FinishNR(Reservoir& rs, OCPControl& ctrl)
 {
+    // Record the residual for time step control
+    ctrl.RecordNRResidual(rs.bulk.res);
+
     OCP_USI dSn;
 
     const OCP_DBL NRdSmax = rs.GetNRdSmax(dSn);
@@ -3087,8 +3106,8 @@ OCP_BOOL IsoT_FIMn::FinishNR(Reservoir& rs, OCPControl& ctrl)
             return OCP_TRUE;
         }
 
-    } else if (ctrl.iterNR > ctrl.ctrlNR.maxNRiter) {
-        ctrl.current_dt *= ctrl.ctrlTime.cutFacNR;
+    } else if (ctrl.iterNR > ctrl.ctrlNR.maxNRiter || ctrl.IfNRStalled()) {
+        ctrl.CutTimeStep(ctrl.ctrlTime.cutFacNR, OCP_TRUE);
         ResetToLastTimeStep(rs, ctrl);
         cout << "### WARNING: NR not fully converged! Cut time step size and repeat!  "
                 "current dt = "
@@ -3117,13 +3136,11 @@ void IsoT_FIMn::AllocateReservoir(Reservoir& rs)
     const OCP_USI np = bk.numPhase;
     const OCP_USI nc = bk.numCom;
 
-    bk.nj.resize(nb * np);
-    bk.res_n.resize(nb * (np + np * nc));
-    bk.resPc.resize(nb);
-
-    bk.lnj.resize(nb * np);
-    bk.lres_n.resize(nb * (np + np * nc));
-    bk.lresPc.resize(nb);
+    OCPStateArena& state = bk.stateArena;
+    state.Add(bk.nj, bk.lnj, nb * np);
+    state.Add(bk.res_n, bk.lres_n, nb * (np + np * nc));
+    state.Add(bk.resPc, bk.lresPc, nb);
+    state.Setup();
 }
 
 void IsoT_FIMn::InitFlash(Bulk& bk) const
@@ -3151,26 +3168,39 @@ void IsoT_FIMn::InitFlash(Bulk& bk) const
 
 void IsoT_FIMn::CalFlash(Bulk& bk)
 {
+    OCP_PROFILE(PROF_FLASH);
 
     const OCP_USI nb = bk.numBulk;
     const OCP_USI np = bk.numPhase;
     const OCP_USI nc = bk.numCom;
 
     if (bk.ifComps) {
-        vector<USI> flagB(np, 0);
-        bk.maxNRdSSP       = 0;
-        bk.index_maxNRdSSP = 0;
+        bk.ResetMaxNRdSSP();
 
-        for (OCP_USI n = 0; n < nb; n++) {
+#ifdef USE_OPENMP
+#pragma omp parallel num_threads(bk.numThreads)
+#endif
+        {
+            vector<USI> flagB(np, 0);
 
-            for (USI j = 0; j < np; j++) flagB[j] = bk.phaseExist[n * np + j];
+#ifdef USE_OPENMP
+#pragma omp for schedule(static)
+#endif
+            for (OCP_USI n = 0; n < nb; n++) {
 
-            bk.flashCal[bk.PVTNUM[n]]->FlashFIMn(
-                bk.P[n], bk.T[n], &bk.Ni[n * nc], &bk.S[n * np], &bk.xij[n * np * nc],
-                &bk.nj[n * np], &flagB[0], bk.phaseNum[n], n);
+                for (USI j = 0; j < np; j++) flagB[j] = bk.phaseExist[n * np + j];
 
-            PassFlashValue(bk, n);
+                bk.GetFlashCal(bk.PVTNUM[n])
+                    ->FlashFIMn(bk.P[n], bk.T[n], &bk.Ni[n * nc], &bk.S[n * np],
+                                &bk.xij[n * np * nc], &bk.nj[n * np], &flagB[0],
+                                bk.phaseNum[n], n);
+
+                PassFlashValue(bk, n);
+                OCP_PROFILE_COUNT(PROF_FLASH_BULK, 1);
+            }
         }
+
+        bk.ReduceMaxNRdSSP();
     } else {
         OCP_ABORT("Not completed!");
     }
@@ -3183,16 +3213,17 @@ void IsoT_FIMn::PassFlashValue(Bulk& bk, const OCP_USI& n) const
     const USI np     = bk.numPhase;
     const USI nc     = bk.numCom;
     const USI pvtnum = bk.PVTNUM[n];
+    Mixture*  flash  = bk.GetFlashCal(pvtnum);
 
     for (USI j = 0; j < bk.numPhase; j++) {
         if (bk.phaseExist[n * np + j]) {
-            bk.nj[n * np + j] = bk.flashCal[pvtnum]->GetNj(j);
+            bk.nj[n * np + j] = flash->GetNj(j);
         }
     }
 
     Dcopy(bk.bRowSizedSdP[n], &bk.res_n[0] + n * (np * (nc + 1)),
-          &bk.flashCal[pvtnum]->GetRes()[0]);
-    bk.resPc[n] = bk.flashCal[pvtnum]->GetResPc();
+          &flash->GetRes()[0]);
+    bk.resPc[n] = flash->GetResPc();
 }
 
 void IsoT_FIMn::AssembleMatBulksNew(LinearSystem&    ls,
@@ -3868,10 +3899,10 @@ void IsoT_FIMn::GetSolution(Reservoir&             rs,
     vector<OCP_DBL> tmpNij(np * nc, 0);
     OCP_USI         n_np_j;
 
-    bk.dSNR       = bk.S;
-    bk.NRphaseNum = bk.phaseNum;
-    bk.NRdPmax    = 0;
-    bk.NRdNmax    = 0;
+    bk.dSNR.assign(bk.S.begin(), bk.S.end());
+    bk.NRphaseNum.assign(bk.phaseNum.begin(), bk.phaseNum.end());
+    bk.NRdPmax = 0;
+    bk.NRdNmax = 0;
 
     OCP_DBL dSmax;
     OCP_DBL dP;
@@ -3996,23 +4027,6 @@ void IsoT_FIMn::GetSolution(Reservoir&             rs,
     }
 }
 
-void IsoT_FIMn::ResetToLastTimeStep(Reservoir& rs, OCPControl& ctrl)
-{
-    rs.bulk.nj    = rs.bulk.lnj;
-    rs.bulk.res_n = rs.bulk.lres_n;
-    rs.bulk.resPc = rs.bulk.lresPc;
-
-    IsoT_FIM::ResetToLastTimeStep(rs, ctrl);
-}
-
-void IsoT_FIMn::UpdateLastTimeStep(Reservoir& rs) const
-{
-    rs.bulk.lnj    = rs.bulk.nj;
-    rs.bulk.lres_n = rs.bulk.res_n;
-    rs.bulk.lresPc = rs.bulk.resPc;
-    IsoT_FIM::UpdateLastTimeStep(rs);
-}
-
 ////////////////////////////////////////////
 // IsoT_AIMc
 ////////////////////////////////////////////
@@ -4073,6 +4087,8 @@ void IsoT_AIMc::SolveLinearSystem(LinearSystem& ls, Reservoir& rs, OCPControl& c
 #endif // DEBUG
 
     ls.AssembleMatLinearSolver();
+    // Capture the linear system for offline benchmarks if required
+    ctrl.CaptureLinearSystem(ls);
 
     GetWallTime Timer;
     Timer.Start();
@@ -4122,6 +4138,9 @@ OCP_BOOL IsoT_AIMc::UpdateProperty(Reservoir& rs, OCPControl& ctrl)
 
 OCP_BOOL IsoT_AIMc::FinishNR(Reservoir& rs, OCPControl& ctrl)
 {
+    // Record the residual for time step control
+    ctrl.RecordNRResidual(rs.bulk.res);
+
     OCP_USI       dSn;
     const OCP_DBL NRdSmax = rs.GetNRdSmax(dSn);
     const OCP_DBL NRdPmax = rs.GetNRdPmax();
@@ -4149,8 +4168,8 @@ OCP_BOOL IsoT_AIMc::FinishNR(Reservoir& rs, OCPControl& ctrl)
             return OCP_TRUE;
         }
 
-    } else if (ctrl.iterNR > ctrl.ctrlNR.maxNRiter) {
-        ctrl.current_dt *= ctrl.ctrlTime.cutFacNR;
+    } else if (ctrl.iterNR > ctrl.ctrlNR.maxNRiter || ctrl.IfNRStalled()) {
+        ctrl.CutTimeStep(ctrl.ctrlTime.cutFacNR, OCP_TRUE);
         ResetToLastTimeStep(rs, ctrl);
         cout << "### WARNING: NR not fully converged! Cut time step size and repeat!  "
                 "current dt = "
@@ -4180,8 +4199,8 @@ void IsoT_AIMc::AllocateReservoir(Reservoir& rs)
     const USI     np = bk.numPhase;
     const USI     nc = bk.numCom;
 
-    bk.vj.resize(nb * np);
-    bk.lvj.resize(nb * np);
+    bk.stateArena.Add(bk.vj, bk.lvj, nb * np);
+    bk.stateArena.Setup();
 
     bk.xijNR.resize(nb * np * nc);
     bk.cfl.resize(nb * np);
@@ -4256,6 +4275,8 @@ void IsoT_AIMc::SetFIMBulk(Reservoir& rs)
 
 void IsoT_AIMc::CalFlashEp(Bulk& bk)
 {
+    OCP_PROFILE(PROF_FLASH);
+
     const OCP_USI nb = bk.numBulk;
     const USI     np = bk.numPhase;
     const USI     nc = bk.numCom;
@@ -4269,12 +4290,15 @@ void IsoT_AIMc::CalFlashEp(Bulk& bk)
                                                   &bk.xijNR[n * np * nc], n);
             // bk.PassFlashValueAIMcEp(n);
             PassFlashValueEp(bk, n);
+            OCP_PROFILE_COUNT(PROF_FLASH_BULK, 1);
         }
     }
 }
 
 void IsoT_AIMc::CalFlashEa(Bulk& bk)
 {
+    OCP_PROFILE(PROF_FLASH);
+
     const OCP_USI nb = bk.numBulk;
     const USI     np = bk.numPhase;
     const USI     nc = bk.numCom;
@@ -4289,12 +4313,15 @@ void IsoT_AIMc::CalFlashEa(Bulk& bk)
             // bk.PassFlashValueAIMcEa(n);
 
             IsoT_IMPEC::PassFlashValue(bk, n);
+            OCP_PROFILE_COUNT(PROF_FLASH_BULK, 1);
         }
     }
 }
 
 void IsoT_AIMc::CalFlashI(Bulk& bk)
 {
+    OCP_PROFILE(PROF_FLASH);
+
     const OCP_USI nb = bk.numBulk;
     const USI     np = bk.numPhase;
     const USI     nc = bk.numCom;
@@ -4307,6 +4334,7 @@ void IsoT_AIMc::CalFlashI(Bulk& bk)
                                                 &bk.S[n * np], bk.phaseNum[n],
                                                 &bk.xij[n * np * nc], n);
             IsoT_FIM::PassFlashValue(bk, n);
+            OCP_PROFILE_COUNT(PROF_FLASH_BULK, 1);
             for (USI j = 0; j < np; j++) {
                 bk.vj[n * np + j] = bk.vf[n] * bk.S[n * np + j];
             }
@@ -4347,14 +4375,18 @@ void IsoT_AIMc::PassFlashValueEp(Bulk& bk, const OCP_USI& n)
 
 void IsoT_AIMc::CalKrPcE(Bulk& bk)
 {
+    OCP_PROFILE(PROF_KRPC);
+
     const OCP_USI nb = bk.numBulk;
     const USI     np = bk.numPhase;
 
+    USI hint[NUM_KRPC_HINT] = {0}; // cursors of saturation tables
     for (OCP_USI n = 0; n < nb; n++) {
         if (bk.bulkTypeAIM.IfIMPECbulk(n)) {
             // Explicit bulk
             const OCP_USI bId = n * np;
-            bk.flow[bk.SATNUM[n]]->CalKrPc(&bk.S[bId], &bk.kr[bId], &bk.Pc[bId], n);
+            bk.flow[bk.SATNUM[n]]->CalKrPc(&bk.S[bId], &bk.kr[bId], &bk.Pc[bId], n,
+                                           hint);
             for (USI j = 0; j < np; j++) bk.Pj[bId + j] = bk.P[n] + bk.Pc[bId + j];
         }
     }
@@ -4362,16 +4394,19 @@ void IsoT_AIMc::CalKrPcE(Bulk& bk)
 
 void IsoT_AIMc::CalKrPcI(Bulk& bk)
 {
+    OCP_PROFILE(PROF_KRPC);
+
     const OCP_USI nb = bk.numBulk;
     const USI     np = bk.numPhase;
 
+    USI hint[NUM_KRPC_HINT] = {0}; // cursors of saturation tables
     for (OCP_USI n = 0; n < nb; n++) {
         if (bk.bulkTypeAIM.IfFIMbulk(n)) {
             // Implicit bulk
             const OCP_USI bId = n * np;
             bk.flow[bk.SATNUM[n]]->CalKrPcDeriv(&bk.S[bId], &bk.kr[bId], &bk.Pc[bId],
                                                 &bk.dKr_dS[bId * np],
-                                                &bk.dPcj_dS[bId * np], n);
+                                                &bk.dPcj_dS[bId * np], n, hint);
             for (USI j = 0; j < np; j++) bk.Pj[bId + j] = bk.P[n] + bk.Pc[bId + j];
         }
     }
@@ -4859,10 +4894,10 @@ void IsoT_AIMc::GetSolution(Reservoir&             rs,
     OCP_DBL         choptmp = 0;
     OCP_USI         n_np_j;
 
-    bk.dSNR       = bk.S;
-    bk.NRphaseNum = bk.phaseNum;
-    bk.NRdPmax    = 0;
-    bk.NRdNmax    = 0;
+    bk.dSNR.assign(bk.S.begin(), bk.S.end());
+    bk.NRphaseNum.assign(bk.phaseNum.begin(), bk.phaseNum.end());
+    bk.NRdPmax = 0;
+    bk.NRdNmax = 0;
 
     for (OCP_USI n = 0; n < nb; n++) {
         if (bk.bulkTypeAIM.IfIMPECbulk(n)) {
@@ -4975,8 +5010,8 @@ void IsoT_AIMc::GetSolution(Reservoir&             rs,
 
 void IsoT_AIMc::ResetToLastTimeStep(Reservoir& rs, OCPControl& ctrl)
 {
-    rs.bulk.vj    = rs.bulk.lvj;
-    rs.bulk.xijNR = rs.bulk.lxij;
+    // vj is restored with other states of bulks
+    rs.bulk.xijNR.assign(rs.bulk.lxij.begin(), rs.bulk.lxij.end());
     IsoT_FIM::ResetToLastTimeStep(rs, ctrl);
 }
 
@@ -4984,8 +5019,7 @@ void IsoT_AIMc::UpdateLastTimeStep(Reservoir& rs) const
 {
     IsoT_FIM::UpdateLastTimeStep(rs);
 
-    rs.bulk.lvj   = rs.bulk.vj;
-    rs.bulk.xijNR = rs.bulk.xij;
+    rs.bulk.xijNR.assign(rs.bulk.xij.begin(), rs.bulk.xij.end());
 }
 
 /*----------------------------------------------------------------------------*/
@@ -4995,4 +5029,8 @@ void IsoT_AIMc::UpdateLastTimeStep(Reservoir& rs) const
 /*----------------------------------------------------------------------------*/
 /*  Shizhe Li           Nov/01/2021      Create file                          */
 /*  Chensong Zhang      Jan/08/2022      Update output                        */
+/*  OpenCAEPoro team    Oct/16/2026      Add nonlinear strategies to FIM      */
+/*  OpenCAEPoro team    Oct/17/2026      Add 64-bit global index option       */
+/*  OpenCAEPoro team    Oct/17/2026      Run CalKrPc in threads               */
+/*  OpenCAEPoro team    Oct/17/2026      Distribute FIM among MPI processes   */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
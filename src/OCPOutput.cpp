@@ -311,11 +311,11 @@ void Summary::Setup(const Reservoir& rs, const OCP_DBL& totalTime)
             USI K = BPR.obj[i].K - 1;
 
             const OCP_INT tarId = initGrid.GetActIndex(I, J, K);
-            if (tarId < 0)
+            if (tarId == -1)
                 OCP_WARNING("Non Fluid Grid: " + GetIJKformat(I + 1, J + 1, K + 1, sp) +
                             "in BPR in SUMMARY");
             else
-                BPR.index.push_back(tarId);
+                BPR.index.push_back(max(tarId, -1));
         }
     }
 
@@ -331,11 +331,11 @@ void Summary::Setup(const Reservoir& rs, const OCP_DBL& totalTime)
             USI K = SOIL.obj[i].K - 1;
 
             const OCP_INT tarId = initGrid.GetActIndex(I, J, K);
-            if (tarId < 0)
+            if (tarId == -1)
                 OCP_WARNING("Non Fluid Grid: " + GetIJKformat(I + 1, J + 1, K + 1, sp) +
                             "in SOIL in SUMMARY");
             else
-                SOIL.index.push_back(tarId);
+                SOIL.index.push_back(max(tarId, -1));
         }
     }
 
@@ -351,11 +351,11 @@ void Summary::Setup(const Reservoir& rs, const OCP_DBL& totalTime)
             USI K = SGAS.obj[i].K - 1;
 
             const OCP_INT tarId = initGrid.GetActIndex(I, J, K);
-            if (tarId < 0)
+            if (tarId == -1)
                 OCP_WARNING("Non Fluid Grid: " + GetIJKformat(I + 1, J + 1, K + 1, sp) +
                             "in SOIL in SUMMARY");
             else
-                SGAS.index.push_back(tarId);
+                SGAS.index.push_back(max(tarId, -1));
         }
     }
 
@@ -371,11 +371,11 @@ void Summary::Setup(const Reservoir& rs, const OCP_DBL& totalTime)
             USI K = SWAT.obj[i].K - 1;
 
             const OCP_INT tarId = initGrid.GetActIndex(I, J, K);
-            if (tarId < 0)
+            if (tarId == -1)
                 OCP_WARNING("Non Fluid Grid: " + GetIJKformat(I + 1, J + 1, K + 1, sp) +
                             "in SWAT in SUMMARY");
             else
-                SWAT.index.push_back(tarId);
+                SWAT.index.push_back(max(tarId, -1));
         }
     }
 
@@ -406,6 +406,7 @@ void Summary::SetVal(const Reservoir& rs, const OCPControl& ctrl)
     // FPR
     if (FPR) Sumdata[n++].val.push_back(bulk.CalFPR());
     if (FTR) Sumdata[n++].val.push_back(bulk.CalFTR());
+    const USI nLocal = n;
     if (FOPR) Sumdata[n++].val.push_back(wells.GetFOPR());
     if (FOPT) Sumdata[n++].val.push_back(wells.GetFOPT());
     if (FGPR) Sumdata[n++].val.push_back(wells.GetFGPR());
@@ -482,24 +483,35 @@ void Summary::SetVal(const Reservoir& rs, const OCPControl& ctrl)
         }
     }
 
+    // Bulks owned by other processes give zeros
     // BPR
     len = BPR.index.size();
-    for (USI i = 0; i < len; i++) Sumdata[n++].val.push_back(bulk.GetP(BPR.index[i]));
+    for (USI i = 0; i < len; i++)
+        Sumdata[n++].val.push_back(BPR.index[i] < 0 ? 0 : bulk.GetP(BPR.index[i]));
 
     // SOIL
     len = SOIL.index.size();
     for (USI i = 0; i < len; i++)
-        Sumdata[n++].val.push_back(bulk.GetSOIL(SOIL.index[i]));
+        Sumdata[n++].val.push_back(SOIL.index[i] < 0 ? 0 : bulk.GetSOIL(SOIL.index[i]));
 
     // SGAS
     len = SGAS.index.size();
     for (USI i = 0; i < len; i++)
-        Sumdata[n++].val.push_back(bulk.GetSGAS(SGAS.index[i]));
+        Sumdata[n++].val.push_back(SGAS.index[i] < 0 ? 0 : bulk.GetSGAS(SGAS.index[i]));
 
     // SWAT
     len = SWAT.index.size();
     for (USI i = 0; i < len; i++)
-        Sumdata[n++].val.push_back(bulk.GetSWAT(SWAT.index[i]));
+        Sumdata[n++].val.push_back(SWAT.index[i] < 0 ? 0 : bulk.GetSWAT(SWAT.index[i]));
+
+    // Wells and bulks are kept by their owners, so the values of all processes are
+    // summed up
+    if (GetMPISize() > 1 && n > nLocal) {
+        vector<OCP_DBL> val(n - nLocal);
+        for (USI i = nLocal; i < n; i++) val[i - nLocal] = Sumdata[i].val.back();
+        AllReduceSum(val.data(), val.size());
+        for (USI i = nLocal; i < n; i++) Sumdata[i].val.back() = val[i - nLocal];
+    }
 }
 
 /// Write output information in the dir/SUMMARY.out file.
@@ -679,6 +691,10 @@ void BasicGridProperty::SetBasicGridProperty(const BasicGridPropertyParam& param
 void Out4RPT::InputParam(const OutputRPTParam& RPTparam)
 {
     useRPT = RPTparam.useRPT;
+    if (useRPT && GetMPISize() > 1) {
+        OCP_WARNING("RPT output is disabled with more than one process!");
+        useRPT = OCP_FALSE;
+    }
     if (!useRPT) return;
 
     bgp.SetBasicGridProperty(RPTparam.bgp);
@@ -957,8 +973,15 @@ void Out4RPT::GetIJKGrid(USI& i, USI& j, USI& k, const OCP_USI& n) const
 void Out4VTK::InputParam(const OutputVTKParam& VTKParam)
 {
     useVTK = VTKParam.useVTK;
+    if (useVTK && GetMPISize() > 1) {
+        OCP_WARNING("VTK output is disabled with more than one process!");
+        useVTK = OCP_FALSE;
+    }
     if (!useVTK) return;
 
+    useVTU     = VTKParam.useVTU;
+    useFloat32 = VTKParam.useFloat32;
+
     bgp.SetBasicGridProperty(VTKParam.bgp);
 }
 
@@ -966,18 +989,25 @@ void Out4VTK::Setup(const string& dir, const Reservoir& rs, const USI& ndates)
 {
     if (!useVTK) return;
 
+    const Grid& initGrid = rs.grid;
+
+    if (useVTU) {
+        // Geometry is encoded once and shared by all vtu files
+        out4vtu.Setup(dir + "grid.pvd", initGrid.polyhedronGrid,
+                      rs.allWells.polyhedronWell, initGrid.gridTag, useFloat32);
+        return;
+    }
+
     string file = dir + "grid" + to_string(index) + ".vtk";
     string newfile;
     string title = "test";
 
-    const Grid& initGrid = rs.grid;
-
     out4vtk.Init(file, title, VTK_ASCII, VTK_UNSTRUCTURED_GRID,
                  initGrid.polyhedronGrid.size(), rs.allWells.polyhedronWell.size());
     out4vtk.OutputPOINTS(file, initGrid.polyhedronGrid, rs.allWells.polyhedronWell,
                          VTK_FLOAT);
     out4vtk.OutputCELLS(file, initGrid.polyhedronGrid, rs.allWells.polyhedronWell);
-    out4vtk.OutputCELL_TYPES(file, initGrid.polyhedronGrid, rs.allWells.polyhedronWell);
+    out4vtk.OutputCELL_TYPES(file);
     out4vtk.BeginCellData();
     // output dead grid, live grid, well
     vector<USI> tmpW(rs.allWells.numWell, 10);
@@ -996,10 +1026,6 @@ void Out4VTK::Setup(const string& dir, const Reservoir& rs, const USI& ndates)
         dest.close();
     }
     index = 0;
-
-#ifdef USE_METIS
-    metisTest.Setup(rs);
-#endif // USE_METIS
 }
 
 void Out4VTK::PrintVTK(const string&    dir,
@@ -1008,7 +1034,8 @@ void Out4VTK::PrintVTK(const string&    dir,
 {
     if (!useVTK) return;
 
-    string file = dir + "grid" + to_string(index) + ".vtk";
+    string file = dir + "grid" + to_string(index) + (useVTU ? ".vtu" : ".vtk");
+    if (useVTU) out4vtu.BeginSnapshot(file, days);
     // Calulcate Well val for output
     rs.allWells.SetWellVal();
 
@@ -1023,32 +1050,20 @@ void Out4VTK::PrintVTK(const string&    dir,
 
     // output
     if (bgp.PRE)
-        out4vtk.OutputCELL_DATA_SCALARS(file, "PRESSURE", VTK_FLOAT, &bulk.P[0], 1,
-                                        g2bp, OCP_TRUE, &well[0]);
+        PrintCellData(file, "PRESSURE", VTK_FLOAT, &bulk.P[0], 1, g2bp, OCP_TRUE,
+                      &well[0]);
     if (bgp.SOIL)
-        out4vtk.OutputCELL_DATA_SCALARS(file, "SOIL", VTK_FLOAT, &bulk.S[OIndex], np,
-                                        g2bp, OCP_TRUE, &well[0]);
+        PrintCellData(file, "SOIL", VTK_FLOAT, &bulk.S[OIndex], np, g2bp, OCP_TRUE,
+                      &well[0]);
     if (bgp.SGAS)
-        out4vtk.OutputCELL_DATA_SCALARS(file, "SGAS", VTK_FLOAT, &bulk.S[GIndex], np,
-                                        g2bp, OCP_TRUE, &well[0]);
+        PrintCellData(file, "SGAS", VTK_FLOAT, &bulk.S[GIndex], np, g2bp, OCP_TRUE,
+                      &well[0]);
     if (bgp.SWAT)
-        out4vtk.OutputCELL_DATA_SCALARS(file, "SWAT", VTK_FLOAT, &bulk.S[WIndex], np,
-                                        g2bp, OCP_TRUE, &well[0]);
-
-#ifdef USE_METIS
-    if (metisTest.useMetis) {
-        // partition and print
-        // vertex weights set to 1 now
-        metisTest.vwgt.resize(metisTest.nvtxs, 1);
-        // metisTest.MyPartitionFunc(METIS_PartGraphRecursive);
-        metisTest.MyPartitionFunc(METIS_PartGraphKway);
-        metisTest.SetPartitions(initGrid.map_Act2All);
-        out4vtk.OutputCELL_DATA_SCALARS(file, "PARTIONS", VTK_UNSIGNED_INT,
-                                        &metisTest.partitions[0], 1, g2bp, OCP_FALSE,
-                                        &metisTest.partitions[metisTest.ng]);
-    }
-#endif // USE_METIS
+        PrintCellData(file, "SWAT", VTK_FLOAT, &bulk.S[WIndex], np, g2bp, OCP_TRUE,
+                      &well[0]);
 
+    // vtu file is written in background
+    if (useVTU) out4vtu.EndSnapshot();
     index++;
 }
 
@@ -1064,6 +1079,7 @@ void OCPOutput::Setup(const Reservoir& reservoir, const OCPControl& ctrl)
     workDir = ctrl.workDir;
     summary.Setup(reservoir, ctrl.criticalTime.back());
     crtInfo.Setup(ctrl.criticalTime.back());
+    OCPProfiler::Instance().Setup(workDir);
     out4RPT.Setup(workDir, reservoir);
     out4VTK.Setup(workDir, reservoir, ctrl.criticalTime.size());
 }
@@ -1072,12 +1088,19 @@ void OCPOutput::SetVal(const Reservoir& reservoir, const OCPControl& ctrl)
 {
     summary.SetVal(reservoir, ctrl);
     crtInfo.SetVal(reservoir, ctrl);
+    OCPProfiler::Instance().EndStep(ctrl.numTstep, ctrl.current_time, ctrl.last_dt,
+                                    ctrl.iterNR_total, ctrl.iterLS_total);
 }
 
 void OCPOutput::PrintInfo() const
 {
+    // Processes share the same summary, which is written by the first one
+    if (GetMPIRank() > 0) return;
+
+    out4VTK.Finish();
     summary.PrintInfo(workDir);
     crtInfo.PrintFastReview(workDir);
+    OCPProfiler::Instance().PrintJSON(workDir);
 }
 
 void OCPOutput::PrintInfoSched(const Reservoir&  rs,
@@ -1095,6 +1118,7 @@ void OCPOutput::PrintInfoSched(const Reservoir&  rs,
 
     // print to output file
     // TODO: Add a control flag to enable or disable --zcs
+    OCP_PROFILE(PROF_OUTPUT);
     GetWallTime timer;
     timer.Start();
     out4RPT.PrintRPT(workDir, rs, days);
@@ -1110,4 +1134,7 @@ void OCPOutput::PrintInfoSched(const Reservoir&  rs,
 /*  Shizhe Li           Oct/01/2021      Create file                          */
 /*  Chensong Zhang      Oct/15/2021      Format file                          */
 /*  Chensong Zhang      Jan/09/2022      Update Doxygen                       */
+/*  OpenCAEPoro team    Oct/16/2026      Add binary and asynchronous VTU      */
+/*  OpenCAEPoro team    Oct/17/2026      Update call of OutputCELL_TYPES      */
+/*  OpenCAEPoro team    Oct/17/2026      Distribute FIM among MPI processes   */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
@@ -0,0 +1,119 @@
+/*! \file    OCPStateArena.cpp
+ *  \brief   OCPStateArena class definition
+ *  \author  OpenCAEPoro team
+ *  \date    Oct/16/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the OpenCAEPoro team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+#include "OCPStateArena.hpp"
+#include "Partition.hpp"
+
+void OCPStateArena::Add(OCPArrayBase*       cur,
+                        OCPArrayBase*       last,
+                        const OCP_USI&      n,
+                        const size_t&       elemSize,
+                        const OCPStateType& type)
+{
+    if (type != CURRENT_STATE && last == nullptr) {
+        OCP_ABORT("Array at last time step is missing!");
+    }
+
+    for (auto& d : desc) {
+        if (d.cur == cur) {
+            d.last     = last;
+            d.num      = n;
+            d.elemSize = elemSize;
+            d.type     = type;
+            return;
+        }
+    }
+    desc.push_back(ArrayDesc{cur, last, n, elemSize, type, 0});
+}
+
+void OCPStateArena::Setup()
+{
+    // Sort arrays by type, the order of registration is kept in each group
+    stable_sort(desc.begin(), desc.end(), [](const ArrayDesc& a, const ArrayDesc& b) {
+        return a.type < b.type;
+    });
+
+    auto align = [](const size_t& s) {
+        return (s + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+    };
+
+    size_t curBytes = 0;
+    restoreBytes    = 0;
+    saveBytes       = 0;
+    for (auto& d : desc) {
+        d.offset = curBytes;
+        curBytes += align(d.num * d.elemSize);
+        if (d.type == ROLLBACK_STATE) restoreBytes = curBytes;
+        if (d.type != CURRENT_STATE) saveBytes = curBytes;
+    }
+
+    // current states, then states at last time step
+    vector<char> newBuffer(curBytes + saveBytes + ALIGNMENT, 0);
+    const size_t shift   = reinterpret_cast<size_t>(newBuffer.data()) % ALIGNMENT;
+    char*        newBase = newBuffer.data() + (shift > 0 ? ALIGNMENT - shift : 0);
+    char*        newLast = newBase + curBytes;
+
+    // entries which have been set are kept
+    auto bind = [](OCPArrayBase* a, char* dst, const ArrayDesc& d) {
+        if (a->addr != nullptr) memcpy(dst, a->addr, min(a->num, d.num) * d.elemSize);
+        a->addr = dst;
+        a->num  = d.num;
+    };
+    for (auto& d : desc) {
+        bind(d.cur, newBase + d.offset, d);
+        if (d.type != CURRENT_STATE) bind(d.last, newLast + d.offset, d);
+    }
+
+    buffer.swap(newBuffer);
+    curBase  = newBase;
+    lastBase = newLast;
+    allBytes = curBytes + saveBytes;
+}
+
+void OCPStateArena::ExchangeGhost(const Partition& part, const OCP_USI& nb) const
+{
+    if (!part.IfDistributed() || nb == 0) return;
+
+    // All current arrays are sent in one message
+    vector<pair<char*, size_t>> arrays;
+    arrays.reserve(desc.size());
+    for (const auto& d : desc) {
+        if (d.num > 0) arrays.emplace_back(d.cur->addr, d.num / nb * d.elemSize);
+    }
+    part.ExchangeGhost(arrays);
+}
+
+void OCPStateArena::WriteRestart(ofstream& out) const
+{
+    // Both groups are contiguous, so they are written at once
+    const OCP_ULL n = allBytes;
+    WriteBinary(out, n);
+    out.write(curBase, allBytes);
+}
+
+void OCPStateArena::ReadRestart(ifstream& in)
+{
+    OCP_ULL n;
+    ReadBinary(in, n);
+    if (n != allBytes) OCP_ABORT("Restart file does not match the model!");
+    in.read(curBase, allBytes);
+    if (!in) OCP_ABORT("Restart file is truncated!");
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  OpenCAEPoro team    Oct/16/2026      Create file                          */
+/*  OpenCAEPoro team    Oct/16/2026      Add restart                          */
+/*  OpenCAEPoro team    Oct/17/2026      Distribute FIM among MPI processes   */
+/*----------------------------------------------------------------------------*/
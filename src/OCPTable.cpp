@@ -9,199 +9,214 @@
  *-----------------------------------------------------------------------------------
  */
 
+// Standard header files
+#include <algorithm>
+#include <cmath>
+
+// OpenCAEPoro header files
 #include "OCPTable.hpp"
+#include "UtilOpenMP.hpp"
+
+OCPTable::OCPTable(const vector<vector<OCP_DBL>>& src) { this->Setup(src); }
 
-OCPTable::OCPTable(const USI& row, const USI& col)
+void OCPTable::Setup(const std::vector<std::vector<OCP_DBL>>& src)
 {
-    nRow = row;
-    nCol = col;
-    bId  = 0;
-    data.resize(nCol);
-    for (USI j = 0; j < nCol; j++) {
-        data[j].resize(nRow);
-    }
+    data.clear();
+    nCol = 0;
+    for (const auto& v : src) PushCol(v);
+    SetRowCol();
 }
 
-OCPTable::OCPTable(const vector<vector<OCP_DBL>>& src) { this->Setup(src); }
+void OCPTable::PushCol(const vector<OCP_DBL>& v)
+{
+    if (nCol == 0) nRow = v.size();
+    if (v.size() != nRow) OCP_ABORT("Columns of table have different length!");
+    data.insert(data.end(), v.begin(), v.end());
+    nCol++;
+}
 
-void OCPTable::Setup(const std::vector<std::vector<OCP_DBL>>& src)
+void OCPTable::SetRowCol()
 {
-    data = src;
-    nCol = data.size();
-    nRow = data[0].size();
-    bId  = nRow / 2;
+    if (nCol == 0) OCP_ABORT("Table is empty!");
+
+    // A column is uniform if its rows are equally spaced in increasing order, then
+    // the row of a value is found directly and corrected by at most a few steps
+    invStep.assign(nCol, 0);
+    if (nRow < 3) return;
+    for (USI j = 0; j < nCol; j++) {
+        const OCP_DBL* x = &data[j * nRow];
+        const OCP_DBL  h = (x[nRow - 1] - x[0]) / (nRow - 1);
+        if (!(h > 0)) continue;
+        OCP_BOOL uniform = OCP_TRUE;
+        for (USI i = 1; i < nRow; i++) {
+            if (fabs(x[i] - x[0] - i * h) > 1E-8 * h) {
+                uniform = OCP_FALSE;
+                break;
+            }
+        }
+        if (uniform) invStep[j] = 1 / h;
+    }
 }
 
 OCP_INT OCPTable::GetRowZero(const USI& mycol) const
 {
     if (mycol > nCol) OCP_ABORT("wrong specified column!");
+    const OCP_DBL* col = &data[mycol * nRow];
     for (USI i = 0; i < nRow; i++) {
-        if (data[mycol][i] >= TINY) {
+        if (col[i] >= TINY) {
             return i - 1;
         }
     }
     return nRow - 1;
 }
 
-/// Careful: the memory outdata and slope have not be allocated before
-USI OCPTable::Eval_All(const USI&       j,
-                       const OCP_DBL&   val,
-                       vector<OCP_DBL>& outdata,
-                       vector<OCP_DBL>& slope)
+OCP_INT OCPTable::Locate(const USI& j, const OCP_DBL& val, USI* hint) const
 {
-    if (val >= data[j][bId]) {
-        for (USI i = bId + 1; i < nRow; i++) {
-            if (val < data[j][i]) {
-                bId = i - 1;
-                for (USI k = 0; k < nCol; k++) {
-                    slope[k] = (data[k][bId + 1] - data[k][bId]) /
-                               (data[j][bId + 1] - data[j][bId]);
-                    outdata[k] = data[k][bId] + slope[k] * (val - data[j][bId]);
-                }
-                return bId;
-            }
-        }
-        for (USI k = 0; k < nCol; k++) {
-            slope[k]   = 0;
-            outdata[k] = data[k].back();
-        }
+    const OCP_DBL* x = &data[j * nRow];
+    if (!(val >= x[0])) return -1;
+    if (val >= x[nRow - 1]) return nRow - 1;
+
+    USI i;
+    if (hint != nullptr && *hint + 1 < nRow && x[*hint] <= val && val < x[*hint + 1]) {
+        return *hint;
+    } else if (invStep[j] > 0) {
+        i = min<USI>(nRow - 2, static_cast<USI>((val - x[0]) * invStep[j]));
+        while (val < x[i]) i--;
+        while (val >= x[i + 1]) i++;
     } else {
-        for (OCP_INT i = bId - 1; i >= 0; i--) {
-            if (val >= data[j][i]) {
-                bId = i;
-                for (USI k = 0; k < nCol; k++) {
-                    slope[k] = (data[k][bId + 1] - data[k][bId]) /
-                               (data[j][bId + 1] - data[j][bId]);
-                    outdata[k] = data[k][bId] + slope[k] * (val - data[j][bId]);
-                }
-                return bId;
-            }
-        }
+        i = upper_bound(x, x + nRow, val) - x - 1;
+    }
+    if (hint != nullptr) *hint = i;
+    return i;
+}
+
+/// Careful: the memory outdata and slope have not be allocated before
+USI OCPTable::Eval_All(const USI&     j,
+                       const OCP_DBL& val,
+                       OCP_DBL*       outdata,
+                       OCP_DBL*       slope,
+                       USI*           hint) const
+{
+    const OCP_INT i = Locate(j, val, hint);
+    if (i < 0 || i == static_cast<OCP_INT>(nRow - 1)) {
+        const USI r = i < 0 ? 0 : nRow - 1;
         for (USI k = 0; k < nCol; k++) {
             slope[k]   = 0;
-            outdata[k] = data[k].front();
+            outdata[k] = data[k * nRow + r];
         }
+        return r;
+    }
+
+    const OCP_DBL* x = &data[j * nRow + i];
+    for (USI k = 0; k < nCol; k++) {
+        const OCP_DBL* y = &data[k * nRow + i];
+        slope[k]         = (y[1] - y[0]) / (x[1] - x[0]);
+        outdata[k]       = y[0] + slope[k] * (val - x[0]);
     }
-    return bId;
+    return i;
 }
 
-USI OCPTable::Eval_All0(const OCP_DBL& val, vector<OCP_DBL>& outdata)
+USI OCPTable::Eval_All0(const OCP_DBL& val, vector<OCP_DBL>& outdata, USI* hint) const
 {
-    const USI j    = 0;
-    OCP_DBL   tmpk = 0;
-    if (val >= data[j][bId]) {
-        for (USI i = bId + 1; i < nRow; i++) {
-            if (val < data[j][i]) {
-                bId = i - 1;
-                for (USI k = 1; k < nCol; k++) {
-                    tmpk = (data[k][bId + 1] - data[k][bId]) /
-                           (data[j][bId + 1] - data[j][bId]);
-                    outdata[k - 1] = data[k][bId] + tmpk * (val - data[j][bId]);
-                }
-                return bId;
-            }
-        }
-        for (USI k = 1; k < nCol; k++) {
-            outdata[k - 1] = data[k].back();
-        }
-    } else {
-        for (OCP_INT i = bId - 1; i >= 0; i--) {
-            if (val >= data[j][i]) {
-                bId = i;
-                for (USI k = 1; k < nCol; k++) {
-                    tmpk = (data[k][bId + 1] - data[k][bId]) /
-                           (data[j][bId + 1] - data[j][bId]);
-                    outdata[k - 1] = data[k][bId] + tmpk * (val - data[j][bId]);
-                }
-                return bId;
-            }
-        }
+    const OCP_INT i = Locate(0, val, hint);
+    if (i < 0 || i == static_cast<OCP_INT>(nRow - 1)) {
+        const USI r = i < 0 ? 0 : nRow - 1;
         for (USI k = 1; k < nCol; k++) {
-            outdata[k - 1] = data[k].front();
+            outdata[k - 1] = data[k * nRow + r];
         }
+        return r;
+    }
+
+    const OCP_DBL* x = &data[i];
+    for (USI k = 1; k < nCol; k++) {
+        const OCP_DBL* y    = &data[k * nRow + i];
+        const OCP_DBL  tmpk = (y[1] - y[0]) / (x[1] - x[0]);
+        outdata[k - 1]      = y[0] + tmpk * (val - x[0]);
     }
-    return bId;
+    return i;
 }
 
-OCP_DBL OCPTable::Eval(const USI& j, const OCP_DBL& val, const USI& destj)
+OCP_DBL OCPTable::Eval(const USI&     j,
+                       const OCP_DBL& val,
+                       const USI&     destj,
+                       USI*           hint) const
 {
-    if (val >= data[j][bId]) {
-        for (USI i = bId + 1; i < nRow; i++) {
-            if (val < data[j][i]) {
-                bId       = i - 1;
-                OCP_DBL k = (data[destj][bId + 1] - data[destj][bId]) /
-                            (data[j][bId + 1] - data[j][bId]);
-                return (data[destj][bId] + k * (val - data[j][bId]));
-            }
-        }
-        return data[destj].back();
-    } else {
-        for (OCP_INT i = bId - 1; i >= 0; i--) {
-            if (val >= data[j][i]) {
-                bId       = i;
-                OCP_DBL k = (data[destj][bId + 1] - data[destj][bId]) /
-                            (data[j][bId + 1] - data[j][bId]);
-                return (data[destj][bId] + k * (val - data[j][bId]));
-            }
-        }
-        return data[destj].front();
-    }
+    OCP_DBL k;
+    return Eval(j, val, destj, k, hint);
 }
 
-OCP_DBL OCPTable::Eval(const USI& j, const OCP_DBL& val, const USI& destj, OCP_DBL& myK)
+OCP_DBL OCPTable::Eval(const USI&     j,
+                       const OCP_DBL& val,
+                       const USI&     destj,
+                       OCP_DBL&       myK,
+                       USI*           hint) const
 {
-    // becareful when the memory outdata and slope have not be allocated before
-
-    if (val >= data[j][bId]) {
-        for (USI i = bId + 1; i < nRow; i++) {
-            if (val < data[j][i]) {
-                bId = i - 1;
-                myK = (data[destj][bId + 1] - data[destj][bId]) /
-                      (data[j][bId + 1] - data[j][bId]);
-                return (data[destj][bId] + myK * (val - data[j][bId]));
-            }
-        }
-        return data[destj].back();
-    } else {
-        for (OCP_INT i = bId - 1; i >= 0; i--) {
-            if (val >= data[j][i]) {
-                bId = i;
-                myK = (data[destj][bId + 1] - data[destj][bId]) /
-                      (data[j][bId + 1] - data[j][bId]);
-                return (data[destj][bId] + myK * (val - data[j][bId]));
-            }
-        }
-        return data[destj].front();
-    }
+    const OCP_INT i = Locate(j, val, hint);
+    if (i < 0) return data[destj * nRow];
+    if (i == static_cast<OCP_INT>(nRow - 1)) return data[destj * nRow + i];
+
+    const OCP_DBL* x = &data[j * nRow + i];
+    const OCP_DBL* y = &data[destj * nRow + i];
+    myK              = (y[1] - y[0]) / (x[1] - x[0]);
+    return (y[0] + myK * (val - x[0]));
 }
 
-OCP_DBL OCPTable::Eval_Inv(const USI& j, const OCP_DBL& val, const USI& destj)
+void OCPTable::EvalBatch(const USI&     j,
+                         const OCP_USI& n,
+                         const OCP_DBL* val,
+                         const USI&     destj,
+                         OCP_DBL*       out,
+                         OCP_DBL*       slope) const
 {
-    // becareful when the memory outdata and slope have not be allocated before
-
-    if (val > data[j][bId]) {
-        for (OCP_INT i = bId - 1; i >= 0; i--) {
-            if (val <= data[j][i]) {
-                bId       = i;
-                OCP_DBL k = (data[destj][bId + 1] - data[destj][bId]) /
-                            (data[j][bId + 1] - data[j][bId]);
-                return (data[destj][bId] + k * (val - data[j][bId]));
-            }
+    const OCP_DBL* x = &data[j * nRow];
+    const OCP_DBL* y = &data[destj * nRow];
+    if (nRow < 2) {
+        for (OCP_USI m = 0; m < n; m++) out[m] = y[0];
+        if (slope != nullptr) fill(slope, slope + n, 0.0);
+        return;
+    }
+
+    // Rows are located first, then values are interpolated in a vectorized loop
+    const OCP_USI block = 128;
+    const USI     last  = nRow - 2;
+    USI           row[block];
+    OCP_BOOL      inside[block];
+    USI           hint = nRow / 2;
+    for (OCP_USI m0 = 0; m0 < n; m0 += block) {
+        const OCP_USI  nb = min(block, n - m0);
+        const OCP_DBL* v  = val + m0;
+        OCP_DBL*       o  = out + m0;
+        for (OCP_USI m = 0; m < nb; m++) {
+            const OCP_INT i = Locate(j, v[m], &hint);
+            row[m]          = i < 0 ? 0 : i;
+            inside[m]       = i >= 0 && i <= static_cast<OCP_INT>(last);
         }
-        return data[destj].front();
-    } else {
-        for (USI i = bId + 1; i < nRow; i++) {
-            if (val >= data[j][i]) {
-                bId       = i;
-                OCP_DBL k = (data[destj][bId] - data[destj][bId - 1]) /
-                            (data[j][bId] - data[j][bId - 1]);
-                return (data[destj][bId - 1] + k * (val - data[j][bId - 1]));
-            }
+
+        OCP_SIMD
+        for (OCP_USI m = 0; m < nb; m++) {
+            const USI     r = row[m];
+            const USI     i = r < last ? r : last;
+            const OCP_DBL k = (y[i + 1] - y[i]) / (x[i + 1] - x[i]);
+            o[m]            = inside[m] ? y[r] + k * (v[m] - x[r]) : y[r];
+            if (slope != nullptr) slope[m0 + m] = inside[m] ? k : 0;
         }
-        return data[destj].back();
     }
 }
 
+OCP_DBL OCPTable::Eval_Inv(const USI& j, const OCP_DBL& val, const USI& destj) const
+{
+    // Find the first row below val in the decreasing column
+    const OCP_DBL* x = &data[j * nRow];
+    const OCP_DBL* y = &data[destj * nRow];
+    const USI      i =
+        partition_point(x, x + nRow, [&val](const OCP_DBL& v) { return v >= val; }) - x;
+    if (i == 0) return y[0];
+    if (i == nRow) return y[nRow - 1];
+
+    const OCP_DBL k = (y[i] - y[i - 1]) / (x[i] - x[i - 1]);
+    return (y[i - 1] + k * (val - x[i - 1]));
+}
+
 void OCPTable::Display() const
 {
     cout << "\n---------------------" << endl
@@ -215,7 +230,7 @@ void OCPTable::Display() const
     cout << fixed << setprecision(3);
     for (USI i = 0; i < nRow; i++) {
         for (USI j = 0; j < nCol; j++) {
-            cout << data[j][i] << "\t";
+            cout << data[j * nRow + i] << "\t";
         }
         cout << "\n";
     }
@@ -228,4 +243,6 @@ void OCPTable::Display() const
 /*----------------------------------------------------------------------------*/
 /*  Shizhe Li           Oct/01/2021      Create file                          */
 /*  Chensong Zhang      Oct/15/2021      Format file                          */
+/*  OpenCAEPoro team    Oct/16/2026      Stateless lookup with hints          */
+/*  OpenCAEPoro team    Oct/17/2026      Interpolate into scratch of callers  */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
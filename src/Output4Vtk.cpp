@@ -9,6 +9,11 @@
  *-----------------------------------------------------------------------------------
  */
 
+// Standard header files
+#include <sstream>
+#include <unordered_map>
+
+// OpenCAEPoro header files
 #include "Output4Vtk.hpp"
 
 void Output4Vtk::Init(const string&  myFile,
@@ -71,7 +76,7 @@ void Output4Vtk::OutputPOINTS(const string&                myFile,
     for (auto& w : myHexWell) {
         numWellPoints += w.numPoints;
     }
-    myVtk << VTK_POINTS << " " << numWellPoints << " " << VTK_FLOAT << "\n";
+    myVtk << VTK_POINTS << " " << numWellPoints << " " << dataType << "\n";
 
     for (VTK_USI i = 0; i < numGrid; i++) {
         for (USI j = 0; j < myHexGrid[i].numPoints; j++) {
@@ -143,9 +148,7 @@ void Output4Vtk::OutputCELLS(const string&                myFile,
     myVtk.close();
 }
 
-void Output4Vtk::OutputCELL_TYPES(const string&                myFile,
-                                  const vector<OCPpolyhedron>& myHexGrid,
-                                  const vector<OCPpolyhedron>& myHexWell) const
+void Output4Vtk::OutputCELL_TYPES(const string& myFile) const
 {
     ofstream myVtk;
     myVtk.open(myFile, ios::app);
@@ -173,6 +176,175 @@ void Output4Vtk::OutputCELL_TYPES(const string&                myFile,
     myVtk.close();
 }
 
+void Output4Vtu::Setup(const string&                pvdFile,
+                       const vector<OCPpolyhedron>& myHexGrid,
+                       const vector<OCPpolyhedron>& myHexWell,
+                       const vector<USI>&           gridTag,
+                       const OCP_BOOL&              float32)
+{
+    numGrid    = myHexGrid.size();
+    numWell    = myHexWell.size();
+    numCell    = numGrid + numWell;
+    useFloat32 = float32;
+    pvdName    = pvdFile;
+    pvdItems.clear();
+
+    // Points, cells and tags of grids, then wells, where corners shared by
+    // neighboring cells are stored once
+    vector<OCP_DBL>                points;
+    vector<int64_t>                connectivity;
+    vector<int64_t>                offsets;
+    vector<uint8_t>                types;
+    vector<uint8_t>                tags;
+    unordered_map<string, int64_t> pointId;
+    string                         key(3 * sizeof(OCP_DBL), 0);
+    for (VTK_USI n = 0; n < numCell; n++) {
+        const OCPpolyhedron& p = n < numGrid ? myHexGrid[n] : myHexWell[n - numGrid];
+        for (USI j = 0; j < p.numPoints; j++) {
+            const OCP_DBL xyz[3] = {p.Points[j].x, p.Points[j].y, p.Points[j].z};
+            memcpy(&key[0], xyz, key.size());
+            const auto it = pointId.emplace(key, points.size() / 3);
+            if (it.second) points.insert(points.end(), xyz, xyz + 3);
+            connectivity.push_back(it.first->second);
+        }
+        offsets.push_back(connectivity.size());
+        types.push_back(n < numGrid ? VTK_HEXAHEDRON : VTK_POLY_LINE);
+        tags.push_back(n < numGrid ? gridTag[n] : 10);
+    }
+    pointId.clear();
+
+    const uint16_t one    = 1;
+    const OCP_BOOL little = *reinterpret_cast<const uint8_t*>(&one) == 1;
+    ostringstream  xml;
+    xml << "<?xml version=\"1.0\"?>\n"
+        << "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\""
+        << (little ? "LittleEndian" : "BigEndian") << "\" header_type=\"UInt64\">\n"
+        << "  <UnstructuredGrid>\n";
+    headXml = xml.str();
+
+    // Geometry and static cell data are the head of appended data of all files
+    geomData.clear();
+    xml.str("");
+    xml << "    <Piece NumberOfPoints=\"" << points.size() / 3 << "\" NumberOfCells=\""
+        << numCell << "\">\n"
+        << "      <Points>\n";
+    if (useFloat32) {
+        const vector<float> tmp(points.begin(), points.end());
+        xml << DataArrayXml(VTU_FLOAT32, "Points", 3, geomData.size());
+        Append(geomData, tmp.data(), tmp.size());
+    } else {
+        xml << DataArrayXml(VTU_FLOAT64, "Points", 3, geomData.size());
+        Append(geomData, points.data(), points.size());
+    }
+    xml << "      </Points>\n"
+        << "      <Cells>\n";
+    if (connectivity.size() <= INT32_MAX) {
+        const vector<int32_t> conn(connectivity.begin(), connectivity.end());
+        const vector<int32_t> offs(offsets.begin(), offsets.end());
+        xml << DataArrayXml(VTU_INT32, "connectivity", 1, geomData.size());
+        Append(geomData, conn.data(), conn.size());
+        xml << DataArrayXml(VTU_INT32, "offsets", 1, geomData.size());
+        Append(geomData, offs.data(), offs.size());
+    } else {
+        xml << DataArrayXml(VTU_INT64, "connectivity", 1, geomData.size());
+        Append(geomData, connectivity.data(), connectivity.size());
+        xml << DataArrayXml(VTU_INT64, "offsets", 1, geomData.size());
+        Append(geomData, offsets.data(), offsets.size());
+    }
+    xml << DataArrayXml(VTU_UINT8, "types", 1, geomData.size());
+    Append(geomData, types.data(), types.size());
+    xml << "      </Cells>\n"
+        << "      <CellData>\n"
+        << DataArrayXml(VTU_UINT8, "CellType", 1, geomData.size());
+    Append(geomData, tags.data(), tags.size());
+    pieceXml = xml.str();
+}
+
+void Output4Vtu::BeginSnapshot(const string& myFile, const OCP_DBL& days)
+{
+    VtuSnapshot& sp = snap[cur];
+    sp.file         = myFile;
+    sp.days         = days;
+    sp.dataXml.clear();
+    sp.data.clear();
+}
+
+void Output4Vtu::EndSnapshot()
+{
+    // The other snapshot is free once the last write finishes
+    Finish();
+
+    const VtuSnapshot& sp   = snap[cur];
+    const size_t       pos  = sp.file.find_last_of("/\\");
+    const string       name = pos == string::npos ? sp.file : sp.file.substr(pos + 1);
+    pvdItems += "    <DataSet timestep=\"" + to_string(sp.days) + "\" file=\"" + name +
+                "\"/>\n";
+    const string pvd = "<?xml version=\"1.0\"?>\n"
+                       "<VTKFile type=\"Collection\" version=\"1.0\">\n"
+                       "  <Collection>\n" +
+                       pvdItems +
+                       "  </Collection>\n"
+                       "</VTKFile>\n";
+
+    writer = thread([this, &sp, pvd]() { WriteSnapshot(sp, pvd); });
+    cur    = 1 - cur;
+}
+
+void Output4Vtu::Finish()
+{
+    if (writer.joinable()) writer.join();
+    if (!writeError.empty()) {
+        OCP_ABORT(writeError);
+    }
+}
+
+void Output4Vtu::WriteSnapshot(const VtuSnapshot& sp, const string& pvd)
+{
+    // OCP_ABORT is not called here as it would exit from the background thread
+    ofstream myVtu(sp.file, ios::binary);
+    if (!myVtu.is_open()) {
+        writeError = "Can not open file: " + sp.file;
+        return;
+    }
+
+    myVtu << headXml << "    <FieldData>\n"
+          << "      <DataArray type=\"" << VTU_FLOAT64
+          << "\" Name=\"TimeValue\" NumberOfTuples=\"1\" format=\"ascii\">"
+          << setprecision(16) << sp.days << "</DataArray>\n"
+          << "    </FieldData>\n"
+          << pieceXml << sp.dataXml << "      </CellData>\n"
+          << "    </Piece>\n"
+          << "  </UnstructuredGrid>\n"
+          << "  <AppendedData encoding=\"raw\">\n_";
+    myVtu.write(geomData.data(), geomData.size());
+    myVtu.write(sp.data.data(), sp.data.size());
+    myVtu << "\n  </AppendedData>\n</VTKFile>\n";
+    myVtu.close();
+    if (!myVtu) {
+        writeError = "Can not write file: " + sp.file;
+        return;
+    }
+
+    ofstream myPvd(pvdName);
+    if (!myPvd.is_open()) {
+        writeError = "Can not open file: " + pvdName;
+        return;
+    }
+    myPvd << pvd;
+    myPvd.close();
+    if (!myPvd) writeError = "Can not write file: " + pvdName;
+}
+
+string Output4Vtu::DataArrayXml(const string& type,
+                                const string& dataName,
+                                const USI&    numCom,
+                                const size_t& offset)
+{
+    return "        <DataArray type=\"" + type + "\" Name=\"" + dataName +
+           "\" NumberOfComponents=\"" + to_string(numCom) +
+           "\" format=\"appended\" offset=\"" + to_string(offset) + "\"/>\n";
+}
+
 /*----------------------------------------------------------------------------*/
 /*  Brief Change History of This File                                         */
 /*----------------------------------------------------------------------------*/
@@ -180,4 +352,6 @@ void Output4Vtk::OutputCELL_TYPES(const string&                myFile,
 /*----------------------------------------------------------------------------*/
 /*  Shizhe Li           Oct/19/2022      Create file                          */
 /*  Chensong Zhang      Feb/05/2023      Update output in vtk files           */
+/*  OpenCAEPoro team    Oct/16/2026      Add binary and asynchronous VTU      */
+/*  OpenCAEPoro team    Oct/17/2026      Raise VTU errors on main thread      */
 /*----------------------------------------------------------------------------*/
@@ -0,0 +1,119 @@
+/*! \file    PCReuse.cpp
+ *  \brief   PCReuse class definition
+ *  \author  OpenCAEPoro team
+ *  \date    Oct/16/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the OpenCAEPoro team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+// Standard header files
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+// OpenCAEPoro header files
+#include "PCReuse.hpp"
+#include "UtilProfiler.hpp"
+
+/////////////////////////////////////////////////////////////////////
+// PCReuseParam
+/////////////////////////////////////////////////////////////////////
+
+OCP_BOOL PCReuseParam::Read(const string& file)
+{
+    ifstream ifs(file);
+    if (!ifs.is_open()) return OCP_FALSE;
+
+    string line;
+    while (getline(ifs, line)) {
+        line = line.substr(0, line.find('%'));
+        istringstream iss(line);
+        string        key, eq, value;
+        if (!(iss >> key >> eq >> value) || eq != "=") continue;
+
+        char*         end = nullptr;
+        const OCP_DBL v   = strtod(value.c_str(), &end);
+        if (end == value.c_str()) continue;
+        if (key == "PC_reuse_max") {
+            maxReuse = static_cast<USI>(v);
+        } else if (key == "PC_reuse_degrade") {
+            degrade = v;
+        } else if (key == "PC_reuse_slack") {
+            slack = static_cast<USI>(v);
+        } else if (key == "print_level") {
+            printLevel = static_cast<USI>(v);
+        }
+    }
+    return OCP_TRUE;
+}
+
+/////////////////////////////////////////////////////////////////////
+// PCReuse
+/////////////////////////////////////////////////////////////////////
+
+OCP_BOOL PCReuse::IfRebuild(const OCP_USI& dim, const OCP_USI& nnz)
+{
+    if (!IfEnabled() || dim != lastDim || nnz != lastNnz) rebuild = OCP_TRUE;
+    if (record.numSolve >= param.maxReuse) rebuild = OCP_TRUE;
+    if (rebuild) {
+        lastDim = dim;
+        lastNnz = nnz;
+    }
+    return rebuild;
+}
+
+USI PCReuse::GetIterLimit() const
+{
+    if (rebuild) return 0;
+    return static_cast<USI>(param.degrade * refIter) + param.slack;
+}
+
+void PCReuse::RecordSetup(const OCP_DBL& time)
+{
+    if (record.numSolve > 0 && param.printLevel > PRINT_MIN) PrintRecord(record);
+
+    record           = Record();
+    record.setupTime = time;
+    rebuild          = OCP_FALSE;
+    refIter          = 0;
+    OCP_PROFILE_COUNT(PROF_PC_REBUILD, 1);
+}
+
+OCP_BOOL PCReuse::RecordSolve(const OCP_INT& status, const OCP_DBL& time)
+{
+    record.numSolve++;
+    record.solveTime += time;
+    if (record.numSolve > 1) OCP_PROFILE_COUNT(PROF_PC_REUSE, 1);
+    if (status < 0) {
+        // the setup is not reliable any more
+        rebuild = OCP_TRUE;
+        return record.numSolve > 1;
+    }
+    record.numIter += status;
+    if (record.numSolve == 1) {
+        refIter = status;
+    } else if (static_cast<USI>(status) > GetIterLimit()) {
+        rebuild = OCP_TRUE;
+    }
+    return OCP_FALSE;
+}
+
+void PCReuse::PrintRecord(const Record& rec) const
+{
+    cout << "Preconditioner setup used by " << rec.numSolve << " solves: setup "
+         << rec.setupTime << "ms, solve " << rec.solveTime << "ms, " << rec.numIter
+         << " iterations" << endl;
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  OpenCAEPoro team    Oct/16/2026      Create file                          */
+/*  OpenCAEPoro team    Oct/17/2026      Retry failed solves with a new setup */
+/*  OpenCAEPoro team    Oct/17/2026      Keep only the record of current setup*/
+/*----------------------------------------------------------------------------*/
@@ -272,6 +272,12 @@ void ParamOutput::InputRPTSCHED(ifstream& ifs, const string& keyword)
                 case Map_Str2Int("PCW", 3):
                     tmpBgpp->PCW = OCP_TRUE;
                     break;
+                case Map_Str2Int("VTU", 3):
+                    if (tmpBgpp == &outVTKParam.bgp) outVTKParam.useVTU = OCP_TRUE;
+                    break;
+                case Map_Str2Int("FLOAT32", 7):
+                    if (tmpBgpp == &outVTKParam.bgp) outVTKParam.useFloat32 = OCP_TRUE;
+                    break;
                 default:
                     break;
             }
@@ -287,4 +293,5 @@ void ParamOutput::InputRPTSCHED(ifstream& ifs, const string& keyword)
 /*----------------------------------------------------------------------------*/
 /*  Shizhe Li           Oct/01/2021      Create file                          */
 /*  Chensong Zhang      Oct/15/2021      Format file                          */
+/*  OpenCAEPoro team    Oct/16/2026      Add VTU options of VTKSCHED          */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
@@ -48,11 +48,15 @@ void ParamRead::ReadInputFile(const string& filename)
 /// Read parameters from a file, which is called in ReadInputFile.
 void ParamRead::ReadFile(const string& filename)
 {
-    ifstream ifs(filename, ios::in);
+    // Binary mode keeps positions of ifs equal to offsets in the mapped file
+    ifstream ifs(filename, ios::in | ios::binary);
     if (!ifs) {
         OCP_MESSAGE("Trying to open file: " << (filename));
         OCP_ABORT("Failed to open the input file!");
     }
+    // Large arrays are parsed in mapped memory, line by line if mapping fails
+    MappedFile file;
+    file.Open(filename);
 
     while (!ifs.eof()) {
         vector<string> vbuf;
@@ -97,6 +101,10 @@ void ParamRead::ReadFile(const string& filename)
                 paramRs.InputRTEMP(ifs);
                 break;
 
+            case Map_Str2Int("REORDER", 7):
+                paramRs.InputREORDER(ifs);
+                break;
+
             case Map_Str2Int("EQUALS", 6):
                 paramRs.InputEQUALS(ifs);
                 break;
@@ -116,7 +124,7 @@ void ParamRead::ReadFile(const string& filename)
             case Map_Str2Int("Ni", 2):
             case Map_Str2Int("SWATINIT", 8):
             case Map_Str2Int("THCONR", 6):
-                paramRs.InputGRID(ifs, keyword);
+                paramRs.InputGRID(ifs, keyword, file);
                 break;
 
             case Map_Str2Int("COPY", 4):
@@ -188,7 +196,7 @@ void ParamRead::ReadFile(const string& filename)
             case Map_Str2Int("PVTNUM", 6):
             case Map_Str2Int("ACTNUM", 6):
             case Map_Str2Int("ROCKNUM", 7):
-                paramRs.InputRegion(ifs, keyword);
+                paramRs.InputRegion(ifs, keyword, file);
                 break;
 
             case Map_Str2Int("INCLUDE", 7):
@@ -333,6 +341,10 @@ void ParamRead::ReadFile(const string& filename)
                 paramRs.InputRR(ifs);
                 break;
 
+            case Map_Str2Int("KVCACHE", 7):
+                paramRs.InputKVCACHE(ifs);
+                break;
+
             default: // skip non-keywords
                 break;
         }
@@ -369,4 +381,8 @@ void ParamRead::CheckParam()
 /*  Shizhe Li           Oct/01/2021      Create file                          */
 /*  Chensong Zhang      Oct/15/2021      Format file                          */
 /*  Chensong Zhang      Jan/08/2022      Test robustness for wrong keywords   */
+/*  OpenCAEPoro team    Oct/16/2026      Parse arrays in mapped files         */
+/*  OpenCAEPoro team    Oct/17/2026      Reorder active cells                 */
+/*  OpenCAEPoro team    Oct/17/2026      Add KVCACHE keyword                  */
+/*  OpenCAEPoro team    Oct/17/2026      Open input files in binary mode      */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
@@ -301,7 +301,7 @@ void ParamReservoir::InputDIMENS(ifstream& ifs)
     dimens.nx = stoi(vbuf[0]);
     dimens.ny = stoi(vbuf[1]);
     dimens.nz = stoi(vbuf[2]);
-    numGrid   = dimens.nx * dimens.ny * dimens.nz;
+    numGrid   = static_cast<OCP_USI>(dimens.nx) * dimens.ny * dimens.nz;
 
     DisplayDIMENS();
 }
@@ -326,6 +326,24 @@ void ParamReservoir::InputRTEMP(ifstream& ifs)
     cout << "RTEMP\n" << rsTemp << endl << endl;
 }
 
+/// Read data from the REORDER keyword.
+void ParamReservoir::InputREORDER(ifstream& ifs)
+{
+    vector<string> vbuf;
+    ReadLine(ifs, vbuf);
+    if (vbuf[0] == "/") return;
+
+    if (vbuf[0] == "NATURAL")
+        gridOrder = ORDER_NATURAL;
+    else if (vbuf[0] == "RCM")
+        gridOrder = ORDER_RCM;
+    else if (vbuf[0] == "HILBERT")
+        gridOrder = ORDER_HILBERT;
+    else
+        OCP_ABORT("Wrong REORDER: use NATURAL, RCM or HILBERT");
+    cout << "REORDER\n" << vbuf[0] << endl << endl;
+}
+
 /// TODO: Add Doxygen
 void ParamReservoir::InputEQUALS(ifstream& ifs)
 {
@@ -378,7 +396,7 @@ void ParamReservoir::InputEQUALS(ifstream& ifs)
 }
 
 /// TODO: Add Doxygen
-void ParamReservoir::InputGRID(ifstream& ifs, string& keyword)
+void ParamReservoir::InputGRID(ifstream& ifs, string& keyword, const MappedFile& file)
 {
     vector<OCP_DBL>* objPtr = nullptr;
 
@@ -387,6 +405,11 @@ void ParamReservoir::InputGRID(ifstream& ifs, string& keyword)
         OCP_ABORT("Unknown keyword!");
     }
 
+    if (file.IsOpen()) {
+        ReadNumbers(ifs, file, keyword, *objPtr);
+        return;
+    }
+
     vector<string> vbuf;
     while (ReadLine(ifs, vbuf)) {
         if (vbuf[0] == "/") break;
@@ -758,7 +781,9 @@ void ParamReservoir::InputTABDIMS(ifstream& ifs)
 
 /// Region information like SATNUM to decide which grid belongs to which saturation
 /// region, so corresponding saturation table will be used.
-void ParamReservoir::InputRegion(ifstream& ifs, const string& keyword)
+void ParamReservoir::InputRegion(ifstream&         ifs,
+                                 const string&     keyword,
+                                 const MappedFile& file)
 {
     Type_A_r<OCP_DBL>* ptr = &PVTNUM;
     USI                lim = NTPVT;
@@ -778,6 +803,12 @@ void ParamReservoir::InputRegion(ifstream& ifs, const string& keyword)
     vector<OCP_USI> obj;
     vector<USI>     region;
 
+    if (file.IsOpen()) {
+        ReadNumbers(ifs, file, keyword, ptr->data);
+        cout << "Number of Tables = " << lim << endl;
+        return;
+    }
+
     while (ReadLine(ifs, vbuf)) {
         if (vbuf[0] == "/") break;
 
@@ -1359,6 +1390,32 @@ void ComponentParam::InputRR(ifstream& ifs)
     cout << endl << endl;
 }
 
+/// Read data from the KVCACHE keyword, default values are kept for "*".
+void ComponentParam::InputKVCACHE(ifstream& ifs)
+{
+    flashCache = OCP_TRUE;
+
+    vector<string> vbuf;
+    ReadLine(ifs, vbuf);
+    if (!vbuf.empty() && vbuf.back() == "/") vbuf.pop_back();
+    if (vbuf.size() > cacheParam.size()) {
+        OCP_ABORT("Too many params in KVCACHE!");
+    }
+    for (USI i = 0; i < vbuf.size(); i++) {
+        if (vbuf[i] != "*") cacheParam[i] = stod(vbuf[i]);
+    }
+    for (USI i = 0; i < 3; i++) {
+        if (cacheParam[i] <= 0) OCP_ABORT("Widths in KVCACHE must be positive!");
+    }
+    if (cacheParam[3] < 0) OCP_ABORT("Max entries in KVCACHE must not be negative!");
+    // no entries means no cache
+    if (cacheParam[3] < 1) flashCache = OCP_FALSE;
+
+    OCP_FUNCNAME;
+    for (const auto& v : cacheParam) cout << v << "   ";
+    cout << endl << endl;
+}
+
 /*----------------------------------------------------------------------------*/
 /*  Brief Change History of This File                                         */
 /*----------------------------------------------------------------------------*/
@@ -1367,4 +1424,10 @@ void ComponentParam::InputRR(ifstream& ifs)
 /*  Shizhe Li           Oct/01/2021      Create file                          */
 /*  Chensong Zhang      Oct/15/2021      Format file                          */
 /*  Chensong Zhang      Jan/09/2022      Update output and Doxygen            */
+/*  OpenCAEPoro team    Oct/16/2026      Parse arrays in mapped files         */
+/*  OpenCAEPoro team    Oct/17/2026      Reorder active cells                 */
+/*  OpenCAEPoro team    Oct/17/2026      Add 64-bit global index option       */
+/*  OpenCAEPoro team    Oct/17/2026      Add KVCACHE keyword                  */
+/*  OpenCAEPoro team    Oct/17/2026      Report wrong numbers of keywords     */
+/*  OpenCAEPoro team    Oct/17/2026      Turn off caches of no entries        */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
@@ -0,0 +1,324 @@
+/*! \file    Partition.cpp
+ *  \brief   Partition class definition
+ *  \author  OpenCAEPoro team
+ *  \date    Oct/17/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the OpenCAEPoro team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+// Standard header files
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <numeric>
+
+#ifdef WITH_METIS
+#include <metis.h>
+#endif
+
+// OpenCAEPoro header files
+#include "Partition.hpp"
+
+void Partition::Setup(Grid& myGrid, const AllWells& wells)
+{
+    OCP_FUNCNAME;
+
+    numDomain = GetMPISize();
+    myDomain  = GetMPIRank();
+    numAct    = myGrid.activeGridNum;
+    numOwned  = numAct;
+    numLocal  = numAct;
+    if (numDomain == 1) return;
+
+    if (numAct < numDomain) {
+        OCP_ABORT("Number of processes is larger than number of active cells!");
+    }
+
+    // Active cells perforated by each well
+    vector<vector<OCP_USI>> perfCell = wells.GetWellPerfGrid(myGrid);
+    for (auto& cells : perfCell) {
+        USI k = 0;
+        for (const auto& n : cells) {
+            if (myGrid.map_All2Act[n].IsAct()) {
+                cells[k++] = myGrid.map_All2Act[n].GetId();
+            }
+        }
+        cells.resize(k);
+    }
+
+    BuildGraph(myGrid, perfCell);
+    PartGraph(myGrid);
+    AssignWell(perfCell);
+    PrintInfo();
+    SetupLocal(myGrid);
+}
+
+void Partition::BuildGraph(const Grid& myGrid, const vector<vector<OCP_USI>>& perfCell)
+{
+    xadj.assign(numAct + 1, 0);
+    for (OCP_USI a = 0; a < numAct; a++) {
+        for (const GPair& g : myGrid.gNeighbor[myGrid.map_Act2All[a]]) {
+            if (myGrid.map_All2Act[g.id].IsAct()) xadj[a + 1]++;
+        }
+    }
+    for (OCP_USI a = 0; a < numAct; a++) xadj[a + 1] += xadj[a];
+    adjncy.resize(xadj[numAct]);
+    adjwgt.resize(xadj[numAct]);
+
+    // Strength of a connection: harmonic mean of areas of intersecting faces
+    vector<OCP_DBL> strength(xadj[numAct], 0);
+    OCP_DBL         maxStrength = 0;
+    for (OCP_USI a = 0; a < numAct; a++) {
+        OCP_USI k = xadj[a];
+        for (const GPair& g : myGrid.gNeighbor[myGrid.map_Act2All[a]]) {
+            if (!myGrid.map_All2Act[g.id].IsAct()) continue;
+            adjncy[k] = myGrid.map_All2Act[g.id].GetId();
+            if (g.areaB > 0 && g.areaE > 0) {
+                strength[k] = g.areaB * g.areaE / (g.areaB + g.areaE);
+            }
+            maxStrength = max(maxStrength, strength[k]);
+            k++;
+        }
+    }
+    if (maxStrength <= 0) maxStrength = 1;
+    for (OCP_USI k = 0; k < xadj[numAct]; k++) {
+        adjwgt[k] = 1 + static_cast<OCP_USI>(round(99 * strength[k] / maxStrength));
+    }
+
+    // Cost of a cell: num of blocks in its row of Jacobian and its perforations
+    vwgt.resize(numAct);
+    for (OCP_USI a = 0; a < numAct; a++) vwgt[a] = xadj[a + 1] - xadj[a] + 1;
+    for (const auto& cells : perfCell) {
+        for (const auto& a : cells) vwgt[a]++;
+    }
+}
+
+void Partition::PartGraph(const Grid& myGrid)
+{
+    domain.assign(numAct, 0);
+
+    // the graph is partitioned in the first process only, then broadcast
+    if (myDomain == 0) {
+#ifdef WITH_METIS
+        (void)myGrid;
+        idx_t nvtxs  = numAct;
+        idx_t ncon   = 1;
+        idx_t nparts = numDomain;
+        idx_t objval = 0;
+
+        vector<idx_t> mxadj(xadj.begin(), xadj.end());
+        vector<idx_t> madjncy(adjncy.begin(), adjncy.end());
+        vector<idx_t> madjwgt(adjwgt.begin(), adjwgt.end());
+        vector<idx_t> mvwgt(vwgt.begin(), vwgt.end());
+        vector<idx_t> part(numAct, 0);
+
+        idx_t options[METIS_NOPTIONS];
+        METIS_SetDefaultOptions(options);
+        options[METIS_OPTION_SEED] = 1;
+
+        const int ret = METIS_PartGraphKway(&nvtxs, &ncon, mxadj.data(),
+                                            madjncy.data(), mvwgt.data(), nullptr,
+                                            madjwgt.data(), &nparts, nullptr, nullptr,
+                                            options, &objval, part.data());
+        if (ret != METIS_OK) OCP_ABORT("METIS failed to partition active cells!");
+        for (OCP_USI a = 0; a < numAct; a++) domain[a] = part[a];
+#else
+        // Blocks of vertical columns of cells with balanced cost, as connections in
+        // the vertical direction are usually the strongest ones of layered reservoirs
+        const OCP_USI   nxy = static_cast<OCP_USI>(myGrid.nx) * myGrid.ny;
+        vector<OCP_USI> order(numAct);
+        iota(order.begin(), order.end(), 0);
+        stable_sort(order.begin(), order.end(), [&myGrid, nxy](OCP_USI a, OCP_USI b) {
+            return myGrid.map_Act2All[a] % nxy < myGrid.map_Act2All[b] % nxy;
+        });
+        OCP_ULL total = 0;
+        for (const auto& w : vwgt) total += w;
+        OCP_ULL acc = 0;
+        USI     d   = 0;
+        for (OCP_USI k = 0; k < numAct; k++) {
+            const OCP_USI a = order[k];
+            // a new column starts
+            if (k == 0 || myGrid.map_Act2All[a] % nxy !=
+                              myGrid.map_Act2All[order[k - 1]] % nxy) {
+                d = min<OCP_ULL>(numDomain - 1, acc * numDomain / total);
+            }
+            domain[a] = d;
+            acc += vwgt[a];
+        }
+#endif
+    }
+
+#ifdef USE_MPI
+    MPI_Bcast(domain.data(), numAct, MPI_UNSIGNED, 0, MPI_COMM_WORLD);
+#endif
+}
+
+void Partition::AssignWell(const vector<vector<OCP_USI>>& perfCell)
+{
+    const USI numWell = perfCell.size();
+
+    // Wells sharing perforated cells are united into groups
+    vector<USI> root(numWell);
+    iota(root.begin(), root.end(), 0);
+    auto find = [&root](USI w) {
+        while (root[w] != w) w = root[w] = root[root[w]];
+        return w;
+    };
+    vector<OCP_INT> cellWell(numAct, -1);
+    for (USI w = 0; w < numWell; w++) {
+        for (const auto& a : perfCell[w]) {
+            if (cellWell[a] < 0) {
+                cellWell[a] = w;
+            } else {
+                root[find(w)] = find(cellWell[a]);
+            }
+        }
+    }
+
+    // A group belongs to the domain holding most of its perforated cells
+    vector<OCP_USI> count(numWell * numDomain, 0);
+    for (USI w = 0; w < numWell; w++) {
+        for (const auto& a : perfCell[w]) count[find(w) * numDomain + domain[a]]++;
+    }
+    for (USI w = 0; w < numWell; w++) {
+        const auto begin = count.begin() + find(w) * numDomain;
+        const USI  d     = max_element(begin, begin + numDomain) - begin;
+        for (const auto& a : perfCell[w]) domain[a] = d;
+    }
+}
+
+void Partition::SetupLocal(Grid& myGrid)
+{
+    // Owned cells and then ghost cells, both in increasing global order
+    vector<OCP_USI>  local;
+    vector<OCP_BOOL> ifGhost(numAct, OCP_FALSE);
+    for (OCP_USI a = 0; a < numAct; a++) {
+        if (domain[a] != myDomain) continue;
+        local.push_back(a);
+        for (OCP_USI k = xadj[a]; k < xadj[a + 1]; k++) {
+            if (domain[adjncy[k]] != myDomain) ifGhost[adjncy[k]] = OCP_TRUE;
+        }
+    }
+    numOwned = local.size();
+    for (OCP_USI a = 0; a < numAct; a++) {
+        if (ifGhost[a]) local.push_back(a);
+    }
+    numLocal = local.size();
+
+    // Lists are in increasing global order on both sides, so they match without
+    // communication
+    vector<vector<OCP_USI>> sendTo(numDomain);
+    vector<vector<OCP_USI>> recvFrom(numDomain);
+    for (OCP_USI n = 0; n < numOwned; n++) {
+        const OCP_USI a = local[n];
+        for (OCP_USI k = xadj[a]; k < xadj[a + 1]; k++) {
+            const USI d = domain[adjncy[k]];
+            if (d != myDomain && (sendTo[d].empty() || sendTo[d].back() != n)) {
+                sendTo[d].push_back(n);
+            }
+        }
+    }
+    for (OCP_USI n = numOwned; n < numLocal; n++) {
+        recvFrom[domain[local[n]]].push_back(n);
+    }
+
+    nbDomain.clear();
+    sendBulk.clear();
+    recvBulk.clear();
+    for (USI d = 0; d < numDomain; d++) {
+        if (recvFrom[d].empty()) continue;
+        nbDomain.push_back(d);
+        sendBulk.push_back(move(sendTo[d]));
+        recvBulk.push_back(move(recvFrom[d]));
+    }
+    sendBuf.resize(nbDomain.size());
+    recvBuf.resize(nbDomain.size());
+
+    myGrid.RestrictActiveGrid(local, numOwned);
+}
+
+void Partition::ExchangeGhost(void* val, const size_t& size) const
+{
+    ExchangeGhost({{static_cast<char*>(val), size}});
+}
+
+void Partition::ExchangeGhost(const vector<pair<char*, size_t>>& arrays) const
+{
+#ifdef USE_MPI
+    if (numDomain == 1) return;
+
+    size_t size = 0;
+    for (const auto& a : arrays) size += a.second;
+
+    const USI           nnb = nbDomain.size();
+    vector<MPI_Request> req(2 * nnb);
+    for (USI i = 0; i < nnb; i++) {
+        recvBuf[i].resize(recvBulk[i].size() * size);
+        MPI_Irecv(recvBuf[i].data(), recvBuf[i].size(), MPI_BYTE, nbDomain[i], 0,
+                  MPI_COMM_WORLD, &req[i]);
+    }
+    for (USI i = 0; i < nnb; i++) {
+        sendBuf[i].resize(sendBulk[i].size() * size);
+        char* dst = sendBuf[i].data();
+        for (const auto& n : sendBulk[i]) {
+            for (const auto& a : arrays) {
+                memcpy(dst, a.first + n * a.second, a.second);
+                dst += a.second;
+            }
+        }
+        MPI_Isend(sendBuf[i].data(), sendBuf[i].size(), MPI_BYTE, nbDomain[i], 0,
+                  MPI_COMM_WORLD, &req[nnb + i]);
+    }
+    MPI_Waitall(2 * nnb, req.data(), MPI_STATUSES_IGNORE);
+
+    for (USI i = 0; i < nnb; i++) {
+        const char* src = recvBuf[i].data();
+        for (const auto& n : recvBulk[i]) {
+            for (const auto& a : arrays) {
+                memcpy(a.first + n * a.second, src, a.second);
+                src += a.second;
+            }
+        }
+    }
+#else
+    // Only one domain, there is no ghost cell
+    (void)arrays;
+#endif
+}
+
+void Partition::PrintInfo() const
+{
+    if (myDomain != 0) return;
+
+    vector<OCP_ULL> cost(numDomain, 0);
+    for (OCP_USI a = 0; a < numAct; a++) cost[domain[a]] += vwgt[a];
+    OCP_ULL edgeCut = 0;
+    for (OCP_USI a = 0; a < numAct; a++) {
+        for (OCP_USI k = xadj[a]; k < xadj[a + 1]; k++) {
+            if (domain[adjncy[k]] != domain[a]) edgeCut++;
+        }
+    }
+    const OCP_ULL maxCost = *max_element(cost.begin(), cost.end());
+    const OCP_ULL minCost = *min_element(cost.begin(), cost.end());
+    OCP_ULL       total   = 0;
+    for (const auto& c : cost) total += c;
+
+    cout << "Partition of active cells:" << endl
+         << "  Number of domains:     " << numDomain << endl
+         << "  Cut connections:       " << edgeCut / 2 << endl
+         << "  Cost per domain:       " << minCost << " ~ " << maxCost << endl
+         << "  Imbalance:             "
+         << static_cast<OCP_DBL>(maxCost) * numDomain / total << endl;
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  OpenCAEPoro team    Oct/17/2026      Create file                          */
+/*----------------------------------------------------------------------------*/
@@ -30,11 +30,13 @@ void Reservoir::SetupIsoT()
     OCP_FUNCNAME;
 
     grid.SetupIsoT();
+    partition.Setup(grid, allWells);
     bulk.SetupIsoT(grid);
     conn.SetupIsoT(grid, bulk);
     allWells.Setup(grid, bulk);
 
     bulk.SetupOptionalFeatures(grid, optFeatures);
+    bulk.SetupFlashThreads();
 }
 
 void Reservoir::SetupT()
@@ -43,6 +45,7 @@ void Reservoir::SetupT()
     bulk.SetupT(grid);
     conn.SetupIsoT(grid, bulk);
     allWells.Setup(grid, bulk);
+    bulk.SetupFlashThreads();
 }
 
 void Reservoir::ApplyControl(const USI& i)
@@ -138,6 +141,22 @@ void Reservoir::PrintSolFIM(const string& outfile) const
     outu.close();
 }
 
+void Reservoir::WriteRestart(ofstream& out) const
+{
+    bulk.WriteRestart(out);
+    conn.WriteRestart(out);
+    allWells.WriteRestart(out);
+    optFeatures.WriteRestart(out);
+}
+
+void Reservoir::ReadRestart(ifstream& in)
+{
+    bulk.ReadRestart(in);
+    conn.ReadRestart(in);
+    allWells.ReadRestart(in);
+    optFeatures.ReadRestart(in);
+}
+
 /*----------------------------------------------------------------------------*/
 /*  Brief Change History of This File                                         */
 /*----------------------------------------------------------------------------*/
@@ -145,4 +164,6 @@ void Reservoir::PrintSolFIM(const string& outfile) const
 /*----------------------------------------------------------------------------*/
 /*  Shizhe Li           Oct/01/2021      Create file                          */
 /*  Chensong Zhang      Oct/15/2021      Format file                          */
+/*  OpenCAEPoro team    Oct/16/2026      Add restart                          */
+/*  OpenCAEPoro team    Oct/17/2026      Distribute FIM among MPI processes   */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
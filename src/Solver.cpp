@@ -9,6 +9,10 @@
  *-----------------------------------------------------------------------------------
  */
 
+// Standard header files
+#include <cstdio>
+#include <cstring>
+
 // OpenCAEPoro header files
 #include "Solver.hpp"
 
@@ -64,7 +68,7 @@ void Solver::RunSimulation(Reservoir& rs, OCPControl& ctrl, OCPOutput& output)
     timer.Start();
     output.PrintInfoSched(rs, ctrl, timer.Stop());
     USI numTSteps = ctrl.GetNumTSteps();
-    for (USI d = 0; d < numTSteps - 1; d++) {
+    for (USI d = ctrl.GetStartTStep(); d < numTSteps - 1; d++) {
         rs.ApplyControl(d);
         ctrl.ApplyControl(d, rs);
         while (!ctrl.IsCriticalTime(d + 1)) {
@@ -76,12 +80,81 @@ void Solver::RunSimulation(Reservoir& rs, OCPControl& ctrl, OCPOutput& output)
             }
         }
         output.PrintInfoSched(rs, ctrl, timer.Stop());
+        if (!ctrl.GetCheckpointFile().empty()) WriteRestart(rs, ctrl);
         // rs.allWells.ShowWellStatus(rs.bulk);
     }
     rs.OutInfoFinal();
     ctrl.RecordTotalTime(timer.Stop() / 1000);
 }
 
+/// Restart files are written at critical times, when states at current and last time
+/// step are identical, so a restarted run repeats the time steps of the original one.
+void Solver::WriteRestart(const Reservoir& rs, const OCPControl& ctrl) const
+{
+    // The last restart file is kept until the new one is complete
+    const string& file = ctrl.GetCheckpointFile();
+    const string  tmp  = file + ".tmp";
+    ofstream      out(tmp, ios::binary);
+    if (!out.is_open()) {
+        OCP_WARNING("Can not open " + tmp);
+        return;
+    }
+    out.write(RESTART_MAGIC, sizeof(RESTART_MAGIC));
+    WriteBinary(out, RESTART_VERSION);
+    WriteBinary(out, OCPModel);
+    WriteBinary(out, ctrl.GetMethod());
+    WriteBinary(out, rs.grid.GetGridOrder());
+    ctrl.WriteRestart(out);
+    rs.WriteRestart(out);
+    out.close();
+    if (out.fail()) {
+        OCP_WARNING("Can not write " + tmp);
+        return;
+    }
+
+#ifdef _WIN32
+    // rename does not replace an existing file on Windows
+    remove(file.c_str());
+#endif
+    if (rename(tmp.c_str(), file.c_str()) != 0) {
+        OCP_WARNING("Can not write " + file);
+    }
+}
+
+void Solver::ReadRestart(Reservoir& rs, OCPControl& ctrl) const
+{
+    const string& file = ctrl.GetRestartFile();
+    ifstream      in(file, ios::binary);
+    if (!in.is_open()) OCP_ABORT("Can not open " + file);
+
+    char magic[sizeof(RESTART_MAGIC)];
+    in.read(magic, sizeof(magic));
+    if (!in || memcmp(magic, RESTART_MAGIC, sizeof(magic)) != 0) {
+        OCP_ABORT(file + " is not a restart file!");
+    }
+    USI version, model, method, gridOrder;
+    ReadBinary(in, version);
+    if (version != RESTART_VERSION) OCP_ABORT("Wrong version of restart file!");
+    ReadBinary(in, model);
+    ReadBinary(in, method);
+    ReadBinary(in, gridOrder);
+    if (model != OCPModel || method != ctrl.GetMethod()) {
+        OCP_ABORT("Restart file does not match the model!");
+    }
+    // Bulk states are stored in the ordering of active cells
+    if (gridOrder != rs.grid.GetGridOrder()) {
+        OCP_ABORT("Restart file does not match the REORDER of active cells!");
+    }
+    ctrl.ReadRestart(in);
+    rs.ReadRestart(in);
+    OCPProfiler::Instance().ResetIters(ctrl.GetNRiterT(), ctrl.GetLSiterT());
+
+    if (ctrl.printLevel >= PRINT_MIN) {
+        cout << "Restart from " << file << " at " << ctrl.GetCurTime() << " Days"
+             << endl;
+    }
+}
+
 /// This is one time step of dynamic simulation in an abstract setting.
 void Solver::GoOneStep(Reservoir& rs, OCPControl& ctrl)
 {
@@ -159,4 +232,7 @@ void Solver::GoOneStepT(Reservoir& rs, OCPControl& ctrl)
 /*  Author              Date             Actions                              */
 /*----------------------------------------------------------------------------*/
 /*  Shizhe Li           Oct/21/2021      Create file                          */
+/*  OpenCAEPoro team    Oct/16/2026      Add restart                          */
+/*  OpenCAEPoro team    Oct/17/2026      Record grid order in restart files   */
+/*  OpenCAEPoro team    Oct/17/2026      Replace checkpoint files on Windows  */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
@@ -0,0 +1,347 @@
+/*! \file    SparseMat.cpp
+ *  \brief   BSRMatrix and BlockILU0 class definition
+ *  \author  OpenCAEPoro team
+ *  \date    Oct/16/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the OpenCAEPoro team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+// Standard header files
+#include <algorithm>
+#include <cmath>
+
+// OpenCAEPoro header files
+#include "SparseMat.hpp"
+#include "UtilError.hpp"
+#include "UtilOpenMP.hpp"
+#include "UtilProfiler.hpp"
+
+OCP_BOOL BlockInverse(const USI& nb, OCP_DBL* A)
+{
+    if (nb == 1) {
+        if (A[0] == 0) return OCP_FALSE;
+        A[0] = 1 / A[0];
+        return OCP_TRUE;
+    }
+
+    // record the pivoting of columns, which are swapped back at the end
+    USI  pivBuf[32];
+    USI* piv = pivBuf;
+    if (nb > 32) piv = new USI[nb];
+    OCP_BOOL flag = OCP_TRUE;
+    for (USI k = 0; k < nb; k++) {
+        USI     p    = k;
+        OCP_DBL pmax = fabs(A[k * nb + k]);
+        for (USI i = k + 1; i < nb; i++) {
+            if (fabs(A[i * nb + k]) > pmax) {
+                pmax = fabs(A[i * nb + k]);
+                p    = i;
+            }
+        }
+        piv[k] = p;
+        if (pmax == 0) {
+            flag = OCP_FALSE;
+            break;
+        }
+        if (p != k) {
+            for (USI j = 0; j < nb; j++) swap(A[k * nb + j], A[p * nb + j]);
+        }
+
+        const OCP_DBL d = 1 / A[k * nb + k];
+        A[k * nb + k]   = 1;
+        for (USI j = 0; j < nb; j++) A[k * nb + j] *= d;
+        for (USI i = 0; i < nb; i++) {
+            if (i == k) continue;
+            const OCP_DBL f = A[i * nb + k];
+            A[i * nb + k]   = 0;
+            for (USI j = 0; j < nb; j++) A[i * nb + j] -= f * A[k * nb + j];
+        }
+    }
+    if (flag) {
+        for (USI k = nb; k-- > 0;) {
+            if (piv[k] == k) continue;
+            for (USI i = 0; i < nb; i++) swap(A[i * nb + k], A[i * nb + piv[k]]);
+        }
+    }
+    if (piv != pivBuf) delete[] piv;
+    return flag;
+}
+
+void BlockMult(const USI& nb, const OCP_DBL* A, const OCP_DBL* B, OCP_DBL* C)
+{
+    for (USI i = 0; i < nb; i++) {
+        OCP_DBL* c = C + i * nb;
+        fill(c, c + nb, 0.0);
+        for (USI k = 0; k < nb; k++) {
+            const OCP_DBL  a = A[i * nb + k];
+            const OCP_DBL* b = B + k * nb;
+            for (USI j = 0; j < nb; j++) c[j] += a * b[j];
+        }
+    }
+}
+
+void BlockMatVec(const USI& nb, const OCP_DBL* A, const OCP_DBL* x, OCP_DBL* y)
+{
+    for (USI i = 0; i < nb; i++) {
+        OCP_DBL s = 0;
+        for (USI j = 0; j < nb; j++) s += A[i * nb + j] * x[j];
+        y[i] = s;
+    }
+}
+
+/// y += A * x for a small nb*nb matrix.
+static inline void
+BlockMatVecAdd(const USI& nb, const OCP_DBL* A, const OCP_DBL* x, OCP_DBL* y)
+{
+    for (USI i = 0; i < nb; i++) {
+        OCP_DBL s = 0;
+        for (USI j = 0; j < nb; j++) s += A[i * nb + j] * x[j];
+        y[i] += s;
+    }
+}
+
+/// y -= A * x for a small nb*nb matrix.
+static inline void
+BlockMatVecSub(const USI& nb, const OCP_DBL* A, const OCP_DBL* x, OCP_DBL* y)
+{
+    for (USI i = 0; i < nb; i++) {
+        OCP_DBL s = 0;
+        for (USI j = 0; j < nb; j++) s += A[i * nb + j] * x[j];
+        y[i] -= s;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////
+// BSRMatrix
+/////////////////////////////////////////////////////////////////////
+
+void BSRMatrix::Allocate(const OCP_USI& maxRow,
+                         const OCP_USI& maxNnz,
+                         const USI&     blockDim)
+{
+    nrow = 0;
+    nb   = blockDim;
+    nb2  = nb * nb;
+    rowPtr.assign(maxRow + 1, 0);
+    colIdx.resize(maxNnz);
+    // the address of values is kept, since it may be filled by LinearSystem directly
+    val.resize(maxNnz * nb2);
+}
+
+void BSRMatrix::CopyPattern(const BSRMatrix& src)
+{
+    nrow = src.nrow;
+    nb   = src.nb;
+    nb2  = src.nb2;
+    rowPtr.resize(max(rowPtr.size(), src.rowPtr.size()));
+    copy(src.rowPtr.begin(), src.rowPtr.begin() + nrow + 1, rowPtr.begin());
+    colIdx.resize(max(colIdx.size(), src.colIdx.size()));
+    copy(src.colIdx.begin(), src.colIdx.begin() + src.GetNnz(), colIdx.begin());
+    val.resize(max(val.size(), src.val.size()));
+}
+
+void BSRMatrix::SpMV(const OCP_DBL* x, OCP_DBL* y) const
+{
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (OCP_USI i = 0; i < nrow; i++) {
+        OCP_DBL* yi = y + i * nb;
+        fill(yi, yi + nb, 0.0);
+        for (OCP_USI k = rowPtr[i]; k < rowPtr[i + 1]; k++) {
+            BlockMatVecAdd(nb, &val[k * nb2], x + colIdx[k] * nb, yi);
+        }
+    }
+}
+
+void BSRMatrix::Residual(const OCP_DBL* b, const OCP_DBL* x, OCP_DBL* r) const
+{
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (OCP_USI i = 0; i < nrow; i++) {
+        OCP_DBL* ri = r + i * nb;
+        copy(b + i * nb, b + i * nb + nb, ri);
+        for (OCP_USI k = rowPtr[i]; k < rowPtr[i + 1]; k++) {
+            BlockMatVecSub(nb, &val[k * nb2], x + colIdx[k] * nb, ri);
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////
+// BlockILU0
+/////////////////////////////////////////////////////////////////////
+
+OCP_BOOL BlockILU0::Setup(const BSRMatrix& A)
+{
+    Symbolic(A);
+
+    const USI nt = GetMaxThreads();
+    tmp.resize(nt * nb2);
+
+    OCP_BOOL  flag   = OCP_TRUE;
+    const USI nLevel = lvPtr.size() - 1;
+    OCP_DBL*  lu     = luVal.data();
+#ifdef USE_OPENMP
+#pragma omp parallel
+#endif
+    {
+        OCP_DBL* blk = &tmp[GetThreadId() * nb2];
+        for (USI l = 0; l < nLevel; l++) {
+#ifdef USE_OPENMP
+#pragma omp for schedule(static)
+#endif
+            for (OCP_USI m = lvPtr[l]; m < lvPtr[l + 1]; m++) {
+                const OCP_USI i = lvRow[m];
+                for (OCP_USI p = rowPtr[i]; p < rowPtr[i + 1]; p++) {
+                    copy(&A.val[perm[p] * nb2], &A.val[perm[p] * nb2] + nb2,
+                         lu + p * nb2);
+                }
+                for (OCP_USI p = rowPtr[i]; p < diagPos[i]; p++) {
+                    // L_ik = A_ik * U_kk^{-1}
+                    const OCP_USI k = luCol[p];
+                    BlockMult(nb, lu + p * nb2, lu + diagPos[k] * nb2, blk);
+                    copy(blk, blk + nb2, lu + p * nb2);
+                    // A_ij -= L_ik * U_kj for j > k in the pattern of row i
+                    OCP_USI s = p + 1;
+                    for (OCP_USI q = diagPos[k] + 1; q < rowPtr[k + 1]; q++) {
+                        const OCP_USI j = luCol[q];
+                        while (s < rowPtr[i + 1] && luCol[s] < j) s++;
+                        if (s == rowPtr[i + 1]) break;
+                        if (luCol[s] != j) continue;
+                        BlockMult(nb, lu + p * nb2, lu + q * nb2, blk);
+                        for (USI e = 0; e < nb2; e++) lu[s * nb2 + e] -= blk[e];
+                    }
+                }
+                if (!BlockInverse(nb, lu + diagPos[i] * nb2)) {
+#ifdef USE_OPENMP
+#pragma omp atomic write
+#endif
+                    flag = OCP_FALSE;
+                }
+            }
+        }
+    }
+    return flag;
+}
+
+void BlockILU0::Apply(const OCP_DBL* r, OCP_DBL* z) const
+{
+    const OCP_DBL* lu      = luVal.data();
+    const USI      nLevel  = lvPtr.size() - 1;
+    const USI      nuLevel = ulvPtr.size() - 1;
+#ifdef USE_OPENMP
+#pragma omp parallel
+#endif
+    {
+        OCP_DBL* t = &tmp[GetThreadId() * nb2];
+        // forward substitution: L * y = r
+        for (USI l = 0; l < nLevel; l++) {
+#ifdef USE_OPENMP
+#pragma omp for schedule(static)
+#endif
+            for (OCP_USI m = lvPtr[l]; m < lvPtr[l + 1]; m++) {
+                const OCP_USI i  = lvRow[m];
+                OCP_DBL*      zi = z + i * nb;
+                copy(r + i * nb, r + i * nb + nb, zi);
+                for (OCP_USI p = rowPtr[i]; p < diagPos[i]; p++) {
+                    BlockMatVecSub(nb, lu + p * nb2, z + luCol[p] * nb, zi);
+                }
+            }
+        }
+        // backward substitution: U * z = y
+        for (USI l = 0; l < nuLevel; l++) {
+#ifdef USE_OPENMP
+#pragma omp for schedule(static)
+#endif
+            for (OCP_USI m = ulvPtr[l]; m < ulvPtr[l + 1]; m++) {
+                const OCP_USI i  = ulvRow[m];
+                OCP_DBL*      zi = z + i * nb;
+                for (OCP_USI p = diagPos[i] + 1; p < rowPtr[i + 1]; p++) {
+                    BlockMatVecSub(nb, lu + p * nb2, z + luCol[p] * nb, zi);
+                }
+                BlockMatVec(nb, lu + diagPos[i] * nb2, zi, t);
+                copy(t, t + nb, zi);
+            }
+        }
+    }
+}
+
+void BlockILU0::Symbolic(const BSRMatrix& A)
+{
+    const OCP_USI nnz = A.GetNnz();
+    if (A.nrow == nrow && A.nb == nb && colIdx.size() == nnz &&
+        equal(rowPtr.begin(), rowPtr.end(), A.rowPtr.begin()) &&
+        equal(colIdx.begin(), colIdx.end(), A.colIdx.begin())) {
+        return;
+    }
+
+    nrow = A.nrow;
+    nb   = A.nb;
+    nb2  = A.nb2;
+    rowPtr.assign(A.rowPtr.begin(), A.rowPtr.begin() + nrow + 1);
+    colIdx.assign(A.colIdx.begin(), A.colIdx.begin() + nnz);
+
+    perm.resize(nnz);
+    luCol.resize(nnz);
+    diagPos.resize(nrow);
+    luVal.resize(nnz * nb2);
+    for (OCP_USI i = 0; i < nrow; i++) {
+        const OCP_USI bId = rowPtr[i];
+        const OCP_USI eId = rowPtr[i + 1];
+        for (OCP_USI p = bId; p < eId; p++) perm[p] = p;
+        sort(perm.begin() + bId, perm.begin() + eId,
+             [this](const OCP_USI& a, const OCP_USI& b) {
+                 return colIdx[a] < colIdx[b];
+             });
+        diagPos[i] = eId;
+        for (OCP_USI p = bId; p < eId; p++) {
+            luCol[p] = colIdx[perm[p]];
+            if (luCol[p] == i) diagPos[i] = p;
+        }
+        if (diagPos[i] == eId) {
+            OCP_ABORT("Missing diagonal block in row " + to_string(i) + "!");
+        }
+    }
+
+    BuildLevel(OCP_TRUE, lvPtr, lvRow);
+    BuildLevel(OCP_FALSE, ulvPtr, ulvRow);
+}
+
+void BlockILU0::BuildLevel(const OCP_BOOL&  lower,
+                           vector<OCP_USI>& levelPtr,
+                           vector<OCP_USI>& levelRow) const
+{
+    // level of a row is one more than the max level of rows it depends on
+    vector<OCP_USI> level(nrow, 0);
+    OCP_USI         nLevel = 0;
+    for (OCP_USI n = 0; n < nrow; n++) {
+        const OCP_USI i  = lower ? n : nrow - 1 - n;
+        const OCP_USI bp = lower ? rowPtr[i] : diagPos[i] + 1;
+        const OCP_USI ep = lower ? diagPos[i] : rowPtr[i + 1];
+        OCP_USI       lv = 0;
+        for (OCP_USI p = bp; p < ep; p++) lv = max(lv, level[luCol[p]] + 1);
+        level[i] = lv;
+        nLevel   = max(nLevel, lv + 1);
+    }
+
+    // rows of a level are kept in increasing order
+    levelPtr.assign(nLevel + 1, 0);
+    for (OCP_USI i = 0; i < nrow; i++) levelPtr[level[i] + 1]++;
+    for (OCP_USI l = 0; l < nLevel; l++) levelPtr[l + 1] += levelPtr[l];
+    levelRow.resize(nrow);
+    vector<OCP_USI> fill(levelPtr.begin(), levelPtr.end() - 1);
+    for (OCP_USI i = 0; i < nrow; i++) levelRow[fill[level[i]]++] = i;
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  OpenCAEPoro team    Oct/16/2026      Create file                          */
+/*  OpenCAEPoro team    Oct/17/2026      Time PC setup apart from Krylov      */
+/*----------------------------------------------------------------------------*/
@@ -15,6 +15,7 @@ void T_FIM::Setup(Reservoir& rs, LinearSystem& ls, const OCPControl& ctrl)
 {
     AllocateReservoir(rs);
     AllocateLinearSystem(ls, rs, ctrl);
+    ls.SetFrozenPattern(OCP_TRUE);
 }
 
 void T_FIM::InitReservoir(Reservoir& rs) const
@@ -44,6 +45,7 @@ void T_FIM::AssembleMat(LinearSystem&    ls,
                         const OCP_DBL&   t,
                         const OCP_DBL&   dt) const
 {
+    ls.CheckPattern(rs.allWells.GetOpenWellSetId());
     AssembleMatBulks(ls, rs, t, dt);
     AssembleMatWells(ls, rs, dt);
     ls.AssembleRhsCopy(rs.bulk.res.resAbs);
@@ -57,6 +59,8 @@ void T_FIM::SolveLinearSystem(LinearSystem& ls, Reservoir& rs, OCPControl& ctrl)
 
     // Assemble external linear solver with internal A and b
     ls.AssembleMatLinearSolver();
+    // Capture the linear system for offline benchmarks if required
+    ctrl.CaptureLinearSystem(ls);
     // Solve linear system
     GetWallTime Timer;
     Timer.Start();
@@ -113,6 +117,9 @@ OCP_BOOL T_FIM::UpdateProperty(Reservoir& rs, OCPControl& ctrl)
 
 OCP_BOOL T_FIM::FinishNR(Reservoir& rs, OCPControl& ctrl)
 {
+    // Record the residual for time step control
+    ctrl.RecordNRResidual(rs.bulk.res);
+
     OCP_USI dSn;
 
     const OCP_DBL NRdSmax = rs.GetNRdSmax(dSn);
@@ -140,8 +147,8 @@ OCP_BOOL T_FIM::FinishNR(Reservoir& rs, OCPControl& ctrl)
             return OCP_TRUE;
         }
 
-    } else if (ctrl.iterNR >= ctrl.ctrlNR.maxNRiter) {
-        ctrl.current_dt *= ctrl.ctrlTime.cutFacNR;
+    } else if (ctrl.iterNR >= ctrl.ctrlNR.maxNRiter || ctrl.IfNRStalled()) {
+        ctrl.CutTimeStep(ctrl.ctrlTime.cutFacNR, OCP_TRUE);
         ResetToLastTimeStep(rs, ctrl);
         cout << "### WARNING: NR not fully converged! Cut time step size and repeat!  "
                 "current dt = "
@@ -163,133 +170,78 @@ void T_FIM::FinishStep(Reservoir& rs, OCPControl& ctrl)
 
 void T_FIM::AllocateReservoir(Reservoir& rs)
 {
-    Bulk&         bk = rs.bulk;
-    const OCP_USI nb = bk.numBulk;
-    const USI     np = bk.numPhase;
-    const USI     nc = bk.numCom;
+    Bulk&          bk    = rs.bulk;
+    OCPStateArena& state = bk.stateArena;
+    const OCP_USI  nb    = bk.numBulk;
+    const USI      np    = bk.numPhase;
+    const USI      nc    = bk.numCom;
 
     // Rock
-    bk.poro.resize(nb);
-    bk.rockVp.resize(nb);
-    bk.vr.resize(nb);
-    bk.Hr.resize(nb);
-
-    bk.lporo.resize(nb);
-    bk.lrockVp.resize(nb);
-    bk.lvr.resize(nb);
-    bk.lHr.resize(nb);
+    state.Add(bk.poro, bk.lporo, nb);
+    state.Add(bk.rockVp, bk.lrockVp, nb);
+    state.Add(bk.vr, bk.lvr, nb);
+    state.Add(bk.Hr, bk.lHr, nb);
 
     // derivatives
-    bk.poroP.resize(nb);
-    bk.poroT.resize(nb);
-    bk.vrP.resize(nb);
-    bk.vrT.resize(nb);
-    bk.HrT.resize(nb);
-
-    bk.lporoP.resize(nb);
-    bk.lporoT.resize(nb);
-    bk.lvrP.resize(nb);
-    bk.lvrT.resize(nb);
-    bk.lHrT.resize(nb);
+    state.Add(bk.poroP, bk.lporoP, nb);
+    state.Add(bk.poroT, bk.lporoT, nb);
+    state.Add(bk.vrP, bk.lvrP, nb);
+    state.Add(bk.vrT, bk.lvrT, nb);
+    state.Add(bk.HrT, bk.lHrT, nb);
 
     // Fluid
-    bk.phaseNum.resize(nb);
-    bk.Nt.resize(nb);
-    bk.Ni.resize(nb * nc);
-    bk.vf.resize(nb);
-    bk.T.resize(nb);
-    bk.P.resize(nb);
+    state.Add(bk.phaseNum, bk.lphaseNum, nb);
+    state.Add(bk.Nt, bk.lNt, nb);
+    state.Add(bk.Ni, bk.lNi, nb * nc);
+    state.Add(bk.vf, bk.lvf, nb);
+    state.Add(bk.T, bk.lT, nb);
+    state.Add(bk.P, bk.lP, nb);
+    state.Add(bk.Pj, bk.lPj, nb * np);
+    state.Add(bk.Pc, bk.lPc, nb * np);
+    state.Add(bk.phaseExist, bk.lphaseExist, nb * np);
+    state.Add(bk.S, bk.lS, nb * np);
+    state.Add(bk.xij, bk.lxij, nb * np * nc);
+    state.Add(bk.rho, bk.lrho, nb * np);
+    state.Add(bk.xi, bk.lxi, nb * np);
+    state.Add(bk.mu, bk.lmu, nb * np);
+    state.Add(bk.kr, bk.lkr, nb * np);
+    state.Add(bk.Uf, bk.lUf, nb);
+    state.Add(bk.H, bk.lH, nb * np);
+    state.Add(bk.kt, bk.lkt, nb);
     bk.Pb.resize(nb);
-    bk.Pj.resize(nb * np);
-    bk.Pc.resize(nb * np);
-    bk.phaseExist.resize(nb * np);
-    bk.S.resize(nb * np);
-    bk.xij.resize(nb * np * nc);
-    bk.rho.resize(nb * np);
-    bk.xi.resize(nb * np);
-    bk.mu.resize(nb * np);
-    bk.kr.resize(nb * np);
-    bk.Uf.resize(nb);
-    bk.H.resize(nb * np);
-    bk.kt.resize(nb);
-
-    bk.lphaseNum.resize(nb);
-    bk.lNt.resize(nb);
-    bk.lNi.resize(nb * nc);
-    bk.lvf.resize(nb);
-    bk.lT.resize(nb);
-    bk.lP.resize(nb);
-    bk.lPj.resize(nb * np);
-    bk.lPc.resize(nb * np);
-    bk.lphaseExist.resize(nb * np);
-    bk.lS.resize(nb * np);
-    bk.lxij.resize(nb * np * nc);
-    bk.lrho.resize(nb * np);
-    bk.lxi.resize(nb * np);
-    bk.lmu.resize(nb * np);
-    bk.lkr.resize(nb * np);
-    bk.lUf.resize(nb);
-    bk.lH.resize(nb * np);
-    bk.lkt.resize(nb);
 
     // derivatives
-    bk.vfP.resize(nb);
-    bk.vfT.resize(nb);
-    bk.vfi.resize(nb * nc);
-    bk.rhoP.resize(nb * np);
-    bk.rhoT.resize(nb * np);
-    bk.rhox.resize(nb * nc * np);
-    bk.xiP.resize(nb * np);
-    bk.xiT.resize(nb * np);
-    bk.xix.resize(nb * nc * np);
-    bk.muP.resize(nb * np);
-    bk.muT.resize(nb * np);
-    bk.mux.resize(nb * nc * np);
-    bk.dPcj_dS.resize(nb * np * np);
-    bk.dKr_dS.resize(nb * np * np);
-    bk.UfP.resize(nb);
-    bk.UfT.resize(nb);
-    bk.Ufi.resize(nb * nc);
-    bk.HT.resize(nb * np);
-    bk.Hx.resize(nb * np * nc);
-    bk.ktP.resize(nb);
-    bk.ktT.resize(nb);
-    bk.ktS.resize(nb * np);
-
-    bk.lvfP.resize(nb);
-    bk.lvfT.resize(nb);
-    bk.lvfi.resize(nb * nc);
-    bk.lrhoP.resize(nb * np);
-    bk.lrhoT.resize(nb * np);
-    bk.lrhox.resize(nb * nc * np);
-    bk.lxiP.resize(nb * np);
-    bk.lxiT.resize(nb * np);
-    bk.lxix.resize(nb * nc * np);
-    bk.lmuP.resize(nb * np);
-    bk.lmuT.resize(nb * np);
-    bk.lmux.resize(nb * nc * np);
-    bk.ldPcj_dS.resize(nb * np * np);
-    bk.ldKr_dS.resize(nb * np * np);
-    bk.UfP.resize(nb);
-    bk.UfT.resize(nb);
-    bk.Ufi.resize(nb * nc);
-    bk.HT.resize(nb * np);
-    bk.Hx.resize(nb * np * nc);
-    bk.ktP.resize(nb);
-    bk.ktT.resize(nb);
-    bk.ktS.resize(nb * np);
+    state.Add(bk.vfP, bk.lvfP, nb);
+    state.Add(bk.vfT, bk.lvfT, nb);
+    state.Add(bk.vfi, bk.lvfi, nb * nc);
+    state.Add(bk.rhoP, bk.lrhoP, nb * np);
+    state.Add(bk.rhoT, bk.lrhoT, nb * np);
+    state.Add(bk.rhox, bk.lrhox, nb * nc * np);
+    state.Add(bk.xiP, bk.lxiP, nb * np);
+    state.Add(bk.xiT, bk.lxiT, nb * np);
+    state.Add(bk.xix, bk.lxix, nb * nc * np);
+    state.Add(bk.muP, bk.lmuP, nb * np);
+    state.Add(bk.muT, bk.lmuT, nb * np);
+    state.Add(bk.mux, bk.lmux, nb * nc * np);
+    state.Add(bk.dPcj_dS, bk.ldPcj_dS, nb * np * np);
+    state.Add(bk.dKr_dS, bk.ldKr_dS, nb * np * np);
+    state.Add(bk.UfP, bk.lUfP, nb);
+    state.Add(bk.UfT, bk.lUfT, nb);
+    state.Add(bk.Ufi, bk.lUfi, nb * nc);
+    state.Add(bk.HT, bk.lHT, nb * np);
+    state.Add(bk.Hx, bk.lHx, nb * np * nc);
+    state.Add(bk.ktP, bk.lktP, nb);
+    state.Add(bk.ktT, bk.lktT, nb);
+    state.Add(bk.ktS, bk.lktS, nb * np);
 
     // FIM-Specified
     bk.maxLendSdP = (nc + 2) * (nc + 1) * np;
-    bk.dSec_dPri.resize(nb * bk.maxLendSdP);
-    bk.bRowSizedSdP.resize(nb);
-    bk.pSderExist.resize(nb * np);
-    bk.pVnumCom.resize(nb * np);
+    state.Add(bk.dSec_dPri, bk.ldSec_dPri, nb * bk.maxLendSdP);
+    state.Add(bk.bRowSizedSdP, nb);
+    state.Add(bk.pSderExist, nb * np);
+    state.Add(bk.pVnumCom, nb * np);
 
-    bk.ldSec_dPri.resize(nb * bk.maxLendSdP);
-    bk.lbRowSizedSdP.resize(nb);
-    bk.lpSderExist.resize(nb * np);
-    bk.lpVnumCom.resize(nb * np);
+    state.Setup();
 
     // Allocate Residual
     bk.res.SetupT(nb, rs.allWells.numWell, nc);
@@ -384,18 +336,28 @@ void T_FIM::InitFlash(Bulk& bk) const
 
 void T_FIM::CalFlash(Bulk& bk) const
 {
+    OCP_PROFILE(PROF_FLASH);
+
     const OCP_USI nb = bk.numBulk;
     const OCP_USI np = bk.numPhase;
     const OCP_USI nc = bk.numCom;
 
+    bk.ResetMaxNRdSSP();
+
+#ifdef USE_OPENMP
+#pragma omp parallel for schedule(static) num_threads(bk.numThreads)
+#endif
     for (OCP_USI n = 0; n < nb; n++) {
         if (bk.bType[n] > 0) {
-            bk.flashCal[bk.PVTNUM[n]]->FlashFIM(bk.P[n], bk.T[n], &bk.Ni[n * nc],
-                                                &bk.S[n * np], bk.phaseNum[n],
-                                                &bk.xij[n * np * nc], n);
+            bk.GetFlashCal(bk.PVTNUM[n])
+                ->FlashFIM(bk.P[n], bk.T[n], &bk.Ni[n * nc], &bk.S[n * np],
+                           bk.phaseNum[n], &bk.xij[n * np * nc], n);
             PassFlashValue(bk, n);
+            OCP_PROFILE_COUNT(PROF_FLASH_BULK, 1);
         }
     }
+
+    bk.ReduceMaxNRdSSP();
 }
 
 void T_FIM::PassFlashValue(Bulk& bk, const OCP_USI& n) const
@@ -404,77 +366,92 @@ void T_FIM::PassFlashValue(Bulk& bk, const OCP_USI& n) const
     const USI     nc     = bk.numCom;
     const OCP_USI bIdp   = n * np;
     const USI     pvtnum = bk.PVTNUM[n];
+    const USI     tid    = GetThreadId();
+    Mixture*      flash  = bk.GetFlashCal(pvtnum);
 
     bk.phaseNum[n] = 0;
-    bk.Nt[n]       = bk.flashCal[pvtnum]->GetNt();
-    bk.vf[n]       = bk.flashCal[pvtnum]->GetVf();
-    bk.Uf[n]       = bk.flashCal[pvtnum]->GetUf();
+    bk.Nt[n]       = flash->GetNt();
+    bk.vf[n]       = flash->GetVf();
+    bk.Uf[n]       = flash->GetUf();
 
     for (USI j = 0; j < np; j++) {
         // Important! Saturation must be passed no matter if the phase exists. This is
         // because it will be used to calculate relative permeability and capillary
         // pressure at each time step. Make sure that all saturations are updated at
         // each step!
-        bk.S[bIdp + j]    = bk.flashCal[pvtnum]->GetS(j);
+        bk.S[bIdp + j]    = flash->GetS(j);
         bk.dSNR[bIdp + j] = bk.S[bIdp + j] - bk.dSNR[bIdp + j];
         if (bk.phaseExist[bIdp + j]) {
-            if (fabs(bk.maxNRdSSP) < fabs(bk.dSNR[bIdp + j] - bk.dSNRP[bIdp + j])) {
-                bk.maxNRdSSP       = bk.dSNR[bIdp + j] - bk.dSNRP[bIdp + j];
-                bk.index_maxNRdSSP = n;
+            if (fabs(bk.maxNRdSSPT[tid]) <
+                fabs(bk.dSNR[bIdp + j] - bk.dSNRP[bIdp + j])) {
+                bk.maxNRdSSPT[tid]       = bk.dSNR[bIdp + j] - bk.dSNRP[bIdp + j];
+                bk.index_maxNRdSSPT[tid] = n;
             }
         }
-        bk.phaseExist[bIdp + j] = bk.flashCal[pvtnum]->GetPhaseExist(j);
+        bk.phaseExist[bIdp + j] = flash->GetPhaseExist(j);
         if (bk.phaseExist[bIdp + j]) {
             bk.phaseNum[n]++;
-            bk.rho[bIdp + j] = bk.flashCal[pvtnum]->GetRho(j);
-            bk.xi[bIdp + j]  = bk.flashCal[pvtnum]->GetXi(j);
-            bk.mu[bIdp + j]  = bk.flashCal[pvtnum]->GetMu(j);
-            bk.H[bIdp + j]   = bk.flashCal[pvtnum]->GetH(j);
+            bk.rho[bIdp + j] = flash->GetRho(j);
+            bk.xi[bIdp + j]  = flash->GetXi(j);
+            bk.mu[bIdp + j]  = flash->GetMu(j);
+            bk.H[bIdp + j]   = flash->GetH(j);
 
             // Derivatives
-            bk.rhoP[bIdp + j] = bk.flashCal[pvtnum]->GetRhoP(j);
-            bk.rhoT[bIdp + j] = bk.flashCal[pvtnum]->GetRhoT(j);
-            bk.xiP[bIdp + j]  = bk.flashCal[pvtnum]->GetXiP(j);
-            bk.xiT[bIdp + j]  = bk.flashCal[pvtnum]->GetXiT(j);
-            bk.muP[bIdp + j]  = bk.flashCal[pvtnum]->GetMuP(j);
-            bk.muT[bIdp + j]  = bk.flashCal[pvtnum]->GetMuT(j);
-            bk.HT[bIdp + j]   = bk.flashCal[pvtnum]->GetHT(j);
+            bk.rhoP[bIdp + j] = flash->GetRhoP(j);
+            bk.rhoT[bIdp + j] = flash->GetRhoT(j);
+            bk.xiP[bIdp + j]  = flash->GetXiP(j);
+            bk.xiT[bIdp + j]  = flash->GetXiT(j);
+            bk.muP[bIdp + j]  = flash->GetMuP(j);
+            bk.muT[bIdp + j]  = flash->GetMuT(j);
+            bk.HT[bIdp + j]   = flash->GetHT(j);
 
             for (USI i = 0; i < nc; i++) {
-                bk.xij[bIdp * nc + j * nc + i]  = bk.flashCal[pvtnum]->GetXij(j, i);
-                bk.rhox[bIdp * nc + j * nc + i] = bk.flashCal[pvtnum]->GetRhoX(j, i);
-                bk.xix[bIdp * nc + j * nc + i]  = bk.flashCal[pvtnum]->GetXiX(j, i);
-                bk.mux[bIdp * nc + j * nc + i]  = bk.flashCal[pvtnum]->GetMuX(j, i);
-                bk.Hx[bIdp * nc + j * nc + i]   = bk.flashCal[pvtnum]->GetHx(j, i);
+                bk.xij[bIdp * nc + j * nc + i]  = flash->GetXij(j, i);
+                bk.rhox[bIdp * nc + j * nc + i] = flash->GetRhoX(j, i);
+                bk.xix[bIdp * nc + j * nc + i]  = flash->GetXiX(j, i);
+                bk.mux[bIdp * nc + j * nc + i]  = flash->GetMuX(j, i);
+                bk.Hx[bIdp * nc + j * nc + i]   = flash->GetHx(j, i);
             }
         }
     }
-    bk.vfP[n] = bk.flashCal[pvtnum]->GetVfP();
-    bk.vfT[n] = bk.flashCal[pvtnum]->GetVfT();
-    bk.UfP[n] = bk.flashCal[pvtnum]->GetUfP();
-    bk.UfT[n] = bk.flashCal[pvtnum]->GetUfT();
+    bk.vfP[n] = flash->GetVfP();
+    bk.vfT[n] = flash->GetVfT();
+    bk.UfP[n] = flash->GetUfP();
+    bk.UfT[n] = flash->GetUfT();
 
     for (USI i = 0; i < nc; i++) {
-        bk.vfi[n * nc + i] = bk.flashCal[pvtnum]->GetVfi(i);
-        bk.Ufi[n * nc + i] = bk.flashCal[pvtnum]->GetUfi(i);
+        bk.vfi[n * nc + i] = flash->GetVfi(i);
+        bk.Ufi[n * nc + i] = flash->GetUfi(i);
     }
 
     Dcopy(bk.maxLendSdP, &bk.dSec_dPri[n * bk.maxLendSdP],
-          &bk.flashCal[pvtnum]->GetDXsDXp()[0]);
+          &flash->GetDXsDXp()[0]);
 }
 
 void T_FIM::CalKrPc(Bulk& bk) const
 {
+    OCP_PROFILE(PROF_KRPC);
+
     const USI& np = bk.numPhase;
 
-    for (OCP_USI n = 0; n < bk.numBulk; n++) {
-        if (bk.bType[n] > 0) {
-            OCP_USI bId = n * np;
-            bk.flow[bk.SATNUM[n]]->CalKrPcDeriv(&bk.S[bId], &bk.kr[bId], &bk.Pc[bId],
-                                                &bk.dKr_dS[bId * np],
-                                                &bk.dPcj_dS[bId * np], n);
-            for (USI j = 0; j < np; j++)
-                bk.Pj[n * np + j] = bk.P[n] + bk.Pc[n * np + j];
+#ifdef USE_OPENMP
+#pragma omp parallel num_threads(bk.numThreads)
+#endif
+    {
+        USI hint[NUM_KRPC_HINT] = {0}; // cursors of saturation tables
+
+#ifdef USE_OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (OCP_USI n = 0; n < bk.numBulk; n++) {
+            if (bk.bType[n] > 0) {
+                OCP_USI bId = n * np;
+                bk.flow[bk.SATNUM[n]]->CalKrPcDeriv(
+                    &bk.S[bId], &bk.kr[bId], &bk.Pc[bId], &bk.dKr_dS[bId * np],
+                    &bk.dPcj_dS[bId * np], n, hint);
+                for (USI j = 0; j < np; j++)
+                    bk.Pj[n * np + j] = bk.P[n] + bk.Pc[n * np + j];
+            }
         }
     }
 }
@@ -540,61 +517,8 @@ void T_FIM::ResetToLastTimeStep(Reservoir& rs, OCPControl& ctrl)
     // Bulk
     Bulk& bk = rs.bulk;
 
-    // Rock
-    bk.poro   = bk.lporo;
-    bk.rockVp = bk.lrockVp;
-    bk.vr     = bk.lvr;
-    bk.Hr     = bk.lHr;
-    // derivatives
-    bk.poroP = bk.lporoP;
-    bk.poroT = bk.lporoT;
-    bk.vrP   = bk.lvrP;
-    bk.vrT   = bk.lvrT;
-    bk.HrT   = bk.lHrT;
-
-    // Fluid
-    bk.phaseNum   = bk.lphaseNum;
-    bk.Nt         = bk.lNt;
-    bk.Ni         = bk.lNi;
-    bk.vf         = bk.lvf;
-    bk.T          = bk.lT;
-    bk.P          = bk.lP;
-    bk.Pj         = bk.lPj;
-    bk.Pc         = bk.lPc;
-    bk.phaseExist = bk.lphaseExist;
-    bk.S          = bk.lS;
-    bk.xij        = bk.lxij;
-    bk.rho        = bk.lrho;
-    bk.xi         = bk.lxi;
-    bk.mu         = bk.lmu;
-    bk.kr         = bk.lkr;
-    bk.Uf         = bk.lUf;
-    bk.H          = bk.lH;
-    bk.kt         = bk.lkt;
-    // derivatives
-    bk.vfP       = bk.lvfP;
-    bk.vfT       = bk.lvfT;
-    bk.vfi       = bk.lvfi;
-    bk.rhoP      = bk.lrhoP;
-    bk.rhoT      = bk.lrhoT;
-    bk.rhox      = bk.lrhox;
-    bk.xiP       = bk.lxiP;
-    bk.xiT       = bk.lxiT;
-    bk.xix       = bk.lxix;
-    bk.muP       = bk.lmuP;
-    bk.muT       = bk.lmuT;
-    bk.mux       = bk.lmux;
-    bk.dPcj_dS   = bk.ldPcj_dS;
-    bk.dKr_dS    = bk.ldKr_dS;
-    bk.UfP       = bk.lUfP;
-    bk.UfT       = bk.lUfT;
-    bk.Ufi       = bk.lUfi;
-    bk.HT        = bk.lHT;
-    bk.Hx        = bk.lHx;
-    bk.ktP       = bk.lktP;
-    bk.ktT       = bk.lktT;
-    bk.ktS       = bk.lktS;
-    bk.dSec_dPri = bk.ldSec_dPri;
+    // Rock, Fluid, derivatives and FIM-Specified
+    bk.stateArena.RestoreState();
 
     bk.hLoss.ResetToLastTimeStep();
 
@@ -624,61 +548,8 @@ void T_FIM::UpdateLastTimeStep(Reservoir& rs) const
     // Bulk
     Bulk& bk = rs.bulk;
 
-    // Rock
-    bk.lporo   = bk.poro;
-    bk.lrockVp = bk.rockVp;
-    bk.lvr     = bk.vr;
-    bk.lHr     = bk.Hr;
-    // derivatives
-    bk.lporoP = bk.poroP;
-    bk.lporoT = bk.poroT;
-    bk.lvrP   = bk.vrP;
-    bk.lvrT   = bk.vrT;
-    bk.lHrT   = bk.HrT;
-
-    // Fluid
-    bk.lphaseNum   = bk.phaseNum;
-    bk.lNt         = bk.Nt;
-    bk.lNi         = bk.Ni;
-    bk.lvf         = bk.vf;
-    bk.lT          = bk.T;
-    bk.lP          = bk.P;
-    bk.lPj         = bk.Pj;
-    bk.lPc         = bk.Pc;
-    bk.lphaseExist = bk.phaseExist;
-    bk.lS          = bk.S;
-    bk.lxij        = bk.xij;
-    bk.lrho        = bk.rho;
-    bk.lxi         = bk.xi;
-    bk.lmu         = bk.mu;
-    bk.lkr         = bk.kr;
-    bk.lUf         = bk.Uf;
-    bk.lH          = bk.H;
-    bk.lkt         = bk.kt;
-    // derivatives
-    bk.lvfP       = bk.vfP;
-    bk.lvfT       = bk.vfT;
-    bk.lvfi       = bk.vfi;
-    bk.lrhoP      = bk.rhoP;
-    bk.lrhoT      = bk.rhoT;
-    bk.lrhox      = bk.rhox;
-    bk.lxiP       = bk.xiP;
-    bk.lxiT       = bk.xiT;
-    bk.lxix       = bk.xix;
-    bk.lmuP       = bk.muP;
-    bk.lmuT       = bk.muT;
-    bk.lmux       = bk.mux;
-    bk.ldPcj_dS   = bk.dPcj_dS;
-    bk.ldKr_dS    = bk.dKr_dS;
-    bk.lUfP       = bk.UfP;
-    bk.lUfT       = bk.UfT;
-    bk.lUfi       = bk.Ufi;
-    bk.lHT        = bk.HT;
-    bk.lHx        = bk.Hx;
-    bk.lktP       = bk.ktP;
-    bk.lktT       = bk.ktT;
-    bk.lktS       = bk.ktS;
-    bk.ldSec_dPri = bk.dSec_dPri;
+    // Rock, Fluid, derivatives and FIM-Specified
+    bk.stateArena.SaveState();
 
     bk.hLoss.UpdateLastTimeStep();
 
@@ -698,13 +569,15 @@ void T_FIM::CalRes(Reservoir&      rs,
                    const OCP_DBL&  dt,
                    const OCP_BOOL& resetRes0)
 {
-    const Bulk& bk   = rs.bulk;
-    const USI   nb   = bk.numBulk;
-    const USI   np   = bk.numPhase;
-    const USI   nc   = bk.numCom;
-    const USI   len  = nc + 2;
-    OCPRes&     Res  = bk.res;
-    BulkConn&   conn = rs.conn;
+    OCP_PROFILE(PROF_CALRES);
+
+    const Bulk&   bk   = rs.bulk;
+    const OCP_USI nb   = bk.numBulk;
+    const USI     np   = bk.numPhase;
+    const USI     nc   = bk.numCom;
+    const USI     len  = nc + 2;
+    OCPRes&       Res  = bk.res;
+    BulkConn&     conn = rs.conn;
 
     Res.SetZero();
 
@@ -1639,10 +1512,10 @@ void T_FIM::GetSolution(Reservoir&             rs,
     OCP_DBL         chopmin = 1;
     OCP_DBL         choptmp = 0;
 
-    bk.dSNR       = bk.S;
-    bk.NRphaseNum = bk.phaseNum;
-    bk.NRdPmax    = 0;
-    bk.NRdNmax    = 0;
+    bk.dSNR.assign(bk.S.begin(), bk.S.end());
+    bk.NRphaseNum.assign(bk.phaseNum.begin(), bk.phaseNum.end());
+    bk.NRdPmax = 0;
+    bk.NRdNmax = 0;
     bk.NRdTmax    = 0;
 
     for (OCP_USI n = 0; n < nb; n++) {
@@ -1713,4 +1586,6 @@ void T_FIM::GetSolution(Reservoir&             rs,
 /*  Author              Date             Actions                              */
 /*----------------------------------------------------------------------------*/
 /*  Shizhe Li           Nov/10/2022      Create file                          */
+/*  OpenCAEPoro team    Oct/17/2026      Add 64-bit global index option       */
+/*  OpenCAEPoro team    Oct/17/2026      Run CalKrPc in threads               */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
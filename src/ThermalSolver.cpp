@@ -26,6 +26,8 @@ void ThermalSolver::Prepare(Reservoir& rs, const OCPControl& ctrl)
 
 void ThermalSolver::AssembleMat(const Reservoir& rs, OCPControl& ctrl)
 {
+    OCP_PROFILE(PROF_ASSEMBLE);
+
     const OCP_DBL dt = ctrl.GetCurDt();
 
     GetWallTime timer;
@@ -38,12 +40,16 @@ void ThermalSolver::AssembleMat(const Reservoir& rs, OCPControl& ctrl)
 
 void ThermalSolver::SolveLinearSystem(Reservoir& rs, OCPControl& ctrl)
 {
+    OCP_PROFILE(PROF_LINEAR_SOLVE);
+
     fim.SolveLinearSystem(LSolver, rs, ctrl);
 }
 
 /// Update properties of fluid.
 OCP_BOOL ThermalSolver::UpdateProperty(Reservoir& rs, OCPControl& ctrl)
 {
+    OCP_PROFILE(PROF_UPDATE);
+
     return fim.UpdateProperty(rs, ctrl);
 }
 
@@ -9,6 +9,21 @@
  *-----------------------------------------------------------------------------------
  */
 
+// Standard header files
+#include <cstdlib>
+#include <cstring>
+
+#if defined(_CONSOLE) || defined(_WIN32) || defined(_WIN64)
+#define OCP_NO_MMAP
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// OpenCAEPoro header files
+#include "UtilError.hpp"
 #include "UtilInput.hpp"
 
 OCP_BOOL ReadLine(ifstream& ifs, vector<string>& result)
@@ -71,6 +86,186 @@ void DealDefault(vector<string>& result)
     swap(result, tmp);
 }
 
+OCP_BOOL MappedFile::Open(const string& filename)
+{
+    Close();
+#ifdef OCP_NO_MMAP
+    ifstream ifs(filename, ios::in | ios::binary);
+    if (!ifs) return OCP_FALSE;
+    buffer.assign(istreambuf_iterator<char>(ifs), istreambuf_iterator<char>());
+    data = buffer.data();
+    size = buffer.size();
+#else
+    const int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) return OCP_FALSE;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        close(fd);
+        return OCP_FALSE;
+    }
+    void* addr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED) return OCP_FALSE;
+    madvise(addr, st.st_size, MADV_SEQUENTIAL);
+    data = static_cast<const char*>(addr);
+    size = st.st_size;
+#endif
+    return OCP_TRUE;
+}
+
+void MappedFile::Close()
+{
+#ifdef OCP_NO_MMAP
+    vector<char>().swap(buffer);
+#else
+    if (data != nullptr) munmap(const_cast<char*>(data), size);
+#endif
+    data = nullptr;
+    size = 0;
+}
+
+/// Delimiters of numbers, quotes and commas are treated as spaces like ReadLine
+static inline OCP_BOOL IsDelimiter(const char& c)
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == ',' || c == '\'';
+}
+
+/// Parse a number in [p, end) into val, return the position behind it or nullptr if
+/// it is not a number. If significant digits fit in 53 bits and the exponent is small,
+/// the number is converted with one correctly rounded operation, otherwise strtod.
+static const char* ParseNumber(const char* p, const char* end, OCP_DBL& val)
+{
+    static const OCP_DBL pow10[] = {1E0,  1E1,  1E2,  1E3,  1E4,  1E5,  1E6,  1E7,
+                                    1E8,  1E9,  1E10, 1E11, 1E12, 1E13, 1E14, 1E15,
+                                    1E16, 1E17, 1E18, 1E19, 1E20, 1E21, 1E22};
+    const char* begin = p;
+
+    OCP_BOOL neg = OCP_FALSE;
+    if (p < end && (*p == '+' || *p == '-')) neg = (*p++ == '-');
+
+    OCP_ULL  m      = 0;     // significant digits
+    USI      digits = 0;     // num of significant digits
+    OCP_INT  e10    = 0;     // decimal exponent
+    OCP_BOOL any    = OCP_FALSE;
+    OCP_BOOL exact  = OCP_TRUE;
+    for (; p < end && *p >= '0' && *p <= '9'; p++) {
+        any = OCP_TRUE;
+        if (digits < 19) {
+            m = m * 10 + (*p - '0');
+            if (m > 0) digits++;
+        } else {
+            e10++;
+            if (*p != '0') exact = OCP_FALSE;
+        }
+    }
+    if (p < end && *p == '.') {
+        for (p++; p < end && *p >= '0' && *p <= '9'; p++) {
+            any = OCP_TRUE;
+            if (digits < 19) {
+                m = m * 10 + (*p - '0');
+                if (m > 0) digits++;
+                e10--;
+            } else if (*p != '0') {
+                exact = OCP_FALSE;
+            }
+        }
+    }
+    if (!any) return nullptr;
+
+    // Fortran style exponent is allowed
+    if (p < end && (*p == 'e' || *p == 'E' || *p == 'd' || *p == 'D')) {
+        const char* q    = p + 1;
+        OCP_BOOL    eneg = OCP_FALSE;
+        if (q < end && (*q == '+' || *q == '-')) eneg = (*q++ == '-');
+        if (q == end || *q < '0' || *q > '9') return nullptr;
+        OCP_INT e = 0;
+        for (; q < end && *q >= '0' && *q <= '9'; q++) {
+            if (e < 10000) e = e * 10 + (*q - '0');
+        }
+        e10 += eneg ? -e : e;
+        p = q;
+    }
+
+    if (m == 0) {
+        val = 0;
+    } else if (exact && m < (1ULL << 53) && e10 >= -22 && e10 <= 22) {
+        // both m and 10^|e10| are exact, so is the rounded result
+        val = e10 < 0 ? m / pow10[-e10] : m * pow10[e10];
+    } else {
+        string tmp(begin, p);
+        for (auto& c : tmp) {
+            if (c == 'd' || c == 'D') c = 'e';
+        }
+        val = strtod(tmp.c_str(), nullptr);
+        return p;
+    }
+    if (neg) val = -val;
+    return p;
+}
+
+const char* ReadNumbers(const char*      p,
+                        const char*      end,
+                        const string&    keyword,
+                        vector<OCP_DBL>& result)
+{
+    while (p < end) {
+        if (IsDelimiter(*p)) {
+            p++;
+            continue;
+        }
+        // comments and the rest of the line behind '/' are skipped
+        const OCP_BOOL comment =
+            (*p == '#') || (*p == '-' && p + 1 < end && p[1] == '-');
+        if (comment || *p == '/') {
+            const char* eol = static_cast<const char*>(memchr(p, '\n', end - p));
+            const char* next = (eol == nullptr) ? end : eol + 1;
+            if (!comment) return next;
+            p = next;
+            continue;
+        }
+
+        // end of the current token, it is only used for checks and errors
+        const char* e = p;
+        while (e < end && !IsDelimiter(*e) && *e != '/') e++;
+
+        OCP_DBL     val;
+        const char* q = ParseNumber(p, end, val);
+        if (q != nullptr && q < end && *q == '*') {
+            // m*n, m is the num of repeats
+            const OCP_DBL num = val;
+            if (q + 1 == e) {
+                OCP_ABORT("Default values are not allowed in " + keyword + ": " +
+                          string(p, e));
+            }
+            q = ParseNumber(q + 1, end, val);
+            if (q != nullptr && num >= 0 && num == static_cast<OCP_USI>(num)) {
+                result.insert(result.end(), static_cast<OCP_USI>(num), val);
+            } else {
+                q = nullptr;
+            }
+        } else if (q != nullptr) {
+            result.push_back(val);
+        }
+        if (q != e) OCP_ABORT("Wrong number in " + keyword + ": " + string(p, e));
+        p = q;
+    }
+    return end;
+}
+
+void ReadNumbers(ifstream&         ifs,
+                 const MappedFile& file,
+                 const string&     keyword,
+                 vector<OCP_DBL>&  result)
+{
+    // ifs is opened in binary mode, so its position is the offset in file
+    const streamoff pos = ifs.tellg();
+    if (pos < 0 || pos > file.End() - file.Begin()) {
+        OCP_ABORT("Wrong position of input file!");
+    }
+    const char* p = ReadNumbers(file.Begin() + pos, file.End(), keyword, result);
+    ifs.seekg(p - file.Begin());
+}
+
 /*----------------------------------------------------------------------------*/
 /*  Brief Change History of This File                                         */
 /*----------------------------------------------------------------------------*/
@@ -78,4 +273,6 @@ void DealDefault(vector<string>& result)
 /*----------------------------------------------------------------------------*/
 /*  Shizhe Li           Oct/01/2021      Create file                          */
 /*  Chensong Zhang      Oct/15/2021      Format file                          */
+/*  OpenCAEPoro team    Oct/16/2026      Parse numeric arrays in mapped files */
+/*  OpenCAEPoro team    Oct/17/2026      Report wrong numbers of keywords     */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
@@ -0,0 +1,192 @@
+/*! \file    UtilProfiler.cpp
+ *  \brief   OCPProfiler class definition
+ *  \author  OpenCAEPoro team
+ *  \date    Oct/16/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the OpenCAEPoro team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+// Standard header files
+#include <algorithm>
+#include <iomanip>
+
+// OpenCAEPoro header files
+#include "UtilError.hpp"
+#include "UtilProfiler.hpp"
+
+const char* OCPProfiler::timerName[PROF_NUM_TIMER] = {
+    "AssembleMat", "CalRes",         "CalFlux", "LinearSolve", "Decoupling", "PCSetup",
+    "Krylov",      "UpdateProperty", "Flash",   "CalKrPc",     "Output"};
+
+const char* OCPProfiler::counterName[PROF_NUM_COUNTER] = {
+    "FlashBulk",      "FlashStability", "FlashSkipStability", "SSMStaIter",
+    "NRStaIter",      "SSMSpIter",      "NRSpIter",           "FlashCacheHit",
+    "FlashCacheMiss", "PCRebuild",      "PCReuse"};
+
+OCPProfiler::OCPProfiler()
+{
+    nodes.resize(1);
+    nodes[0].item   = PROF_NUM_TIMER;
+    nodes[0].parent = 0;
+    stack.push_back(0);
+    start.push_back(chrono::steady_clock::now());
+
+    stepTime.resize(PROF_NUM_TIMER, 0);
+    allTime.resize(PROF_NUM_TIMER, 0);
+
+    const USI lineSize = 64 / sizeof(OCP_ULL);
+    countStride = (PROF_NUM_COUNTER + lineSize - 1) / lineSize * lineSize;
+    count.resize(GetMaxThreads() * countStride, 0);
+    allCount.resize(PROF_NUM_COUNTER, 0);
+}
+
+void OCPProfiler::Setup(const string& dir)
+{
+    if (csv.is_open()) csv.close();
+    if (!enabled) return;
+    csv.open(dir + "Profile.csv");
+    if (!csv.is_open()) {
+        OCP_WARNING("Can not open " + dir + "Profile.csv");
+        return;
+    }
+
+    csv << "Step,Time,dt,NR,LS";
+    for (USI i = 0; i < PROF_NUM_TIMER; i++) csv << "," << timerName[i] << "(s)";
+    for (USI i = 0; i < PROF_NUM_COUNTER; i++) csv << "," << counterName[i];
+    csv << "\n";
+}
+
+void OCPProfiler::Start(const OCPProfTimer& item)
+{
+    if (!enabled || GetThreadId() != 0) return;
+
+    const USI cur = stack.back();
+    USI       n   = 0;
+    for (const auto& c : nodes[cur].child) {
+        if (nodes[c].item == item) {
+            n = c;
+            break;
+        }
+    }
+    if (n == 0) {
+        n = nodes.size();
+        nodes.push_back(Node());
+        nodes[n].item   = item;
+        nodes[n].parent = cur;
+        nodes[cur].child.push_back(n);
+    }
+
+    stack.push_back(n);
+    start.push_back(chrono::steady_clock::now());
+}
+
+void OCPProfiler::Stop()
+{
+    if (!enabled || GetThreadId() != 0) return;
+    OCP_ASSERT(stack.size() > 1, "No running timer!");
+
+    const OCP_DBL t =
+        chrono::duration<OCP_DBL>(chrono::steady_clock::now() - start.back()).count();
+    Node& node = nodes[stack.back()];
+    node.time += t;
+    node.calls++;
+    stepTime[node.item] += t;
+
+    stack.pop_back();
+    start.pop_back();
+}
+
+void OCPProfiler::EndStep(const USI&     step,
+                          const OCP_DBL& time,
+                          const OCP_DBL& dt,
+                          const USI&     iterNRT,
+                          const USI&     iterLST)
+{
+    if (!enabled) return;
+
+    // reduce counters of all threads
+    vector<OCP_ULL> stepCount(PROF_NUM_COUNTER, 0);
+    for (USI t = 0; t < count.size() / countStride; t++) {
+        for (USI i = 0; i < PROF_NUM_COUNTER; i++) {
+            stepCount[i] += count[t * countStride + i];
+        }
+    }
+
+    if (csv.is_open()) {
+        csv << step << "," << setprecision(6) << time << "," << dt << ","
+            << iterNRT - lastNRT << "," << iterLST - lastLST << scientific
+            << setprecision(3);
+        for (USI i = 0; i < PROF_NUM_TIMER; i++) csv << "," << stepTime[i];
+        for (USI i = 0; i < PROF_NUM_COUNTER; i++) csv << "," << stepCount[i];
+        csv << defaultfloat << "\n";
+        csv.flush();
+    }
+
+    lastNRT = iterNRT;
+    lastLST = iterLST;
+    for (USI i = 0; i < PROF_NUM_TIMER; i++) allTime[i] += stepTime[i];
+    for (USI i = 0; i < PROF_NUM_COUNTER; i++) allCount[i] += stepCount[i];
+    fill(stepTime.begin(), stepTime.end(), 0);
+    fill(count.begin(), count.end(), 0);
+}
+
+void OCPProfiler::PrintJSON(const string& dir) const
+{
+    if (!enabled) return;
+
+    const string FileOut = dir + "Profile.json";
+    ofstream     out(FileOut);
+    if (!out.is_open()) {
+        OCP_WARNING("Can not open " + FileOut);
+        return;
+    }
+
+    out << scientific << setprecision(6);
+    out << "{\n  \"timers\": [";
+    const auto& root = nodes[0].child;
+    for (USI i = 0; i < root.size(); i++) {
+        out << (i > 0 ? "," : "") << "\n";
+        PrintNode(out, root[i], 4);
+    }
+    out << "\n  ],\n  \"total\": {";
+    for (USI i = 0; i < PROF_NUM_TIMER; i++) {
+        out << (i > 0 ? "," : "") << "\n    \"" << timerName[i]
+            << "\": " << allTime[i];
+    }
+    out << "\n  },\n  \"counters\": {";
+    for (USI i = 0; i < PROF_NUM_COUNTER; i++) {
+        out << (i > 0 ? "," : "") << "\n    \"" << counterName[i]
+            << "\": " << allCount[i];
+    }
+    out << "\n  }\n}\n";
+}
+
+void OCPProfiler::PrintNode(ofstream& out, const USI& n, const USI& indent) const
+{
+    const Node&  node = nodes[n];
+    const string pad(indent, ' ');
+
+    out << pad << "{\"name\": \"" << timerName[node.item] << "\", \"calls\": "
+        << node.calls << ", \"time\": " << node.time;
+    if (!node.child.empty()) {
+        out << ", \"children\": [";
+        for (USI i = 0; i < node.child.size(); i++) {
+            out << (i > 0 ? "," : "") << "\n";
+            PrintNode(out, node.child[i], indent + 2);
+        }
+        out << "\n" << pad << "]";
+    }
+    out << "}";
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  OpenCAEPoro team    Oct/16/2026      Create file                          */
+/*  OpenCAEPoro team    Oct/17/2026      Add run-time switch of profiler      */
+/*----------------------------------------------------------------------------*/
@@ -59,15 +59,21 @@ void Well::Setup(const Grid& gd, const Bulk& bk, const vector<SolventINJ>& sols)
     }
 
     // Perf
-    USI pp = 0;
+    // Note: All perforations of a well are owned by one process, which owns the well.
+    // Other processes keep the well closed, and its perforations refer to no bulk.
+    ifOwned = OCP_TRUE;
+    USI pp  = 0;
     for (USI p = 0; p < numPerf; p++) {
         OCP_USI pId = perf[p].K * gd.nx * gd.ny + perf[p].J * gd.nx + perf[p].I;
         if (gd.map_All2Flu[pId].IsAct()) {
 
+            const GB_Pair& act = gd.map_All2Act[pId];
+            if (!act.IsAct() || act.GetId() >= gd.ownedGridNum) ifOwned = OCP_FALSE;
+
             perf[pp]            = perf[p];
             perf[pp].state      = OPEN;
-            perf[pp].location   = gd.map_All2Act[pId].GetId();
-            perf[pp].depth      = bk.depth[perf[pp].location];
+            perf[pp].location   = ifOwned ? act.GetId() : 0;
+            perf[pp].depth      = gd.depth[pId];
             perf[pp].multiplier = 1;
             perf[pp].qi_lbmol.resize(numCom);
             perf[pp].transj.resize(numPhase);
@@ -85,11 +91,20 @@ void Well::Setup(const Grid& gd, const Bulk& bk, const vector<SolventINJ>& sols)
 
     if (depth < 0) depth = perf[0].depth;
 
-    CalWI_Peaceman(bk);
+    if (ifOwned) CalWI_Peaceman(bk);
     // test
     // ShowPerfStatus(bk);
 }
 
+vector<OCP_USI> Well::GetPerfGrid(const Grid& gd) const
+{
+    vector<OCP_USI> perfGrid(numPerf);
+    for (USI p = 0; p < numPerf; p++) {
+        perfGrid[p] = perf[p].K * gd.nx * gd.ny + perf[p].J * gd.nx + perf[p].I;
+    }
+    return perfGrid;
+}
+
 void Well::CalWI_Peaceman(const Bulk& myBulk)
 {
     OCP_FUNCNAME;
@@ -1279,4 +1294,5 @@ void Well::SetPolyhedronWell(const Grid& myGrid, OCPpolyhedron& mypol)
 /*----------------------------------------------------------------------------*/
 /*  Shizhe Li           Oct/01/2021      Create file                          */
 /*  Chensong Zhang      Oct/15/2021      Format file                          */
+/*  OpenCAEPoro team    Oct/17/2026      Distribute FIM among MPI processes   */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
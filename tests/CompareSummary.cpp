@@ -0,0 +1,120 @@
+/*! \file    CompareSummary.cpp
+ *  \brief   Compare the final values of two SUMMARY.out files
+ *  \author  OpenCAEPoro team
+ *  \date    Oct/17/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the OpenCAEPoro team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+// Standard header files
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/// Split a line of SUMMARY.out by tabs and trim the spaces of each item.
+static vector<string> SplitItems(const string& line)
+{
+    vector<string> items;
+    istringstream  iss(line);
+    string         item;
+    while (getline(iss, item, '\t')) {
+        const auto b = item.find_first_not_of(' ');
+        const auto e = item.find_last_not_of(' ');
+        items.push_back(b == string::npos ? "" : item.substr(b, e - b + 1));
+    }
+    return items;
+}
+
+/// Read the values of the last row of each block in file, they are indexed by the
+/// names of items followed by their wells or bulks.
+//  Note: A block begins with "Row k", followed by lines of names, units, wells or
+//  bulks, and rows of values.
+static map<string, double> ReadLastRow(const string& file)
+{
+    ifstream ifs(file);
+    if (!ifs.is_open()) {
+        cout << "Can not open " << file << endl;
+        exit(EXIT_FAILURE);
+    }
+
+    map<string, double> result;
+    vector<string>      names;
+    string              line;
+    while (getline(ifs, line)) {
+        if (line.compare(0, 3, "Row") == 0) {
+            string units, objs;
+            getline(ifs, line);
+            getline(ifs, units);
+            getline(ifs, objs);
+            names                     = SplitItems(line);
+            const vector<string> objv = SplitItems(objs);
+            for (size_t i = 0; i < names.size() && i < objv.size(); i++) {
+                if (!objv[i].empty()) names[i] += " " + objv[i];
+            }
+            continue;
+        }
+        const vector<string> values = SplitItems(line);
+        for (size_t i = 0; i < names.size() && i < values.size(); i++) {
+            if (!names[i].empty() && !values[i].empty()) {
+                result[names[i]] = atof(values[i].c_str());
+            }
+        }
+    }
+    return result;
+}
+
+/// Usage: compareSummary <reference> <result> <rtol> [skipped items...]
+/// The final values of all items in reference, except the skipped ones, should be in
+/// result and differ by at most rtol * max(|reference value|, 1).
+int main(int argc, const char* argv[])
+{
+    if (argc < 4) {
+        cout << "Usage: " << argv[0] << " <reference> <result> <rtol> [skipped items]"
+             << endl;
+        return EXIT_FAILURE;
+    }
+    const map<string, double> ref  = ReadLastRow(argv[1]);
+    const map<string, double> res  = ReadLastRow(argv[2]);
+    const double              rtol = atof(argv[3]);
+    const vector<string>      skip(argv + 4, argv + argc);
+
+    if (ref.empty()) {
+        cout << "No values in " << argv[1] << endl;
+        return EXIT_FAILURE;
+    }
+    int numDiff = 0;
+    for (const auto& v : ref) {
+        const string item = v.first.substr(0, v.first.find(' '));
+        if (find(skip.begin(), skip.end(), item) != skip.end()) continue;
+        const auto it = res.find(v.first);
+        if (it == res.end()) {
+            cout << v.first << " is missing" << endl;
+            numDiff++;
+        } else if (it->second != v.second &&
+                   !(fabs(it->second - v.second) <= rtol * max(fabs(v.second), 1.0))) {
+            cout << v.first << ": " << v.second << " vs " << it->second << endl;
+            numDiff++;
+        }
+    }
+    cout << ref.size() << " items compared, " << numDiff << " differ" << endl;
+    return numDiff == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  OpenCAEPoro team    Oct/17/2026      Create file                          */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,72 @@
+/*! \file    TestExclusiveScan.cpp
+ *  \brief   Unit test of parallel exclusive prefix sums
+ *  \author  OpenCAEPoro team
+ *  \date    Oct/17/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the OpenCAEPoro team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+// Standard header files
+#include <vector>
+
+// OpenCAEPoro header files
+#include "OCPConst.hpp"
+#include "UnitTest.hpp"
+#include "UtilOpenMP.hpp"
+
+using namespace std;
+
+/// Check ExclusiveScan of src against a serial scan.
+template <typename T, typename I>
+static void CheckScan(const vector<T>& src)
+{
+    vector<T> ref(src.size());
+    T         sum = 0;
+    for (size_t i = 0; i < src.size(); i++) {
+        ref[i] = sum;
+        sum += src[i];
+    }
+
+    vector<T> a(src);
+    const T   total = ExclusiveScan(a.data(), static_cast<I>(a.size()));
+    OCP_CHECK(total == sum);
+    OCP_CHECK(a == ref);
+}
+
+int main()
+{
+    // sizes below, at and above the num of threads
+    const vector<OCP_USI> sizes{0, 1, 2, 3, 5, 7, 8, 9, 16, 17, 1000, 100003};
+
+    for (int nt = 1; nt <= 8; nt *= 2) {
+#ifdef USE_OPENMP
+        omp_set_num_threads(nt);
+#else
+        if (nt > 1) break;
+#endif
+        for (const auto& n : sizes) {
+            vector<OCP_USI> u(n);
+            vector<OCP_INT> v(n);
+            for (OCP_USI i = 0; i < n; i++) {
+                u[i] = (i * 7919) % 13;
+                v[i] = static_cast<OCP_INT>(i % 5) - 2;
+            }
+            CheckScan<OCP_USI, OCP_USI>(u);
+            CheckScan<OCP_USI, USI>(u);
+            CheckScan<OCP_INT, OCP_INT>(v);
+        }
+    }
+
+    return OCP_TEST_RESULT;
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  OpenCAEPoro team    Oct/17/2026      Create file                          */
+/*----------------------------------------------------------------------------*/
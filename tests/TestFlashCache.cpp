@@ -0,0 +1,77 @@
+/*! \file    TestFlashCache.cpp
+ *  \brief   Unit test of FlashCache
+ *  \author  OpenCAEPoro team
+ *  \date    Oct/17/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the OpenCAEPoro team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+// OpenCAEPoro header files
+#include "AcceleratePVT.hpp"
+#include "UnitTest.hpp"
+
+int main()
+{
+    const USI             nc = 3;
+    const OCP_DBL         P  = 3000;
+    const OCP_DBL         T  = 160;
+    const vector<OCP_DBL> zi{0.2, 0.3, 0.5};
+    const vector<OCP_DBL> Ks{2.5, 1.1, 0.05};
+    vector<OCP_DBL>       Kout(nc, 0);
+
+    FlashCache cache;
+    cache.SetUseCache(OCP_TRUE);
+    cache.SetParam({1E-3, 0.1, 1E-3, 4});
+    cache.Setup(nc);
+    OCP_CHECK(cache.IfUseCache());
+
+    // an empty cache misses
+    OCP_CHECK(!cache.Find(P, T, zi, Kout));
+
+    // a hit returns the inserted Ks for states in the same cell
+    cache.Insert(P, T, zi, Ks);
+    OCP_CHECK(cache.Find(P, T, zi, Kout));
+    OCP_CHECK(Kout == Ks);
+    fill(Kout.begin(), Kout.end(), 0);
+    OCP_CHECK(cache.Find(P * (1 + 1E-4), T + 0.01, {0.2001, 0.3, 0.4999}, Kout));
+    OCP_CHECK(Kout == Ks);
+
+    // states in other cells miss, Kout is unchanged then
+    fill(Kout.begin(), Kout.end(), 0);
+    OCP_CHECK(!cache.Find(P * 1.01, T, zi, Kout));
+    OCP_CHECK(!cache.Find(P, T + 1, zi, Kout));
+    OCP_CHECK(!cache.Find(P, T, {0.21, 0.3, 0.49}, Kout));
+    OCP_CHECK(Kout == vector<OCP_DBL>(nc, 0));
+
+    // an entry of the same cell is replaced
+    const vector<OCP_DBL> Ks2{2.4, 1.2, 0.06};
+    cache.Insert(P, T + 0.01, zi, Ks2);
+    OCP_CHECK(cache.Find(P, T, zi, Kout));
+    OCP_CHECK(Kout == Ks2);
+
+    // a full cache is cleared before a new entry is inserted
+    for (USI i = 1; i < 4; i++) cache.Insert(P * (1 + 0.01 * i), T, zi, Ks);
+    OCP_CHECK(cache.Find(P, T, zi, Kout));
+    cache.Insert(P * 1.1, T, zi, Ks);
+    OCP_CHECK(!cache.Find(P, T, zi, Kout));
+    OCP_CHECK(cache.Find(P * 1.1, T, zi, Kout));
+
+    // a cache of no entries is not used
+    FlashCache off;
+    off.SetUseCache(OCP_TRUE);
+    off.SetParam({1E-3, 0.1, 1E-3, 0});
+    OCP_CHECK(!off.IfUseCache());
+
+    return OCP_TEST_RESULT;
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  OpenCAEPoro team    Oct/17/2026      Create file                          */
+/*----------------------------------------------------------------------------*/
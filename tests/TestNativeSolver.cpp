@@ -0,0 +1,170 @@
+/*! \file    TestNativeSolver.cpp
+ *  \brief   Unit test of native linear solvers and AMG on known systems
+ *  \author  OpenCAEPoro team
+ *  \date    Oct/17/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the OpenCAEPoro team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+// Standard header files
+#include <fstream>
+
+// OpenCAEPoro header files
+#include "NativeSolver.hpp"
+#include "UnitTest.hpp"
+
+/// Build the five-point matrix of a nx*nx grid with nb*nb blocks, the diagonal block
+/// of each row is the first one. Off-diagonal blocks couple the first unknowns most
+/// strongly, as pressure does in reservoir problems.
+static BSRMatrix FivePoint(const USI& nx, const USI& nb)
+{
+    const USI nb2 = nb * nb;
+    BSRMatrix A;
+    A.Allocate(nx * nx, 5 * nx * nx, nb);
+    A.nrow      = nx * nx;
+    A.rowPtr[0] = 0;
+    OCP_USI k   = 0;
+    for (OCP_USI i = 0; i < A.nrow; i++) {
+        const OCP_USI ix = i % nx, iy = i / nx;
+        vector<OCP_USI> nbr;
+        if (ix > 0) nbr.push_back(i - 1);
+        if (ix + 1 < nx) nbr.push_back(i + 1);
+        if (iy > 0) nbr.push_back(i - nx);
+        if (iy + 1 < nx) nbr.push_back(i + nx);
+
+        // diagonal block
+        A.colIdx[k] = i;
+        OCP_DBL* D  = &A.val[k * nb2];
+        for (USI r = 0; r < nb; r++) {
+            for (USI c = 0; c < nb; c++) {
+                D[r * nb + c] = r == c ? 0.1 : 0.02 / (1 + r + c);
+            }
+        }
+        k++;
+        for (const auto& j : nbr) {
+            A.colIdx[k] = j;
+            OCP_DBL* B  = &A.val[k * nb2];
+            for (USI r = 0; r < nb; r++) {
+                for (USI c = 0; c < nb; c++) {
+                    B[r * nb + c] = r == c ? -1.0 / (1 + r) : (r == 0 ? -0.05 : 0);
+                }
+                D[r * nb + r] += 1.0 / (1 + r);
+            }
+            k++;
+        }
+        A.rowPtr[i + 1] = k;
+    }
+    return A;
+}
+
+/// Return ||a - b|| / ||b||.
+static OCP_DBL RelError(const vector<OCP_DBL>& a, const vector<OCP_DBL>& b)
+{
+    OCP_DBL e = 0, n = 0;
+    for (size_t i = 0; i < a.size(); i++) {
+        e += (a[i] - b[i]) * (a[i] - b[i]);
+        n += b[i] * b[i];
+    }
+    return sqrt(e / n);
+}
+
+/// Return ||a||.
+static OCP_DBL Norm2(const vector<OCP_DBL>& a)
+{
+    OCP_DBL n = 0;
+    for (const auto& v : a) n += v * v;
+    return sqrt(n);
+}
+
+/// A V-cycle of AMG used as a stationary iteration reduces the residual of Poisson
+/// problem by a constant factor.
+static void CheckAMG()
+{
+    const BSRMatrix A = FivePoint(64, 1);
+    const OCP_USI   n = A.nrow;
+    vector<OCP_DBL> b(n), x(n, 0), r(n), z(n);
+    for (OCP_USI i = 0; i < n; i++) b[i] = 1 + (i % 7) * 0.1;
+
+    NativeAMG amg;
+    amg.SetupParam(AMGParam());
+    amg.Setup(A);
+    OCP_CHECK(amg.GetNumLevels() > 2);
+
+    A.Residual(b.data(), x.data(), r.data());
+    const OCP_DBL r0 = Norm2(r);
+    for (USI k = 0; k < 20; k++) {
+        amg.Apply(r.data(), z.data());
+        for (OCP_USI i = 0; i < n; i++) x[i] += z[i];
+        A.Residual(b.data(), x.data(), r.data());
+    }
+    OCP_CHECK(Norm2(r) < 1E-8 * r0);
+
+    // a setup reusing the interpolations gives the same V-cycle for the same matrix
+    vector<OCP_DBL> z1(n);
+    amg.Apply(b.data(), z.data());
+    amg.Setup(A);
+    amg.Apply(b.data(), z1.data());
+    OCP_CHECK(z == z1);
+}
+
+/// Solve A * x = A * xs by the native solver with param file and check x = xs.
+static void CheckSolver(const BSRMatrix& A, const string& param)
+{
+    const string file = "TestNativeSolver.fasp";
+    ofstream(file) << param;
+
+    const USI       nb2 = A.nb * A.nb;
+    const OCP_USI   n   = A.nrow * A.nb;
+    vector<OCP_DBL> xs(n), b(n), x(n, 0);
+    for (OCP_USI i = 0; i < n; i++) xs[i] = sin(0.01 * i) + (i % A.nb) * 10;
+    A.SpMV(xs.data(), b.data());
+
+    vector<USI>             rowCapacity(A.nrow);
+    vector<vector<OCP_USI>> colId(A.nrow);
+    vector<vector<OCP_DBL>> val(A.nrow);
+    for (OCP_USI i = 0; i < A.nrow; i++) {
+        const OCP_USI bId = A.rowPtr[i], eId = A.rowPtr[i + 1];
+        rowCapacity[i]    = eId - bId;
+        colId[i].assign(A.colIdx.begin() + bId, A.colIdx.begin() + eId);
+        val[i].assign(A.val.begin() + bId * nb2, A.val.begin() + eId * nb2);
+    }
+
+    NativeSolver solver;
+    solver.SetupParam("", file);
+    solver.Allocate(rowCapacity, A.nrow, A.nb);
+    for (USI k = 0; k < 2; k++) {
+        // the second solve reuses the pattern of the first one
+        fill(x.begin(), x.end(), 1.0);
+        solver.AssembleMat(colId, val, A.nrow, A.nb, b, x);
+        const OCP_INT iters = solver.Solve();
+        OCP_CHECK(iters >= 0);
+        OCP_CHECK(RelError(x, xs) < 1E-7);
+    }
+    remove(file.c_str());
+}
+
+int main()
+{
+    CheckAMG();
+
+    const BSRMatrix A = FivePoint(40, 3);
+    const string    tol{"itsolver_tol = 1e-10\nitsolver_maxit = 500\n"};
+    CheckSolver(A, tol + "precond_type = 81\nsolver_type = 6\n");
+    CheckSolver(A, tol + "precond_type = 81\nsolver_type = 2\n");
+    CheckSolver(A, tol + "precond_type = 82\nsolver_type = 6\n");
+    CheckSolver(A, tol + "precond_type = 82\nsolver_type = 6\ndecoup_type = 0\n");
+    CheckSolver(FivePoint(40, 1), tol + "precond_type = 82\nsolver_type = 2\n");
+
+    return OCP_TEST_RESULT;
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  OpenCAEPoro team    Oct/17/2026      Create file                          */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,120 @@
+/*! \file    TestOCPTable.cpp
+ *  \brief   Unit test of lookups of OCPTable with and without hints
+ *  \author  OpenCAEPoro team
+ *  \date    Oct/17/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the OpenCAEPoro team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+// OpenCAEPoro header files
+#include "OCPTable.hpp"
+#include "UnitTest.hpp"
+
+/// Interpolate y at val by scanning x, values out of x take the end values of y.
+static OCP_DBL Interpolate(const vector<OCP_DBL>& x,
+                           const vector<OCP_DBL>& y,
+                           const OCP_DBL&         val,
+                           OCP_DBL&               slope)
+{
+    slope = 0;
+    if (val < x.front()) return y.front();
+    if (val >= x.back()) return y.back();
+    USI i = 0;
+    while (val >= x[i + 1]) i++;
+    slope = (y[i + 1] - y[i]) / (x[i + 1] - x[i]);
+    return y[i] + slope * (val - x[i]);
+}
+
+/// Check all lookups of table by its first column at the values in val.
+static void CheckTable(const vector<vector<OCP_DBL>>& src, const vector<OCP_DBL>& val)
+{
+    const OCPTable  table(src);
+    const USI       nCol = table.GetColNum();
+    const OCP_DBL   tol  = 1E-12;
+    vector<OCP_DBL> out(nCol), slope(nCol), out0(nCol), batch(val.size());
+    vector<OCP_DBL> bslope(val.size());
+    USI             hint = 0;
+
+    for (const auto& v : val) {
+        // a hint out of the table is not used, it is reset then
+        USI bad = 1000;
+        for (USI k = 0; k < nCol; k++) {
+            OCP_DBL       refK, myK = 0;
+            const OCP_DBL ref = Interpolate(src[0], src[k], v, refK);
+            OCP_CHECK_NEAR(table.Eval(0, v, k), ref, tol);
+            OCP_CHECK_NEAR(table.Eval(0, v, k, &hint), ref, tol);
+            OCP_CHECK_NEAR(table.Eval(0, v, k, &bad), ref, tol);
+            OCP_CHECK_NEAR(table.Eval(0, v, k, myK, &hint), ref, tol);
+            if (refK != 0) OCP_CHECK_NEAR(myK, refK, tol);
+        }
+
+        // a hint gives the same results as a lookup without it
+        table.Eval_All(0, v, out, slope);
+        const vector<OCP_DBL> out1(out), slope1(slope);
+        table.Eval_All(0, v, out, slope, &hint);
+        OCP_CHECK(out == out1 && slope == slope1);
+        table.Eval_All(0, v, out.data(), slope.data(), &hint);
+        OCP_CHECK(out == out1 && slope == slope1);
+        for (USI k = 0; k < nCol; k++) {
+            OCP_DBL refK;
+            OCP_CHECK_NEAR(out1[k], Interpolate(src[0], src[k], v, refK), tol);
+            OCP_CHECK_NEAR(slope1[k], refK, tol);
+        }
+        table.Eval_All0(v, out0, &hint);
+        for (USI k = 1; k < nCol; k++) OCP_CHECK(out0[k - 1] == out1[k]);
+    }
+
+    // batch lookups agree with single ones
+    for (USI k = 0; k < nCol; k++) {
+        table.EvalBatch(0, val.size(), val.data(), k, batch.data(), bslope.data());
+        for (USI m = 0; m < val.size(); m++) {
+            OCP_DBL       refK;
+            const OCP_DBL ref = Interpolate(src[0], src[k], val[m], refK);
+            OCP_CHECK_NEAR(batch[m], ref, tol);
+            OCP_CHECK_NEAR(bslope[m], refK, tol);
+        }
+    }
+}
+
+int main()
+{
+    // values at nodes, between them, out of the table, in and out of order
+    vector<OCP_DBL> val{-1, 0, 0.05, 0.1, 0.35, 1, 2, 0.7, 0.2, 0.999, 0.5, 0.5};
+    for (USI m = 0; m < 300; m++) val.push_back((m * 37 % 300) / 250.0 - 0.1);
+
+    // uniformly spaced column
+    CheckTable({{0, 0.2, 0.4, 0.6, 0.8, 1.0},
+                {0, 0.01, 0.05, 0.2, 0.5, 1.0},
+                {1.0, 0.6, 0.3, 0.1, 0.02, 0},
+                {5, 4, 3, 2, 1, 0}},
+               val);
+
+    // nonuniformly spaced column
+    CheckTable({{0, 0.05, 0.1, 0.35, 0.7, 0.75, 1.0},
+                {0, 0.001, 0.01, 0.1, 0.5, 0.6, 1.0},
+                {1.0, 0.9, 0.7, 0.3, 0.05, 0.03, 0}},
+               val);
+
+    // table of two rows
+    CheckTable({{0.1, 0.9}, {1, 2}}, val);
+
+    // decreasing columns
+    const OCPTable inv({{1.0, 0.6, 0.3, 0.0}, {0, 1, 2, 3}});
+    OCP_CHECK(inv.Eval_Inv(0, 2.0, 1) == 0);
+    OCP_CHECK_NEAR(inv.Eval_Inv(0, 0.8, 1), 0.5, 1E-12);
+    OCP_CHECK_NEAR(inv.Eval_Inv(0, 0.15, 1), 2.5, 1E-12);
+    OCP_CHECK(inv.Eval_Inv(0, -1.0, 1) == 3);
+
+    return OCP_TEST_RESULT;
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  OpenCAEPoro team    Oct/17/2026      Create file                          */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,51 @@
+/*! \file    UnitTest.hpp
+ *  \brief   Checks used by unit tests
+ *  \author  OpenCAEPoro team
+ *  \date    Oct/17/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the OpenCAEPoro team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+#ifndef __UNITTEST_HEADER__
+#define __UNITTEST_HEADER__
+
+// Standard header files
+#include <algorithm>
+#include <cmath>
+
+// OpenCAEPoro header files
+#include "UtilError.hpp"
+
+/// Num of failed checks in a unit test
+static int numFailedCheck = 0;
+
+/// Check a condition, a failure is logged and counted but the test goes on
+//  cond: check condition
+//  We use do-while to allow the macro to be ended with ";"
+#define OCP_CHECK(cond)                                                                \
+    do {                                                                               \
+        if (!(cond)) {                                                                 \
+            OCP_MESSAGE("### CHECK: " << #cond);                                       \
+            numFailedCheck++;                                                          \
+        }                                                                              \
+    } while (false)
+
+/// Check if a is close to b, i.e. |a - b| <= tol * max(|b|, 1)
+#define OCP_CHECK_NEAR(a, b, tol)                                                      \
+    OCP_CHECK(std::fabs((a) - (b)) <= (tol) * std::max(std::fabs(b), 1.0))
+
+/// Return value of main of a unit test: 0 if all checks pass
+#define OCP_TEST_RESULT (numFailedCheck == 0 ? 0 : 1)
+
+#endif /* end if __UNITTEST_HEADER__ */
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  OpenCAEPoro team    Oct/17/2026      Create file                          */
+/*----------------------------------------------------------------------------*/